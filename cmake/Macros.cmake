@@ -160,7 +160,36 @@ macro(lug_add_test name)
     add_test(NAME ${name}UnitTests COMMAND ${target} --gtest_output=xml:${TEST_OUTPUT}/${name}UnitTests.xml)
 endmacro()
 
+macro(lug_add_tool target)
+    # parse the arguments
+    cmake_parse_arguments(THIS "" "" "SOURCES;DEPENDS;EXTERNAL_LIBS" ${ARGN})
+
+    add_executable(${target} ${THIS_SOURCES})
+
+    # add compile options
+    lug_add_compile_options(${target})
+
+    # set the target's folder (for IDEs that support it, e.g. Visual Studio)
+    set_target_properties(${target} PROPERTIES FOLDER "tools")
+
+    # link the target to its lug dependencies
+    if(THIS_DEPENDS)
+        target_link_libraries(${target} ${THIS_DEPENDS})
+    endif()
+
+    # link the target to its external dependencies
+    if(THIS_EXTERNAL_LIBS)
+        target_link_libraries(${target} ${THIS_EXTERNAL_LIBS})
+    endif()
+
+    # setup the install of the tool
+    install(TARGETS ${target}
+            RUNTIME DESTINATION bin COMPONENT bin
+    )
+endmacro()
+
 function(lug_download_thirdparty)
+
     lug_set_option(LUG_THIRDPARTY_URL "https://thirdparty-dl.lugbench.eu" STRING "Choose the server from which to download the thirdparty directory")
     lug_set_option(LUG_ACCEPT_DL OFF BOOL "Choose whether to accept or not the download of the thirdparty directory")
 
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <lug/Core/Export.hpp>
 #include <lug/Core/Version.hpp>
 #include <lug/Graphics/Graphics.hpp>
 #include <lug/Graphics/Render/Window.hpp>
+#include <lug/System/Profiler/Event.hpp>
 #include <lug/System/Time.hpp>
 
 namespace lug {
@@ -88,6 +91,20 @@ public:
     const lug::Graphics::Graphics::InitInfo& getGraphicsInfo() const;
     lug::Graphics::Graphics::InitInfo& getGraphicsInfo();
 
+    /**
+     * @brief      Gets the number of frames after which #run stops, set with the `--frames` option.
+     *
+     * @return     The number of frames, 0 if there is no limit.
+     */
+    uint32_t getFramesLimit() const;
+
+    /**
+     * @brief      Gets the zones of the CPU profiler collected after each frame, while the profiler is enabled.
+     *
+     * @return     The events, sorted by end time for each thread.
+     */
+    const std::vector<System::Profiler::Event>& getTraceEvents() const;
+
     /**
      * @brief      Init the application with the informations filled in the lug::Graphics::Graphics::InitInfo
      *             and lug::Graphics::RenderWindow::InitInfo structures.
@@ -108,6 +125,15 @@ public:
      *
      *             The lug::Graphics::Graphics::InitInfo structure can be modified by calling #getGraphicsInfo or #setGraphicsInfo. @n
      *
+     *             The command line options are:
+     *              - `--headless`: render offscreen, without window (see lug::Graphics::Render::Window::Headless).
+     *              - `--frames N`: stop #run after N frames.
+     *              - `--trace FILE`: enable the CPU profiler (see lug::System::Profiler::Profiler) and write its zones to FILE
+     *                at the end of #run, in the Chrome trace format if FILE ends with `.json`, in the binary format otherwise.
+     *              - `--frames-in-flight N`: number of frames prepared by the CPU while the GPU renders (see lug::Graphics::Render::Window::InitInfo).
+     *              - `--present-mode fifo|mailbox|immediate`: presentation mode of the swapchain.
+     *              - `--bloom blur|mip-chain`: bloom technique (see lug::Graphics::Renderer::BloomTechnique).
+     *
      * @param[in]  argc  The argc argument as received from the main function.
      * @param[in]  argv  The argv argument as received from the main function.
      *
@@ -161,10 +187,18 @@ private:
     bool beginFrame(const lug::System::Time& elapsedTime);
     bool endFrame();
 
+    bool writeTrace() const;
+
 private:
     Info _info;
     bool _closed{false};
 
+    // Number of frames after which #run stops, 0 for no limit
+    uint32_t _framesLimit{0};
+
+    // File written with the CPU profiler zones, empty to disable the profiler
+    std::string _traceFilename;
+    std::vector<System::Profiler::Event> _traceEvents;
 
     lug::Graphics::Graphics::InitInfo _graphicsInitInfo{
         lug::Graphics::Renderer::Type::Vulkan,                  // type
@@ -179,7 +213,8 @@ private:
             true,
 #endif
             {                                                   // bloomOptions
-                0.5f                                            // blurThreshold
+                0.5f,                                           // blurThreshold
+                lug::Graphics::Renderer::BloomTechnique::Blur   // technique
             }
         },
         {                                                       // mandatoryModules
@@ -196,7 +231,10 @@ private:
             lug::Window::Style::Default // style
         },
 
-        {}                              // renderViewsInitInfo
+        {},                             // renderViewsInitInfo
+        {},                             // headless
+        lug::Graphics::Render::Window::PresentMode::Default, // presentMode
+        2                               // framesInFlight
     };
 
     lug::Graphics::Render::Window* _window{nullptr};
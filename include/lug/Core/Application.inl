@@ -42,3 +42,11 @@ inline const lug::Graphics::Graphics::InitInfo& Application::getGraphicsInfo() c
 inline lug::Graphics::Graphics::InitInfo& Application::getGraphicsInfo() {
     return _graphicsInitInfo;
 }
+
+inline uint32_t Application::getFramesLimit() const {
+    return _framesLimit;
+}
+
+inline const std::vector<System::Profiler::Event>& Application::getTraceEvents() const {
+    return _traceEvents;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/AssetPackage.hpp>
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Converts the glTF files to AssetPackage, offline: the images are decoded, their mip levels generated
+ *             and optionally compressed, the missing normals are generated and the buffers are packed per attribute.
+ */
+namespace AssetCooker {
+
+struct Statistics {
+    uint32_t texturesCount{0};
+    uint32_t meshesCount{0};
+    uint32_t nodesCount{0};
+
+    uint64_t texturesSize{0};               ///< Size of the textures, mip levels included, in bytes
+    uint64_t uncompressedTexturesSize{0};   ///< Size of the textures in R8G8B8A8_UNORM, to compare with `texturesSize`
+    uint64_t buffersSize{0};                ///< Size of the vertex and index buffers, in bytes
+};
+
+/**
+ * @brief      Cooks the default scene of a glTF file.
+ *
+ * @param[in]  filename          The filename of the .gltf or .glb file.
+ * @param[out] writer            The package to fill.
+ * @param[out] statistics        The size of the content of the package.
+ * @param[in]  compressTextures  Encodes the textures to BC1, or BC3 if they are not opaque (see TextureCompression).
+ *                               The KTX 2.0 images are kept in their format.
+ *
+ * @return     False if the file can't be loaded or has no scene.
+ */
+LUG_GRAPHICS_API bool cook(const std::string& filename, AssetPackage::Writer& writer, Statistics& statistics, bool compressTextures = false);
+
+/**
+ * @brief      Gets the number of mip levels of a full mip chain, down to 1x1.
+ */
+LUG_GRAPHICS_API uint32_t getMipLevelsCount(uint32_t width, uint32_t height);
+
+/**
+ * @brief      Generates the full mip chain of a R8G8B8A8 image with a box filter.
+ *
+ * @param[in]  pixels  The pixels of the image.
+ *
+ * @return     All the mip levels, the image included, in the layout of Builder::Texture::addExternalLayer.
+ */
+LUG_GRAPHICS_API std::vector<uint8_t> generateMipLevels(const uint8_t* pixels, uint32_t width, uint32_t height);
+
+/**
+ * @brief      Generates the normals of triangles, averaged by vertex and weighted by the area of the triangles.
+ *
+ * @param[in]  positions       The positions, 3 floats per vertex.
+ * @param[in]  verticesCount   The number of vertices.
+ * @param[in]  indices         The indices of the triangles, or empty if the vertices are not indexed.
+ *
+ * @return     The normals, 3 floats per vertex.
+ */
+LUG_GRAPHICS_API std::vector<float> generateNormals(const float* positions, uint32_t verticesCount, const std::vector<uint32_t>& indices);
+
+} // AssetCooker
+
+} // Graphics
+} // lug
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/System/MappedFile.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Binary package of a cooked scene, generated offline by the asset cooker tool from a glTF file
+ *             and loaded by AssetPackageLoader without parsing or decoding anything.
+ *
+ *             The file is mapped in memory and its tables are read in place, so all the structures are
+ *             little-endian and naturally aligned. File layout:
+ *              - Header: magic, version, name of the scene, size of each table
+ *              - Tables, each aligned on 8 bytes: blobs, textures, materials, meshes, primitive sets, attributes, nodes
+ *              - Data: the content of the blobs, each aligned on `blobAlignment` bytes
+ *
+ *             The blobs are the strings, the vertex and index buffers ready to be copied to the GPU and the textures
+ *             with all their mip levels. The nodes are sorted so that the parents are before their children.
+ */
+class LUG_GRAPHICS_API AssetPackage {
+public:
+    static constexpr uint32_t magic = 0x4B50474C; // "LGPK"
+    static constexpr uint32_t version = 1;
+    static constexpr uint32_t blobAlignment = 16;
+
+    static constexpr uint32_t none = 0xFFFFFFFF;   ///< Index of an optional element which is not set
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t name;                  ///< Blob of the name of the scene
+        uint32_t blobsCount;
+        uint32_t texturesCount;
+        uint32_t materialsCount;
+        uint32_t meshesCount;
+        uint32_t primitiveSetsCount;
+        uint32_t attributesCount;
+        uint32_t nodesCount;
+    };
+
+    struct Blob {
+        uint64_t offset;                ///< Offset from the start of the file, in bytes
+        uint64_t size;                  ///< Size, in bytes
+    };
+
+    struct Texture {
+        uint32_t blob;                  ///< The mip levels, from the largest one (see Builder::Texture::addExternalLayer)
+        uint32_t width;
+        uint32_t height;
+        uint32_t mipLevels;
+        uint8_t format;                 ///< Render::Texture::Format
+        uint8_t magFilter;              ///< Render::Texture::Filter
+        uint8_t minFilter;              ///< Render::Texture::Filter
+        uint8_t mipMapFilter;           ///< Render::Texture::Filter
+        uint8_t wrapS;                  ///< Render::Texture::WrappingMode
+        uint8_t wrapT;                  ///< Render::Texture::WrappingMode
+        uint8_t padding[2];
+    };
+
+    struct TextureInfo {
+        uint32_t texture;               ///< Index of the texture, or `none`
+        uint32_t texCoord;
+    };
+
+    struct Material {
+        uint32_t name;
+        float baseColorFactor[4];
+        float metallicFactor;
+        float roughnessFactor;
+        float emissiveFactor[3];
+        TextureInfo baseColorTexture;
+        TextureInfo metallicRoughnessTexture;
+        TextureInfo normalTexture;
+        TextureInfo occlusionTexture;
+        TextureInfo emissiveTexture;
+    };
+
+    struct Mesh {
+        uint32_t name;
+        uint32_t firstPrimitiveSet;
+        uint32_t primitiveSetsCount;
+    };
+
+    struct PrimitiveSet {
+        uint32_t mode;                  ///< Render::Mesh::PrimitiveSet::Mode
+        uint32_t material;              ///< Index of the material, or `none` for the default material
+        uint32_t firstAttribute;
+        uint32_t attributesCount;
+    };
+
+    struct Attribute {
+        uint32_t type;                  ///< Render::Mesh::PrimitiveSet::Attribute::Type
+        uint32_t blob;                  ///< The tightly packed elements
+        uint32_t elementSize;           ///< Size of an element, in bytes
+        uint32_t elementsCount;
+    };
+
+    struct Node {
+        uint32_t name;
+        uint32_t parent;                ///< Index of the parent node, or `none` for the children of the root of the scene
+        uint32_t mesh;                  ///< Index of the mesh, or `none`
+        float translation[3];
+        float rotation[4];              ///< Quaternion, x y z w
+        float scale[3];
+    };
+
+    /**
+     * @brief      A table of the mapped package.
+     */
+    template <typename T>
+    struct Table {
+        const T* data{nullptr};
+        uint32_t count{0};
+
+        const T& operator[](uint32_t index) const;
+        const T* begin() const;
+        const T* end() const;
+    };
+
+    /**
+     * @brief      Builds the content of a package, then writes it to a file.
+     */
+    class LUG_GRAPHICS_API Writer {
+    public:
+        Writer() = default;
+
+        Writer(const Writer&) = delete;
+        Writer(Writer&&) = default;
+
+        Writer& operator=(const Writer&) = delete;
+        Writer& operator=(Writer&&) = default;
+
+        ~Writer() = default;
+
+        /**
+         * @brief      Adds a blob, the data is copied.
+         *
+         * @return     The index of the blob.
+         */
+        uint32_t addBlob(const void* data, std::size_t size);
+        uint32_t addString(const std::string& text);
+
+        void setName(const std::string& name);
+
+        std::vector<Texture> textures;
+        std::vector<Material> materials;
+        std::vector<Mesh> meshes;
+        std::vector<PrimitiveSet> primitiveSets;
+        std::vector<Attribute> attributes;
+        std::vector<Node> nodes;
+
+        /**
+         * @brief      Writes the package to a file.
+         *
+         * @return     False if the file can't be written.
+         */
+        bool save(const std::string& filename) const;
+
+    private:
+        uint32_t _name{none};
+        std::vector<Blob> _blobs;
+        std::vector<uint8_t> _data;
+    };
+
+public:
+    AssetPackage() = default;
+
+    AssetPackage(const AssetPackage&) = delete;
+    AssetPackage(AssetPackage&&) = default;
+
+    AssetPackage& operator=(const AssetPackage&) = delete;
+    AssetPackage& operator=(AssetPackage&&) = default;
+
+    ~AssetPackage() = default;
+
+    /**
+     * @brief      Maps a package, replacing the current one.
+     *             The tables and the indices they contain are checked, so they can be used without checks.
+     *
+     * @param[in]  filename  The filename of the package.
+     *
+     * @return     False if the file can't be mapped or is not a valid package.
+     */
+    bool open(const std::string& filename);
+
+    const Header& getHeader() const;
+
+    const Table<Blob>& getBlobs() const;
+    const Table<Texture>& getTextures() const;
+    const Table<Material>& getMaterials() const;
+    const Table<Mesh>& getMeshes() const;
+    const Table<PrimitiveSet>& getPrimitiveSets() const;
+    const Table<Attribute>& getAttributes() const;
+    const Table<Node>& getNodes() const;
+
+    /**
+     * @brief      Gets the data of a blob, in the mapped file.
+     */
+    const uint8_t* getBlobData(uint32_t blob) const;
+
+    /**
+     * @brief      Gets a string blob, an empty string for `none`.
+     */
+    std::string getString(uint32_t blob) const;
+
+    /**
+     * @brief      Gets the offsets of the tables and the data in a file, from the header.
+     *
+     * @param[in]  header   The header.
+     * @param[out] offsets  The offsets of the blobs, textures, materials, meshes, primitive sets, attributes
+     *                      and nodes tables, then of the data.
+     */
+    static void getOffsets(const Header& header, uint64_t (&offsets)[8]);
+
+private:
+    bool check(const std::string& filename) const;
+
+    System::MappedFile _file;
+
+    Table<Blob> _blobs;
+    Table<Texture> _textures;
+    Table<Material> _materials;
+    Table<Mesh> _meshes;
+    Table<PrimitiveSet> _primitiveSets;
+    Table<Attribute> _attributes;
+    Table<Node> _nodes;
+};
+
+#include <lug/Graphics/AssetPackage.inl>
+
+} // Graphics
+} // lug
@@ -0,0 +1,50 @@
+template <typename T>
+inline const T& AssetPackage::Table<T>::operator[](uint32_t index) const {
+    return data[index];
+}
+
+template <typename T>
+inline const T* AssetPackage::Table<T>::begin() const {
+    return data;
+}
+
+template <typename T>
+inline const T* AssetPackage::Table<T>::end() const {
+    return data + count;
+}
+
+inline const AssetPackage::Header& AssetPackage::getHeader() const {
+    return *reinterpret_cast<const Header*>(_file.getData());
+}
+
+inline const AssetPackage::Table<AssetPackage::Blob>& AssetPackage::getBlobs() const {
+    return _blobs;
+}
+
+inline const AssetPackage::Table<AssetPackage::Texture>& AssetPackage::getTextures() const {
+    return _textures;
+}
+
+inline const AssetPackage::Table<AssetPackage::Material>& AssetPackage::getMaterials() const {
+    return _materials;
+}
+
+inline const AssetPackage::Table<AssetPackage::Mesh>& AssetPackage::getMeshes() const {
+    return _meshes;
+}
+
+inline const AssetPackage::Table<AssetPackage::PrimitiveSet>& AssetPackage::getPrimitiveSets() const {
+    return _primitiveSets;
+}
+
+inline const AssetPackage::Table<AssetPackage::Attribute>& AssetPackage::getAttributes() const {
+    return _attributes;
+}
+
+inline const AssetPackage::Table<AssetPackage::Node>& AssetPackage::getNodes() const {
+    return _nodes;
+}
+
+inline const uint8_t* AssetPackage::getBlobData(uint32_t blob) const {
+    return _file.getData() + _blobs[blob].offset;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include <lug/Graphics/AssetPackage.hpp>
+#include <lug/Graphics/Builder/UploadBatch.hpp>
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Loader.hpp>
+#include <lug/Graphics/Render/Material.hpp>
+#include <lug/Graphics/Render/Mesh.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+class Renderer;
+
+/**
+ * @brief      Class for loading the packages cooked by the asset cooker tool (see AssetPackage).
+ *
+ *             The package is mapped and its blobs are uploaded to the GPU straight from the mapping,
+ *             the mip levels and the normals being already generated.
+ */
+class LUG_GRAPHICS_API AssetPackageLoader final : public Loader {
+private:
+    struct LoadedAssets {
+        explicit LoadedAssets(Renderer& renderer) : uploadBatch(renderer) {}
+
+        std::vector<Resource::SharedPtr<Render::Texture>> textures;
+        Resource::SharedPtr<Render::Material> defaultMaterial;
+        std::vector<Resource::SharedPtr<Render::Material>> materials;
+        std::vector<Resource::SharedPtr<Render::Mesh>> meshes;
+
+        // Upload of all the textures, running while the other resources are created
+        Builder::UploadBatch uploadBatch;
+    };
+
+public:
+    AssetPackageLoader(Renderer& renderer);
+
+    AssetPackageLoader(const AssetPackageLoader&) = delete;
+    AssetPackageLoader(AssetPackageLoader&&) = delete;
+
+    AssetPackageLoader& operator=(const AssetPackageLoader&) = delete;
+    AssetPackageLoader& operator=(AssetPackageLoader&&) = delete;
+
+    ~AssetPackageLoader() = default;
+
+    /**
+     * @brief      Loads the scene of a package from a file
+     * @param[in]  filename  The filename
+     * @return     SharedPtr to the resulting Resource
+     */
+    Resource::SharedPtr<Resource> loadFile(const std::string& filename) override final;
+
+private:
+    Resource::SharedPtr<Render::Texture> createTexture(const AssetPackage& package, LoadedAssets& loadedAssets, const AssetPackage::Texture& packageTexture);
+    Resource::SharedPtr<Render::Material> createMaterial(const AssetPackage& package, LoadedAssets& loadedAssets, const AssetPackage::Material& packageMaterial);
+    Resource::SharedPtr<Render::Material> createDefaultMaterial(LoadedAssets& loadedAssets);
+    Resource::SharedPtr<Render::Mesh> createMesh(const AssetPackage& package, LoadedAssets& loadedAssets, const AssetPackage::Mesh& packageMesh);
+};
+
+} // Graphics
+} // lug
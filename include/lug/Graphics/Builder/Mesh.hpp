@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <string>
 #include <vector>
 
+#include <lug/Graphics/MeshOptimizer.hpp>
 #include <lug/Graphics/Render/Mesh.hpp>
 #include <lug/Graphics/Resource.hpp>
 #include <lug/Graphics/Vulkan/Builder/Mesh.hpp>
@@ -39,6 +42,25 @@ public:
         // Raw mode
         void addAttributeBuffer(const void* data, uint32_t elementSize, uint32_t elementsCount, Render::Mesh::PrimitiveSet::Attribute::Type type);
 
+        /**
+         * @brief      Adds an attribute buffer without copying its data, which is copied directly to the memory of the GPU
+         *             when the mesh is built. The data must stay valid until then.
+         */
+        void addExternalAttributeBuffer(const void* data, uint32_t elementSize, uint32_t elementsCount, Render::Mesh::PrimitiveSet::Attribute::Type type);
+
+        /**
+         * @brief      Optimizes an indexed triangle list with MeshOptimizer: reorders the triangles for the vertex cache
+         *             and against overdraw, reorders the vertices for the fetches and narrows the indices to 16 bits
+         *             when there are at most 65535 vertices. The attributes are copied to buffers owned by the builder.
+         *
+         * @param[out] before  If not nullptr, the statistics of the vertex cache before the optimization.
+         * @param[out] after   If not nullptr, the statistics of the vertex cache after the optimization.
+         *
+         * @return     False if the primitive set can't be optimized, it is left unchanged: it is not a triangle list,
+         *             has no indices or positions (3 floats), or its vertex attributes don't have the same number of elements.
+         */
+        bool optimize(MeshOptimizer::Statistics* before = nullptr, MeshOptimizer::Statistics* after = nullptr);
+
         Render::Mesh::PrimitiveSet::Mode getMode() const;
         Resource::SharedPtr<Render::Material> getMaterial() const;
         const std::vector<Render::Mesh::PrimitiveSet::Attribute>& getAttributes() const;
@@ -74,13 +96,29 @@ public:
      */
     PrimitiveSet* addPrimitiveSet();
 
+    /**
+     * @brief      Sets whether the primitive sets are optimized when the mesh is built (see PrimitiveSet::optimize).
+     *             Defaults to false: the optimization copies the external attribute buffers.
+     */
+    void setOptimized(bool optimized);
+
     Resource::SharedPtr<Render::Mesh> build();
 
+    /**
+     * @brief      Gets the number of bytes of attribute data copied by the CPU in all the mesh builders,
+     *             to their own buffers and to the memory of the GPU.
+     */
+    static uint64_t getCopiedBytes();
+
 protected:
     Renderer& _renderer;
 
     std::string _name;
     std::list<PrimitiveSet> _primitiveSets;
+    bool _optimized{false};
+
+private:
+    static std::atomic<uint64_t> _copiedBytes;
 };
 
 #include <lug/Graphics/Builder/Mesh.inl>
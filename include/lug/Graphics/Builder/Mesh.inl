@@ -26,3 +26,11 @@ inline Mesh::PrimitiveSet* Mesh::addPrimitiveSet() {
 inline void Mesh::setName(const std::string& name) {
     _name = name;
 }
+
+inline void Mesh::setOptimized(bool optimized) {
+    _optimized = optimized;
+}
+
+inline uint64_t Mesh::getCopiedBytes() {
+    return _copiedBytes.load();
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include <lug/Graphics/ImageDecoder.hpp>
 #include <lug/Graphics/Resource.hpp>
 #include <lug/Graphics/Render/Texture.hpp>
 #include <lug/Graphics/Vulkan/Builder/Texture.hpp>
@@ -14,11 +15,15 @@ class Renderer;
 
 namespace Builder {
 
+class UploadBatch;
+
 class LUG_GRAPHICS_API Texture {
-    friend Resource::SharedPtr<lug::Graphics::Render::Texture> lug::Graphics::Vulkan::Builder::Texture::build(const ::lug::Graphics::Builder::Texture&);
+    friend Resource::SharedPtr<lug::Graphics::Render::Texture> lug::Graphics::Vulkan::Builder::Texture::build(::lug::Graphics::Builder::Texture&);
 
     struct Layer {
         const unsigned char* data{nullptr};
+        bool allMipLevels{false};       ///< The data contains all the mip levels, otherwise only the first one
+        ImageDecoder::Pixels pixels;    ///< The data owned by the builder, null for the external layers
     };
 
 public:
@@ -36,7 +41,7 @@ public:
     Texture& operator=(const Texture&) = delete;
     Texture& operator=(Texture&&) = delete;
 
-    ~Texture();
+    ~Texture() = default;
 
     /**
      * @brief      Sets the name.
@@ -55,11 +60,41 @@ public:
     void setWrapT(Render::Texture::WrappingMode wrapT);
     void setWrapW(Render::Texture::WrappingMode wrapW);
 
+    /**
+     * @brief      Sets the batch of the upload of the layers, to upload many textures at once.
+     *             The texture can't be used before the batch is complete. Without batch (by default),
+     *             the texture is uploaded alone and is ready once built.
+     */
+    void setUploadBatch(UploadBatch* uploadBatch);
+
     bool addLayer(const std::string& filename, bool hdr = false);
     bool addLayer(uint32_t width, uint32_t height, Render::Texture::Format format, const unsigned char* data = nullptr);
 
+    /**
+     * @brief      Adds a layer decoded by an ImageDecoder, e.g. in parallel with the images of the other textures.
+     *             The pixels are moved to the builder, without copy.
+     *             The images with several mip levels (e.g. KTX 2.0 textures) set the mip levels of the texture.
+     */
+    bool addLayer(ImageDecoder::Image&& image);
+
+    /**
+     * @brief      Adds a layer decoded by an ImageDecoder without owning its pixels, e.g. an image shared by several textures.
+     *             The pixels must stay valid until the texture is built, or until its upload batch is submitted.
+     */
+    bool addLayer(const ImageDecoder::Image& image);
+
+    /**
+     * @brief      Adds a layer with all its mip levels (see setMipLevels), without copying its data.
+     *             The levels follow each other from the largest one (see Render::Texture::getMipLevelsSize).
+     *             The data must stay valid until the texture is built, or until its upload batch is submitted.
+     */
+    bool addExternalLayer(uint32_t width, uint32_t height, Render::Texture::Format format, const unsigned char* data);
+
     Resource::SharedPtr<Render::Texture> build();
 
+private:
+    bool checkLayer(uint32_t width, uint32_t height, Render::Texture::Format format);
+
 protected:
     Renderer& _renderer;
 
@@ -82,6 +117,8 @@ protected:
     Render::Texture::WrappingMode _wrapW{Render::Texture::WrappingMode::ClampToEdge};
 
     std::vector<Layer> _layers;
+
+    UploadBatch* _uploadBatch{nullptr};
 };
 
 #include <lug/Graphics/Builder/Texture.inl>
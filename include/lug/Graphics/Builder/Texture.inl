@@ -33,3 +33,7 @@ inline void Texture::setWrapT(Render::Texture::WrappingMode wrapT) {
 inline void Texture::setWrapW(Render::Texture::WrappingMode wrapW) {
     _wrapW = wrapW;
 }
+
+inline void Texture::setUploadBatch(UploadBatch* uploadBatch) {
+    _uploadBatch = uploadBatch;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/Graphics/Resource.hpp>
+#include <lug/Graphics/Vulkan/Builder/Texture.hpp>
+#include <lug/Graphics/Vulkan/Builder/UploadBatch.hpp>
+
+namespace lug {
+namespace Graphics {
+
+class Renderer;
+
+namespace Vulkan {
+namespace Render {
+class UploadBatch;
+} // Render
+} // Vulkan
+
+namespace Builder {
+
+/**
+ * @brief      Batch of the uploads of several textures (see Texture::setUploadBatch), to upload them at once.
+ *
+ *             The uploads are recorded by the renderer when the textures are built,
+ *             and sent to the GPU in one submission by #submit.
+ */
+class LUG_GRAPHICS_API UploadBatch {
+    friend Resource::SharedPtr<lug::Graphics::Render::Texture> lug::Graphics::Vulkan::Builder::Texture::build(::lug::Graphics::Builder::Texture&);
+    friend void lug::Graphics::Vulkan::Builder::UploadBatch::init(::lug::Graphics::Builder::UploadBatch&);
+    friend bool lug::Graphics::Vulkan::Builder::UploadBatch::submit(::lug::Graphics::Builder::UploadBatch&);
+    friend bool lug::Graphics::Vulkan::Builder::UploadBatch::wait(::lug::Graphics::Builder::UploadBatch&);
+
+public:
+    explicit UploadBatch(Renderer& renderer);
+
+    UploadBatch(const UploadBatch&) = delete;
+    UploadBatch(UploadBatch&&) = delete;
+
+    UploadBatch& operator=(const UploadBatch&) = delete;
+    UploadBatch& operator=(UploadBatch&&) = delete;
+
+    /**
+     * @brief      Waits for the uploads if they were submitted.
+     */
+    ~UploadBatch();
+
+    /**
+     * @brief      Submits all the uploads recorded. The textures can be used once #wait returns.
+     *
+     * @return     false if the uploads can't be submitted, they are then dropped.
+     */
+    bool submit();
+
+    /**
+     * @brief      Waits for the end of the uploads submitted.
+     */
+    bool wait();
+
+private:
+    Renderer& _renderer;
+
+    std::unique_ptr<Vulkan::Render::UploadBatch> _vulkanUploadBatch;
+};
+
+} // Builder
+} // Graphics
+} // lug
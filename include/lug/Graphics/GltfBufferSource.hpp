@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/System/MappedFile.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Maps the binary buffers of a glTF file in memory, so the accessors point directly into the files.
+ *
+ *             The buffer of a .glb file without uri is its BIN chunk, the other buffers are the files
+ *             referenced by their uri, relative to the glTF file. The data URIs are not mapped.
+ */
+class LUG_GRAPHICS_API GltfBufferSource {
+public:
+    /**
+     * @brief      Location of a chunk in a .glb file.
+     */
+    struct Chunk {
+        std::size_t offset{0};  ///< Offset of the data from the start of the file, in bytes.
+        std::size_t size{0};    ///< Size of the data, in bytes.
+    };
+
+public:
+    GltfBufferSource() = default;
+
+    GltfBufferSource(const GltfBufferSource&) = delete;
+    GltfBufferSource(GltfBufferSource&&) = default;
+
+    GltfBufferSource& operator=(const GltfBufferSource&) = delete;
+    GltfBufferSource& operator=(GltfBufferSource&&) = default;
+
+    ~GltfBufferSource() = default;
+
+    /**
+     * @brief      Prepares the buffers of a glTF file, the .glb files are mapped immediately.
+     *
+     * @param[in]  filename  The filename of the .gltf or .glb file.
+     *
+     * @return     False if the file is a .glb file that can't be mapped or is malformed.
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief      Gets the data of a buffer, mapping its file on the first call.
+     *
+     * @param[in]  index       The index of the buffer in the asset.
+     * @param[in]  uri         The uri of the buffer, empty for the BIN chunk of a .glb file.
+     * @param[in]  byteLength  The size of the buffer declared by the asset, in bytes.
+     *
+     * @return     The data, or nullptr if the buffer can't be mapped or is smaller than `byteLength`.
+     */
+    const char* getBufferData(uint32_t index, const std::string& uri, std::size_t byteLength);
+
+    /**
+     * @brief      Finds the JSON and BIN chunks of a .glb file.
+     *
+     * @param[in]  data  The content of the file.
+     * @param[in]  size  The size of the file, in bytes.
+     * @param[out] json  The JSON chunk.
+     * @param[out] bin   The BIN chunk, empty if there is none.
+     *
+     * @return     False if the data is not a valid .glb file.
+     */
+    static bool parseGlb(const uint8_t* data, std::size_t size, Chunk& json, Chunk& bin);
+
+    /**
+     * @brief      Gets the number of bytes of the files mapped, whether their pages are loaded or not.
+     */
+    std::size_t getMappedSize() const;
+
+private:
+    struct Buffer {
+        System::MappedFile file;
+        bool opened{false};
+    };
+
+    std::string _directory;
+
+    System::MappedFile _glb;
+    Chunk _glbBin;
+
+    std::vector<Buffer> _buffers;
+};
+
+#include <lug/Graphics/GltfBufferSource.inl>
+
+} // Graphics
+} // lug
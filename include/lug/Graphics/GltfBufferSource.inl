@@ -0,0 +1,9 @@
+inline std::size_t GltfBufferSource::getMappedSize() const {
+    std::size_t size = _glb.getSize();
+
+    for (const auto& buffer : _buffers) {
+        size += buffer.file.getSize();
+    }
+
+    return size;
+}
@@ -4,7 +4,10 @@
 
 #include <gltf2/glTF2.hpp>
 
+#include <lug/Graphics/Builder/UploadBatch.hpp>
 #include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/GltfBufferSource.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
 #include <lug/Graphics/Loader.hpp>
 #include <lug/Graphics/Render/Material.hpp>
 #include <lug/Graphics/Render/Mesh.hpp>
@@ -22,10 +25,20 @@ class Renderer;
 class LUG_GRAPHICS_API GltfLoader final : public Loader {
 private:
     struct LoadedAssets {
+        explicit LoadedAssets(Renderer& renderer) : uploadBatch(renderer) {}
+
         std::vector<Resource::SharedPtr<Render::Texture>> textures;
         Resource::SharedPtr<Render::Material> defaultMaterial;
         std::vector<Resource::SharedPtr<Render::Material>> materials;
         std::vector<Resource::SharedPtr<Render::Mesh>> meshes;
+
+        GltfBufferSource buffers;
+
+        // Images of the textures by image index, decoded in parallel before the textures are created
+        std::vector<ImageDecoder::Image> images;
+
+        // Upload of all the textures, submitted at once when the scene is created
+        Builder::UploadBatch uploadBatch;
     };
 
 public:
@@ -46,12 +59,40 @@ public:
      */
     Resource::SharedPtr<Resource> loadFile(const std::string& filename) override final;
 
+    /**
+     * @brief      Gets the decoder of the images of the textures, e.g. to set a faster decoder or the number of threads.
+     */
+    ImageDecoder& getImageDecoder();
+
+    /**
+     * @brief      Sets whether the triangles and vertices of the meshes are reordered for the GPU at load time
+     *             (see Builder::Mesh::setOptimized). Defaults to false, the attributes are then not copied.
+     */
+    void setOptimizeMeshes(bool optimizeMeshes);
+
+    /**
+     * @brief      Gets the size of an element of an accessor, in bytes.
+     */
+    static uint32_t getAttributeSize(const gltf2::Accessor& accessor);
+
+    /**
+     * @brief      Gets the first element of an accessor, in the mapped file of its buffer when possible.
+     *
+     * @return     The data, or nullptr if the accessor is out of the bounds of its buffer or the buffer has no data.
+     */
+    static const void* getBufferViewData(const gltf2::Asset& asset, GltfBufferSource& buffers, const gltf2::Accessor& accessor);
+
 private:
+    void decodeImages(const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets);
     Resource::SharedPtr<Render::Texture> createTexture(Renderer& renderer, const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets, int32_t index);
     Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer, const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets, int32_t index);
     Resource::SharedPtr<Render::Material> createDefaultMaterial(Renderer& renderer, GltfLoader::LoadedAssets& loadedAssets);
     Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets, int32_t index);
     bool createNode(Renderer& renderer, const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets, int32_t index, Scene::Node& parent);
+
+private:
+    ImageDecoder _imageDecoder;
+    bool _optimizeMeshes{false};
 };
 
 } // Graphics
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Decodes the images of the textures, in parallel on worker threads.
+ *
+ *             The images are decoded with stb_image by default, and the KTX 2.0 textures are read with Ktx2::read
+ *             in their own format. A faster decoder can be set for an extension (e.g. "jpg" or "png") with setDecoder().
+ */
+class LUG_GRAPHICS_API ImageDecoder {
+public:
+    struct Deleter {
+        void operator()(unsigned char* pixels) const;
+    };
+
+    /**
+     * @brief      Decoded pixels, allocated with std::malloc.
+     */
+    using Pixels = std::unique_ptr<unsigned char, Deleter>;
+
+    struct Source {
+        std::string filename;
+        bool hdr{false};        ///< Decodes to R32G32B32A32_SFLOAT instead of R8G8B8A8_UNORM
+    };
+
+    struct Image {
+        uint32_t width{0};
+        uint32_t height{0};
+        Render::Texture::Format format{Render::Texture::Format::Undefined};
+        uint32_t mipLevels{1};  ///< The mip levels follow each other in the pixels, from the largest one
+        Pixels pixels;          ///< Null if the image can't be decoded
+    };
+
+    /**
+     * @brief      Decodes an encoded image to R8G8B8A8_UNORM, or R32G32B32A32_SFLOAT if `hdr` is true.
+     *             It is called from the worker threads.
+     */
+    using Decoder = std::function<bool(const unsigned char* data, std::size_t size, bool hdr, Image& image)>;
+
+public:
+    /**
+     * @brief      Constructs an image decoder.
+     *
+     * @param[in]  threadsCount  The maximum number of worker threads, 0 for the number of hardware threads.
+     */
+    explicit ImageDecoder(uint8_t threadsCount = 0);
+
+    ImageDecoder(const ImageDecoder&) = delete;
+    ImageDecoder(ImageDecoder&&) = default;
+
+    ImageDecoder& operator=(const ImageDecoder&) = delete;
+    ImageDecoder& operator=(ImageDecoder&&) = default;
+
+    ~ImageDecoder() = default;
+
+    /**
+     * @brief      Sets the decoder of the files of an extension, instead of stb_image.
+     *
+     * @param[in]  extension  The extension, without the dot and case insensitive.
+     * @param[in]  decoder    The decoder.
+     */
+    void setDecoder(const std::string& extension, Decoder decoder);
+
+    void setThreadsCount(uint8_t threadsCount);
+    uint8_t getThreadsCount() const;
+
+    /**
+     * @brief      Decodes an image on the calling thread.
+     *
+     * @return     False if the file can't be read or decoded.
+     */
+    bool decode(const Source& source, Image& image) const;
+
+    /**
+     * @brief      Decodes images in parallel, one task per image. The sources with an empty filename are skipped.
+     *
+     * @return     The images, in the order of the sources. The pixels of the images which can't be decoded are null.
+     */
+    std::vector<Image> decode(const std::vector<Source>& sources) const;
+
+    /**
+     * @brief      Decodes an image with stb_image, the default decoder.
+     */
+    static bool decodeWithStb(const unsigned char* data, std::size_t size, bool hdr, Image& image);
+
+private:
+    uint8_t _threadsCount{0};
+    std::unordered_map<std::string, Decoder> _decoders;
+};
+
+#include <lug/Graphics/ImageDecoder.inl>
+
+} // Graphics
+} // lug
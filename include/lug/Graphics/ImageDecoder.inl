@@ -0,0 +1,7 @@
+inline void ImageDecoder::setThreadsCount(uint8_t threadsCount) {
+    _threadsCount = threadsCount;
+}
+
+inline uint8_t ImageDecoder::getThreadsCount() const {
+    return _threadsCount;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Reads and writes the KTX 2.0 containers of 2D textures, with their mip levels.
+ *
+ *             The formats are the ones of Render::Texture::Format, identified by their VkFormat.
+ *             The supercompressed textures (BasisLZ, Zstandard and ZLIB) and the Basis Universal UASTC textures
+ *             need a transcoder which is not part of the engine: they are rejected, and must be transcoded
+ *             offline to one of the supported formats.
+ */
+namespace Ktx2 {
+
+/**
+ * @brief      Checks whether data starts with the KTX 2.0 identifier.
+ */
+LUG_GRAPHICS_API bool isKtx2(const unsigned char* data, std::size_t size);
+
+/**
+ * @brief      Reads a KTX 2.0 texture, with the signature of an ImageDecoder::Decoder.
+ *             The mip levels are copied to the pixels of the image, from the largest one.
+ *
+ * @param[in]  hdr    Unused, the format is the one of the texture.
+ * @param[out] image  The image, with its format and number of mip levels.
+ *
+ * @return     False if the data is not a valid KTX 2.0 texture or is not supported.
+ */
+LUG_GRAPHICS_API bool read(const unsigned char* data, std::size_t size, bool hdr, ImageDecoder::Image& image);
+
+/**
+ * @brief      Writes a KTX 2.0 texture, without supercompression.
+ *
+ * @param[in]  data       The mip levels, from the largest one (see Render::Texture::getMipLevelsSize).
+ *
+ * @return     The content of the file, or an empty vector if the format can't be written.
+ */
+LUG_GRAPHICS_API std::vector<uint8_t> write(uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format, const uint8_t* data);
+
+} // Ktx2
+
+} // Graphics
+} // lug
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Reorders the indexed triangle lists of the meshes for the GPU, at import time.
+ *
+ *             The optimizations are applied in this order (see Builder::Mesh::PrimitiveSet::optimize):
+ *             the triangles for the post-transform vertex cache, then clusters of triangles against overdraw,
+ *             and finally the vertices in the order they are fetched.
+ */
+namespace MeshOptimizer {
+
+/**
+ * @brief      Size of the FIFO post-transform vertex cache simulated by getCacheStatistics.
+ */
+constexpr uint32_t defaultCacheSize = 16;
+
+struct Statistics {
+    /**
+     * @brief      Average cache miss ratio: the number of transformed vertices per triangle, from 0.5 to 3.
+     */
+    float acmr{0.0f};
+
+    /**
+     * @brief      Average transform to vertex ratio: the number of transformed vertices per referenced vertex, 1 at best.
+     */
+    float atvr{0.0f};
+};
+
+/**
+ * @brief      Simulates a FIFO post-transform vertex cache on a triangle list.
+ *
+ * @param[in]  indices        The indices of the triangles.
+ * @param[in]  verticesCount  The number of vertices.
+ * @param[in]  cacheSize      The number of vertices in the cache.
+ */
+LUG_GRAPHICS_API Statistics getCacheStatistics(const std::vector<uint32_t>& indices, uint32_t verticesCount, uint32_t cacheSize = defaultCacheSize);
+
+/**
+ * @brief      Reorders the triangles for the post-transform vertex cache, with the algorithm of Tom Forsyth
+ *             ("Linear-Speed Vertex Cache Optimisation"). The result doesn't depend on the size of the cache of the GPU.
+ */
+LUG_GRAPHICS_API void optimizeVertexCache(std::vector<uint32_t>& indices, uint32_t verticesCount);
+
+/**
+ * @brief      Reorders clusters of triangles to draw first the ones likely to occlude the others, after optimizeVertexCache
+ *             (Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").
+ *
+ *             The triangles are split in clusters where the cache is flushed and where the cache miss ratio of the cluster
+ *             is low enough, then the clusters are sorted from the most outward facing to the most inward facing.
+ *
+ * @param[in]  positions  The positions of the vertices, 3 floats per vertex.
+ * @param[in]  threshold  The maximum increase of the ACMR allowed, e.g. 1.05 for 5%.
+ */
+LUG_GRAPHICS_API void optimizeOverdraw(std::vector<uint32_t>& indices, const float* positions, uint32_t verticesCount, float threshold = 1.05f);
+
+/**
+ * @brief      Renumbers the vertices in the order of their first use by the triangles, which are fetched in this order.
+ *             The vertices not used by any triangle are removed.
+ *
+ * @param[out] remap  The new index of each vertex, or ~0u for the removed ones (see remapVertices).
+ *
+ * @return     The number of vertices left.
+ */
+LUG_GRAPHICS_API uint32_t optimizeVertexFetch(std::vector<uint32_t>& indices, uint32_t verticesCount, std::vector<uint32_t>& remap);
+
+/**
+ * @brief      Moves the elements of a vertex attribute to their new index, returned by optimizeVertexFetch.
+ *
+ * @param[out] destination  The elements of the vertices left, elementSize bytes each.
+ */
+LUG_GRAPHICS_API void remapVertices(void* destination, const void* source, uint32_t elementSize, const std::vector<uint32_t>& remap);
+
+} // MeshOptimizer
+
+} // Graphics
+} // lug
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      CPU reference of the mip chain bloom, the same filters as the shaders bloom-downsample.comp
+ *             and bloom-upsample.comp. Used to validate the filter in the unit tests.
+ *
+ *             The glow image is thresholded and downsampled with a 13 taps filter into a chain of half resolution
+ *             mip levels, then each level is upsampled with a 3x3 tent filter and added to the level above it,
+ *             from the smallest to the largest. The bloom is the first level of the chain, at half resolution.
+ *             All the samples are bilinear with a clamp to edge addressing, like the sampler of the shaders.
+ */
+namespace Bloom {
+
+constexpr uint32_t defaultMipLevelsCount = 6;
+constexpr uint32_t minMipLevelSize = 2;
+constexpr float defaultKnee = 0.1f;
+constexpr float defaultRadius = 1.0f;
+
+struct Extent {
+    uint32_t width;
+    uint32_t height;
+};
+
+/**
+ * @brief      RGBA image in linear float, row by row.
+ */
+struct Image {
+    uint32_t width{0};
+    uint32_t height{0};
+    std::vector<float> data{};
+
+    Image() = default;
+    Image(uint32_t width, uint32_t height);
+
+    float* at(uint32_t x, uint32_t y);
+    const float* at(uint32_t x, uint32_t y) const;
+};
+
+/**
+ * @brief      Computes the extents of the mip chain of an image, each level is half the previous one,
+ *             starting at half the image, until a side is smaller than minMipLevelSize.
+ *
+ * @return     The extents, from the largest to the smallest, empty if the image is too small.
+ */
+LUG_GRAPHICS_API std::vector<Extent> computeMipChain(uint32_t width, uint32_t height, uint32_t maxMipLevelsCount = defaultMipLevelsCount);
+
+/**
+ * @brief      Samples an image at normalized coordinates, with bilinear filtering and clamp to edge addressing.
+ */
+LUG_GRAPHICS_API void sample(const Image& image, float u, float v, float color[4]);
+
+/**
+ * @brief      Attenuates a color below the threshold of luminance, with a quadratic soft knee around the threshold.
+ *             The luminance uses the same weights as the glow output of the forward shader.
+ */
+LUG_GRAPHICS_API void applyThreshold(float color[4], float threshold, float knee);
+
+/**
+ * @brief      Downsamples an image with the 13 taps filter, the weighted average of five overlapping 2x2 boxes.
+ *
+ * @param[in]  source     The source image, about twice the extent.
+ * @param[in]  extent     The extent of the downsampled image.
+ * @param[in]  threshold  The threshold applied to the downsampled colors, negative to disable it.
+ * @param[in]  knee       The soft knee of the threshold.
+ */
+LUG_GRAPHICS_API Image downsample(const Image& source, const Extent& extent, float threshold = -1.0f, float knee = defaultKnee);
+
+/**
+ * @brief      Upsamples an image with a 3x3 tent filter and adds it to the destination.
+ *
+ * @param[in]  source       The source image, about half the destination.
+ * @param      destination  The destination image.
+ * @param[in]  radius       The distance between the taps, in texels of the source image.
+ */
+LUG_GRAPHICS_API void upsampleAdd(const Image& source, Image& destination, float radius = defaultRadius);
+
+/**
+ * @brief      Computes the bloom of a glow image: downsample chain with the threshold on the first level,
+ *             then the tent upsample chain with additive combine.
+ *
+ * @return     The bloom, the first level of the mip chain. Empty if the glow image is too small.
+ */
+LUG_GRAPHICS_API Image compute(
+    const Image& glow,
+    float threshold,
+    uint32_t maxMipLevelsCount = defaultMipLevelsCount,
+    float knee = defaultKnee,
+    float radius = defaultRadius
+);
+
+} // Bloom
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      Axis aligned bounding box. Empty (invalid) until a point is added.
+ */
+struct BoundingBox {
+    Math::Vec3f min = Math::Vec3f(std::numeric_limits<float>::max());
+    Math::Vec3f max = Math::Vec3f(std::numeric_limits<float>::lowest());
+
+    /**
+     * @brief      Checks whether at least one point has been added to the box.
+     */
+    bool isValid() const;
+
+    void extend(const Math::Vec3f& point);
+    void extend(const BoundingBox& box);
+
+    Math::Vec3f getCenter() const;
+
+    /**
+     * @brief      Gets the half size of the box on each axis.
+     */
+    Math::Vec3f getExtent() const;
+
+    /**
+     * @brief      Computes the bounding box of this box transformed by a matrix.
+     *             The result contains the 8 transformed corners, it can be larger than the transformed box.
+     *
+     * @param[in]  matrix  The transform, with the translation in the last column.
+     *
+     * @return     The transformed box, invalid if this box is invalid.
+     */
+    BoundingBox transform(const Math::Mat4x4f& matrix) const;
+};
+
+#include <lug/Graphics/Render/BoundingBox.inl>
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,60 @@
+inline bool BoundingBox::isValid() const {
+    return min.x() <= max.x() && min.y() <= max.y() && min.z() <= max.z();
+}
+
+inline void BoundingBox::extend(const Math::Vec3f& point) {
+    for (uint8_t i = 0; i < 3; ++i) {
+        min(i) = std::min(min(i), point(i));
+        max(i) = std::max(max(i), point(i));
+    }
+}
+
+inline void BoundingBox::extend(const BoundingBox& box) {
+    if (box.isValid()) {
+        extend(box.min);
+        extend(box.max);
+    }
+}
+
+inline Math::Vec3f BoundingBox::getCenter() const {
+    return {
+        (min.x() + max.x()) * 0.5f,
+        (min.y() + max.y()) * 0.5f,
+        (min.z() + max.z()) * 0.5f
+    };
+}
+
+inline Math::Vec3f BoundingBox::getExtent() const {
+    return {
+        (max.x() - min.x()) * 0.5f,
+        (max.y() - min.y()) * 0.5f,
+        (max.z() - min.z()) * 0.5f
+    };
+}
+
+inline BoundingBox BoundingBox::transform(const Math::Mat4x4f& matrix) const {
+    if (!isValid()) {
+        return BoundingBox{};
+    }
+
+    // Transform the center, and project the extent on each axis with the absolute values of the matrix
+    const Math::Vec3f center = getCenter();
+    const Math::Vec3f extent = getExtent();
+
+    BoundingBox result;
+
+    for (uint8_t row = 0; row < 3; ++row) {
+        float transformedCenter = matrix(row, 3);
+        float transformedExtent = 0.0f;
+
+        for (uint8_t column = 0; column < 3; ++column) {
+            transformedCenter += matrix(row, column) * center(column);
+            transformedExtent += std::abs(matrix(row, column)) * extent(column);
+        }
+
+        result.min(row) = transformedCenter - transformedExtent;
+        result.max(row) = transformedCenter + transformedExtent;
+    }
+
+    return result;
+}
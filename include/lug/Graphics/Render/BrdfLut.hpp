@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/IblCache.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      CPU reference of the split sum BRDF integration, the same as the shader genbrdflut.frag.
+ *             Used to generate the precomputed BRDF LUT asset and to validate it.
+ */
+namespace BrdfLut {
+
+constexpr uint32_t defaultSize = 512;
+constexpr uint32_t defaultSamplesCount = 1024;
+
+/**
+ * @brief      Integrates the BRDF for a view angle and a roughness.
+ *
+ * @param[in]  NoV           The cosine of the angle between the normal and the view vector, in ]0, 1].
+ * @param[in]  roughness     The roughness, in [0, 1].
+ * @param[in]  samplesCount  The number of importance samples.
+ *
+ * @return     The scale (x) and the bias (y) to apply to F0.
+ */
+LUG_GRAPHICS_API Math::Vec2f integrate(float NoV, float roughness, uint32_t samplesCount = defaultSamplesCount);
+
+/**
+ * @brief      Computes the LUT, with the layout of the texture rendered by the GPU:
+ *             NoV increases with x and the roughness decreases with y, sampled at the center of the texels.
+ *
+ * @param[in]  size          The width and height of the LUT.
+ * @param[in]  samplesCount  The number of importance samples per texel.
+ *
+ * @return     The size * size values, row by row.
+ */
+LUG_GRAPHICS_API std::vector<Math::Vec2f> compute(uint32_t size = defaultSize, uint32_t samplesCount = defaultSamplesCount);
+
+/**
+ * @brief      Gets the key of the LUT in the IBL cache.
+ */
+LUG_GRAPHICS_API uint64_t getKey(uint32_t size = defaultSize, uint32_t samplesCount = defaultSamplesCount);
+
+/**
+ * @brief      Computes the LUT and stores it in an R16G16_SFLOAT cache entry, the format of the BRDF LUT texture.
+ */
+LUG_GRAPHICS_API IblCache::Entry createEntry(uint32_t size = defaultSize, uint32_t samplesCount = defaultSamplesCount);
+
+} // BrdfLut
+
+} // Render
+} // Graphics
+} // lug
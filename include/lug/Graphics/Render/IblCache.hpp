@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      Content addressed cache of the image based lighting textures (irradiance map, prefiltered map, BRDF LUT).
+ *
+ *             The key of an entry is a hash of everything the texture is generated from: the environment
+ *             texture file and the generation parameters. Each entry is stored in its own file, named after its key,
+ *             and contains the raw texels of all the mip levels and layers of the texture.
+ */
+namespace IblCache {
+
+constexpr uint32_t magic = 0x4C42494C; // "LIBL"
+constexpr uint32_t version = 1;
+
+constexpr uint64_t hashSeed = 0xCBF29CE484222325ull;
+
+struct Entry {
+    uint64_t key;
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t layersCount;
+    uint32_t mipLevels;
+    Texture::Format format;
+
+    // The texels, mip level by mip level, with all the layers of a mip level one after the other
+    std::vector<uint8_t> data;
+};
+
+/**
+ * @brief      Hashes some data with 64 bits FNV-1a.
+ *
+ * @param[in]  data  The data.
+ * @param[in]  size  The size of the data.
+ * @param[in]  seed  The hash to continue, to hash several pieces of data.
+ *
+ * @return     The hash.
+ */
+LUG_GRAPHICS_API uint64_t hash(const void* data, size_t size, uint64_t seed = hashSeed);
+
+/**
+ * @brief      Hashes the content of a file.
+ *
+ * @param[in]  filename  The filename.
+ * @param[out] hash      The hash.
+ *
+ * @return     False if the file can't be read.
+ */
+LUG_GRAPHICS_API bool hashFile(const std::string& filename, uint64_t& hash);
+
+/**
+ * @brief      Gets the filename of an entry.
+ *
+ * @param[in]  directory  The directory of the cache, empty for the working directory.
+ * @param[in]  key        The key of the entry.
+ */
+LUG_GRAPHICS_API std::string getFilename(const std::string& directory, uint64_t key);
+
+/**
+ * @brief      Gets the size of the texels of a mip level, for all the layers.
+ */
+LUG_GRAPHICS_API size_t getMipLevelSize(const Entry& entry, uint32_t mipLevel);
+
+/**
+ * @brief      Gets the size of all the texels of an entry.
+ */
+LUG_GRAPHICS_API size_t getDataSize(const Entry& entry);
+
+/**
+ * @brief      Loads an entry.
+ *
+ * @param[in]  filename  The filename.
+ * @param[in]  key       The expected key, the file is rejected if it was stored with another key.
+ * @param[out] entry     The entry.
+ *
+ * @return     False if the file doesn't exist or is invalid, without error in the former case.
+ */
+LUG_GRAPHICS_API bool load(const std::string& filename, uint64_t key, Entry& entry);
+
+/**
+ * @brief      Saves an entry.
+ *
+ * @param[in]  filename  The filename.
+ * @param[in]  entry     The entry, its data must have the size returned by getDataSize.
+ *
+ * @return     False if the file can't be written.
+ */
+LUG_GRAPHICS_API bool save(const std::string& filename, const Entry& entry);
+
+} // IblCache
+
+} // Render
+} // Graphics
+} // lug
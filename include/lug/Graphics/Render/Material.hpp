@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include <lug/Graphics/Export.hpp>
@@ -116,6 +117,12 @@ public:
      */
     const Resource::SharedPtr<SkyBox> getPrefilteredMap() const;
 
+    /**
+     * @brief      Gets the version of the properties of the material which select its pipeline.
+     *             Incremented by the setters of the irradiance and prefiltered maps.
+     */
+    uint32_t getPipelineVersion() const;
+
 protected:
     Constants _constants;
     TextureInfo _baseColorTexture;
@@ -125,6 +132,7 @@ protected:
     TextureInfo _emissiveTexture;
     Resource::SharedPtr<SkyBox> _irradianceMap;
     Resource::SharedPtr<SkyBox> _prefilteredMap;
+    std::atomic<uint32_t> _pipelineVersion{0};
 };
 
 #include <lug/Graphics/Render/Material.inl>
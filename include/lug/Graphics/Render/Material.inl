@@ -1,10 +1,12 @@
 inline void Material::setIrradianceMap(const Resource::SharedPtr<SkyBox> irradianceMap) {
     _irradianceMap = irradianceMap;
+    _pipelineVersion.fetch_add(1, std::memory_order_release);
     DirtyObject::setDirty(true);
 }
 
 inline void Material::setPrefilteredMap(const Resource::SharedPtr<SkyBox> prefilteredMap) {
     _prefilteredMap = prefilteredMap;
+    _pipelineVersion.fetch_add(1, std::memory_order_release);
     DirtyObject::setDirty(true);
 }
 
@@ -39,3 +41,7 @@ inline const Resource::SharedPtr<SkyBox> Material::getIrradianceMap() const {
 inline const Resource::SharedPtr<SkyBox> Material::getPrefilteredMap() const {
     return _prefilteredMap;
 }
+
+inline uint32_t Material::getPipelineVersion() const {
+    return _pipelineVersion.load(std::memory_order_acquire);
+}
@@ -5,6 +5,7 @@
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Resource.hpp>
+#include <lug/Graphics/Render/BoundingBox.hpp>
 #include <lug/Graphics/Render/Material.hpp>
 #include <lug/Math/Vector.hpp>
 
@@ -33,7 +34,7 @@ public:
     struct PrimitiveSet {
         struct Attribute {
             enum class Type : uint8_t {
-                Indice,     ///< Indices (UNSIGNED_SHORT)
+                Indice,     ///< Indices (UNSIGNED_SHORT, or UNSIGNED_INT with 4 bytes per element)
                 Position,   ///< Position (VEC3<FLOAT>)
                 Normal,     ///< Normal (VEC3<FLOAT>)
                 TexCoord,   ///< UV (VEC2<FLOAT>)
@@ -48,6 +49,7 @@ public:
                 char* data{nullptr};        ///< The data of the buffer.
                 uint32_t size{0};           ///< The size of the above data buffer, in bytes.
                 uint32_t elementsCount{0};  ///< The number of elements (indices, vertices, normals)
+                bool external{false};       ///< The data is not owned by the mesh, it is only valid until the mesh is built.
             } buffer;
 
             void* _data{nullptr}; // Specific to each Renderer
@@ -95,11 +97,25 @@ public:
      */
     const std::vector<Mesh::PrimitiveSet>& getPrimitiveSets() const;
 
+    /**
+     * @brief      Gets the bounding box of the positions of all the primitive sets, in the space of the mesh.
+     *
+     * @return     The bounding box, invalid if the mesh has no position.
+     */
+    const BoundingBox& getBoundingBox() const;
+
 protected:
     explicit Mesh(const std::string& name);
 
+    /**
+     * @brief      Computes the bounding box from the positions of the primitive sets.
+     *             Must be called by the builder once the primitive sets are set.
+     */
+    void computeBoundingBox();
+
 protected:
     std::vector<PrimitiveSet> _primitiveSets;
+    BoundingBox _boundingBox;
 };
 
 #include <lug/Graphics/Render/Mesh.inl>
@@ -1,3 +1,7 @@
 inline const std::vector<Mesh::PrimitiveSet>& Mesh::getPrimitiveSets() const {
     return _primitiveSets;
 }
+
+inline const BoundingBox& Mesh::getBoundingBox() const {
+    return _boundingBox;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Resource.hpp>
 
@@ -33,7 +35,14 @@ public:
         R8G8B8A8_UNORM,
         R16G16_SFLOAT,
         R16G16B16_SFLOAT,
-        R32G32B32A32_SFLOAT
+        R32G32B32A32_SFLOAT,
+
+        // Block compressed formats, each block encodes 4x4 texels
+        BC1_RGBA_UNORM,
+        BC3_UNORM,
+        BC7_UNORM,
+        ETC2_R8G8B8A8_UNORM,
+        ASTC_4x4_UNORM
     };
 
 public:
@@ -97,8 +106,29 @@ public:
      */
     Render::Texture::WrappingMode getWrapT() const;
 
+    /**
+     * @brief      Gets the size of a texel, or of a block of texels for the compressed formats, in bytes.
+     */
     static size_t formatToSize(Render::Texture::Format format);
 
+    static bool isCompressed(Render::Texture::Format format);
+
+    /**
+     * @brief      Gets the width and height of a block of texels: 4 for the compressed formats, 1 otherwise.
+     */
+    static uint32_t formatToBlockExtent(Render::Texture::Format format);
+
+    /**
+     * @brief      Gets the size of an image, in bytes. The compressed images are padded to whole blocks.
+     */
+    static size_t getImageSize(uint32_t width, uint32_t height, Render::Texture::Format format);
+
+    /**
+     * @brief      Gets the size of the mip levels of a layer, from `firstMipLevel` to the last one.
+     *             Each level is half the size of the previous one, rounded down, at least 1.
+     */
+    static size_t getMipLevelsSize(uint32_t width, uint32_t height, Render::Texture::Format format, uint32_t mipLevels, uint32_t firstMipLevel = 0);
+
 private:
     uint32_t _width{0};
     uint32_t _height{0};
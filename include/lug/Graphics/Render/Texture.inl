@@ -39,7 +39,47 @@ inline size_t Texture::formatToSize(Render::Texture::Format format) {
             return 6;
         case Texture::Format::R32G32B32A32_SFLOAT:
             return 16;
+        case Texture::Format::BC1_RGBA_UNORM:
+            return 8;
+        case Texture::Format::BC3_UNORM:
+        case Texture::Format::BC7_UNORM:
+        case Texture::Format::ETC2_R8G8B8A8_UNORM:
+        case Texture::Format::ASTC_4x4_UNORM:
+            return 16;
         default:
             return 0;
     };
 }
+
+inline bool Texture::isCompressed(Render::Texture::Format format) {
+    switch(format) {
+        case Texture::Format::BC1_RGBA_UNORM:
+        case Texture::Format::BC3_UNORM:
+        case Texture::Format::BC7_UNORM:
+        case Texture::Format::ETC2_R8G8B8A8_UNORM:
+        case Texture::Format::ASTC_4x4_UNORM:
+            return true;
+        default:
+            return false;
+    };
+}
+
+inline uint32_t Texture::formatToBlockExtent(Render::Texture::Format format) {
+    return isCompressed(format) ? 4 : 1;
+}
+
+inline size_t Texture::getImageSize(uint32_t width, uint32_t height, Render::Texture::Format format) {
+    const uint32_t blockExtent = formatToBlockExtent(format);
+
+    return static_cast<size_t>((width + blockExtent - 1) / blockExtent) * ((height + blockExtent - 1) / blockExtent) * formatToSize(format);
+}
+
+inline size_t Texture::getMipLevelsSize(uint32_t width, uint32_t height, Render::Texture::Format format, uint32_t mipLevels, uint32_t firstMipLevel) {
+    size_t size = 0;
+
+    for (uint32_t level = firstMipLevel; level < mipLevels; ++level) {
+        size += getImageSize(std::max(width >> level, 1u), std::max(height >> level, 1u), format);
+    }
+
+    return size;
+}
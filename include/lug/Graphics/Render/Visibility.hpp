@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/BoundingBox.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      The 6 planes of a view frustum, pointing inside.
+ */
+class LUG_GRAPHICS_API Frustum {
+public:
+    enum class Plane : uint8_t {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far
+    };
+
+    static constexpr uint8_t planesCount = 6;
+
+public:
+    Frustum() = default;
+
+    /**
+     * @brief      Extracts the planes of a projection * view matrix, with a depth range of [0, 1].
+     *             The planes are normalized, so the distances are in world units.
+     *
+     * @param[in]  viewProjection  The projection matrix multiplied by the view matrix.
+     */
+    explicit Frustum(const Math::Mat4x4f& viewProjection);
+
+    Frustum(const Frustum&) = default;
+    Frustum(Frustum&&) = default;
+
+    Frustum& operator=(const Frustum&) = default;
+    Frustum& operator=(Frustum&&) = default;
+
+    ~Frustum() = default;
+
+    /**
+     * @brief      Gets a plane (normal, distance), a point p is in front of it if dot(normal, p) + distance >= 0.
+     */
+    const Math::Vec4f& getPlane(Plane plane) const;
+
+    /**
+     * @brief      Checks whether a bounding box is at least partially inside the frustum.
+     *             The test is conservative, a box near a corner of the frustum can be reported visible.
+     *             An invalid box is always visible.
+     */
+    bool intersects(const BoundingBox& box) const;
+
+private:
+    std::array<Math::Vec4f, planesCount> _planes;
+};
+
+/**
+ * @brief      Visibility of a list of objects from several views, computed in one pass.
+ *             Each object is tested against the frustums of all the views at once, 4 views at a time
+ *             with SSE when it is available, and the results are stored in one bitset per view.
+ */
+class LUG_GRAPHICS_API Visibility {
+public:
+    Visibility() = default;
+
+    Visibility(const Visibility&) = delete;
+    Visibility(Visibility&&) = default;
+
+    Visibility& operator=(const Visibility&) = delete;
+    Visibility& operator=(Visibility&&) = default;
+
+    ~Visibility() = default;
+
+    /**
+     * @brief      Computes the visibility of the objects from each frustum.
+     *             The results of the previous call are replaced.
+     *
+     * @param[in]  frustums       The frustums of the views.
+     * @param[in]  boundingBoxes  The world bounding boxes of the objects, an invalid box is always visible.
+     */
+    void compute(const std::vector<Frustum>& frustums, const std::vector<BoundingBox>& boundingBoxes);
+
+    uint32_t getViewsCount() const;
+    uint32_t getObjectsCount() const;
+
+    bool isVisible(uint32_t viewIdx, uint32_t objectIdx) const;
+
+    /**
+     * @brief      Gets the visible objects of a view, the bit (objectIdx % 64) of the word (objectIdx / 64).
+     */
+    const std::vector<uint64_t>& getBitset(uint32_t viewIdx) const;
+
+    /**
+     * @brief      Calls a function with the index of each visible object of a view, in increasing order.
+     */
+    template <typename Function>
+    void forEachVisible(uint32_t viewIdx, Function function) const;
+
+private:
+    /**
+     * @brief      The planes of 4 frustums, one frustum per lane.
+     *             The absolute values of the normals are precomputed for the extent of the boxes.
+     */
+    struct FrustumGroup {
+        float normals[Frustum::planesCount][3][4];
+        float absNormals[Frustum::planesCount][3][4];
+        float distances[Frustum::planesCount][4];
+    };
+
+private:
+    uint32_t _objectsCount{0};
+    std::vector<FrustumGroup> _frustumGroups;
+    std::vector<std::vector<uint64_t>> _bitsets;
+};
+
+#include <lug/Graphics/Render/Visibility.inl>
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,34 @@
+inline const Math::Vec4f& Frustum::getPlane(Plane plane) const {
+    return _planes[static_cast<uint8_t>(plane)];
+}
+
+inline uint32_t Visibility::getViewsCount() const {
+    return static_cast<uint32_t>(_bitsets.size());
+}
+
+inline uint32_t Visibility::getObjectsCount() const {
+    return _objectsCount;
+}
+
+inline bool Visibility::isVisible(uint32_t viewIdx, uint32_t objectIdx) const {
+    return (_bitsets[viewIdx][objectIdx / 64] >> (objectIdx % 64)) & 1;
+}
+
+inline const std::vector<uint64_t>& Visibility::getBitset(uint32_t viewIdx) const {
+    return _bitsets[viewIdx];
+}
+
+template <typename Function>
+inline void Visibility::forEachVisible(uint32_t viewIdx, Function function) const {
+    const std::vector<uint64_t>& bitset = _bitsets[viewIdx];
+
+    for (uint32_t wordIdx = 0; wordIdx < bitset.size(); ++wordIdx) {
+        uint64_t word = bitset[wordIdx];
+
+        for (uint32_t bitIdx = 0; word; ++bitIdx, word >>= 1) {
+            if (word & 1) {
+                function(wordIdx * 64 + bitIdx);
+            }
+        }
+    }
+}
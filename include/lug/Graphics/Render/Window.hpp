@@ -13,9 +13,36 @@ namespace Render {
 
 class LUG_GRAPHICS_API Window: public ::lug::Window::Window, public ::lug::Graphics::Render::Target {
 public:
+    /**
+     * @brief      Rendering without window nor surface, for benchmarks and tests on machines without display.
+     *             The window only has the size of lug::Window::Window::InitInfo and never receives events.
+     */
+    struct Headless {
+        bool enabled{false};
+        uint32_t imagesCount{3};    // Number of offscreen images
+        bool readback{false};       // Copy each rendered image to CPU memory
+    };
+
+    /**
+     * @brief      Presentation mode of the swapchain.
+     *             Default uses the preferences of the renderer, the others fall back to them if they are not supported.
+     */
+    enum class PresentMode : uint8_t {
+        Default,
+        Fifo,       // Waits for the vertical blank, never tears, the CPU is throttled by the display
+        Mailbox,    // Replaces the queued image at each frame, never tears, lowest latency without tearing
+        Immediate   // Presents right away, may tear
+    };
+
     struct InitInfo {
         lug::Window::Window::InitInfo windowInitInfo;
         std::vector<View::InitInfo> renderViewsInitInfo;
+        Headless headless;
+        PresentMode presentMode{PresentMode::Default};
+
+        // Number of frames the CPU can prepare while the GPU renders the previous ones,
+        // independently of the number of images of the swapchain (it is clamped to it)
+        uint32_t framesInFlight{2};
     };
 
 public:
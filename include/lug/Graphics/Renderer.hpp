@@ -40,8 +40,14 @@ public:
         MSAA16X
     };
 
+    enum class BloomTechnique : uint8_t {
+        Blur,       // Separable gaussian blur of the glow image at full and half resolution
+        MipChain    // Compute shaders downsampling then upsampling the glow image through a mip chain
+    };
+
     struct BloomOtions {
         float blurThreshold{0.5f};
+        BloomTechnique technique{BloomTechnique::Blur};
     };
 
     struct InitInfo {
@@ -86,6 +92,12 @@ public:
     const Antialiasing& getAntialiasing() const;
     void setAntialiasing(Antialiasing antialiasing);
 
+    /**
+     * @brief      Gets the version of the settings used by the pipelines of the models, the display mode
+     *             and the antialiasing. Incremented each time one of them changes, never 0.
+     */
+    uint32_t getPipelineSettingsVersion() const;
+
     bool isBloomEnabled() const;
     void isBloomEnabled(bool enabled);
 
@@ -95,6 +107,8 @@ public:
     float getBlurThreshold() const;
     void setBlurThreshold(float blurThreshold);
 
+    BloomTechnique getBloomTechnique() const;
+
     ResourceManager* getResourceManager() const;
 
 protected:
@@ -102,6 +116,7 @@ protected:
     Type _type;
     DisplayMode _displayMode;
     Antialiasing _antialiasing;
+    uint32_t _pipelineSettingsVersion{1};
     InitInfo _initInfo;
     std::unique_ptr<ResourceManager> _resourceManager{nullptr};
 
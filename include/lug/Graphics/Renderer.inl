@@ -15,7 +15,10 @@ inline const Renderer::DisplayMode& Renderer::getDisplayMode() const {
 }
 
 inline void Renderer::setDisplayMode(Renderer::DisplayMode displayMode) {
-    _displayMode = displayMode;
+    if (_displayMode != displayMode) {
+        _displayMode = displayMode;
+        ++_pipelineSettingsVersion;
+    }
 }
 
 inline const Renderer::Antialiasing& Renderer::getAntialiasing() const {
@@ -23,7 +26,14 @@ inline const Renderer::Antialiasing& Renderer::getAntialiasing() const {
 }
 
 inline void Renderer::setAntialiasing(Renderer::Antialiasing antialiasing) {
-    _antialiasing = antialiasing;
+    if (_antialiasing != antialiasing) {
+        _antialiasing = antialiasing;
+        ++_pipelineSettingsVersion;
+    }
+}
+
+inline uint32_t Renderer::getPipelineSettingsVersion() const {
+    return _pipelineSettingsVersion;
 }
 
 inline bool Renderer::isBloomEnabled() const {
@@ -50,3 +60,7 @@ inline void Renderer::setBlurThreshold(float blurThreshold) {
     _bloomOptions.blurThreshold = blurThreshold;
     isBloomDirty(true);
 }
+
+inline Renderer::BloomTechnique Renderer::getBloomTechnique() const {
+    return _bloomOptions.technique;
+}
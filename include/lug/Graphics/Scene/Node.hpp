@@ -4,6 +4,7 @@
 #include <vector>
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Node.hpp>
+#include <lug/Graphics/Render/BoundingBox.hpp>
 #include <lug/Graphics/Render/Camera/Camera.hpp>
 #include <lug/Graphics/Render/DirtyObject.hpp>
 #include <lug/Graphics/Render/Light.hpp>
@@ -13,13 +14,6 @@
 namespace lug {
 namespace Graphics {
 
-namespace Render {
-
-class Queue;
-class View;
-
-} // Render
-
 namespace Scene {
 
 class Scene;
@@ -29,8 +23,31 @@ class LUG_GRAPHICS_API Node : public ::lug::Graphics::Node, public Render::Dirty
 
 public:
     struct MeshInstance {
+        /**
+         * @brief      A primitive set of the mesh resolved by the renderer, with its pipeline and its material.
+         */
+        struct DrawItem {
+            uint32_t pipelineId;                                // Specific to each Renderer
+            const Render::Mesh::PrimitiveSet* primitiveSet;
+            Render::Material* material;
+            uint32_t materialVersion;                           // Render::Material::getPipelineVersion() when resolved
+        };
+
+        /**
+         * @brief      The draw items of the instance, never modified once published: the views read them concurrently.
+         */
+        struct DrawItems {
+            uint32_t version;                                   // Renderer::getPipelineSettingsVersion() when resolved
+            std::vector<DrawItem> items;
+        };
+
         Resource::SharedPtr<Render::Mesh> mesh{nullptr};
         std::vector<Resource::SharedPtr<Render::Material>> materials;
+
+        // Resolved by the renderer the first time the instance is drawn, and again when the mesh,
+        // the materials or the pipeline settings of the renderer change. Replaced as a whole with
+        // std::atomic_store, and read with std::atomic_load. nullptr if not resolved
+        mutable std::shared_ptr<const DrawItems> drawItems;
     };
 
 public:
@@ -63,10 +80,20 @@ public:
     Render::Camera::Camera* getCamera();
     const Render::Camera::Camera* getCamera() const;
 
-    void fetchVisibleObjects(const Renderer& renderer, const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const;
-
     virtual void needUpdate() override;
 
+private:
+    /**
+     * @brief      Collects the nodes of the subtree with a mesh instance or a light, children first.
+     *             The world bounding boxes of the mesh instances are computed at the same time.
+     */
+    void fetchObjects(std::vector<Node*>& meshNodes, std::vector<Render::BoundingBox>& boundingBoxes, std::vector<Node*>& lightNodes);
+
+    /**
+     * @brief      Checks whether the light of the node reaches the node of a camera.
+     */
+    bool isLightInRange(const Render::Camera::Camera& camera) const;
+
 private:
     Scene &_scene;
 
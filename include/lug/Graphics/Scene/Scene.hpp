@@ -2,10 +2,12 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Render/Light.hpp>
 #include <lug/Graphics/Render/SkyBox.hpp>
+#include <lug/Graphics/Render/Visibility.hpp>
 #include <lug/Graphics/Resource.hpp>
 #include <lug/Graphics/Scene/Node.hpp>
 
@@ -52,14 +54,46 @@ public:
     const Node* getSceneNode(const std::string& name) const;
     const Resource::SharedPtr<Render::SkyBox> getSkyBox() const;
 
+    /**
+     * @brief      Computes the visible objects of several views of the scene in one traversal.
+     *             The world bounding boxes of the mesh instances are computed once and tested against
+     *             the frustums of all the views at once. fetchVisibleObjects() uses the results for these views
+     *             until the next call, so it must not be called while the views are fetching their visible objects.
+     *
+     * @param[in]  renderViews  The views, with a camera attached to a node of this scene. Empty to clear the results.
+     */
+    void computeVisibility(const std::vector<const Render::View*>& renderViews);
+
+    /**
+     * @brief      Adds the skybox, the mesh instances in the frustum of the camera and the lights in range
+     *             to a render queue. If computeVisibility() was not called for this view, the scene is traversed
+     *             for this view only.
+     */
     void fetchVisibleObjects(const Renderer& renderer, const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const;
 
+private:
+    /**
+     * @brief      Results of one traversal of the scene, for a list of views.
+     */
+    struct VisibilityCache {
+        std::vector<const Render::View*> renderViews;
+        std::vector<Node*> meshNodes;
+        std::vector<Render::BoundingBox> boundingBoxes;
+        std::vector<Node*> lightNodes;
+        Render::Visibility visibility;
+    };
+
 private:
     Scene(const std::string& name);
 
+    void computeVisibility(VisibilityCache& cache, const std::vector<const Render::View*>& renderViews);
+    void fetchVisibleObjects(const VisibilityCache& cache, uint32_t viewIdx, const Renderer& renderer, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const;
+
 private:
     Node _root;
 
+    VisibilityCache _visibilityCache;
+
     Resource::SharedPtr<Render::SkyBox> _skyBox{nullptr};
 
     std::list<Node> _nodes;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Encodes and decodes the block compressed textures on the CPU.
+ *
+ *             The textures are encoded offline to BC1 or BC3 (e.g. by the asset cooker or the texture encoder tool)
+ *             and decoded to R8G8B8A8_UNORM at load time when the device can't sample them.
+ *             The images are in the layout of Builder::Texture::addExternalLayer, one block row after another.
+ */
+namespace TextureCompression {
+
+/**
+ * @brief      Checks whether a format can be encoded from R8G8B8A8_UNORM, i.e. BC1_RGBA_UNORM and BC3_UNORM.
+ */
+LUG_GRAPHICS_API bool canEncode(Render::Texture::Format format);
+
+/**
+ * @brief      Checks whether a format can be decoded to R8G8B8A8_UNORM, i.e. BC1_RGBA_UNORM and BC3_UNORM.
+ */
+LUG_GRAPHICS_API bool canDecode(Render::Texture::Format format);
+
+/**
+ * @brief      Checks whether a R8G8B8A8 image has texels which are not opaque.
+ */
+LUG_GRAPHICS_API bool hasAlpha(const uint8_t* pixels, uint32_t width, uint32_t height);
+
+/**
+ * @brief      Selects the format to encode a R8G8B8A8 image: BC1_RGBA_UNORM if it is opaque, BC3_UNORM otherwise.
+ */
+LUG_GRAPHICS_API Render::Texture::Format selectEncodeFormat(const uint8_t* pixels, uint32_t width, uint32_t height);
+
+/**
+ * @brief      Selects the format a texture is uploaded with: its own format if the device supports it,
+ *             otherwise R8G8B8A8_UNORM if it can be decoded on the CPU.
+ *
+ * @param[in]  format       The format of the texture.
+ * @param[in]  isSupported  Checks whether the device can sample a format.
+ *
+ * @return     The format, or Undefined if the texture can't be used by the device.
+ */
+LUG_GRAPHICS_API Render::Texture::Format selectTranscodeFormat(Render::Texture::Format format, const std::function<bool(Render::Texture::Format)>& isSupported);
+
+/**
+ * @brief      Encodes the mip levels of a R8G8B8A8 image, e.g. generated by AssetCooker::generateMipLevels.
+ *             The texels of the blocks outside of the image are copies of its last row and column.
+ *
+ * @param[in]  pixels     The mip levels, from the largest one.
+ * @param[in]  format     BC1_RGBA_UNORM or BC3_UNORM. With BC1, the texels with an alpha lower than 128 are transparent.
+ *
+ * @return     The encoded mip levels, from the largest one, or an empty vector if the format can't be encoded.
+ */
+LUG_GRAPHICS_API std::vector<uint8_t> encode(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format);
+
+/**
+ * @brief      Decodes the mip levels of a compressed image to R8G8B8A8.
+ *
+ * @param[in]  data       The encoded mip levels, from the largest one.
+ * @param[out] pixels     The decoded mip levels, Render::Texture::getMipLevelsSize() bytes with R8G8B8A8_UNORM.
+ *
+ * @return     False if the format can't be decoded.
+ */
+LUG_GRAPHICS_API bool decode(const uint8_t* data, uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format, uint8_t* pixels);
+
+} // TextureCompression
+
+} // Graphics
+} // lug
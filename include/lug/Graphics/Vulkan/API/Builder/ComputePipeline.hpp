@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <lug/Graphics/Vulkan/API/Builder/ShaderModule.hpp>
+#include <lug/Graphics/Vulkan/API/ComputePipeline.hpp>
+#include <lug/Graphics/Vulkan/API/PipelineLayout.hpp>
+#include <lug/Graphics/Vulkan/API/ShaderModule.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+class Device;
+
+namespace Builder {
+
+class LUG_GRAPHICS_API ComputePipeline {
+public:
+    ComputePipeline(const API::Device& device);
+
+    ComputePipeline(const ComputePipeline&) = delete;
+    ComputePipeline(ComputePipeline&&) = delete;
+
+    ComputePipeline& operator=(const ComputePipeline&) = delete;
+    ComputePipeline& operator=(ComputePipeline&&) = delete;
+
+    ~ComputePipeline() = default;
+
+    // Setters
+    void setShader(const char* entry, API::ShaderModule shaderModule, const VkSpecializationInfo* specializationInfo = nullptr);
+    bool setShaderFromFile(const char* entry, const std::string& filename, const VkSpecializationInfo* specializationInfo = nullptr);
+
+    void setPipelineLayout(API::PipelineLayout pipelineLayout);
+    void setPipelineCache(VkPipelineCache pipelineCache);
+
+    // Build methods
+    bool build(API::ComputePipeline& computePipeline, VkResult* returnResult = nullptr);
+    std::unique_ptr<API::ComputePipeline> build(VkResult* returnResult = nullptr);
+
+private:
+    const API::Device& _device;
+
+    // Shader state
+    API::ShaderModule _shaderModule;
+    const char* _entry{nullptr};
+    const VkSpecializationInfo* _specializationInfo{nullptr};
+
+    // General
+    API::PipelineLayout _pipelineLayout;
+    VkPipelineCache _pipelineCache{VK_NULL_HANDLE};
+};
+
+#include <lug/Graphics/Vulkan/API/Builder/ComputePipeline.inl>
+
+} // Builder
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,32 @@
+inline void ComputePipeline::setShader(const char* entry, API::ShaderModule shaderModule, const VkSpecializationInfo* specializationInfo) {
+    _entry = entry;
+    _shaderModule = std::move(shaderModule);
+    _specializationInfo = specializationInfo;
+}
+
+inline bool ComputePipeline::setShaderFromFile(const char* entry, const std::string& filename, const VkSpecializationInfo* specializationInfo) {
+    API::Builder::ShaderModule shaderModuleBuilder(_device);
+
+    if (!shaderModuleBuilder.loadFromFile(filename)) {
+        LUG_LOG.error("Builder::ComputePipeline: Create load from file {}", filename);
+        return false;
+    }
+
+    VkResult result{VK_SUCCESS};
+    API::ShaderModule shaderModule;
+    if (!shaderModuleBuilder.build(shaderModule, &result)) {
+        LUG_LOG.error("Builder::ComputePipeline: Create create shader from file {}: {}", filename, result);
+        return false;
+    }
+
+    setShader(entry, std::move(shaderModule), specializationInfo);
+    return true;
+}
+
+inline void ComputePipeline::setPipelineLayout(API::PipelineLayout pipelineLayout) {
+    _pipelineLayout = std::move(pipelineLayout);
+}
+
+inline void ComputePipeline::setPipelineCache(VkPipelineCache pipelineCache) {
+    _pipelineCache = pipelineCache;
+}
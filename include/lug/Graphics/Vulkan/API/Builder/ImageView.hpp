@@ -33,6 +33,7 @@ public:
     void setAspectFlags(VkImageAspectFlags aspectFlags);
     void setLayerCount(uint32_t layerCount);
     void setLevelCount(uint32_t levelCount);
+    void setBaseMipLevel(uint32_t baseMipLevel);
 
     // Build methods
     bool build(API::ImageView& instance, VkResult* returnResult = nullptr);
@@ -47,6 +48,7 @@ private:
     VkImageAspectFlags _aspectFlags{VK_IMAGE_ASPECT_COLOR_BIT};
     uint32_t _layerCount{1};
     uint32_t _levelCount{1};
+    uint32_t _baseMipLevel{0};
 };
 
 #include <lug/Graphics/Vulkan/API/Builder/ImageView.inl>
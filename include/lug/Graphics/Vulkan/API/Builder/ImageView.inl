@@ -17,3 +17,7 @@ inline void ImageView::setLayerCount(uint32_t layerCount) {
 inline void ImageView::setLevelCount(uint32_t levelCount) {
     _levelCount = levelCount;
 }
+
+inline void ImageView::setBaseMipLevel(uint32_t baseMipLevel) {
+    _baseMipLevel = baseMipLevel;
+}
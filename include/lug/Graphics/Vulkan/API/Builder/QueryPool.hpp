@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+
+#include <lug/Graphics/Vulkan/API/QueryPool.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+class Device;
+
+namespace Builder {
+
+class QueryPool {
+public:
+    QueryPool(const API::Device& device);
+
+    QueryPool(const QueryPool&) = delete;
+    QueryPool(QueryPool&&) = delete;
+
+    QueryPool& operator=(const QueryPool&) = delete;
+    QueryPool& operator=(QueryPool&&) = delete;
+
+    ~QueryPool() = default;
+
+    // Setters
+    void setQueryType(VkQueryType queryType);
+    void setQueryCount(uint32_t queryCount);
+    void setPipelineStatistics(VkQueryPipelineStatisticFlags pipelineStatistics);
+
+    // Build methods
+    bool build(API::QueryPool& instance, VkResult* returnResult = nullptr);
+    std::unique_ptr<API::QueryPool> build(VkResult* returnResult = nullptr);
+
+private:
+    const API::Device& _device;
+
+    VkQueryType _queryType{VK_QUERY_TYPE_TIMESTAMP};
+    uint32_t _queryCount{1};
+    VkQueryPipelineStatisticFlags _pipelineStatistics{0};
+};
+
+#include <lug/Graphics/Vulkan/API/Builder/QueryPool.inl>
+
+} // Builder
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,11 @@
+inline void QueryPool::setQueryType(VkQueryType queryType) {
+    _queryType = queryType;
+}
+
+inline void QueryPool::setQueryCount(uint32_t queryCount) {
+    _queryCount = queryCount;
+}
+
+inline void QueryPool::setPipelineStatistics(VkQueryPipelineStatisticFlags pipelineStatistics) {
+    _pipelineStatistics = pipelineStatistics;
+}
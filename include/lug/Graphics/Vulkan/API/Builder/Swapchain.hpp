@@ -43,12 +43,21 @@ public:
     void setClipped(VkBool32 clipped);
     void setOldSwapchain(VkSwapchainKHR oldSwapchain);
 
+    /**
+     * @brief      Builds an offscreen swapchain, which owns its images, instead of a swapchain of a surface.
+     *             Only the image count, format, extent, usage and queue family indices are used.
+     *
+     * @param[in]  offscreen  True to build an offscreen swapchain.
+     */
+    void setOffscreen(bool offscreen);
+
     // Build methods
     bool build(API::Swapchain& instance, VkResult* returnResult = nullptr);
     std::unique_ptr<API::Swapchain> build(VkResult* returnResult = nullptr);
 
 private:
     bool setFromPreferences();
+    bool buildOffscreen(API::Swapchain& instance, VkResult* returnResult);
 
 private:
     const API::Device& _device;
@@ -67,6 +76,7 @@ private:
     VkPresentModeKHR _presentMode{VK_PRESENT_MODE_MAX_ENUM_KHR};
     VkBool32 _clipped{VK_TRUE};
     VkSwapchainKHR _oldSwapchain{VK_NULL_HANDLE};
+    bool _offscreen{false};
 };
 
 #include <lug/Graphics/Vulkan/API/Builder/Swapchain.inl>
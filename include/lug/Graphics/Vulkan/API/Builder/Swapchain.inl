@@ -53,3 +53,7 @@ inline void Swapchain::setClipped(VkBool32 clipped) {
 inline void Swapchain::setOldSwapchain(VkSwapchainKHR oldSwapchain) {
     _oldSwapchain = oldSwapchain;
 }
+
+inline void Swapchain::setOffscreen(bool offscreen) {
+    _offscreen = offscreen;
+}
@@ -14,11 +14,13 @@ class CommandBuffer;
 
 class Buffer;
 class CommandPool;
+class ComputePipeline;
 class DescriptorSet;
 class Framebuffer;
 class GraphicsPipeline;
 class Image;
 class PipelineLayout;
+class QueryPool;
 class RenderPass;
 
 class LUG_GRAPHICS_API CommandBuffer {
@@ -42,7 +44,11 @@ public:
     const CommandPool* getCommandPool() const;
 
     // Add begin, end, etc
-    bool begin(VkCommandBufferUsageFlags flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) const;
+    // The inheritance info is only used by secondary command buffers
+    bool begin(
+        VkCommandBufferUsageFlags flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        const VkCommandBufferInheritanceInfo* inheritanceInfo = nullptr
+    ) const;
     bool end() const;
 
     #include <lug/Graphics/Vulkan/API/CommandBuffer/Buffer.inl>
@@ -50,6 +56,7 @@ public:
     #include <lug/Graphics/Vulkan/API/CommandBuffer/Image.inl>
     #include <lug/Graphics/Vulkan/API/CommandBuffer/RenderPass.inl>
     #include <lug/Graphics/Vulkan/API/CommandBuffer/Pipeline.inl>
+    #include <lug/Graphics/Vulkan/API/CommandBuffer/Query.inl>
 
     bool reset(bool releaseRessources = false) const;
     void destroy();
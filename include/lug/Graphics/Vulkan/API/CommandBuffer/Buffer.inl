@@ -1 +1,9 @@
+struct CmdCopyBuffer {
+    const API::Buffer& srcBuffer;
+    const API::Buffer& dstBuffer;
+
+    std::vector<VkBufferCopy> regions;
+};
+
 void updateBuffer(const API::Buffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0) const;
+void copyBuffer(const CmdCopyBuffer& parameters) const;
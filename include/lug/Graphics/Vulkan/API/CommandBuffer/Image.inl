@@ -20,5 +20,25 @@ struct CmdBlitImage {
     VkFilter filter;
 };
 
+struct CmdCopyImageToBuffer {
+    const API::Image& srcImage;
+    VkImageLayout srcImageLayout;
+
+    const API::Buffer& dstBuffer;
+
+    std::vector<VkBufferImageCopy> regions;
+};
+
+struct CmdCopyBufferToImage {
+    const API::Buffer& srcBuffer;
+
+    const API::Image& dstImage;
+    VkImageLayout dstImageLayout;
+
+    std::vector<VkBufferImageCopy> regions;
+};
+
 void copyImage(const CmdCopyImage& parameters) const;
 void blitImage(const CmdBlitImage& parameters) const;
+void copyImageToBuffer(const CmdCopyImageToBuffer& parameters) const;
+void copyBufferToImage(const CmdCopyBufferToImage& parameters) const;
@@ -46,6 +46,12 @@ struct CmdPipelineBarrier {
     std::vector<BufferMemoryBarrier> bufferMemoryBarriers;
 };
 
+struct CmdDispatch {
+    uint32_t groupCountX{1};
+    uint32_t groupCountY{1};
+    uint32_t groupCountZ{1};
+};
+
 struct CmdPushConstants {
     VkPipelineLayout layout = VK_NULL_HANDLE;
     VkShaderStageFlags stageFlags = VK_SHADER_STAGE_ALL;
@@ -62,6 +68,7 @@ void pipelineBarrier(
 ) const;
 
 void bindPipeline(const API::GraphicsPipeline& pipeline, VkPipelineBindPoint pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS) const;
+void bindPipeline(const API::ComputePipeline& pipeline) const;
 void bindVertexBuffers(
     const std::vector<const API::Buffer*>& buffers,
     const std::vector<VkDeviceSize>& offsets,
@@ -74,3 +81,5 @@ void setScissor(const std::vector<VkRect2D>& scissors, uint32_t firstScissor = 0
 void setBlendConstants(const float blendConstants[4]) const;
 
 void pushConstants(const CmdPushConstants& parameters) const;
+
+void dispatch(const CmdDispatch& parameters) const;
@@ -0,0 +1,4 @@
+void resetQueryPool(const API::QueryPool& queryPool, uint32_t firstQuery, uint32_t queryCount) const;
+void beginQuery(const API::QueryPool& queryPool, uint32_t query, VkQueryControlFlags flags = 0) const;
+void endQuery(const API::QueryPool& queryPool, uint32_t query) const;
+void writeTimestamp(VkPipelineStageFlagBits pipelineStage, const API::QueryPool& queryPool, uint32_t query) const;
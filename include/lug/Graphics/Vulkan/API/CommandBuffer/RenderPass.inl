@@ -26,3 +26,4 @@ void beginRenderPass(const API::RenderPass& renderPass,
 void endRenderPass() const;
 void draw(const CmdDraw& params) const;
 void drawIndexed(const CmdDrawIndexed& params) const;
+void executeCommands(const std::vector<const API::CommandBuffer*>& commandBuffers) const;
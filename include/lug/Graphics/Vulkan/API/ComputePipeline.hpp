@@ -0,0 +1,51 @@
+#pragma once
+
+#include <lug/Graphics/Vulkan/API/PipelineLayout.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+namespace Builder {
+class ComputePipeline;
+} // Builder
+
+class Device;
+
+class LUG_GRAPHICS_API ComputePipeline {
+    friend class Builder::ComputePipeline;
+
+public:
+    ComputePipeline() = default;
+
+    ComputePipeline(const ComputePipeline&) = delete;
+    ComputePipeline(ComputePipeline&& pipeline);
+
+    ComputePipeline& operator=(const ComputePipeline&) = delete;
+    ComputePipeline& operator=(ComputePipeline&& pipeline);
+
+    ~ComputePipeline();
+
+    explicit operator VkPipeline() const {
+        return _pipeline;
+    }
+
+    void destroy();
+
+    const PipelineLayout* getLayout() const;
+
+private:
+    explicit ComputePipeline(VkPipeline pipeline, const Device* device, PipelineLayout pipelineLayout);
+
+private:
+    VkPipeline _pipeline{VK_NULL_HANDLE};
+    const Device* _device{nullptr};
+
+    PipelineLayout _pipelineLayout;
+};
+
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -45,6 +45,15 @@ public:
 
     bool waitIdle() const;
 
+    /**
+     * @brief      Flushes host writes to mapped non-coherent memory, with only one call for all the ranges.
+     *
+     * @param[in]  ranges  The ranges to flush.
+     *
+     * @return     True on success.
+     */
+    bool flushMappedMemoryRanges(const std::vector<VkMappedMemoryRange>& ranges) const;
+
     void destroy();
 
 
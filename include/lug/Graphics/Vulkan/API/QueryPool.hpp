@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/Vulkan.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+namespace Builder {
+class QueryPool;
+} // Builder
+
+class Device;
+
+class LUG_GRAPHICS_API QueryPool {
+    friend class Builder::QueryPool;
+
+public:
+    QueryPool() = default;
+
+    QueryPool(const QueryPool&) = delete;
+    QueryPool(QueryPool&& queryPool);
+
+    QueryPool& operator=(const QueryPool&) = delete;
+    QueryPool& operator=(QueryPool&& queryPool);
+
+    ~QueryPool();
+
+    explicit operator VkQueryPool() const {
+        return _queryPool;
+    }
+
+    /**
+     * @brief      Gets the results of a range of queries, as 64 bits values.
+     *
+     * @param[in]  firstQuery  The first query.
+     * @param[in]  queryCount  The number of queries.
+     * @param[out] results     The results. Pipeline statistics queries write one value per enabled statistic.
+     * @param[in]  wait        Wait for the results to be available.
+     *
+     * @return     False if the results are not available yet or on error.
+     */
+    bool getResults(uint32_t firstQuery, uint32_t queryCount, std::vector<uint64_t>& results, bool wait = false) const;
+
+    VkQueryType getQueryType() const;
+    uint32_t getQueryCount() const;
+
+    /**
+     * @brief      Gets the number of values written by each query.
+     *
+     * @return     The number of enabled statistics for the pipeline statistics queries, 1 otherwise.
+     */
+    uint32_t getValuesPerQuery() const;
+
+    void destroy();
+
+private:
+    explicit QueryPool(VkQueryPool queryPool, const Device* device, VkQueryType queryType, uint32_t queryCount, uint32_t valuesPerQuery);
+
+private:
+    VkQueryPool _queryPool{VK_NULL_HANDLE};
+    const Device* _device{nullptr};
+
+    VkQueryType _queryType{VK_QUERY_TYPE_TIMESTAMP};
+    uint32_t _queryCount{0};
+    uint32_t _valuesPerQuery{1};
+};
+
+#include <lug/Graphics/Vulkan/API/QueryPool.inl>
+
+} // API
+} // Vulkan
+} // Graphics
+} // lug
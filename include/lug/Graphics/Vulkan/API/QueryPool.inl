@@ -0,0 +1,11 @@
+inline VkQueryType QueryPool::getQueryType() const {
+    return _queryType;
+}
+
+inline uint32_t QueryPool::getQueryCount() const {
+    return _queryCount;
+}
+
+inline uint32_t QueryPool::getValuesPerQuery() const {
+    return _valuesPerQuery;
+}
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
 #include <lug/Graphics/Vulkan/API/ImageView.hpp>
 #include <lug/Graphics/Vulkan/Vulkan.hpp>
@@ -20,6 +21,12 @@ class Device;
 class Queue;
 class RenderPass;
 
+/**
+ * @brief      Swapchain of a surface, or offscreen swapchain.
+ *
+ *             An offscreen swapchain has no VkSwapchainKHR: it owns its images, which are
+ *             acquired in turn and never presented. It allows to render without a surface.
+ */
 class LUG_GRAPHICS_API Swapchain {
     friend class Builder::Swapchain;
 
@@ -52,10 +59,13 @@ public:
     void setOutOfDate(bool outOfDate);
     bool isOutOfDate() const;
 
+    bool isOffscreen() const;
+
 private:
     explicit Swapchain(VkSwapchainKHR swapchain, const Device* device, const VkSurfaceFormatKHR& swapchainFormat, const VkExtent2D& extent);
 
     bool init();
+    bool initImagesViews();
 
 private:
     VkSwapchainKHR _swapchain{VK_NULL_HANDLE};
@@ -68,6 +78,11 @@ private:
     VkExtent2D _extent;
 
     bool _outOfDate{false};
+
+    // Only used by the offscreen swapchains
+    bool _offscreen{false};
+    DeviceMemory _imagesMemory;
+    uint32_t _nextImageIndex{0};
 };
 
 #include <lug/Graphics/Vulkan/API/Swapchain.inl>
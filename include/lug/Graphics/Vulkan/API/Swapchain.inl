@@ -6,6 +6,10 @@ inline bool Swapchain::isOutOfDate() const {
     return _outOfDate;
 }
 
+inline bool Swapchain::isOffscreen() const {
+    return _offscreen;
+}
+
 inline const std::vector<Image>& Swapchain::getImages() const {
     return _images;
 }
@@ -14,7 +14,7 @@ namespace Vulkan {
 namespace Builder {
 namespace Texture {
 
-Resource::SharedPtr<lug::Graphics::Render::Texture> build(const ::lug::Graphics::Builder::Texture& builder);
+Resource::SharedPtr<lug::Graphics::Render::Texture> build(::lug::Graphics::Builder::Texture& builder);
 
 } // Texture
 } // Builder
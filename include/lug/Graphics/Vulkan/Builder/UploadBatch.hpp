@@ -0,0 +1,24 @@
+#pragma once
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace Builder {
+class UploadBatch;
+} // Builder
+
+namespace Vulkan {
+namespace Builder {
+namespace UploadBatch {
+
+void init(::lug::Graphics::Builder::UploadBatch& builder);
+bool submit(::lug::Graphics::Builder::UploadBatch& builder);
+bool wait(::lug::Graphics::Builder::UploadBatch& builder);
+
+} // UploadBatch
+} // Builder
+} // Vulkan
+} // Graphics
+} // lug
@@ -18,6 +18,7 @@
 #include <lug/Graphics/Render/Texture.hpp>
 #include <lug/Graphics/Vulkan/API/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Queue.hpp>
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
 #include <lug/Graphics/Render/Window.hpp>
 #include <lug/System/Time.hpp>
 #include <lug/Math/Vector.hpp>
@@ -92,6 +93,11 @@ private:
     bool updateBuffers(uint32_t currentImageIndex);
     bool initFrameData();
 
+    /**
+     * @brief      Draws the rolling statistics of the GpuProfiler scopes in an ImGui window.
+     */
+    void drawGpuProfilerOverlay() const;
+
 private:
     lug::Graphics::Vulkan::Renderer& _renderer;
     lug::Graphics::Vulkan::Render::Window& _window;
@@ -110,6 +116,8 @@ private:
     API::GraphicsPipeline _pipeline;
 
     std::vector<FrameData> _framesData;
+
+    uint32_t _gpuProfilerScope{Render::GpuProfiler::invalidScope};
 };
 
 } // Vulkan
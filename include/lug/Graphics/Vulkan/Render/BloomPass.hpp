@@ -2,11 +2,17 @@
 
 #include <array>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/Render/Bloom.hpp>
 #include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/ComputePipeline.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Framebuffer.hpp>
@@ -15,6 +21,7 @@
 #include <lug/Graphics/Vulkan/API/ImageView.hpp>
 #include <lug/Graphics/Vulkan/API/Sampler.hpp>
 #include <lug/Graphics/Vulkan/API/Semaphore.hpp>
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
 #include <lug/Graphics/Vulkan/Render/Technique/Forward.hpp>
 
 namespace lug {
@@ -43,6 +50,19 @@ private:
         std::array<API::ImageView, 2> imagesViews;
     };
 
+    // Used instead of the blur passes with the BloomTechnique::MipChain technique
+    struct MipChain {
+        // One storage image with a mip level per step of the chain, the level 0 is half the size of the glow image
+        API::Image image;
+        std::vector<API::ImageView> imagesViews;
+        API::Sampler sampler;
+
+        // downsampleDescriptorSets[i] reads the level i - 1 (the glow image for i == 0) and writes the level i
+        // upsampleDescriptorSets[i] reads the level i + 1 and adds it to the level i
+        std::vector<API::DescriptorSet> downsampleDescriptorSets;
+        std::vector<API::DescriptorSet> upsampleDescriptorSets;
+    };
+
     struct BlendPass {
         API::Framebuffer framebuffer;
         API::Image image;
@@ -66,6 +86,7 @@ private:
         API::CommandBuffer hdrCmdBuffer;
 
         std::vector<BlurPass> blurPasses;
+        MipChain mipChain;
         BlendPass blendPass;
         HdrPass hdrPass;
         API::Fence fence;
@@ -109,9 +130,12 @@ public:
 
 private:
     bool renderBlurPass(uint32_t currentImageIndex);
+    void renderMipChain(FrameData& frameData);
     bool initHdrPipeline();
     bool initBlendPipeline();
     bool initBlurPipeline(API::GraphicsPipeline& pipeline, int blurDirection);
+    bool initMipChainPipeline(API::ComputePipeline& pipeline, const std::string& shaderFile, uint32_t pushConstantsSize);
+    bool initMipChainDescriptorSets();
     bool initPipelines();
 
 private:
@@ -122,6 +146,12 @@ private:
     const API::Queue* _transferQueue{nullptr};
     const API::Queue* _graphicsQueue{nullptr};
 
+    ::lug::Graphics::Renderer::BloomTechnique _technique{::lug::Graphics::Renderer::BloomTechnique::Blur};
+
+    uint32_t _blurScope{GpuProfiler::invalidScope};
+    uint32_t _blendScope{GpuProfiler::invalidScope};
+    uint32_t _hdrScope{GpuProfiler::invalidScope};
+
     std::vector<FrameData> _framesData;
 
     API::CommandPool _graphicsCommandPool;
@@ -134,6 +164,11 @@ private:
     API::GraphicsPipeline _blendPipeline;
     API::GraphicsPipeline _hdrPipeline;
 
+    API::ComputePipeline _downsamplePipeline;
+    API::ComputePipeline _upsamplePipeline;
+    API::DescriptorPool _mipChainDescriptorPool;
+    std::vector<::lug::Graphics::Render::Bloom::Extent> _mipChainExtents;
+
     std::unique_ptr<Render::DescriptorSetPool::BloomSampler> _texturesDescriptorSetPool;
 };
 
@@ -7,10 +7,6 @@ namespace lug {
 namespace Graphics {
 namespace Vulkan {
 
-namespace API {
-class CommandBuffer;
-} // API
-
 namespace Render {
 namespace BufferPool {
 
@@ -26,7 +22,7 @@ public:
 
     ~Bloom() = default;
 
-    const SubBuffer* allocate(const API::CommandBuffer& cmdBuffer, float blurThreshold, bool dirty);
+    const SubBuffer* allocate(float blurThreshold, bool dirty);
 };
 
 } // BufferPool
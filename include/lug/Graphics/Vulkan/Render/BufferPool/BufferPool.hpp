@@ -2,7 +2,9 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include <lug/Graphics/Vulkan/Render/BufferPool/Chunk.hpp>
 #include <lug/Graphics/Vulkan/Render/BufferPool/SubBuffer.hpp>
@@ -29,18 +31,40 @@ public:
 
     ~BufferPool() = default;
 
-    std::tuple<bool, const SubBuffer*> allocate(size_t hash, bool dirty);
     void free(const SubBuffer* buffer);
 
+    /**
+     * @brief      Collects the memory ranges written since the last flush.
+     *             The ranges of all the pools are then flushed at once with API::Device::flushMappedMemoryRanges().
+     *
+     * @param      ranges  The vector to append the ranges to.
+     */
+    void flush(std::vector<VkMappedMemoryRange>& ranges);
+
+protected:
+    /**
+     * @brief      Gets the sub buffer of the hash, or a new one to write in if it doesn't exist or is dirty.
+     *             The caller must hold _mutex until it has written in the new sub buffer,
+     *             so that another view neither uses it nor flushes its memory before.
+     */
+    std::tuple<bool, const SubBuffer*> allocate(size_t hash, bool dirty);
+
 private:
     SubBuffer* allocateNewBuffer();
 
 protected:
     Renderer& _renderer;
+
+    // The pools are shared by the render views, which render in parallel
+    std::mutex _mutex;
+
     std::set<uint32_t> _queueFamilyIndices;
 
     std::list<Chunk<subBufferPerChunk, subBufferSize>> _chunks;
     std::map<size_t, SubBuffer*> _subBuffersInUse;
+
+    // Memories of the chunks written since the last flush
+    std::set<const API::DeviceMemory*> _dirtyMemories;
 };
 
 #include <lug/Graphics/Vulkan/Render/BufferPool/BufferPool.inl>
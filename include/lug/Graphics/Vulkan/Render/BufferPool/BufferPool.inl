@@ -16,6 +16,9 @@ inline std::tuple<bool, const SubBuffer*> BufferPool<subBufferPerChunk, subBuffe
         subBuffer->setHash(hash);
         _subBuffersInUse[hash] = subBuffer;
 
+        // The caller is going to write in it
+        _dirtyMemories.insert(subBuffer->_deviceMemory);
+
         return std::make_tuple(true, subBuffer);
     }
 
@@ -29,6 +32,8 @@ inline void BufferPool<subBufferPerChunk, subBufferSize>::free(const SubBuffer*
         return;
     }
 
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const_cast<SubBuffer*>(buffer)->_referenceCount -= 1;
 
     const auto it = _subBuffersInUse.find(buffer->getHash());
@@ -37,6 +42,23 @@ inline void BufferPool<subBufferPerChunk, subBufferSize>::free(const SubBuffer*
     }
 }
 
+template <size_t subBufferPerChunk, size_t subBufferSize>
+inline void BufferPool<subBufferPerChunk, subBufferSize>::flush(std::vector<VkMappedMemoryRange>& ranges) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    for (const auto deviceMemory : _dirtyMemories) {
+        ranges.push_back({
+            /* range.sType  */ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+            /* range.pNext  */ nullptr,
+            /* range.memory */ static_cast<VkDeviceMemory>(*deviceMemory),
+            /* range.offset */ 0,
+            /* range.size   */ VK_WHOLE_SIZE
+        });
+    }
+
+    _dirtyMemories.clear();
+}
+
 template <size_t subBufferPerChunk, size_t subBufferSize>
 inline SubBuffer* BufferPool<subBufferPerChunk, subBufferSize>::allocateNewBuffer() {
     for (auto& chunk : _chunks) {
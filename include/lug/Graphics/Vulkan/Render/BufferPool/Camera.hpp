@@ -14,10 +14,6 @@ class Camera;
 
 namespace Vulkan {
 
-namespace API {
-class CommandBuffer;
-} // API
-
 namespace Render {
 namespace BufferPool {
 
@@ -33,7 +29,7 @@ public:
 
     ~Camera() = default;
 
-    const SubBuffer* allocate(const API::CommandBuffer& cmdBuffer, ::lug::Graphics::Render::Camera::Camera& camera);
+    const SubBuffer* allocate(::lug::Graphics::Render::Camera::Camera& camera);
 };
 
 } // BufferPool
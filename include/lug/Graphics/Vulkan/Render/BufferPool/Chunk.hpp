@@ -33,6 +33,9 @@ private:
     API::DeviceMemory _bufferMemory;
     API::Buffer _buffer;
 
+    // The memory stays mapped for the lifetime of the chunk
+    void* _mappedData{nullptr};
+
     std::array<SubBuffer, subBufferPerChunk> _subBuffers;
 };
 
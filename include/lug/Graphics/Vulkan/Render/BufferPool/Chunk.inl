@@ -14,7 +14,7 @@ inline bool Chunk<subBufferPerChunk, subBufferSize>::init(Renderer& renderer, st
 
         bufferBuilder.setQueueFamilyIndices(queueFamilyIndices);
         bufferBuilder.setSize(subBufferSizeAligned * (subBufferPerChunk - 1) + subBufferSize);
-        bufferBuilder.setUsage(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
 
         VkResult result{VK_SUCCESS};
         if (!bufferBuilder.build(_buffer, &result)) {
@@ -24,9 +24,11 @@ inline bool Chunk<subBufferPerChunk, subBufferSize>::init(Renderer& renderer, st
     }
 
     // Create buffer memory
+    // The sub buffers are written directly by the CPU, which is safe as a sub buffer is
+    // only reused when no frame in flight references it anymore
     {
         API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
-        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
 
         if (!deviceMemoryBuilder.addBuffer(_buffer)) {
             LUG_LOG.error("BufferPool::Chunk: Can't add buffer to device memory");
@@ -40,10 +42,19 @@ inline bool Chunk<subBufferPerChunk, subBufferSize>::init(Renderer& renderer, st
         }
     }
 
+    // Map the memory
+    _mappedData = _bufferMemory.mapBuffer(_buffer);
+    if (!_mappedData) {
+        LUG_LOG.error("BufferPool::Chunk: Can't map device memory");
+        return false;
+    }
+
     // Init subBuffers
     for (uint32_t i = 0; i < subBufferPerChunk; ++i) {
         _subBuffers[i] = SubBuffer(
             &_buffer,
+            &_bufferMemory,
+            static_cast<uint8_t*>(_mappedData) + subBufferSizeAligned * i,
             static_cast<uint32_t>(subBufferSizeAligned * i),
             static_cast<uint32_t>(subBufferSize)
         );
@@ -12,10 +12,6 @@ class Node;
 
 namespace Vulkan {
 
-namespace API {
-class CommandBuffer;
-} // API
-
 namespace Render {
 namespace BufferPool {
 
@@ -31,7 +27,7 @@ public:
 
     ~Light() = default;
 
-    const SubBuffer* allocate(uint32_t currentFrame, const API::CommandBuffer& cmdBuffer, const std::vector<::lug::Graphics::Scene::Node*> nodes);
+    const SubBuffer* allocate(uint32_t currentFrame, const std::vector<::lug::Graphics::Scene::Node*> nodes);
 };
 
 } // BufferPool
@@ -7,14 +7,10 @@ namespace lug {
 namespace Graphics {
 namespace Vulkan {
 
-namespace API {
-class CommandBuffer;
-} // API
-
 namespace Render {
 namespace BufferPool {
 
-class LUG_GRAPHICS_API Material : public BufferPool<20, sizeof(::lug::Graphics::Render::Material::Constants) * 2> {
+class LUG_GRAPHICS_API Material : public BufferPool<256, sizeof(::lug::Graphics::Render::Material::Constants) * 2> {
 public:
     Material(Renderer& renderer);
 
@@ -26,7 +22,7 @@ public:
 
     ~Material() = default;
 
-    const SubBuffer* allocate(const API::CommandBuffer& cmdBuffer, ::lug::Graphics::Render::Material& material);
+    const SubBuffer* allocate(::lug::Graphics::Render::Material& material);
 };
 
 } // BufferPool
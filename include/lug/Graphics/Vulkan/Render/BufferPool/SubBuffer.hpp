@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 #include <lug/Graphics/Export.hpp>
 
@@ -11,6 +12,7 @@ namespace Vulkan {
 
 namespace API {
 class Buffer;
+class DeviceMemory;
 } // API
 
 namespace Render {
@@ -31,7 +33,7 @@ class LUG_GRAPHICS_API SubBuffer {
 
 public:
     SubBuffer() = default;
-    SubBuffer(const API::Buffer* buffer, uint32_t offset, uint32_t size);
+    SubBuffer(const API::Buffer* buffer, const API::DeviceMemory* deviceMemory, void* data, uint32_t offset, uint32_t size);
 
     SubBuffer(const SubBuffer&) = delete;
     SubBuffer(SubBuffer&&) = default;
@@ -45,11 +47,26 @@ public:
     uint32_t getOffset() const;
     uint32_t getSize() const;
 
+    /**
+     * @brief      Writes directly in the persistently mapped memory of the sub buffer.
+     *             The memory needs to be flushed before being used by the device, see BufferPool::flush().
+     *
+     * @param[in]  data    The data to write.
+     * @param[in]  size    The size of the data, in bytes.
+     * @param[in]  offset  The offset from the beginning of the sub buffer, in bytes.
+     */
+    void update(const void* data, uint32_t size, uint32_t offset = 0) const;
+
     size_t getHash() const;
     void setHash(size_t hash);
 
 private:
     const API::Buffer* _buffer{nullptr};
+    const API::DeviceMemory* _deviceMemory{nullptr};
+
+    // Mapped memory of the sub buffer, at _offset in _buffer
+    void* _data{nullptr};
+
     uint32_t _offset{0};
     uint32_t _size{0};
 
@@ -1,4 +1,5 @@
-inline SubBuffer::SubBuffer(const API::Buffer* buffer, uint32_t offset, uint32_t size) : _buffer(buffer), _offset(offset), _size(size) {}
+inline SubBuffer::SubBuffer(const API::Buffer* buffer, const API::DeviceMemory* deviceMemory, void* data, uint32_t offset, uint32_t size)
+    : _buffer(buffer), _deviceMemory(deviceMemory), _data(data), _offset(offset), _size(size) {}
 
 inline const API::Buffer* SubBuffer::getBuffer() const {
     return _buffer;
@@ -12,6 +13,10 @@ inline uint32_t SubBuffer::getSize() const {
     return _size;
 }
 
+inline void SubBuffer::update(const void* data, uint32_t size, uint32_t offset) const {
+    std::memcpy(static_cast<uint8_t*>(_data) + offset, data, size);
+}
+
 inline size_t SubBuffer::getHash() const {
     return _hash;
 }
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_set>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSetLayout.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+} // API
+
+namespace Render {
+namespace DescriptorSetPool {
+
+/**
+ * @brief      Chain of descriptor pools which grows when the current pools are exhausted,
+ *             so the number of descriptor sets is not limited by an arbitrary pool size.
+ *             The chain is shared by the descriptor set pools of all the views, it can be used from several threads.
+ */
+class LUG_GRAPHICS_API DescriptorPoolChain {
+public:
+    // Size of each pool of the chain, per descriptor set
+    static constexpr uint32_t setsPerPool = 64;
+    static constexpr uint32_t uniformBuffersPerSet = 2;
+    static constexpr uint32_t combinedImageSamplersPerSet = 8;
+
+    /**
+     * @brief      The Vulkan calls of the chain, replaced by the tests to run without a device.
+     */
+    struct Backend {
+        std::function<bool(const API::Device& device, API::DescriptorPool& descriptorPool, VkResult* result)> createPool;
+        std::function<bool(
+            const API::Device& device,
+            const API::DescriptorPool& descriptorPool,
+            const API::DescriptorSetLayout& descriptorSetLayout,
+            API::DescriptorSet& descriptorSet,
+            VkResult* result
+        )> allocateSet;
+        std::function<void(const API::Device& device, const API::DescriptorPool& descriptorPool, API::DescriptorSet& descriptorSet)> freeSet;
+    };
+
+public:
+    DescriptorPoolChain();
+    explicit DescriptorPoolChain(Backend backend);
+
+    DescriptorPoolChain(const DescriptorPoolChain&) = delete;
+    DescriptorPoolChain(DescriptorPoolChain&&) = delete;
+
+    DescriptorPoolChain& operator=(const DescriptorPoolChain&) = delete;
+    DescriptorPoolChain& operator=(DescriptorPoolChain&&) = delete;
+
+    ~DescriptorPoolChain() = default;
+
+    /**
+     * @brief      Creates the first pool of the chain, if it doesn't exist yet.
+     *
+     * @param[in]  device  The device.
+     *
+     * @return     False if the pool can't be created.
+     */
+    bool init(const API::Device& device);
+
+    /**
+     * @brief      Allocates a descriptor set, creating a new pool if all the pools of the chain are full.
+     *
+     * @param[in]  device               The device.
+     * @param[in]  descriptorSetLayout  The layout of the descriptor set.
+     * @param[out] descriptorSet        The allocated descriptor set.
+     * @param[out] descriptorPool       The pool the descriptor set was allocated from, needed to free it.
+     *
+     * @return     True if the descriptor set was allocated.
+     */
+    bool allocate(
+        const API::Device& device,
+        const API::DescriptorSetLayout& descriptorSetLayout,
+        API::DescriptorSet& descriptorSet,
+        const API::DescriptorPool*& descriptorPool
+    );
+
+    /**
+     * @brief      Frees a single descriptor set.
+     *
+     * @param[in]  device          The device.
+     * @param[in]  descriptorPool  The pool the descriptor set was allocated from.
+     * @param      descriptorSet   The descriptor set.
+     */
+    void free(const API::Device& device, const API::DescriptorPool& descriptorPool, API::DescriptorSet& descriptorSet);
+
+    void destroy();
+
+    bool empty() const;
+
+    uint32_t getPoolsCount() const;
+
+private:
+    API::DescriptorPool* addPool(const API::Device& device);
+
+    static Backend getVulkanBackend();
+
+private:
+    Backend _backend;
+
+    // Locked for the whole allocation, so two views can't both grow the chain
+    mutable std::mutex _mutex;
+
+    // std::list because a DescriptorPool must not be moved once sets are allocated from it
+    std::list<API::DescriptorPool> _descriptorPools;
+
+    // The last pool a set was allocated from, the first one tried for the next allocation
+    API::DescriptorPool* _currentDescriptorPool{nullptr};
+
+    // The pools which failed an allocation, not tried again until a set is freed from them
+    std::unordered_set<const API::DescriptorPool*> _fullDescriptorPools;
+};
+
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorPoolChain.inl>
+
+} // DescriptorSetPool
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
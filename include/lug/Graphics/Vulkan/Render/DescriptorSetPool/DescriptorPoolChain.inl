@@ -0,0 +1,9 @@
+inline bool DescriptorPoolChain::empty() const {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+    return _descriptorPools.empty();
+}
+
+inline uint32_t DescriptorPoolChain::getPoolsCount() const {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+    return static_cast<uint32_t>(_descriptorPools.size());
+}
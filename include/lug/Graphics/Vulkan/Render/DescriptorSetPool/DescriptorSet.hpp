@@ -1,5 +1,6 @@
 #pragma once
 
+#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
 
 namespace lug {
@@ -8,11 +9,9 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-template <size_t maxSets>
 class DescriptorSetPool;
 
 class LUG_GRAPHICS_API DescriptorSet {
-    template <size_t maxSets>
     friend class DescriptorSetPool;
 
 public:
@@ -35,6 +34,9 @@ public:
 private:
     API::DescriptorSet _descriptorSet;
 
+    // The pool of the chain the descriptor set was allocated from
+    const API::DescriptorPool* _descriptorPool{nullptr};
+
     size_t _hash{0};
     uint32_t _referenceCount{0};
 };
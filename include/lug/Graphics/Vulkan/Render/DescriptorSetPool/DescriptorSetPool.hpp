@@ -1,11 +1,13 @@
 #pragma once
 
+#include <list>
 #include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
 
-#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
-#include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
-#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/DescriptorSetLayout.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorPoolChain.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
@@ -19,11 +21,23 @@ namespace Render {
 namespace DescriptorSetPool {
 
 // TODO: Use another method than a global (same for reference counting)
-extern API::DescriptorPool descriptorPool;
+extern DescriptorPoolChain descriptorPoolChain;
 extern uint32_t poolCount;
 
-template <size_t maxSets>
+/**
+ * @brief      Allocates the descriptor sets from the shared descriptor pool chain.
+ *             The descriptor sets are cached by the hash of their content, so identical
+ *             bindings share the same descriptor set as long as it is in use, across frames.
+ */
 class LUG_GRAPHICS_API DescriptorSetPool {
+public:
+    struct Statistics {
+        uint32_t allocations{0};    // Descriptor sets allocated from the pool chain
+        uint32_t cacheHits{0};      // Requests served by a descriptor set already in use
+        uint32_t cacheMisses{0};    // Requests which needed a new descriptor set
+        uint32_t poolsCount{0};     // Pools of the chain at the end of the frame
+    };
+
 public:
     DescriptorSetPool(Renderer& renderer);
 
@@ -37,22 +51,43 @@ public:
 
     bool init();
 
-    std::tuple<bool, const DescriptorSet*> allocate(size_t hash, const API::DescriptorSetLayout& descriptorSetLayout);
     void free(const DescriptorSet* descriptorSet);
 
+    /**
+     * @brief      Returns the counters of all the pools during the previous frame, shown by the GPU profiler overlay.
+     */
+    static const Statistics& getStatistics();
+
+    /**
+     * @brief      Ends the counting of the previous frame, called by Render::Window::beginFrame before the views render.
+     */
+    static void newFrame();
+
+protected:
+    /**
+     * @brief      Gets the descriptor set of the hash, or a new one to update if it isn't in use.
+     *             The caller must hold _mutex until it has updated the new descriptor set,
+     *             otherwise another view could bind it before.
+     */
+    std::tuple<bool, const DescriptorSet*> allocate(size_t hash, const API::DescriptorSetLayout& descriptorSetLayout);
+
 private:
     DescriptorSet* allocateNewDescriptorSet(const API::DescriptorSetLayout& descriptorSetLayout);
 
 protected:
     Renderer& _renderer;
 
-    size_t _descriptorSetsCount{0};
-    std::array<DescriptorSet, maxSets> _descriptorSets;
+    // The pools are static members of the techniques, used by all the views at once
+    std::mutex _mutex;
 
-    size_t _freeDescriptorSetsCount{0};
-    std::array<DescriptorSet*, maxSets> _freeDescriptorSets;
+    // std::list because the descriptor sets are referenced by pointer
+    std::list<DescriptorSet> _descriptorSets;
+    std::vector<DescriptorSet*> _freeDescriptorSets;
 
     std::map<size_t, DescriptorSet*> _descriptorSetsInUse;
+
+private:
+    static Statistics _previousFrameStatistics;
 };
 
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.inl>
@@ -9,7 +9,7 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API Material : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API Material : public DescriptorSetPool {
 public:
     Material(Renderer& renderer);
 
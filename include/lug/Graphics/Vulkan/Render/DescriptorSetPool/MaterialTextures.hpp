@@ -10,7 +10,7 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API MaterialTextures : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API MaterialTextures : public DescriptorSetPool {
 public:
     MaterialTextures(Renderer& renderer);
 
@@ -10,7 +10,7 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API SkyBox : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API SkyBox : public DescriptorSetPool {
 public:
     SkyBox(Renderer& renderer);
 
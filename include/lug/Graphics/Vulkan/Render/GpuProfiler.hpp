@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
+#include <lug/Graphics/Vulkan/API/QueryPool.hpp>
+#include <lug/Graphics/Vulkan/Vulkan.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+} // API
+
+namespace Render {
+
+/**
+ * @brief      GPU profiler based on timestamp queries, and optionally on pipeline statistics queries.
+ *
+ *             The passes register their named scopes once with #addScope, then surround their commands
+ *             with #begin and #end (or a GpuProfiler::Scope) each frame. Each frame, i.e. each swapchain image,
+ *             has its own queries, which are reset at the beginning of the frame by the window.
+ *             The results of a frame are read without waiting by #resolve when the frame is used again,
+ *             so they are available with (at least) one frame of latency.
+ */
+class LUG_GRAPHICS_API GpuProfiler {
+public:
+    static constexpr uint32_t maxScopesCount = 32;
+    static constexpr uint32_t invalidScope = ~0u;
+
+    // Number of frames used for the rolling statistics of each scope
+    static constexpr uint32_t historySize = 128;
+
+    static constexpr VkQueryPipelineStatisticFlags pipelineStatisticsFlags =
+        VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+
+    /**
+     * @brief      Statistics of the GPU times of a scope, in milliseconds.
+     */
+    struct Statistics {
+        float average;
+        float p50;
+        float p90;
+        float p99;
+        float max;
+        uint32_t samplesCount;
+    };
+
+    /**
+     * @brief      Writes the beginning of a scope on construction and its end on destruction.
+     */
+    class Scope {
+    public:
+        Scope(const GpuProfiler& profiler, const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics = false);
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        ~Scope();
+
+    private:
+        const GpuProfiler& _profiler;
+        const API::CommandBuffer& _cmdBuffer;
+        uint32_t _scope;
+        uint32_t _frameIndex;
+        bool _pipelineStatistics;
+    };
+
+private:
+    struct ScopeData {
+        std::string name;
+        std::vector<float> history;
+        uint32_t historyIndex{0};
+        float lastTime{0.0f};
+        std::vector<uint64_t> pipelineStatistics;
+    };
+
+public:
+    GpuProfiler() = default;
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler(GpuProfiler&&) = delete;
+
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+    ~GpuProfiler() = default;
+
+    /**
+     * @brief      Creates the query pools.
+     *             The profiler stays disabled, without error, if the queue family doesn't support timestamps.
+     *
+     * @param[in]  device              The device.
+     * @param[in]  physicalDeviceInfo  The physical device info of the device.
+     * @param[in]  queueFamilyIdx      The index of the queue family the scopes are recorded for.
+     * @param[in]  framesCount         The number of frames.
+     * @param[in]  pipelineStatistics  Also create the pipeline statistics queries. The device must have been created
+     *                                 with the pipelineStatisticsQuery feature.
+     *
+     * @return     False if the query pools can't be created.
+     */
+    bool init(const API::Device& device, const PhysicalDeviceInfo& physicalDeviceInfo, uint32_t queueFamilyIdx, uint32_t framesCount, bool pipelineStatistics);
+    void destroy();
+
+    bool isEnabled() const;
+    bool hasPipelineStatistics() const;
+
+    /**
+     * @brief      Registers a scope.
+     *
+     * @param[in]  name  The name of the scope, several scopes can have the same name.
+     *
+     * @return     The index of the scope, invalidScope if the profiler is disabled or full.
+     */
+    uint32_t addScope(const std::string& name);
+
+    /**
+     * @brief      Records the reset of all the queries of a frame.
+     *             Must be recorded outside of a render pass, before the scopes of the frame.
+     */
+    void reset(const API::CommandBuffer& cmdBuffer, uint32_t frameIndex) const;
+
+    /**
+     * @brief      Records the beginning of a scope. Does nothing for invalidScope.
+     *
+     * @param[in]  cmdBuffer           The command buffer.
+     * @param[in]  scope               The scope.
+     * @param[in]  frameIndex          The index of the frame.
+     * @param[in]  pipelineStatistics  Also count the pipeline statistics, if enabled. The pipeline statistics
+     *                                 scopes can't be nested and must begin and end in the same command buffer.
+     */
+    void begin(const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics = false) const;
+
+    /**
+     * @brief      Records the end of a scope, with the same parameters as #begin.
+     */
+    void end(const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics = false) const;
+
+    /**
+     * @brief      Indicates that the queries of a frame have been reset and submitted, so that they can be read.
+     */
+    void markSubmitted(uint32_t frameIndex);
+
+    /**
+     * @brief      Reads the results of the previous submission of a frame, without waiting.
+     *             Must be called before the queries of the frame are reset again.
+     */
+    void resolve(uint32_t frameIndex);
+
+    uint32_t getScopesCount() const;
+    const std::string& getScopeName(uint32_t scope) const;
+
+    /**
+     * @brief      Gets the most recent GPU time of a scope.
+     *
+     * @return     The time in milliseconds, 0 if it's not available.
+     */
+    float getLastTime(uint32_t scope) const;
+
+    /**
+     * @brief      Gets the statistics of the last historySize GPU times of a scope.
+     */
+    Statistics getStatistics(uint32_t scope) const;
+
+    /**
+     * @brief      Gets the most recent pipeline statistics of a scope, one value per bit of pipelineStatisticsFlags,
+     *             in the order of the bits. Empty if the scope doesn't count them.
+     */
+    const std::vector<uint64_t>& getPipelineStatistics(uint32_t scope) const;
+
+    /**
+     * @brief      Gets the names of the pipeline statistics, in the order of getPipelineStatistics.
+     */
+    static const std::vector<std::string>& getPipelineStatisticsNames();
+
+    /**
+     * @brief      Computes the average and the (nearest-rank) percentiles of samples.
+     *
+     * @param[in]  samples  The samples, in any order.
+     *
+     * @return     The statistics, all zeros if there is no sample.
+     */
+    static Statistics computeStatistics(std::vector<float> samples);
+
+private:
+    std::vector<ScopeData> _scopes;
+    std::vector<bool> _submittedFrames;
+
+    API::QueryPool _timestampsQueryPool{};
+    API::QueryPool _pipelineStatisticsQueryPool{};
+
+    float _timestampPeriod{0.0f};   // Nanoseconds per timestamp tick
+    uint64_t _timestampMask{0};
+};
+
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
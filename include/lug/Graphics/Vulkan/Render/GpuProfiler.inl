@@ -0,0 +1,32 @@
+inline GpuProfiler::Scope::Scope(const GpuProfiler& profiler, const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics) :
+    _profiler(profiler), _cmdBuffer(cmdBuffer), _scope(scope), _frameIndex(frameIndex), _pipelineStatistics(pipelineStatistics) {
+    _profiler.begin(_cmdBuffer, _scope, _frameIndex, _pipelineStatistics);
+}
+
+inline GpuProfiler::Scope::~Scope() {
+    _profiler.end(_cmdBuffer, _scope, _frameIndex, _pipelineStatistics);
+}
+
+inline bool GpuProfiler::isEnabled() const {
+    return static_cast<VkQueryPool>(_timestampsQueryPool) != VK_NULL_HANDLE;
+}
+
+inline bool GpuProfiler::hasPipelineStatistics() const {
+    return static_cast<VkQueryPool>(_pipelineStatisticsQueryPool) != VK_NULL_HANDLE;
+}
+
+inline uint32_t GpuProfiler::getScopesCount() const {
+    return static_cast<uint32_t>(_scopes.size());
+}
+
+inline const std::string& GpuProfiler::getScopeName(uint32_t scope) const {
+    return _scopes[scope].name;
+}
+
+inline float GpuProfiler::getLastTime(uint32_t scope) const {
+    return scope < _scopes.size() ? _scopes[scope].lastTime : 0.0f;
+}
+
+inline const std::vector<uint64_t>& GpuProfiler::getPipelineStatistics(uint32_t scope) const {
+    return _scopes[scope].pipelineStatistics;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+#include <lug/Math/Matrix.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace Scene {
+class Node;
+} // Scene
+
+namespace Vulkan {
+
+class Renderer;
+
+namespace Render {
+
+/**
+ * @brief      Per-frame vertex buffer containing the model transforms of the instanced draws.
+ *             The memory is host visible and stays mapped, the transforms are written directly
+ *             by the CPU once the frame using the buffer is finished.
+ */
+class LUG_GRAPHICS_API InstanceBuffer {
+public:
+    InstanceBuffer() = default;
+
+    InstanceBuffer(const InstanceBuffer&) = delete;
+    InstanceBuffer(InstanceBuffer&&) = default;
+
+    InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+    InstanceBuffer& operator=(InstanceBuffer&&) = default;
+
+    ~InstanceBuffer() = default;
+
+    /**
+     * @brief      Writes the model transforms of the instances, growing the buffer if needed.
+     *             The buffer must not be in use by the device.
+     *
+     * @param      renderer   The renderer.
+     * @param[in]  instances  The nodes of the instances.
+     *
+     * @return     False if the buffer can't be grown.
+     */
+    bool update(Renderer& renderer, const std::vector<Scene::Node*>& instances);
+
+    /**
+     * @brief      Adds the range written by the last update, if any.
+     *
+     * @param      ranges  The ranges to flush.
+     */
+    void flush(std::vector<VkMappedMemoryRange>& ranges);
+
+    const API::Buffer& getBuffer() const;
+
+    void destroy();
+
+private:
+    bool reserve(Renderer& renderer, uint32_t instancesCount);
+
+private:
+    API::DeviceMemory _bufferMemory;
+    API::Buffer _buffer;
+
+    Math::Mat4x4f* _mappedData{nullptr};
+    uint32_t _capacity{0};
+
+    bool _dirty{false};
+};
+
+#include <lug/Graphics/Vulkan/Render/InstanceBuffer.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
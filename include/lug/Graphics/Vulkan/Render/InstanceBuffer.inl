@@ -0,0 +1,3 @@
+inline const API::Buffer& InstanceBuffer::getBuffer() const {
+    return _buffer;
+}
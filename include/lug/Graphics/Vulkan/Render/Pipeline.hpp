@@ -376,9 +376,35 @@ public:
         ~ShaderBuilder() = delete;
 
     public:
+        /**
+         * @brief      Builds the shader of a pipeline.
+         *             The shader is taken from the precompiled archive of the technique if it
+         *             contains it (see ShaderArchive), otherwise it is compiled from the sources.
+         */
         static std::vector<uint32_t> buildShader(std::string shaderRoot, ::lug::Graphics::Render::Technique::Type technique, Type type, Pipeline::Id id);
         static std::vector<uint32_t> buildShaderFromFile(std::string filename, Type type, Pipeline::Id id);
         static std::vector<uint32_t> buildShaderFromString(std::string filename, std::string content, Type type, Pipeline::Id id);
+
+        /**
+         * @brief      Returns the filename of the precompiled shaders archive of a technique.
+         */
+        static std::string getArchiveFilename(std::string shaderRoot, ::lug::Graphics::Render::Technique::Type technique);
+
+        /**
+         * @brief      Enumerates the ids of the model pipelines with different shaders.
+         *             The positions and normals are always present, as they are required by the techniques.
+         *
+         * @param[in]  maxTexCoords  The maximum number of texture coordinates (at most 3).
+         * @param[in]  maxColors     The maximum number of colors (at most 3).
+         * @param[in]  displayModes  The display modes to enumerate.
+         *
+         * @return     The ids.
+         */
+        static std::vector<Pipeline::Id> getModelPermutations(
+            uint8_t maxTexCoords,
+            uint8_t maxColors,
+            const std::vector<::lug::Graphics::Renderer::DisplayMode>& displayModes
+        );
     };
 
 public:
@@ -405,6 +431,26 @@ public:
     static Id getPrefilteredMapBaseId();
     static Id getBrdfLutBaseId();
 
+    /**
+     * @brief      Returns the id of an untextured model pipeline compatible with the vertex layout of another one.
+     *             It can be used to draw a primitive set while its own pipeline is compiling.
+     *
+     * @param[in]  id    The id of a model pipeline.
+     *
+     * @return     The fallback id.
+     */
+    static Id getModelFallbackId(Id id);
+
+    /**
+     * @brief      Returns the id of the model pipeline drawing several instances of a primitive set at once,
+     *             reading the model transforms from a per-instance vertex buffer.
+     *
+     * @param[in]  id    The id of a model pipeline.
+     *
+     * @return     The instanced id.
+     */
+    static Id getModelInstancedId(Id id);
+
     const API::GraphicsPipeline& getPipelineAPI();
 
     static Resource::SharedPtr<Pipeline> create(Renderer& renderer, Id id);
@@ -21,6 +21,7 @@ inline Pipeline::Id Pipeline::getModelBaseId() {
     Pipeline::Id::Model::ExtraPart extraPart;
     extraPart.displayMode = 0;
     extraPart.antialiasing = 0;
+    extraPart.instanced = 0;
     extraPart.irradianceMapInfo = 0; // No texture
     extraPart.prefilteredMapInfo = 0; // No texture
 
@@ -46,6 +47,26 @@ inline Pipeline::Id Pipeline::getBrdfLutBaseId() {
     return Pipeline::Id::createBrdfLut();
 }
 
+inline Pipeline::Id Pipeline::getModelFallbackId(Id id) {
+    Pipeline::Id::Model::MaterialPart materialPart;
+    materialPart.baseColorInfo = 0b11; // No texture
+    materialPart.metallicRoughnessInfo = 0b11; // No texture
+    materialPart.normalInfo = 0b11; // No texture
+    materialPart.occlusionInfo = 0b11; // No texture
+    materialPart.emissiveInfo = 0b11; // No texture
+
+    Pipeline::Id::Model::ExtraPart extraPart = id.getModelExtraPart();
+    extraPart.irradianceMapInfo = 0; // No texture
+    extraPart.prefilteredMapInfo = 0; // No texture
+
+    return Pipeline::Id::createModel(id.getModelPrimitivePart(), materialPart, extraPart);
+}
+
+inline Pipeline::Id Pipeline::getModelInstancedId(Id id) {
+    id.modelInfo.instanced = 1;
+    return id;
+}
+
 inline const API::GraphicsPipeline& Pipeline::getPipelineAPI() {
     return _pipeline;
 }
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+#include <lug/System/ThreadPool.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+/**
+ * @brief      Compiles the pipelines in background threads.
+ *             The compiled pipelines are registered in the renderer as soon as they are ready,
+ *             so a frame never has to wait on shaderc or vkCreateGraphicsPipelines.
+ */
+class LUG_GRAPHICS_API PipelineCompiler {
+public:
+    /**
+     * @brief      What to do with a draw whose pipeline is still compiling.
+     */
+    enum class Fallback : uint8_t {
+        Skip,   // Don't draw the primitive set until its pipeline is ready
+        Base    // Draw the primitive set with an untextured pipeline compatible with its vertex layout
+    };
+
+    struct Statistics {
+        // Bucket 0 counts the compilations under 1ms, bucket i the ones in [2^(i-1), 2^i[ ms
+        // and the last bucket everything above
+        static constexpr uint32_t latencyBucketsCount = 12;
+
+        uint32_t requested{0};
+        uint32_t compiled{0};
+        uint32_t failed{0};
+
+        // In microseconds
+        int64_t totalLatency{0};
+        int64_t maxLatency{0};
+        std::array<uint32_t, latencyBucketsCount> latencyHistogram{};
+    };
+
+    /**
+     * @brief      Creates the pipeline of an id and registers it, called from the compilation threads
+     *             and from the threads of #compile. Returns false if the pipeline can't be created.
+     */
+    using Factory = std::function<bool(Pipeline::Id)>;
+
+public:
+    /**
+     * @brief      Constructs the compiler.
+     *
+     * @param[in]  factory      The function creating the pipelines, see Renderer::init.
+     * @param[in]  workerCount  The number of compilation threads, 0 for the hardware concurrency.
+     */
+    PipelineCompiler(Factory factory, uint8_t workerCount = 0);
+
+    PipelineCompiler(const PipelineCompiler&) = delete;
+    PipelineCompiler(PipelineCompiler&&) = delete;
+
+    PipelineCompiler& operator=(const PipelineCompiler&) = delete;
+    PipelineCompiler& operator=(PipelineCompiler&&) = delete;
+
+    /**
+     * @brief      Waits for all the requested compilations before returning.
+     */
+    ~PipelineCompiler();
+
+    /**
+     * @brief      Requests the compilation of a pipeline.
+     *             Does nothing if the pipeline is already compiling or failed to compile before.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     False if the pipeline previously failed to compile, true otherwise.
+     */
+    bool request(Pipeline::Id id);
+
+    /**
+     * @brief      Requests the compilation of a list of pipelines, typically at load time,
+     *             to avoid compiling them during the first frames.
+     *             The pipelines already created should be filtered out by the caller.
+     *
+     * @param[in]  ids   The ids of the pipelines.
+     */
+    void prewarm(const std::vector<Pipeline::Id>& ids);
+
+    /**
+     * @brief      Compiles a pipeline on the calling thread, or waits for its compilation
+     *             if it is already in flight, so it is never compiled twice at the same time.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     False if the pipeline can't be compiled.
+     */
+    bool compile(Pipeline::Id id);
+
+    bool isPending(Pipeline::Id id) const;
+
+    /**
+     * @brief      Blocks until the compilation of a pipeline is finished.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     False if the pipeline was not being compiled.
+     */
+    bool wait(Pipeline::Id id);
+
+    /**
+     * @brief      Blocks until all the requested compilations are finished.
+     */
+    void waitIdle();
+
+    Statistics getStatistics() const;
+
+    /**
+     * @brief      Returns the bucket of Statistics::latencyHistogram counting a compilation.
+     *
+     * @param[in]  latency  The duration of the compilation, in microseconds.
+     */
+    static uint32_t getLatencyBucket(int64_t latency);
+
+private:
+    void compile(Pipeline::Id id, std::promise<bool>& promise);
+
+private:
+    Factory _factory;
+
+    // The result of each compilation in flight, to wait for it instead of starting another one
+    std::unordered_map<Pipeline::Id, std::shared_future<bool>> _pending;
+    std::unordered_set<Pipeline::Id> _failed;
+    Statistics _statistics;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+
+    // Last so the workers are joined before the rest of the members are destroyed
+    std::unique_ptr<System::ThreadPool> _threadPool;
+};
+
+#include <lug/Graphics/Vulkan/Render/PipelineCompiler.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,9 @@
+inline bool PipelineCompiler::isPending(Pipeline::Id id) const {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+    return _pending.find(id) != _pending.end();
+}
+
+inline PipelineCompiler::Statistics PipelineCompiler::getStatistics() const {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+    return _statistics;
+}
@@ -35,13 +35,15 @@
 /*
     displayMode         ///< Corresponding to the value in Renderer::DisplayMode.
     antialiasing        ///< Corresponding to the value in Renderer::Antialiasing.
+    instanced           ///< 1 the model transform is a per-instance vertex attribute, 0 it is a push constant.
     irradianceMapInfo   ///< 1 texture, 0 no texture.
     prefilteredMapInfo  ///< 1 texture, 0 no texture
 */
 
 #define LUG_PIPELINE_ID_MODEL_EXTRA_PART(macro) \
     macro(displayMode, 3)                       \
-    macro(antialiasing, 4)                      \
+    macro(antialiasing, 3)                      \
+    macro(instanced, 1)                         \
     macro(irradianceMapInfo, 1)                 \
     macro(prefilteredMapInfo, 1)
 
@@ -22,6 +22,16 @@ public:
         Render::Material* material;
     };
 
+    /**
+     * @brief      Instances of the same primitive set with the same material, drawn with one instanced draw.
+     */
+    struct PrimitiveSetBatch {
+        const Render::Mesh::PrimitiveSet* primitiveSet;
+        Render::Material* material;
+        uint32_t firstInstance;     // Index of the first node in getInstances()
+        uint32_t instancesCount;
+    };
+
 public:
     Queue() = default;
 
@@ -38,9 +48,34 @@ public:
     void addSkyBox(Resource::SharedPtr<::lug::Graphics::Render::SkyBox> skyBox) override final;
     void clear() override final;
 
-    const std::map<Render::Pipeline::Id, std::vector<PrimitiveSetInstance>> getPrimitiveSets() const;
-
-    const std::vector<Scene::Node*> getLights() const;
+    /**
+     * @brief      Adds a primitive set to draw with the pipeline pipelineId, called by #addMeshInstance for each primitive set of the mesh.
+     */
+    void addPrimitiveSetInstance(Pipeline::Id pipelineId, const PrimitiveSetInstance& primitiveSetInstance);
+
+    /**
+     * @brief      Moves the primitive sets which are drawn several times with the same material
+     *             from the primitive sets to the batches, so they can be drawn with one instanced draw.
+     *             The instances of a batch keep the order in which they were added.
+     *
+     * @param[in]  minInstancesCount  The minimum number of instances to make a batch.
+     */
+    void groupInstances(uint32_t minInstancesCount);
+
+    const std::map<Render::Pipeline::Id, std::vector<PrimitiveSetInstance>>& getPrimitiveSets() const;
+
+    /**
+     * @brief      Returns the batches, by instanced pipeline id.
+     */
+    const std::map<Render::Pipeline::Id, std::vector<PrimitiveSetBatch>>& getPrimitiveSetBatches() const;
+
+    /**
+     * @brief      Returns the nodes of all the batches. The nodes of a batch are contiguous,
+     *             in the same order as the model transforms in the instance buffer.
+     */
+    const std::vector<Scene::Node*>& getInstances() const;
+
+    const std::vector<Scene::Node*>& getLights() const;
     std::size_t getLightsCount() const;
 
     const Resource::SharedPtr<Render::SkyBox> getSkyBox() const;
@@ -50,6 +85,9 @@ private:
     // TODO: Also sort by material ?
     std::map<Render::Pipeline::Id, std::vector<PrimitiveSetInstance>> _primitiveSets;
 
+    std::map<Render::Pipeline::Id, std::vector<PrimitiveSetBatch>> _primitiveSetBatches;
+    std::vector<Scene::Node*> _instances;
+
     std::vector<Scene::Node*> _lights{50};
     std::size_t _lightsCount{0};
 
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+/**
+ * @brief      Packed archive of precompiled SPIR-V shaders, indexed by pipeline id.
+ *             It is generated offline by the shaders compiler tool and used by
+ *             Pipeline::ShaderBuilder to avoid compiling the shaders at runtime.
+ *
+ *             File layout (all the fields are little-endian uint32_t):
+ *              - Header: magic, version, entries count, blobs count
+ *              - Entries, sorted by key then type: key, type, blob index
+ *              - Blobs: offset (in words, from the start of the data), size (in words)
+ *              - Data: the SPIR-V words of the blobs. Identical shaders are only stored once.
+ */
+class LUG_GRAPHICS_API ShaderArchive {
+public:
+    static constexpr uint32_t magic = 0x5241534C; // "LSAR"
+    static constexpr uint32_t version = 1;
+
+private:
+    struct Entry {
+        uint32_t key;
+        uint32_t type;
+        uint32_t blobIndex;
+    };
+
+    struct Blob {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+public:
+    ShaderArchive() = default;
+
+    ShaderArchive(const ShaderArchive&) = delete;
+    ShaderArchive(ShaderArchive&&) = default;
+
+    ShaderArchive& operator=(const ShaderArchive&) = delete;
+    ShaderArchive& operator=(ShaderArchive&&) = default;
+
+    ~ShaderArchive() = default;
+
+    /**
+     * @brief      Loads an archive from a file, replacing the current content.
+     *
+     * @param[in]  filename  The filename of the archive.
+     *
+     * @return     False if the file can't be read or is not a valid archive.
+     */
+    bool load(const std::string& filename);
+
+    /**
+     * @brief      Writes the archive to a file.
+     *
+     * @param[in]  filename  The filename of the archive.
+     *
+     * @return     False if the file can't be written.
+     */
+    bool save(const std::string& filename) const;
+
+    /**
+     * @brief      Adds a compiled shader to the archive.
+     *             Replaces the previous shader of the same key and type, if any.
+     *
+     * @param[in]  id     The id of the pipeline the shader was compiled for.
+     * @param[in]  type   The type of the shader.
+     * @param[in]  spirv  The SPIR-V code.
+     */
+    void add(Pipeline::Id id, Pipeline::ShaderBuilder::Type type, const std::vector<uint32_t>& spirv);
+
+    /**
+     * @brief      Looks for a shader in the archive.
+     *
+     * @param[in]  id     The id of the pipeline.
+     * @param[in]  type   The type of the shader.
+     * @param[out] spirv  The SPIR-V code, if found.
+     *
+     * @return     True if the shader was found.
+     */
+    bool find(Pipeline::Id id, Pipeline::ShaderBuilder::Type type, std::vector<uint32_t>& spirv) const;
+
+    uint32_t getEntriesCount() const;
+    uint32_t getBlobsCount() const;
+
+    /**
+     * @brief      Returns the key of a pipeline id in the archive.
+     *             Only the parts of the id that change the shaders are kept, so all the pipelines
+     *             which only differ by their primitive mode or antialiasing share the same shaders.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     The key.
+     */
+    static uint32_t getKey(Pipeline::Id id);
+
+private:
+    std::vector<Entry> _entries;
+    std::vector<Blob> _blobs;
+    std::vector<uint32_t> _data;
+};
+
+#include <lug/Graphics/Vulkan/Render/ShaderArchive.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
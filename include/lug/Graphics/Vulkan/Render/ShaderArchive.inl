@@ -0,0 +1,16 @@
+inline uint32_t ShaderArchive::getEntriesCount() const {
+    return static_cast<uint32_t>(_entries.size());
+}
+
+inline uint32_t ShaderArchive::getBlobsCount() const {
+    return static_cast<uint32_t>(_blobs.size());
+}
+
+inline uint32_t ShaderArchive::getKey(Pipeline::Id id) {
+    if (id.getType() == Pipeline::Type::Model) {
+        id.modelInfo.primitiveMode = 0;
+        id.modelInfo.antialiasing = 0;
+    }
+
+    return id.value;
+}
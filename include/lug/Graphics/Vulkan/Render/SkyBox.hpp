@@ -15,6 +15,9 @@ namespace Graphics {
 class Renderer;
 
 namespace Vulkan {
+
+class Renderer;
+
 namespace Render {
 
 /**
@@ -49,7 +52,22 @@ private:
      */
     SkyBox(const std::string& name);
 
+    /**
+     * @brief      Gets the key of a map generated from the environment texture in the IBL cache.
+     *
+     * @param[in]  renderer   The renderer.
+     * @param[in]  mapName    The name of the map, e.g. "irradiance_map".
+     * @param[in]  size       The width and height of the map.
+     * @param[in]  mipLevels  The number of mip levels of the map.
+     *
+     * @return     The key, 0 if the cache is disabled or if the environment texture couldn't be hashed.
+     */
+    uint64_t getCacheKey(const Vulkan::Renderer& renderer, const std::string& mapName, uint32_t size, uint32_t mipLevels) const;
+
 private:
+    // Hash of the environment texture file, the base of the keys of the maps in the IBL cache
+    uint64_t _environnementHash{0};
+
     static lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Mesh> _mesh;
     static lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> _brdfLut;
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
@@ -18,7 +20,13 @@
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/Material.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/MaterialTextures.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/SkyBox.hpp>
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
+#include <lug/Graphics/Vulkan/Render/InstanceBuffer.hpp>
+#include <lug/Graphics/Vulkan/Render/Mesh.hpp>
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
 #include <lug/Graphics/Vulkan/Render/Technique/Technique.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/System/ThreadPool.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -66,6 +74,11 @@ private:
         API::Fence renderFence;
         API::CommandBuffer renderCmdBuffer;
 
+        // One command pool and one secondary command buffer per recording thread,
+        // plus one for the skybox recorded by the main thread
+        std::vector<API::CommandPool> recordingCmdPools;
+        std::vector<API::CommandBuffer> recordingCmdBuffers;
+
         API::Fence transferFence;
         API::CommandBuffer transferCmdBuffer;
         API::Semaphore transferSemaphore;
@@ -76,6 +89,8 @@ private:
         std::vector<const BufferPool::SubBuffer*> lightBuffers;
         std::vector<const BufferPool::SubBuffer*> materialBuffers;
 
+        InstanceBuffer instanceBuffer;
+
         const DescriptorSetPool::DescriptorSet* cameraDescriptorSet{nullptr};
         const DescriptorSetPool::DescriptorSet* bloomOptionsDescriptorSet{nullptr};
         const DescriptorSetPool::DescriptorSet* skyBoxDescriptorSet{nullptr};
@@ -84,6 +99,27 @@ private:
         std::vector<const DescriptorSetPool::DescriptorSet*> materialTexturesDescriptorSets;
     };
 
+    struct LightBinding {
+        const DescriptorSetPool::DescriptorSet* descriptorSet;
+        uint32_t offset;
+    };
+
+    /**
+     * @brief      Everything needed to record a draw.
+     *             The draws are prepared by the main thread, which is the only one to touch
+     *             the buffer and descriptor set pools, and can then be recorded by any thread.
+     */
+    struct DrawCall {
+        Render::Pipeline* pipeline;
+        const Render::Mesh::PrimitiveSet* primitiveSet;
+        const DescriptorSetPool::DescriptorSet* materialDescriptorSet;
+        const DescriptorSetPool::DescriptorSet* materialTexturesDescriptorSet; // nullptr if the pipeline has no textures
+        uint32_t materialBufferOffset;
+        Math::Mat4x4f transform;    // Only used if instancesCount is 1 and the pipeline is not instanced
+        uint32_t instancesCount;
+        uint32_t firstInstance;
+    };
+
 public:
     Forward(Renderer& renderer, View& renderView);
 
@@ -115,16 +151,44 @@ public:
 
 private:
     bool initFramedata(uint32_t nb, const API::ImageView& swapchainImageView);
+    bool initRecording(FrameData& frameData, uint32_t cmdBuffersCount);
+
+    /**
+     * @brief      Records a range of the draws of the frame, once per batch of lights.
+     *
+     * @param[in]  cmdBuffer      The command buffer to record into.
+     * @param[in]  frameData      The frame data.
+     * @param[in]  basePipeline   The base pipeline, used to bind the lights.
+     * @param[in]  lightBindings  The light descriptor sets of the frame.
+     * @param[in]  first          The index of the first draw to record.
+     * @param[in]  last           The index after the last draw to record.
+     */
+    void recordDrawCalls(
+        const API::CommandBuffer& cmdBuffer,
+        const FrameData& frameData,
+        Render::Pipeline& basePipeline,
+        const std::vector<LightBinding>& lightBindings,
+        size_t first,
+        size_t last
+    ) const;
 
 private:
     std::vector<FrameData> _framesData;
 
+    // Reused each frame to avoid reallocating it
+    std::vector<DrawCall> _drawCalls;
+    std::unique_ptr<System::ThreadPool> _recordingThreadPool;
+    uint8_t _recordingThreadCount{0};
+
     const API::Queue* _graphicsQueue{nullptr};
     API::CommandPool _graphicsCommandPool;
 
     const API::Queue* _transferQueue{nullptr};
     API::CommandPool _transferCommandPool;
 
+    uint32_t _forwardScope{GpuProfiler::invalidScope};
+    uint32_t _skyBoxScope{GpuProfiler::invalidScope};
+
 private:
     // TODO: Use shared_ptr in the instance and static weak_ptr to avoid problem when we delete one forward renderer and not the others
     static std::unique_ptr<BufferPool::Camera> _cameraBufferPool;
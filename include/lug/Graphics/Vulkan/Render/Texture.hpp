@@ -16,7 +16,7 @@ namespace Vulkan {
 namespace Render {
 
 class LUG_GRAPHICS_API Texture final : public ::lug::Graphics::Render::Texture {
-    friend Resource::SharedPtr<lug::Graphics::Render::Texture> Builder::Texture::build(const ::lug::Graphics::Builder::Texture&);
+    friend Resource::SharedPtr<lug::Graphics::Render::Texture> Builder::Texture::build(::lug::Graphics::Builder::Texture&);
 
 public:
     Texture(const Texture&) = delete;
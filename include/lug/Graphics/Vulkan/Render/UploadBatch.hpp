@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
+#include <lug/Graphics/Vulkan/API/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Fence.hpp>
+#include <lug/Graphics/Vulkan/Vulkan.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+class Image;
+class Queue;
+} // API
+
+namespace Render {
+
+/**
+ * @brief      Batch of uploads of images and buffers, e.g. all the textures of a file.
+ *
+ *             The uploads are recorded without any Vulkan call, then #submit copies all their data
+ *             to one staging buffer, records all the copies in one command buffer between two pipeline barriers
+ *             (one for all the layout transitions to TRANSFER_DST, one for all the transitions to their final layout
+ *             or access) and submits it once with one fence.
+ *             The batch completes asynchronously: #isComplete polls the fence and #wait blocks on it,
+ *             the staging buffer is released once the batch is complete.
+ */
+class LUG_GRAPHICS_API UploadBatch {
+public:
+    /**
+     * @brief      The Vulkan calls of the batch, replaced by the tests to run without a device.
+     */
+    struct Backend {
+        // Creates the staging buffer of getStagingSize() bytes and fills it with copyData()
+        std::function<bool(UploadBatch& uploadBatch, const API::Device& device, const API::Queue& queue)> createStagingBuffer;
+
+        // Records all the copies in one command buffer and submits it with the fence of the batch
+        std::function<bool(UploadBatch& uploadBatch, const API::Device& device, const API::Queue& queue)> submit;
+
+        std::function<bool(UploadBatch& uploadBatch)> isComplete;
+        std::function<bool(UploadBatch& uploadBatch)> wait;
+    };
+
+public:
+    UploadBatch();
+    explicit UploadBatch(Backend backend);
+
+    UploadBatch(const UploadBatch&) = delete;
+    UploadBatch(UploadBatch&&) = delete;
+
+    UploadBatch& operator=(const UploadBatch&) = delete;
+    UploadBatch& operator=(UploadBatch&&) = delete;
+
+    /**
+     * @brief      Waits for the batch if it is submitted.
+     */
+    ~UploadBatch();
+
+    /**
+     * @brief      Adds data to copy to the staging buffer, without copying it.
+     *             The data must stay valid until the batch is submitted.
+     *
+     * @param[in]  alignment  The alignment of the data in the staging buffer, e.g. the size of a texel.
+     *                        The offsets are always aligned on 4 bytes, as required by the copy commands.
+     *
+     * @return     The offset of the data in the staging buffer.
+     */
+    VkDeviceSize addData(const void* data, VkDeviceSize size, VkDeviceSize alignment = 4);
+
+    /**
+     * @brief      Adds data to copy to the staging buffer, the pixels are kept by the batch until it is submitted.
+     */
+    VkDeviceSize addData(ImageDecoder::Pixels&& pixels, VkDeviceSize size, VkDeviceSize alignment = 4);
+
+    /**
+     * @brief      Adds the copies of data of the staging buffer (see #addData) to an image.
+     *             The image is transitioned from UNDEFINED to SHADER_READ_ONLY_OPTIMAL,
+     *             it must stay valid until the batch is complete.
+     *
+     * @param[in]  image        The image.
+     * @param[in]  mipLevels    The number of mip levels of the image.
+     * @param[in]  layersCount  The number of array layers of the image.
+     * @param[in]  regions      The copies, their offsets are the ones returned by #addData.
+     */
+    void addImage(const API::Image& image, uint32_t mipLevels, uint32_t layersCount, std::vector<VkBufferImageCopy> regions);
+
+    /**
+     * @brief      Adds a copy of data to a buffer, created with VK_BUFFER_USAGE_TRANSFER_DST_BIT.
+     *             The data must stay valid until the batch is submitted and the buffer until the batch is complete.
+     */
+    void addBuffer(const API::Buffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+    /**
+     * @brief      Submits all the uploads to a queue supporting the transfers, without waiting for them.
+     *             The batch can't be used to record uploads until it is complete.
+     *
+     * @return     False if the staging buffer, the command buffer or the fence can't be created, or the submit failed.
+     *             The uploads are dropped in this case.
+     */
+    bool submit(const API::Device& device, const API::Queue& queue);
+
+    /**
+     * @brief      Checks whether the batch is complete, releasing its staging buffer if so.
+     *             An empty or not submitted batch is complete.
+     */
+    bool isComplete();
+
+    /**
+     * @brief      Waits for the batch, then releases its staging buffer.
+     *
+     * @return     False if the wait failed.
+     */
+    bool wait();
+
+    /**
+     * @brief      Copies the data of all the uploads to the mapped staging buffer, at the offsets returned by #addData.
+     *             Called by Backend::createStagingBuffer.
+     */
+    void copyData(void* stagingData) const;
+
+    bool isEmpty() const;
+    bool isSubmitted() const;
+
+    /**
+     * @brief      Gets the size of the staging buffer needed by the uploads recorded since the last submit, in bytes.
+     */
+    VkDeviceSize getStagingSize() const;
+
+    uint32_t getImagesCount() const;
+    uint32_t getBuffersCount() const;
+
+    /**
+     * @brief      Gets the number of submits of all the batches, e.g. to check that a file is uploaded at once.
+     */
+    static uint64_t getSubmitsCount();
+
+    /**
+     * @brief      Gets the number of staging buffers, i.e. of device memory allocations, of all the batches.
+     */
+    static uint64_t getStagingAllocationsCount();
+
+private:
+    struct Data {
+        const void* data;
+        VkDeviceSize size;
+        VkDeviceSize offset;
+    };
+
+    struct ImageUpload {
+        const API::Image* image;
+        uint32_t mipLevels;
+        uint32_t layersCount;
+        std::vector<VkBufferImageCopy> regions;
+    };
+
+    struct BufferUpload {
+        const API::Buffer* buffer;
+        VkBufferCopy region;
+    };
+
+    void release();
+
+    bool createVulkanStagingBuffer(const API::Device& device, const API::Queue& queue);
+    bool submitVulkan(const API::Device& device, const API::Queue& queue);
+
+    static Backend getVulkanBackend();
+
+private:
+    Backend _backend;
+
+    std::vector<Data> _data;
+    std::vector<ImageDecoder::Pixels> _pixels;
+    VkDeviceSize _stagingSize{0};
+
+    std::vector<ImageUpload> _images;
+    std::vector<BufferUpload> _buffers;
+
+    // Kept alive until the batch is complete
+    API::Buffer _stagingBuffer;
+    API::DeviceMemory _stagingBufferMemory;
+    API::CommandPool _commandPool;
+    API::CommandBuffer _commandBuffer;
+    API::Fence _fence;
+
+    bool _submitted{false};
+
+    static std::atomic<uint64_t> _submitsCount;
+    static std::atomic<uint64_t> _stagingAllocationsCount;
+};
+
+#include <lug/Graphics/Vulkan/Render/UploadBatch.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,27 @@
+inline bool UploadBatch::isEmpty() const {
+    return _images.empty() && _buffers.empty();
+}
+
+inline bool UploadBatch::isSubmitted() const {
+    return _submitted;
+}
+
+inline VkDeviceSize UploadBatch::getStagingSize() const {
+    return _stagingSize;
+}
+
+inline uint32_t UploadBatch::getImagesCount() const {
+    return static_cast<uint32_t>(_images.size());
+}
+
+inline uint32_t UploadBatch::getBuffersCount() const {
+    return static_cast<uint32_t>(_buffers.size());
+}
+
+inline uint64_t UploadBatch::getSubmitsCount() {
+    return _submitsCount.load();
+}
+
+inline uint64_t UploadBatch::getStagingAllocationsCount() {
+    return _stagingAllocationsCount.load();
+}
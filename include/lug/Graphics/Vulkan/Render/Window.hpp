@@ -1,11 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Render/Window.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/CommandPool.hpp>
 #include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
 #include <lug/Graphics/Vulkan/API/ImageView.hpp>
 #include <lug/Graphics/Vulkan/API/Semaphore.hpp>
@@ -13,6 +17,7 @@
 #include <lug/Graphics/Vulkan/API/Swapchain.hpp>
 #include <lug/Graphics/Vulkan/Vulkan.hpp>
 #include <lug/Graphics/Vulkan/Gui.hpp>
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
 #include <lug/System/ThreadPool.hpp>
 
 namespace lug {
@@ -29,16 +34,29 @@ namespace Render {
 
 class LUG_GRAPHICS_API Window final : public ::lug::Graphics::Render::Window {
 private:
-    struct AcquireImageData {
-        API::Semaphore completeSemaphore;
-        int imageIdx = -1;
+    /**
+     * @brief      Synchronization of a frame in flight, independent of the swapchain images.
+     */
+    struct InFlightFrame {
+        // Signaled when all the commands of the frame are finished
+        API::Fence fence{};
+        API::Semaphore acquireImageSemaphore{};
+
+        // Latency measurement, timestamps of lug::System::Clock::getTimestamp
+        int64_t beginTimestamp{0};
+        int64_t presentTimestamp{0};
+        bool pending{false};
     };
 
-
     struct FrameData {
         API::Semaphore allDrawsFinishedSemaphore{};
         std::vector<API::Semaphore> imageReadySemaphores{};
         std::vector<API::CommandBuffer> cmdBuffers;
+
+        // Headless only, copy of the image in CPU memory
+        API::Buffer readbackBuffer{};
+        API::DeviceMemory readbackMemory{};
+        const void* readbackData{nullptr};
     };
 
 public:
@@ -61,6 +79,47 @@ public:
 
     const API::Swapchain& getSwapchain() const;
 
+    bool isHeadless() const;
+
+    GpuProfiler& getGpuProfiler();
+    const GpuProfiler& getGpuProfiler() const;
+
+    /**
+     * @brief      Gets the GPU time of the most recent frame whose timestamps are available,
+     *             from the beginning of the frame to the end of all the draws.
+     *
+     * @return     The time in milliseconds, 0 if the timestamps are not supported or not available yet.
+     */
+    float getGpuFrameTime() const;
+
+    /**
+     * @brief      Gets the number of frames in flight, i.e. the InitInfo::framesInFlight clamped to the number of images.
+     */
+    uint32_t getFramesInFlight() const;
+
+    /**
+     * @brief      Latency of the most recent finished frame, in milliseconds.
+     *             The end of a frame is observed by the CPU at the beginning of the next frames, so the latencies
+     *             are rounded up to the next beginFrame.
+     */
+    struct Latency {
+        float cpu;      // From beginFrame to the presentation request
+        float total;    // From beginFrame to the end of the rendering on the GPU
+    };
+
+    const Latency& getLatency() const;
+    GpuProfiler::Statistics getLatencyStatistics() const;
+
+    /**
+     * @brief      Copies the last rendered image in CPU memory, waiting for the end of its rendering.
+     *             Only available in headless mode with the readback enabled.
+     *
+     * @param[out] pixels  The pixels, row by row without padding, in the format of the swapchain (4 bytes per pixel).
+     *
+     * @return     False if the readback is not enabled or no frame has been rendered yet.
+     */
+    bool readback(std::vector<uint8_t>& pixels) const;
+
     ::lug::Graphics::Render::View* createView(::lug::Graphics::Render::View::InitInfo& initInfo) override final;
 
     bool render() override final;
@@ -82,6 +141,17 @@ private:
     bool initPresentQueue();
     bool initSwapchain();
     bool initFramesData();
+    bool initInFlightFrames();
+    bool resignalFence(InFlightFrame& inFlightFrame);
+    void updateLatency();
+
+    /**
+     * @brief      Computes the visibility of the views of each scene in one traversal, before the views render in parallel.
+     */
+    void computeVisibility();
+
+    bool initReadback(FrameData& frameData);
+    bool initGpuProfiler();
 
     bool buildBeginCommandBuffer();
     bool buildEndCommandBuffer();
@@ -99,13 +169,25 @@ private:
     const API::Queue* _presentQueue{nullptr};
     const API::QueueFamily* _presentQueueFamily{nullptr};
     uint32_t _currentImageIndex{0};
+    int _lastRenderedImageIndex{-1};
 
+    // One per swapchain image
     std::vector<FrameData> _framesData;
 
-    std::vector<AcquireImageData> _acquireImageDatas;
+    std::vector<InFlightFrame> _inFlightFrames;
+    uint32_t _currentFrameIndex{0};
+    int _lastRenderedFrameIndex{-1};
+
+    Latency _latency{0.0f, 0.0f};
+    std::vector<float> _latencyHistory;
+    uint32_t _latencyHistoryIndex{0};
 
     API::CommandPool _commandPool{};
 
+    GpuProfiler _gpuProfiler;
+    // From the beginning of the frame to the end of all the draws
+    uint32_t _frameScope{GpuProfiler::invalidScope};
+
     lug::Graphics::Vulkan::Gui  _guiInstance;
     bool _isGuiInitialized;
 };
@@ -2,6 +2,34 @@ inline const API::Swapchain& Window::getSwapchain() const {
     return _swapchain;
 }
 
+inline bool Window::isHeadless() const {
+    return _initInfo.headless.enabled;
+}
+
+inline GpuProfiler& Window::getGpuProfiler() {
+    return _gpuProfiler;
+}
+
+inline const GpuProfiler& Window::getGpuProfiler() const {
+    return _gpuProfiler;
+}
+
+inline float Window::getGpuFrameTime() const {
+    return _gpuProfiler.getLastTime(_frameScope);
+}
+
+inline uint32_t Window::getFramesInFlight() const {
+    return static_cast<uint32_t>(_inFlightFrames.size());
+}
+
+inline const Window::Latency& Window::getLatency() const {
+    return _latency;
+}
+
+inline GpuProfiler::Statistics Window::getLatencyStatistics() const {
+    return GpuProfiler::computeStatistics(_latencyHistory);
+}
+
 inline uint16_t Window::getWidth() const {
     return _mode.width;
 }
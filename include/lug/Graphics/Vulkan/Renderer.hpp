@@ -3,6 +3,7 @@
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include <lug/Graphics/Export.hpp>
@@ -12,6 +13,7 @@
 #include <lug/Graphics/Vulkan/API/Loader.hpp>
 #include <lug/Graphics/Vulkan/Render/Mesh.hpp>
 #include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+#include <lug/Graphics/Vulkan/Render/PipelineCompiler.hpp>
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
 #include <lug/Graphics/Vulkan/Vulkan.hpp>
 
@@ -46,6 +48,38 @@ public:
             std::vector<VkFormat> formats;                              // By order of preference
             std::vector<VkCompositeAlphaFlagBitsKHR> compositeAlphas;   // By order of preference
         } swapchain;
+
+        struct PipelineCompilation {
+            bool async;                                                 // Compile the pipelines in background threads
+            uint8_t workerCount;                                        // 0 to use the hardware concurrency
+            Render::PipelineCompiler::Fallback fallback;                // What to draw while a pipeline is compiling
+        } pipelineCompilation;
+
+        struct Instancing {
+            bool enabled;                                               // Draw the identical primitive sets with one instanced draw
+            uint32_t minInstancesCount;                                 // Minimum number of identical primitive sets to use instancing
+        } instancing;
+
+        struct Visibility {
+            bool shared;                                                // Cull the views of a scene in one traversal, before they render
+        } visibility;
+
+        struct Recording {
+            uint8_t threadCount;                                        // 1 to record the draws in the primary command buffer
+            uint32_t minDrawsPerThread;                                 // Minimum number of draws recorded by each thread
+        } recording;
+
+        struct Profiling {
+            bool enabled;                                               // Measure the GPU time of the passes with timestamp queries
+            bool pipelineStatistics;                                    // Also count the primitives and shader invocations, if supported
+            bool overlay;                                               // Draw the results in the Gui
+        } profiling;
+
+        struct Ibl {
+            bool cache;                                                 // Reload the irradiance and prefiltered maps generated by a previous run
+            std::string cacheDirectory;                                 // Must exist, empty for the working directory
+            std::string brdfLut;                                        // Precomputed BRDF LUT, generated on the GPU if it can't be loaded
+        } ibl;
     };
 
 public:
@@ -66,6 +100,8 @@ public:
     bool isInstanceExtensionLoaded(const char* name) const;
     bool isDeviceExtensionLoaded(const char* name) const;
 
+    const VkPhysicalDeviceFeatures& getLoadedDeviceFeatures() const;
+
     ::lug::Graphics::Render::Window* createWindow(Render::Window::InitInfo& initInfo) override final;
     ::lug::Graphics::Render::Window* getWindow() override final;
 
@@ -87,8 +123,47 @@ public:
 
     void addPipeline(Resource::SharedPtr<Render::Pipeline> pipeline);
     bool containsPipeline(Render::Pipeline::Id id) const;
+
+    /**
+     * @brief      Retrieves a pipeline only if it is already compiled.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     The pipeline, or nullptr if it doesn't exist.
+     */
+    Resource::SharedPtr<Render::Pipeline> findPipeline(Render::Pipeline::Id id) const;
+
+    /**
+     * @brief      Retrieves a pipeline, compiling it if necessary.
+     *             Blocks until the pipeline is ready.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     The pipeline, or nullptr if it can't be compiled.
+     */
     Resource::SharedPtr<Render::Pipeline> getPipeline(Render::Pipeline::Id id);
 
+    /**
+     * @brief      Retrieves a pipeline without waiting for its compilation.
+     *             If the pipeline is not ready yet, its compilation is requested in the background
+     *             and nullptr is returned. Behaves like getPipeline() if the asynchronous compilation is disabled.
+     *
+     * @param[in]  id    The id of the pipeline.
+     *
+     * @return     The pipeline, or nullptr if it is not ready yet.
+     */
+    Resource::SharedPtr<Render::Pipeline> getPipelineAsync(Render::Pipeline::Id id);
+
+    /**
+     * @brief      Compiles in the background a list of pipelines that will be needed soon,
+     *             to avoid stalls when they are first used.
+     *
+     * @param[in]  ids   The ids of the pipelines.
+     */
+    void prewarmPipelines(const std::vector<Render::Pipeline::Id>& ids);
+
+    Render::PipelineCompiler* getPipelineCompiler() const;
+
     Render::Window* getRenderWindow() const;
 
     void destroy();
@@ -145,15 +220,51 @@ private:
                 VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
                 VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR
             }
+        },
+
+        {                                           // pipelineCompilation
+            true,                                   // async
+            2,                                      // workerCount
+            Render::PipelineCompiler::Fallback::Base // fallback
+        },
+
+        {                                           // instancing
+            true,                                   // enabled
+            2                                       // minInstancesCount
+        },
+
+        {                                           // visibility
+            true                                    // shared
+        },
+
+        {                                           // recording
+            1,                                      // threadCount
+            256                                     // minDrawsPerThread
+        },
+
+        {                                           // profiling
+            true,                                   // enabled
+            false,                                  // pipelineStatistics
+            false                                   // overlay
+        },
+
+        {                                           // ibl
+            true,                                   // cache
+            "",                                     // cacheDirectory
+            "textures/brdf_lut.iblcache"            // brdfLut
         }
     };
 
     std::unordered_map<Render::Pipeline::Id, Resource::WeakPtr<Render::Pipeline>> _pipelines;
+    std::unique_ptr<Render::PipelineCompiler> _pipelineCompiler;
 
 private:
     static const std::unordered_map<Module::Type, Requirements> modulesRequirements;
 
+    // Serializes the synchronous creation of the pipelines, without the pipeline compiler
     mutable std::mutex _mutex;
+    // Protects _pipelines, which is also filled by the pipeline compiler threads
+    mutable std::mutex _pipelinesMutex;
 };
 
 #include <lug/Graphics/Vulkan/Renderer.inl>
@@ -42,6 +42,10 @@ inline const InstanceInfo& Renderer::getInstanceInfo() const {
     return _instanceInfo;
 }
 
+inline const VkPhysicalDeviceFeatures& Renderer::getLoadedDeviceFeatures() const {
+    return _loadedDeviceFeatures;
+}
+
 inline PhysicalDeviceInfo* Renderer::getPhysicalDeviceInfo() {
     return _physicalDeviceInfo;
 }
@@ -67,20 +71,17 @@ inline const Renderer::Preferences& Renderer::getPreferences() const {
 }
 
 inline void Renderer::addPipeline(Resource::SharedPtr<Render::Pipeline> pipeline) {
+    std::lock_guard<std::mutex> lockGuard(_pipelinesMutex);
     _pipelines[pipeline->getId()] = pipeline;
 }
 
 inline bool Renderer::containsPipeline(Render::Pipeline::Id id) const {
+    std::lock_guard<std::mutex> lockGuard(_pipelinesMutex);
     return _pipelines.find(id) != _pipelines.end() && _pipelines.at(id).lock();
 }
 
-inline Resource::SharedPtr<Render::Pipeline> Renderer::getPipeline(Render::Pipeline::Id id) {
-    std::lock_guard<std::mutex> lockGuard(_mutex);
-    if (containsPipeline(id)) {
-        return _pipelines.at(id).lock();
-    }
-
-    return Render::Pipeline::create(*this, id);
+inline Render::PipelineCompiler* Renderer::getPipelineCompiler() const {
+    return _pipelineCompiler.get();
 }
 
 inline Render::Window* Renderer::getRenderWindow() const {
@@ -101,10 +101,13 @@
     macro(vkCreateShaderModule)                         \
     macro(vkCreatePipelineLayout)                       \
     macro(vkCreateGraphicsPipelines)                    \
+    macro(vkCreateComputePipelines)                     \
     macro(vkCmdBeginRenderPass)                         \
     macro(vkCmdBindPipeline)                            \
     macro(vkCmdDraw)                                    \
     macro(vkCmdDrawIndexed)                             \
+    macro(vkCmdDispatch)                                \
+    macro(vkCmdExecuteCommands)                         \
     macro(vkCmdEndRenderPass)                           \
     macro(vkDestroyShaderModule)                        \
     macro(vkDestroyPipelineLayout)                      \
@@ -139,6 +142,7 @@
     macro(vkCmdCopyImage)                               \
     macro(vkCmdBlitImage)                               \
     macro(vkCmdCopyBufferToImage)                       \
+    macro(vkCmdCopyImageToBuffer)                       \
     macro(vkCreateDescriptorSetLayout)                  \
     macro(vkCreateDescriptorPool)                       \
     macro(vkAllocateDescriptorSets)                     \
@@ -152,6 +156,13 @@
     macro(vkDestroyImage)                               \
     macro(vkCmdPushConstants)                           \
     macro(vkCmdResolveImage)                            \
+    macro(vkCreateQueryPool)                            \
+    macro(vkDestroyQueryPool)                           \
+    macro(vkGetQueryPoolResults)                        \
+    macro(vkCmdResetQueryPool)                          \
+    macro(vkCmdBeginQuery)                              \
+    macro(vkCmdEndQuery)                                \
+    macro(vkCmdWriteTimestamp)                          \
     LUG_DEVICE_VULKAN_FUNCTIONS_KHR_SWAPCHAIN(macro)
 
 inline namespace Vulkan {
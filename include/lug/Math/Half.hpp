@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace lug {
+namespace Math {
+
+/**
+ * @brief      Converts a float to an IEEE 754 half precision float, rounding to nearest even.
+ *             The values too large for a half are converted to infinity.
+ *
+ * @param[in]  value  The value.
+ *
+ * @return     The bits of the half.
+ */
+uint16_t toHalf(float value);
+
+/**
+ * @brief      Converts an IEEE 754 half precision float to a float.
+ *
+ * @param[in]  half  The bits of the half.
+ *
+ * @return     The value.
+ */
+float fromHalf(uint16_t half);
+
+#include <lug/Math/Half.inl>
+
+} // Math
+} // lug
@@ -0,0 +1,73 @@
+inline uint16_t toHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t absBits = bits & 0x7FFFFFFF;
+
+    // NaN, keeps it a quiet NaN
+    if (absBits > 0x7F800000) {
+        return static_cast<uint16_t>(sign | 0x7E00);
+    }
+
+    // Overflow to infinity
+    if (absBits >= 0x477FF000) {
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+
+    // Normal half
+    if (absBits >= 0x38800000) {
+        const uint32_t rounded = absBits + 0x0FFF + ((absBits >> 13) & 1);
+        return static_cast<uint16_t>(sign | ((rounded - 0x38000000) >> 13));
+    }
+
+    // Subnormal half or zero
+    if (absBits < 0x33000000) {
+        return static_cast<uint16_t>(sign);
+    }
+
+    const uint32_t exponent = absBits >> 23;
+    const uint32_t mantissa = (absBits & 0x007FFFFF) | 0x00800000;
+    const uint32_t shift = 126 - exponent;
+
+    uint32_t half = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+
+    if (remainder > halfway || (remainder == halfway && (half & 1))) {
+        ++half;
+    }
+
+    return static_cast<uint16_t>(sign | half);
+}
+
+inline float fromHalf(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x03FF;
+
+    uint32_t bits;
+
+    if (exponent == 0x1F) {
+        // Infinity or NaN
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half, normal float
+        exponent = 113;
+        while (!(mantissa & 0x0400)) {
+            mantissa <<= 1;
+            --exponent;
+        }
+
+        bits = sign | (exponent << 23) | ((mantissa & 0x03FF) << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
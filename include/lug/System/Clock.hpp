@@ -21,6 +21,13 @@ public:
     Time reset();
     Time getElapsedTime() const;
 
+    /**
+     * @brief      Gets a high resolution timestamp, from a monotonic clock.
+     *
+     * @return     The timestamp in nanoseconds, from an arbitrary origin.
+     */
+    static int64_t getTimestamp();
+
 private:
     Time _startTime;
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <lug/System/Logger/Common.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+/**
+ * @brief      Types of the arguments of the binary log files.
+ */
+enum class ArgumentType : uint8_t {
+    Int,        ///< Signed integer, zigzag varint
+    UInt,       ///< Unsigned integer, varint
+    Boolean,    ///< 1 byte, not Bool which is a macro of X11
+    Char,       ///< 1 byte
+    Float,      ///< 4 bytes
+    Double,     ///< 8 bytes
+    String,     ///< Varint size, then the characters. The other types are written as their text.
+    Pointer     ///< 8 bytes
+};
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+/**
+ * Layout of the binary log files, in little endian:
+ * - Header: the magic "LUGB", the version (uint32) and the time of the file (int64, nanoseconds since the epoch).
+ * - Records, each starting with its RecordType:
+ *   - Format: the id (varint), the size (varint) and the characters of a format string, before its first use in the file.
+ *   - Logger: the id (varint), the size (varint) and the characters of a logger name, before its first use in the file.
+ *   - Message: the level (1 byte), the format id, the logger id, the time since the previous message (zigzag varint),
+ *     the size of the arguments (varint), then each argument as its ArgumentType and value.
+ *   - End: the end of the data, the unused end of a file is filled with zeros.
+ *
+ * Each file defines its own ids, so a file decodes alone after a rotation.
+ */
+enum class RecordType : uint8_t {
+    End,
+    Format,
+    Logger,
+    Message
+};
+
+constexpr char binaryMagic[4] = {'L', 'U', 'G', 'B'};
+constexpr uint32_t binaryVersion = 1;
+constexpr std::size_t binaryHeaderSize = 16;
+
+constexpr std::size_t maxVarintSize = 10;
+
+inline uint64_t zigzagEncode(int64_t value);
+inline int64_t zigzagDecode(uint64_t value);
+
+/**
+ * @brief      Writes a varint, at most maxVarintSize bytes.
+ *
+ * @return     The end of the varint.
+ */
+inline uint8_t* writeVarint(uint8_t* data, uint64_t value);
+
+/**
+ * @brief      Reads a varint, and moves data after it.
+ *
+ * @return     False if the varint doesn't end before `end`.
+ */
+inline bool readVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value);
+
+inline void writeBytes(fmt::MemoryWriter& writer, const void* data, std::size_t size);
+inline void writeString(fmt::MemoryWriter& writer, const char* data, std::size_t size);
+
+/**
+ * @brief      Writes an argument of type T, chosen on the decayed type of the argument.
+ *
+ *             The types that are not specialized are written as the text formatted by fmt.
+ */
+template <typename T, typename Enable = void>
+struct ArgumentWriter {
+    static void write(fmt::MemoryWriter& writer, const T& value);
+};
+
+inline void writeArguments(fmt::MemoryWriter& writer);
+
+template <typename Arg, typename... Args>
+inline void writeArguments(fmt::MemoryWriter& writer, const Arg& arg, const Args&... args);
+
+/**
+ * @brief      Captures the format and the arguments of a log call, for the handlers that need them.
+ *
+ *             The format is copied as the first argument, a char array can't be told apart from a string literal
+ *             and the asynchronous loggers handle the message after the call.
+ */
+template <typename T, typename... Args>
+inline void captureArguments(Message& msg, const T& format, const Args&... args);
+
+#include <lug/System/Logger/BinaryFormat.inl>
+
+} // priv
+/**
+ * \endcond
+ */
+
+} // Logger
+} // System
+} // lug
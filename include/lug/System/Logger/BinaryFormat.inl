@@ -0,0 +1,153 @@
+inline uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline uint8_t* writeVarint(uint8_t* data, uint64_t value) {
+    while (value >= 0x80) {
+        *data++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+
+    *data++ = static_cast<uint8_t>(value);
+
+    return data;
+}
+
+inline bool readVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value) {
+    value = 0;
+
+    for (uint32_t shift = 0; data < end && shift < 64; shift += 7) {
+        const uint8_t byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void writeBytes(fmt::MemoryWriter& writer, const void* data, std::size_t size) {
+    writer << fmt::StringRef(static_cast<const char*>(data), size);
+}
+
+inline void writeString(fmt::MemoryWriter& writer, const char* data, std::size_t size) {
+    uint8_t header[1 + maxVarintSize];
+    header[0] = static_cast<uint8_t>(ArgumentType::String);
+
+    writeBytes(writer, header, writeVarint(header + 1, size) - header);
+    writeBytes(writer, data, size);
+}
+
+template <typename T, typename Enable>
+inline void ArgumentWriter<T, Enable>::write(fmt::MemoryWriter& writer, const T& value) {
+    fmt::MemoryWriter text;
+    text.write("{}", value);
+
+    writeString(writer, text.data(), text.size());
+}
+
+template <>
+struct ArgumentWriter<bool> {
+    static void write(fmt::MemoryWriter& writer, bool value) {
+        const uint8_t data[2] = {static_cast<uint8_t>(ArgumentType::Boolean), static_cast<uint8_t>(value)};
+        writeBytes(writer, data, sizeof(data));
+    }
+};
+
+template <>
+struct ArgumentWriter<char> {
+    static void write(fmt::MemoryWriter& writer, char value) {
+        const uint8_t data[2] = {static_cast<uint8_t>(ArgumentType::Char), static_cast<uint8_t>(value)};
+        writeBytes(writer, data, sizeof(data));
+    }
+};
+
+template <typename T>
+struct ArgumentWriter<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+    static void write(fmt::MemoryWriter& writer, T value) {
+        uint8_t data[1 + maxVarintSize];
+        data[0] = static_cast<uint8_t>(ArgumentType::Int);
+
+        writeBytes(writer, data, writeVarint(data + 1, zigzagEncode(static_cast<int64_t>(value))) - data);
+    }
+};
+
+template <typename T>
+struct ArgumentWriter<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type> {
+    static void write(fmt::MemoryWriter& writer, T value) {
+        uint8_t data[1 + maxVarintSize];
+        data[0] = static_cast<uint8_t>(ArgumentType::UInt);
+
+        writeBytes(writer, data, writeVarint(data + 1, static_cast<uint64_t>(value)) - data);
+    }
+};
+
+template <>
+struct ArgumentWriter<float> {
+    static void write(fmt::MemoryWriter& writer, float value) {
+        uint8_t data[1 + sizeof(float)];
+        data[0] = static_cast<uint8_t>(ArgumentType::Float);
+        std::memcpy(data + 1, &value, sizeof(float));
+
+        writeBytes(writer, data, sizeof(data));
+    }
+};
+
+template <typename T>
+struct ArgumentWriter<T, typename std::enable_if<std::is_same<T, double>::value || std::is_same<T, long double>::value>::type> {
+    static void write(fmt::MemoryWriter& writer, T value) {
+        const double doubleValue = static_cast<double>(value);
+
+        uint8_t data[1 + sizeof(double)];
+        data[0] = static_cast<uint8_t>(ArgumentType::Double);
+        std::memcpy(data + 1, &doubleValue, sizeof(double));
+
+        writeBytes(writer, data, sizeof(data));
+    }
+};
+
+template <typename T>
+struct ArgumentWriter<T, typename std::enable_if<std::is_same<T, const char*>::value || std::is_same<T, char*>::value>::type> {
+    static void write(fmt::MemoryWriter& writer, const char* value) {
+        writeString(writer, value ? value : "", value ? std::strlen(value) : 0);
+    }
+};
+
+template <>
+struct ArgumentWriter<std::string> {
+    static void write(fmt::MemoryWriter& writer, const std::string& value) {
+        writeString(writer, value.data(), value.size());
+    }
+};
+
+template <typename T>
+struct ArgumentWriter<T, typename std::enable_if<std::is_same<T, const void*>::value || std::is_same<T, void*>::value>::type> {
+    static void write(fmt::MemoryWriter& writer, const void* value) {
+        const uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+
+        uint8_t data[1 + sizeof(uint64_t)];
+        data[0] = static_cast<uint8_t>(ArgumentType::Pointer);
+        std::memcpy(data + 1, &address, sizeof(uint64_t));
+
+        writeBytes(writer, data, sizeof(data));
+    }
+};
+
+inline void writeArguments(fmt::MemoryWriter&) {}
+
+template <typename Arg, typename... Args>
+inline void writeArguments(fmt::MemoryWriter& writer, const Arg& arg, const Args&... args) {
+    ArgumentWriter<typename std::decay<Arg>::type>::write(writer, arg);
+    writeArguments(writer, args...);
+}
+
+template <typename T, typename... Args>
+inline void captureArguments(Message& msg, const T& format, const Args&... args) {
+    writeArguments(msg.arguments, format, args...);
+}
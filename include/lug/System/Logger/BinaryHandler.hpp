@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <lug/System/Export.hpp>
+#include <lug/System/MappedFile.hpp>
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+/**
+ * @brief      Writes the messages as compact binary records in memory-mapped, rotating files.
+ *
+ *             The messages are not formatted: each file holds the format strings and the logger names once,
+ *             then for each message its level, the time since the previous one and the raw bytes of its arguments
+ *             (see priv::RecordType). BinaryReader and the `lug-log-decoder` tool read them back as text or JSON.
+ *
+ *             When a message doesn't fit in the current file, the file is truncated to its data and renamed
+ *             `filename.1`, the previous ones are shifted up to `filename.<filesCount - 1>` and the oldest is removed.
+ */
+class LUG_SYSTEM_API BinaryHandler : public Handler {
+public:
+    /**
+     * @param[in]  name        The name of the handler.
+     * @param[in]  filename    The current file.
+     * @param[in]  fileSize    The size of the files mapped, in bytes.
+     * @param[in]  filesCount  The number of files kept, the current one included.
+     */
+    BinaryHandler(const std::string& name, const std::string& filename, uint32_t fileSize = 16 * 1024 * 1024, uint32_t filesCount = 4);
+
+    BinaryHandler(const BinaryHandler&) = delete;
+    BinaryHandler(BinaryHandler&&) = delete;
+
+    BinaryHandler& operator=(const BinaryHandler&) = delete;
+    BinaryHandler& operator=(BinaryHandler&&) = delete;
+
+    ~BinaryHandler();
+
+    void handle(const priv::Message& msg) override;
+    void flush() override;
+
+    bool needsText() const override;
+    bool needsArguments() const override;
+
+    /**
+     * @brief      Number of messages not written, because they are larger than a file or a file can't be created.
+     */
+    uint64_t getDroppedCount() const;
+
+private:
+    // The strings defined in the current file
+    struct Dictionary {
+        // Characters not owned by the key, so looking up a text doesn't copy it
+        struct Key {
+            const char* text;
+            std::size_t size;
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        struct KeyEqual {
+            bool operator()(const Key& lhs, const Key& rhs) const;
+        };
+
+        // The pointer of a stable string is cached, its characters are still compared
+        uint32_t getId(const char* text, std::size_t size, bool stablePointer, bool& added);
+        void clear();
+
+        std::unordered_map<const char*, uint32_t> pointerIds;
+
+        // The keys point to the characters of texts, which a deque doesn't move when it grows
+        std::unordered_map<Key, uint32_t, KeyHash, KeyEqual> ids;
+        std::deque<std::string> texts;
+    };
+
+    bool openFile();
+    bool rotate();
+    std::string getRotatedFilename(uint32_t index) const;
+
+    const std::string _filename;
+    const uint32_t _fileSize;
+    const uint32_t _filesCount;
+
+    // A handler can be shared by several loggers
+    std::mutex _mutex;
+
+    MappedFile _file;
+    std::size_t _position{0};
+    int64_t _previousTime{0};
+
+    Dictionary _formats;
+    Dictionary _loggers;
+
+    std::atomic<uint64_t> _droppedCount{0};
+};
+
+} // Logger
+} // System
+} // lug
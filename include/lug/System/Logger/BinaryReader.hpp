@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/System/Export.hpp>
+#include <lug/System/MappedFile.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
+#include <lug/System/Logger/Common.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+/**
+ * @brief      Reads the files written by BinaryHandler, one message at a time.
+ */
+class LUG_SYSTEM_API BinaryReader {
+public:
+    struct Argument {
+        ArgumentType type;
+
+        int64_t integer{0};             ///< Int, Bool and Char
+        uint64_t unsignedInteger{0};    ///< UInt and Pointer
+        double real{0.0};               ///< Float and Double
+        std::string text;               ///< String
+    };
+
+    struct Record {
+        std::chrono::system_clock::time_point time;
+        Level level;
+
+        std::string loggerName;
+        std::string format;
+        std::vector<Argument> arguments;
+    };
+
+public:
+    BinaryReader() = default;
+
+    BinaryReader(const BinaryReader&) = delete;
+    BinaryReader(BinaryReader&&) = default;
+
+    BinaryReader& operator=(const BinaryReader&) = delete;
+    BinaryReader& operator=(BinaryReader&&) = default;
+
+    ~BinaryReader() = default;
+
+    /**
+     * @brief      Maps a binary log file.
+     *
+     * @return     False if the file can't be mapped or is not a binary log file.
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief      Reads the next message.
+     *
+     * @param      record  The message, its members are reused.
+     *
+     * @return     False at the end of the data, or if the next record is corrupted (see isCorrupted).
+     */
+    bool next(Record& record);
+
+    bool isCorrupted() const;
+
+    /**
+     * @brief      Formats a message like fmt, from the arguments read.
+     *
+     *             Supports the automatic and the explicit argument indices, and the format specifications,
+     *             but not the nested replacement fields.
+     *
+     * @param[out] message  The formatted message.
+     *
+     * @return     False if the format doesn't match the arguments.
+     */
+    static bool formatMessage(const std::string& format, const std::vector<Argument>& arguments, std::string& message);
+
+private:
+    bool readDefinition(std::vector<std::string>& definitions);
+    bool readArguments(const uint8_t* data, const uint8_t* end, std::vector<Argument>& arguments);
+
+    MappedFile _file;
+    const uint8_t* _position{nullptr};
+    const uint8_t* _end{nullptr};
+
+    int64_t _time{0};
+    bool _corrupted{false};
+
+    std::vector<std::string> _formats;
+    std::vector<std::string> _loggerNames;
+};
+
+} // Logger
+} // System
+} // lug
@@ -19,6 +19,7 @@
 #endif
 
 #define LUG_LOG_LEVELS(PROCESS)     \
+    PROCESS(Trace)                  \
     PROCESS(Debug)                  \
     PROCESS(Info)                   \
     PROCESS(Warning)                \
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <chrono>
-#include <memory>
+#include <ctime>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <lug/System/Export.hpp>
+#include <lug/System/Logger/Common.hpp>
 
 namespace lug {
 namespace System {
@@ -14,52 +15,28 @@ namespace Logger {
  * \cond HIDDEN_SYMBOLS
  */
 namespace priv {
-class Message;
-} // priv
-/**
- * \endcond
- */
-
-class Formatter;
-
-using FlagHandlerPointer = std::string (Formatter::*)(const std::tm* now);
-
-/**
- * \cond HIDDEN_SYMBOLS
- */
-namespace priv {
-
-class Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const = 0;
-};
 
-class UserChars : public Formattable {
-public:
-    void addChar(char c);
-    virtual std::string format(Message* = nullptr) const;
+class Message;
 
-private:
-    std::string _chars;
-};
+struct Instruction {
+    enum class Type : uint8_t {
+        Text,       ///< Characters of the pattern
+        Time,       ///< Characters and time flags of the pattern, rendered once per second
+        Level,      ///< %l
+        Message     ///< %v
+    };
 
-class LevelFlag : public Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const;
-};
+    Type type;
 
-class MessageFlag : public Formattable {
-public:
-    virtual std::string format(Message* = nullptr) const;
-};
+    // Range of the characters in the text (Text), or start of the null-terminated characters in the time text (Time)
+    uint32_t offset;
+    uint32_t size;
 
-struct Token {
-    Token() = default;
-    Token(FlagHandlerPointer flagHandle) : basic(flagHandle) {}
-    Token(std::unique_ptr<Formattable> formattable) : advanced(std::move(formattable)) {}
+    // Room for the rendered characters and the null character (Time)
+    uint32_t capacity;
 
-    FlagHandlerPointer basic{nullptr};
-    std::unique_ptr<Formattable> advanced{nullptr};
+    // Index of the strftime pattern (Time)
+    uint32_t timePattern;
 };
 
 } // priv
@@ -67,6 +44,18 @@ struct Token {
  * \endcond
  */
 
+/**
+ * @brief      Formats the messages according to a pattern.
+ *
+ *             The pattern is compiled once into a flat list of instructions appending
+ *             ranges of characters to the formatted message:
+ *             - `%y`, `%Y`, `%m`, `%d`, `%H`, `%M`, `%S`: the time of the message, as std::strftime.
+ *               The consecutive time flags and characters are rendered together, once per second.
+ *             - `%l`: the level, in upper case and padded to 7 characters.
+ *             - `%v`: the message.
+ *
+ *             Formatting a message doesn't allocate, as long as it fits in the buffer of the formatted message.
+ */
 class LUG_SYSTEM_API Formatter {
 public:
     Formatter(const std::string& pattern);
@@ -82,19 +71,37 @@ public:
     virtual void format(priv::Message& msg);
     virtual void format(priv::Message& msg, const std::tm* now);
 
+    /**
+     * @brief      The level as formatted by `%l`.
+     *
+     * @return     7 characters, null-terminated.
+     */
+    static const char* getLevelName(Level level);
+
 private:
-    void handleFlag(char c);
     void compilePattern(const std::string& pattern);
 
-    std::string handleFlagy(const std::tm* now); // Year 2 digits
-    std::string handleFlagY(const std::tm* now); // Year 4 digits
-    std::string handleFlagm(const std::tm* now); // Month from 1 to 12
-    std::string handleFlagd(const std::tm* now); // Day from 1 to 31
-    std::string handleFlagH(const std::tm* now); // Hour from 0 to 24
-    std::string handleFlagM(const std::tm* now); // Minute from 0 to 59
-    std::string handleFlagS(const std::tm* now); // Sec from 0 to 61
+    void renderTime(const std::tm* now);
+
+    /**
+     * @brief      Copies the rendered time flags, to format the message without holding _timeMutex.
+     *             Must be called with _timeMutex locked.
+     *
+     * @return     The copy, owned by the calling thread until its next call.
+     */
+    const std::vector<char>& copyTimeText() const;
+
+    void write(priv::Message& msg, const char* timeText) const;
+
+    std::vector<priv::Instruction> _instructions;
+
+    std::string _text;
+    std::vector<std::string> _timePatterns;
 
-    std::vector<priv::Token> _formatChain;
+    // The time flags rendered for _renderedTime, shared by the threads formatting with the formatter
+    std::mutex _timeMutex;
+    std::vector<char> _timeText;
+    std::time_t _renderedTime{-1};
 };
 
 } // Logger
@@ -31,14 +31,34 @@ public:
     virtual void flush() = 0;
     virtual void handle(const priv::Message& msg) = 0;
 
+    /**
+     * @brief      Whether the handler reads the text of the messages, true by default.
+     *             When no handler of a logger needs it, the log calls don't format the messages.
+     */
+    virtual bool needsText() const;
+
+    /**
+     * @brief      Whether the handler reads the format and the arguments captured in the messages, false by default.
+     */
+    virtual bool needsArguments() const;
+
     bool shouldLog(Level level) const;
     void setLevel(Level level);
     Level getLevel() const;
 
+    /**
+     * @brief      Incremented when the level of any handler changes.
+     *             The loggers compare it to update their minimum level lazily.
+     */
+    static uint32_t getLevelsVersion();
+
 protected:
     std::string _name;
     std::unique_ptr<Formatter> _formatter;
     Level _level;
+
+private:
+    static std::atomic<uint32_t> _levelsVersion;
 };
 
 template<typename T, typename... Args>
@@ -5,3 +5,7 @@ inline T* makeHandler(const std::string& handlerName, Args&&... args) {
     LoggingFacility::registerHandler(handlerName, std::move(handler));
     return handlerRawPtr;
 }
+
+inline uint32_t Handler::getLevelsVersion() {
+    return _levelsVersion.load(std::memory_order_acquire);
+}
@@ -1,31 +1,103 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <ostream>
 #include <set>
 #include <string>
 
 #include <lug/System/Export.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
 #include <lug/System/Logger/Common.hpp>
+#include <lug/System/Logger/Handler.hpp>
 #include <lug/System/Logger/LoggingFacility.hpp>
 #include <lug/System/Logger/Message.hpp>
 
+// The levels of the log macros, LUG_LOG_MIN_LEVEL removes the calls below it at compile time
+#define LUG_LOG_LEVEL_TRACE     0
+#define LUG_LOG_LEVEL_DEBUG     1
+#define LUG_LOG_LEVEL_INFO      2
+#define LUG_LOG_LEVEL_WARNING   3
+#define LUG_LOG_LEVEL_ERROR     4
+
+#if !defined(LUG_LOG_MIN_LEVEL)
+    #define LUG_LOG_MIN_LEVEL LUG_LOG_LEVEL_TRACE
+#endif
+
 namespace lug {
 namespace System {
 namespace Logger {
 
-class Handler;
+static_assert(static_cast<int>(Level::Trace) == LUG_LOG_LEVEL_TRACE &&
+              static_cast<int>(Level::Debug) == LUG_LOG_LEVEL_DEBUG &&
+              static_cast<int>(Level::Info) == LUG_LOG_LEVEL_INFO &&
+              static_cast<int>(Level::Warning) == LUG_LOG_LEVEL_WARNING &&
+              static_cast<int>(Level::Error) == LUG_LOG_LEVEL_ERROR,
+              "The LUG_LOG_LEVEL_* values must match the levels");
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+struct AsyncQueue;
+} // priv
+/**
+ * \endcond
+ */
+
+/**
+ * @brief      What a producer does when the queue of an asynchronous logger is full.
+ */
+enum class Overflow : uint8_t {
+    Block,  ///< Waits for the background thread to make room.
+    Drop,   ///< Drops the message, only counted in Logger::getDroppedCount().
+    Count   ///< Drops the message, and logs the number of dropped messages once there is room again.
+};
+
+/**
+ * @brief      Argument evaluated only if the message is formatted.
+ *
+ *             The function is called when the message is formatted, so an expensive argument
+ *             of a log call costs nothing when its level is disabled. The result is written with operator<<.
+ *
+ * @tparam     Function  Callable without argument, returning a type printable to a std::ostream.
+ */
+template <typename Function>
+class LazyArg {
+public:
+    explicit LazyArg(Function function) : _function(std::move(function)) {}
+
+    friend std::ostream& operator<<(std::ostream& os, const LazyArg& arg) {
+        return os << arg._function();
+    }
+
+private:
+    Function _function;
+};
+
+template <typename Function>
+inline LazyArg<typename std::decay<Function>::type> lazy(Function&& function);
+
+struct AsyncInfo {
+    uint32_t capacity{8192};            ///< Number of messages in the queue, rounded up to a power of two.
+    uint32_t batchSize{256};            ///< Maximum number of messages handled before the background thread checks the flush barriers.
+    Overflow overflow{Overflow::Block};
+    bool drainOnCrash{false};           ///< Handles the queued messages on std::terminate, and writes their text to stderr on the fatal signals.
+};
 
 class LUG_SYSTEM_API Logger {
 public:
     explicit Logger(const std::string& loggerName);
 
     Logger(const Logger&) = delete;
-    Logger(Logger&&) = default;
+    Logger(Logger&& logger);
 
     Logger& operator=(const Logger&) = delete;
-    Logger& operator=(Logger&&) = default;
+    Logger& operator=(Logger&&) = delete;
 
-    ~Logger() = default;
+    ~Logger();
 
     void addHandler(Handler* handler);
     void addHandler(const std::string& name);
@@ -39,6 +111,9 @@ public:
     template<typename... Args, typename T>
     void log(Level lvl, const T& fmt, Args&&... args);
 
+    template<typename T, typename... Args>
+    void trace(const T& fmt, Args&&... args);
+
     template<typename T, typename... Args>
     void debug(const T& fmt, Args&&... args);
 
@@ -58,20 +133,143 @@ public:
     void assrt(const T& fmt, Args&&... args);
 
     const std::string& getName() const;
+
+    /**
+     * @brief      Whether a message of this level would be handled by at least one handler.
+     *
+     *             The log calls check it before building the message, so a disabled level doesn't format its arguments.
+     *             The minimum level over the handlers is cached, and updated when a handler is added or changes its level.
+     *             The message is only formatted if a handler needs its text (Handler::needsText),
+     *             and its arguments only captured if a handler needs them (Handler::needsArguments).
+     */
+    bool shouldLog(Level level) const;
+
+    /**
+     * @brief      Handles the message with the handlers of the logger.
+     *
+     *             In asynchronous mode, the message is moved in the queue and handled by the background thread,
+     *             except for the Fatal and Assert messages that are handled before returning (see #flush).
+     */
     void handle(priv::Message& msg);
+
+    /**
+     * @brief      Flushes the handlers.
+     *
+     *             In asynchronous mode, it is a barrier: the messages logged before the call,
+     *             by any thread, are handled before the handlers are flushed.
+     */
     void flush();
 
+    /**
+     * @brief      Handles the messages on a background thread.
+     *
+     *             The log calls only format the message and push it in a bounded lock-free queue,
+     *             so the handlers are called by one thread at a time and don't slow down the callers.
+     *             Enabling and disabling it is not thread-safe, it should be done while no other thread logs.
+     *
+     * @param[in]  asyncInfo  The queue settings.
+     *
+     * @return     False if the background thread can't be started, the logger stays synchronous.
+     */
+    bool enableAsync(const AsyncInfo& asyncInfo = AsyncInfo{});
+
+    /**
+     * @brief      Handles the queued messages and stops the background thread.
+     */
+    void disableAsync();
+
+    bool isAsync() const;
+
+    /**
+     * @brief      Number of messages dropped because the queue was full, with Overflow::Drop and Overflow::Count.
+     */
+    uint64_t getDroppedCount() const;
+
     static Logger& getInternalLogger();
 
+private:
+    void dispatch(priv::Message& msg);
+    void updateHandlersState() const;
+
+    friend struct priv::AsyncQueue;
+
 protected:
     const std::string _name;
     std::set<Handler*> _handlers;
+
+    // Serializes the handlers in synchronous mode, recursive for the handlers that log
+    // A pointer to keep the logger movable
+    std::unique_ptr<std::recursive_mutex> _mutex;
+    std::unique_ptr<priv::AsyncQueue> _asyncQueue;
+
+    // Minimum level of the handlers, valid for the version of the levels of Handler::getLevelsVersion()
+    mutable std::atomic<Level> _minLevel{Level::Off};
+    mutable std::atomic<uint32_t> _levelsVersion{0};
+
+    // What the handlers read from the messages, updated with the handlers
+    mutable std::atomic<bool> _needsText{true};
+    mutable std::atomic<bool> _needsArguments{false};
 };
 
 #include <lug/System/Logger/Logger.inl>
 
 #define LUG_LOG ::lug::System::Logger::Logger::getInternalLogger()
 
+/**
+ * @brief      Logs with a logger if the level is enabled, the arguments are not evaluated otherwise.
+ */
+#define LUG_LOG_AT(logger, level, ...)                                              \
+    do {                                                                            \
+        if ((logger).shouldLog(level)) {                                            \
+            (logger).log(level, __VA_ARGS__);                                       \
+        }                                                                           \
+    } while (0)
+
+// Removed at compile time, still compiled to keep the arguments used and checked
+#define LUG_LOG_STRIPPED(logger, level, ...)                                        \
+    do {                                                                            \
+        if (false) {                                                                \
+            (logger).log(level, __VA_ARGS__);                                       \
+        }                                                                           \
+    } while (0)
+
+#if LUG_LOG_MIN_LEVEL <= LUG_LOG_LEVEL_TRACE
+    #define LUG_LOGGER_TRACE(logger, ...) LUG_LOG_AT(logger, ::lug::System::Logger::Level::Trace, __VA_ARGS__)
+#else
+    #define LUG_LOGGER_TRACE(logger, ...) LUG_LOG_STRIPPED(logger, ::lug::System::Logger::Level::Trace, __VA_ARGS__)
+#endif
+
+#if LUG_LOG_MIN_LEVEL <= LUG_LOG_LEVEL_DEBUG
+    #define LUG_LOGGER_DEBUG(logger, ...) LUG_LOG_AT(logger, ::lug::System::Logger::Level::Debug, __VA_ARGS__)
+#else
+    #define LUG_LOGGER_DEBUG(logger, ...) LUG_LOG_STRIPPED(logger, ::lug::System::Logger::Level::Debug, __VA_ARGS__)
+#endif
+
+#if LUG_LOG_MIN_LEVEL <= LUG_LOG_LEVEL_INFO
+    #define LUG_LOGGER_INFO(logger, ...) LUG_LOG_AT(logger, ::lug::System::Logger::Level::Info, __VA_ARGS__)
+#else
+    #define LUG_LOGGER_INFO(logger, ...) LUG_LOG_STRIPPED(logger, ::lug::System::Logger::Level::Info, __VA_ARGS__)
+#endif
+
+#if LUG_LOG_MIN_LEVEL <= LUG_LOG_LEVEL_WARNING
+    #define LUG_LOGGER_WARN(logger, ...) LUG_LOG_AT(logger, ::lug::System::Logger::Level::Warning, __VA_ARGS__)
+#else
+    #define LUG_LOGGER_WARN(logger, ...) LUG_LOG_STRIPPED(logger, ::lug::System::Logger::Level::Warning, __VA_ARGS__)
+#endif
+
+#if LUG_LOG_MIN_LEVEL <= LUG_LOG_LEVEL_ERROR
+    #define LUG_LOGGER_ERROR(logger, ...) LUG_LOG_AT(logger, ::lug::System::Logger::Level::Error, __VA_ARGS__)
+#else
+    #define LUG_LOGGER_ERROR(logger, ...) LUG_LOG_STRIPPED(logger, ::lug::System::Logger::Level::Error, __VA_ARGS__)
+#endif
+
+// With the internal logger
+#define LUG_LOG_TRACE(...)  LUG_LOGGER_TRACE(LUG_LOG, __VA_ARGS__)
+#define LUG_LOG_DEBUG(...)  LUG_LOGGER_DEBUG(LUG_LOG, __VA_ARGS__)
+#define LUG_LOG_INFO(...)   LUG_LOGGER_INFO(LUG_LOG, __VA_ARGS__)
+#define LUG_LOG_WARN(...)   LUG_LOGGER_WARN(LUG_LOG, __VA_ARGS__)
+#define LUG_LOG_ERROR(...)  LUG_LOGGER_ERROR(LUG_LOG, __VA_ARGS__)
+
 } // Logger
 } // System
 } // lug
@@ -1,8 +1,33 @@
+template <typename Function>
+inline LazyArg<typename std::decay<Function>::type> lazy(Function&& function) {
+    return LazyArg<typename std::decay<Function>::type>(std::forward<Function>(function));
+}
+
+inline bool Logger::shouldLog(Level level) const {
+    if (_levelsVersion.load(std::memory_order_relaxed) != Handler::getLevelsVersion()) {
+        updateHandlersState();
+    }
+
+    return level >= _minLevel.load(std::memory_order_relaxed);
+}
+
 template<typename T>
 inline void Logger::log(Level lvl, const T& msg) {
+    if (!shouldLog(lvl)) {
+        return;
+    }
+
     try {
-        priv::Message logMsg(_name, lvl);
-        logMsg.raw.write("{}", msg);
+        priv::Message logMsg(_name.c_str(), lvl);
+
+        if (_needsText.load(std::memory_order_relaxed)) {
+            logMsg.raw.write("{}", msg);
+        }
+
+        if (_needsArguments.load(std::memory_order_relaxed)) {
+            priv::captureArguments(logMsg, "{}", msg);
+        }
+
         handle(logMsg);
     } catch (const std::exception& ex) {
         defaultErrHandler(ex);
@@ -11,15 +36,32 @@ inline void Logger::log(Level lvl, const T& msg) {
 
 template<typename... Args, typename T>
 inline void Logger::log(Level lvl, const T& fmt, Args&&... args) {
+    if (!shouldLog(lvl)) {
+        return;
+    }
+
     try {
-        priv::Message logMsg(_name, lvl);
-        logMsg.raw.write(fmt, std::forward<Args>(args)...);
+        priv::Message logMsg(_name.c_str(), lvl);
+
+        if (_needsText.load(std::memory_order_relaxed)) {
+            logMsg.raw.write(fmt, args...);
+        }
+
+        if (_needsArguments.load(std::memory_order_relaxed)) {
+            priv::captureArguments(logMsg, fmt, args...);
+        }
+
         handle(logMsg);
     } catch (const std::exception& ex) {
         defaultErrHandler(ex);
     }
 }
 
+template<typename T, typename... Args>
+inline void Logger::trace(const T& fmt, Args&&... args) {
+    log(Level::Trace, fmt, std::forward<Args>(args)...);
+}
+
 template<typename T, typename... Args>
 inline void Logger::debug(const T& fmt, Args&&... args) {
     log(Level::Debug, fmt, std::forward<Args>(args)...);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <lug/System/Logger/Common.hpp>
 
 namespace lug {
@@ -14,7 +16,7 @@ namespace priv {
 class Message {
 public:
     Message() = default;
-    Message(const std::string& _loggerName, Level _level): loggerName(_loggerName), level(_level) {}
+    Message(const char* _loggerName, Level _level): loggerName(_loggerName), level(_level) {}
 
     Message(const Message&) = default;
     Message(Message&&) = default;
@@ -24,11 +26,19 @@ public:
 
     ~Message() = default;
 
-    const std::string loggerName;
+    // Name of the logger, owned by the logger, not copied for each message
+    const char* loggerName{""};
     Level level;
 
+    // Time of the log call, the asynchronous handlers format the message later
+    std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
+
     fmt::MemoryWriter raw;
     fmt::MemoryWriter formatted;
+
+    // Captured for the handlers that need the arguments instead of the text (see Handler::needsArguments)
+    // The format is the first argument
+    fmt::MemoryWriter arguments;
 };
 
 } // priv
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+/**
+ * @brief      Bounded lock-free multiple producers / single consumer ring buffer.
+ *
+ *             Each slot has a sequence number telling whether it is free for the producer
+ *             of a position or filled for the consumer, so the producers only contend on
+ *             the claim of a position (one compare and swap).
+ *             Any thread can #tryPush, only one thread at a time can #pop.
+ *
+ * @tparam     T     Type of the elements, constructed in place in the slots.
+ */
+template <typename T>
+class RingBuffer {
+public:
+    /**
+     * @param[in]  capacity  The capacity, rounded up to the next power of two.
+     */
+    explicit RingBuffer(uint32_t capacity);
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&&) = delete;
+
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer& operator=(RingBuffer&&) = delete;
+
+    ~RingBuffer();
+
+    /**
+     * @brief      Moves the element in the buffer.
+     *
+     * @param      element  The element, left untouched if the buffer is full.
+     *
+     * @return     False if the buffer is full.
+     */
+    bool tryPush(T&& element);
+
+    /**
+     * @brief      Removes up to maxCount elements, in the order of their positions. Consumer only.
+     *
+     * @param      function  Called with a reference to each element, before its destruction. Must not throw.
+     * @param[in]  maxCount  The maximum number of elements to remove.
+     *
+     * @return     The number of elements removed.
+     */
+    template <typename Function>
+    uint32_t pop(Function&& function, uint32_t maxCount = UINT32_MAX);
+
+    /**
+     * @brief      Calls function with each element not removed yet, in the order of their positions, without removing them.
+     *             Consumer only, it doesn't allocate nor lock, so it can be called from a signal handler.
+     *
+     * @return     The number of elements visited.
+     */
+    template <typename Function>
+    uint32_t peek(Function&& function) const;
+
+    /**
+     * @brief      Position of the next element to push, i.e. the number of positions claimed.
+     *             An element is removed once #getReadPosition is past its position.
+     */
+    uint64_t getWritePosition() const;
+
+    /**
+     * @brief      Position of the next element to remove, i.e. the number of elements removed.
+     */
+    uint64_t getReadPosition() const;
+
+    uint32_t getCapacity() const;
+    bool empty() const;
+
+private:
+    static uint32_t roundCapacity(uint32_t capacity);
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+private:
+    // Claimed by the producers
+    std::atomic<uint64_t> _writePosition{0};
+
+    const uint32_t _capacity;
+    std::unique_ptr<Slot[]> _slots;
+
+    // Written by the consumer
+    std::atomic<uint64_t> _readPosition{0};
+};
+
+#include <lug/System/Logger/RingBuffer.inl>
+
+} // Logger
+} // System
+} // lug
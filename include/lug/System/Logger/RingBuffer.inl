@@ -0,0 +1,115 @@
+template <typename T>
+inline RingBuffer<T>::RingBuffer(uint32_t capacity) : _capacity(roundCapacity(capacity)) {
+    _slots = std::make_unique<Slot[]>(_capacity);
+
+    for (uint32_t i = 0; i < _capacity; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+inline RingBuffer<T>::~RingBuffer() {
+    pop([](T&) {});
+}
+
+template <typename T>
+inline bool RingBuffer<T>::tryPush(T&& element) {
+    uint64_t position = _writePosition.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Slot& slot = _slots[position & (_capacity - 1)];
+        const int64_t difference = static_cast<int64_t>(slot.sequence.load(std::memory_order_acquire) - position);
+
+        if (difference == 0) {
+            // The slot is free for this position, claim it
+            if (_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                new (&slot.storage) T(std::move(element));
+                slot.sequence.store(position + 1, std::memory_order_release);
+
+                return true;
+            }
+        } else if (difference < 0) {
+            // The slot still holds the element of the previous lap, the buffer is full
+            return false;
+        } else {
+            // Another producer claimed the position
+            position = _writePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+template <typename Function>
+inline uint32_t RingBuffer<T>::pop(Function&& function, uint32_t maxCount) {
+    uint64_t position = _readPosition.load(std::memory_order_relaxed);
+    uint32_t count = 0;
+
+    for (; count < maxCount; ++count, ++position) {
+        Slot& slot = _slots[position & (_capacity - 1)];
+
+        // The position is claimed but the element is not written yet, or nothing was pushed
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+
+        T* element = reinterpret_cast<T*>(&slot.storage);
+        function(*element);
+        element->~T();
+
+        // Free the slot for the position of the next lap
+        slot.sequence.store(position + _capacity, std::memory_order_release);
+        _readPosition.store(position + 1, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template <typename T>
+template <typename Function>
+inline uint32_t RingBuffer<T>::peek(Function&& function) const {
+    uint64_t position = _readPosition.load(std::memory_order_acquire);
+    uint32_t count = 0;
+
+    for (; count < _capacity; ++count, ++position) {
+        const Slot& slot = _slots[position & (_capacity - 1)];
+
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+
+        function(*reinterpret_cast<const T*>(&slot.storage));
+    }
+
+    return count;
+}
+
+template <typename T>
+inline uint32_t RingBuffer<T>::roundCapacity(uint32_t capacity) {
+    uint32_t powerOfTwo = 2;
+
+    while (powerOfTwo < capacity && powerOfTwo < (1u << 31)) {
+        powerOfTwo <<= 1;
+    }
+
+    return powerOfTwo;
+}
+
+template <typename T>
+inline uint64_t RingBuffer<T>::getWritePosition() const {
+    return _writePosition.load(std::memory_order_acquire);
+}
+
+template <typename T>
+inline uint64_t RingBuffer<T>::getReadPosition() const {
+    return _readPosition.load(std::memory_order_acquire);
+}
+
+template <typename T>
+inline uint32_t RingBuffer<T>::getCapacity() const {
+    return _capacity;
+}
+
+template <typename T>
+inline bool RingBuffer<T>::empty() const {
+    return getReadPosition() == getWritePosition();
+}
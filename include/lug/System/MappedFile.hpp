@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+
+/**
+ * @brief      A file mapped in memory.
+ *
+ *             The pages are loaded by the system on access and the writes go to its page cache,
+ *             so they are kept if the program crashes.
+ */
+class LUG_SYSTEM_API MappedFile {
+public:
+    MappedFile() = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& mappedFile);
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& mappedFile);
+
+    ~MappedFile();
+
+    /**
+     * @brief      Maps an existing file, read only.
+     *
+     * @param[in]  filename  The filename.
+     *
+     * @return     False if the file can't be opened or mapped, or is empty.
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief      Creates or truncates a file of `size` bytes filled with zeros, and maps it for writing.
+     *
+     * @param[in]  filename  The filename.
+     * @param[in]  size      The size of the file.
+     *
+     * @return     False if the file can't be created or mapped.
+     */
+    bool create(const std::string& filename, std::size_t size);
+
+    /**
+     * @brief      Starts writing the modified pages back to the file, without waiting.
+     */
+    void flush();
+
+    /**
+     * @brief      Unmaps the file.
+     */
+    void close();
+
+    /**
+     * @brief      Unmaps a file mapped by create() and truncates it.
+     *
+     * @param[in]  size  The size to keep, in bytes.
+     */
+    void close(std::size_t size);
+
+    bool isOpen() const;
+
+    const uint8_t* getData() const;
+    uint8_t* getData();
+    std::size_t getSize() const;
+
+private:
+    uint8_t* _data{nullptr};
+    std::size_t _size{0};
+    bool _writable{false};
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    void* _file{nullptr};
+    void* _mapping{nullptr};
+#else
+    int _file{-1};
+#endif
+};
+
+#include <lug/System/MappedFile.inl>
+
+} // System
+} // lug
@@ -0,0 +1,15 @@
+inline bool MappedFile::isOpen() const {
+    return _data != nullptr;
+}
+
+inline const uint8_t* MappedFile::getData() const {
+    return _data;
+}
+
+inline uint8_t* MappedFile::getData() {
+    return _data;
+}
+
+inline std::size_t MappedFile::getSize() const {
+    return _size;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+
+/**
+ * @brief      A zone measured on one thread.
+ */
+struct Event {
+    const char* name;   // Static string, only its address is stored
+    int64_t begin;      // Nanoseconds, see lug::System::Clock::getTimestamp
+    int64_t end;
+    uint32_t threadId;
+    uint32_t depth;     // Number of zones of the same thread containing this one
+};
+
+} // Profiler
+} // System
+} // lug
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <lug/System/Export.hpp>
+#include <lug/System/Profiler/Event.hpp>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+namespace Exporter {
+
+/**
+ * @brief      Writes events in the Chrome trace event format (chrome://tracing, Perfetto, Speedscope).
+ *             The timestamps are relative to the first event.
+ *
+ * @return     Whether the events were successfully written.
+ */
+LUG_SYSTEM_API bool writeChromeTrace(std::ostream& stream, const std::vector<Event>& events);
+LUG_SYSTEM_API bool writeChromeTrace(const std::string& filename, const std::vector<Event>& events);
+
+/**
+ * @brief      Writes events in the compact binary format:
+ *             a header (magic, version, names count, events count), the names (size and characters),
+ *             then the events (name index, thread id, depth, begin, end), in native endianness.
+ *
+ * @return     Whether the events were successfully written.
+ */
+LUG_SYSTEM_API bool writeBinary(const std::string& filename, const std::vector<Event>& events);
+
+/**
+ * @brief      Reads events written by #writeBinary.
+ *
+ * @param[in]  filename  The filename.
+ * @param      names     The names of the events, the events point into its strings.
+ * @param      events    The events.
+ *
+ * @return     Whether the events were successfully read.
+ */
+LUG_SYSTEM_API bool readBinary(const std::string& filename, std::vector<std::string>& names, std::vector<Event>& events);
+
+} // Exporter
+} // Profiler
+} // System
+} // lug
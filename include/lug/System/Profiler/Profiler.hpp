@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <lug/System/Clock.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Profiler/Event.hpp>
+#include <lug/System/Profiler/ThreadBuffer.hpp>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+
+/**
+ * @brief      CPU profiler.
+ *
+ *             The code is instrumented with #LUG_PROFILE_SCOPE, each zone writes an Event in the ThreadBuffer
+ *             of its thread when it ends, without lock. The events are gathered by #collect, usually once per frame,
+ *             then exported (see Exporter.hpp).
+ *
+ *             The profiler is disabled by default, a disabled zone only costs the check of #isEnabled.
+ *             Building with LUG_PROFILER_DISABLED removes the zones completely.
+ */
+class LUG_SYSTEM_API Profiler {
+private:
+    Profiler() = default;
+
+public:
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    ~Profiler() = default;
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * @brief      Gets the buffer of the calling thread, created on the first call.
+     *             The buffers are never destroyed, the events of a thread can be collected after its end.
+     */
+    ThreadBuffer& getThreadBuffer();
+
+    /**
+     * @brief      Moves the events of all the threads at the end of events.
+     *             The events of each thread are sorted by end time.
+     */
+    void collect(std::vector<Event>& events);
+
+    /**
+     * @brief      Gets the number of events dropped because a thread buffer was full,
+     *             #collect should be called more often if it isn't 0.
+     */
+    uint64_t getDroppedCount();
+
+    static Profiler& getInstance();
+
+private:
+    std::atomic<bool> _enabled{false};
+
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> _threadBuffers;
+};
+
+/**
+ * @brief      Measures a zone, from its construction to its destruction.
+ */
+class Zone {
+public:
+    /**
+     * @param[in]  name  The name of the zone, must be a static string.
+     */
+    explicit Zone(const char* name);
+
+    Zone(const Zone&) = delete;
+    Zone(Zone&&) = delete;
+
+    Zone& operator=(const Zone&) = delete;
+    Zone& operator=(Zone&&) = delete;
+
+    ~Zone();
+
+private:
+    const char* _name;
+    ThreadBuffer* _threadBuffer{nullptr};
+    int64_t _begin{0};
+};
+
+#include <lug/System/Profiler/Profiler.inl>
+
+} // Profiler
+} // System
+} // lug
+
+#if defined(LUG_PROFILER_DISABLED)
+    #define LUG_PROFILE_SCOPE(name)
+#else
+    #define LUG_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define LUG_PROFILE_CONCAT(a, b) LUG_PROFILE_CONCAT_IMPL(a, b)
+
+    #define LUG_PROFILE_SCOPE(name) ::lug::System::Profiler::Zone LUG_PROFILE_CONCAT(lugProfilerZone, __LINE__)(name)
+#endif
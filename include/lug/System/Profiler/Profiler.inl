@@ -0,0 +1,23 @@
+inline void Profiler::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+inline bool Profiler::isEnabled() const {
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+inline Zone::Zone(const char* name) : _name(name) {
+    Profiler& profiler = Profiler::getInstance();
+
+    if (profiler.isEnabled()) {
+        _threadBuffer = &profiler.getThreadBuffer();
+        _threadBuffer->beginZone();
+        _begin = Clock::getTimestamp();
+    }
+}
+
+inline Zone::~Zone() {
+    if (_threadBuffer) {
+        _threadBuffer->endZone(_name, _begin, Clock::getTimestamp());
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <lug/System/Export.hpp>
+#include <lug/System/Profiler/Event.hpp>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+
+/**
+ * @brief      Lock-free ring buffer of the events of one thread.
+ *
+ *             The thread owning the buffer is the only one to #push (and to begin zones),
+ *             and only one thread at a time can #pop, i.e. the profiler when it collects the events.
+ *             When the buffer is full the new events are dropped, and counted.
+ */
+class LUG_SYSTEM_API ThreadBuffer {
+public:
+    // Must be a power of two
+    static constexpr uint32_t capacity = 1 << 14;
+
+public:
+    explicit ThreadBuffer(uint32_t threadId);
+
+    ThreadBuffer(const ThreadBuffer&) = delete;
+    ThreadBuffer(ThreadBuffer&&) = delete;
+
+    ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+    ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+    ~ThreadBuffer() = default;
+
+    /**
+     * @brief      Begins a zone. Owner thread only.
+     *
+     * @return     The depth of the zone.
+     */
+    uint32_t beginZone();
+
+    /**
+     * @brief      Ends the zone begun last and pushes its event. Owner thread only.
+     */
+    void endZone(const char* name, int64_t begin, int64_t end);
+
+    /**
+     * @brief      Pushes an event. Owner thread only.
+     *
+     * @return     False if the buffer is full and the event has been dropped.
+     */
+    bool push(const Event& event);
+
+    /**
+     * @brief      Moves all the pushed events at the end of events.
+     */
+    void pop(std::vector<Event>& events);
+
+    uint32_t getThreadId() const;
+    uint64_t getDroppedCount() const;
+
+private:
+    std::unique_ptr<Event[]> _events;
+
+    // Written by the owner thread
+    std::atomic<uint32_t> _head{0};
+    // Written by the consumer
+    std::atomic<uint32_t> _tail{0};
+
+    std::atomic<uint64_t> _droppedCount{0};
+
+    const uint32_t _threadId;
+    uint32_t _depth{0};
+};
+
+#include <lug/System/Profiler/ThreadBuffer.inl>
+
+} // Profiler
+} // System
+} // lug
@@ -0,0 +1,37 @@
+inline uint32_t ThreadBuffer::beginZone() {
+    return _depth++;
+}
+
+inline void ThreadBuffer::endZone(const char* name, int64_t begin, int64_t end) {
+    --_depth;
+
+    push({
+        /* event.name       */ name,
+        /* event.begin      */ begin,
+        /* event.end        */ end,
+        /* event.threadId   */ _threadId,
+        /* event.depth      */ _depth
+    });
+}
+
+inline bool ThreadBuffer::push(const Event& event) {
+    const uint32_t head = _head.load(std::memory_order_relaxed);
+
+    if (head - _tail.load(std::memory_order_acquire) == capacity) {
+        _droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    _events[head & (capacity - 1)] = event;
+    _head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+inline uint32_t ThreadBuffer::getThreadId() const {
+    return _threadId;
+}
+
+inline uint64_t ThreadBuffer::getDroppedCount() const {
+    return _droppedCount.load(std::memory_order_relaxed);
+}
@@ -10,9 +10,12 @@ auto ThreadPool::enqueue(Func&& func, Args&&... args) {
 
     // Add lambda which execute the task
     // futureTask will be destroyed when finished
-    _queue.push([futureTask]{
-        (*futureTask)();
-    });
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push([futureTask]{
+            (*futureTask)();
+        });
+    }
 
     // Notify one worker to execute the task
     _condition.notify_one();
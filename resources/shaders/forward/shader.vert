@@ -4,9 +4,13 @@
 // BLOCK OF STATIC INPUTS
 //////////////////////////////////////////////////////////////////////////////
 
+#if INSTANCED
+layout (location = IN_INSTANCE_TRANSFORM_LOCATION) in mat4 inInstanceTransform;
+#else
 layout (push_constant) uniform modelBlock {
     mat4 transform;
 } model;
+#endif
 
 layout(std140, set = 0, binding = 0) uniform cameraBlock {
     mat4 view;
@@ -86,12 +90,18 @@ layout (location = IN_FREE_LOCATION) out vec3 outCameraPositionWorldSpace;
 //////////////////////////////////////////////////////////////////////////////
 
 void main() {
+    #if INSTANCED
+    mat4 transform = inInstanceTransform;
+    #else
+    mat4 transform = model.transform;
+    #endif
+
     //////////////////////////////////////////////////////////////////////
     // TRANSFER DYNAMIC OUTPUT
     //////////////////////////////////////////////////////////////////////
 
     #if IN_TANGENT
-    outTangent = vec4(normalize(mat3(transpose(inverse(model.transform))) * inTangent.xyz), inTangent.w);
+    outTangent = vec4(normalize(mat3(transpose(inverse(transform))) * inTangent.xyz), inTangent.w);
     #endif
 
     #if IN_UV >= 1
@@ -120,13 +130,13 @@ void main() {
     // TRANSFER STATIC OUTPUT
     //////////////////////////////////////////////////////////////////////
 
-    outPositionWorldSpace = vec3(model.transform * vec4(inPosition, 1.0));
-    outNormalWorldSpace = normalize(mat3(transpose(inverse(model.transform))) * inNormal);
+    outPositionWorldSpace = vec3(transform * vec4(inPosition, 1.0));
+    outNormalWorldSpace = normalize(mat3(transpose(inverse(transform))) * inNormal);
 
     //////////////////////////////////////////////////////////////////////
     // OUTPUT gl_Position
     //////////////////////////////////////////////////////////////////////
 
-    gl_Position = camera.proj * camera.view * model.transform * vec4(inPosition, 1.0);
+    gl_Position = camera.proj * camera.view * transform * vec4(inPosition, 1.0);
     gl_Position.y = -gl_Position.y;
 }
@@ -163,6 +163,12 @@ macro(lug_add_sample target)
         add_shaders(${target} ${THIS_SHADERS})
     endif()
 
+    # copy the archive of the forward shaders with them, if Lugdunum was installed with one
+    list(FIND THIS_LUG_RESOURCES shaders/forward/shader.frag THIS_FORWARD_SHADERS_INDEX)
+    if(NOT LUG_OS_ANDROID AND NOT THIS_FORWARD_SHADERS_INDEX EQUAL -1 AND EXISTS ${LUG_RESOURCES_DIR}/shaders/forward/shaders.lsa)
+        list(APPEND THIS_LUG_RESOURCES shaders/forward/shaders.lsa)
+    endif()
+
     # copy lugdunum resources
     if(THIS_LUG_RESOURCES)
         add_resources(${target} "lug-resources-${target}" ${LUG_RESOURCES_DIR} ${THIS_LUG_RESOURCES})
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Core/Application.hpp>
+#include <lug/Graphics/Render/Mesh.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
+
+/**
+ * @brief      Renders a grid of PBR spheres for a fixed number of frames and reports
+ *             the percentiles of the CPU and GPU frame times and of the latency.
+ *
+ *             Run it with `--headless` to render offscreen (e.g. on lavapipe or SwiftShader in CI)
+ *             and `--frames N` to change the number of rendered frames, the warmup frames included.
+ *             `--frames-in-flight N` and `--present-mode fifo|mailbox|immediate` compare the frame pacing settings.
+ *             `--views N` splits the window into N views around the scene, `--nodes N` renders N spheres in a cube
+ *             instead of the 7x7 grid and `--visibility shared|per-view` compares the culling of the views
+ *             in one traversal of the scene with one traversal per view, e.g. `--views 4 --nodes 50000`.
+ *             `--load <file>` times the load of a file by the ResourceManager before the first frame, e.g. to compare
+ *             a glTF file with the package cooked from it by `lug-asset-cooker`.
+ *             `--materials N` and `--lights N` change the number of materials and point lights, to time the upload of the
+ *             uniforms of each frame, e.g. `--nodes 10000 --materials 10000 --lights 1000`.
+ *             `--recording-threads N` and `--instancing on|off` time the recording of the draws,
+ *             e.g. `--nodes 50000 --materials 50000 --recording-threads 8` for 50k draws.
+ */
+class Application : public ::lug::Core::Application {
+public:
+    Application();
+
+    Application(const Application&) = delete;
+    Application(Application&&) = delete;
+
+    Application& operator=(const Application&) = delete;
+    Application& operator=(Application&&) = delete;
+
+    ~Application() override final = default;
+
+    bool init(int argc, char* argv[]);
+    bool initSphereMesh(int segmentsCount);
+
+    void onEvent(const lug::Window::Event& event) override final;
+    void onFrame(const lug::System::Time& elapsedTime) override final;
+
+    /**
+     * @brief      Logs the percentiles of the frame times and latencies measured after the warmup.
+     */
+    void printResults() const;
+
+private:
+    void initRenderViews();
+
+    /**
+     * @brief      Gets the durations in milliseconds of a zone of the CPU profiler, measured after the warmup.
+     */
+    std::vector<float> getZoneTimes(const char* name) const;
+
+    static void printPercentiles(const std::string& name, std::vector<float> samples);
+
+private:
+    static constexpr uint32_t warmupFramesCount = 60;
+    static constexpr uint32_t defaultFramesCount = 600;
+    static constexpr uint32_t defaultNodesCount = 49;
+    static constexpr uint32_t defaultMaterialsCount = 49;
+    static constexpr uint32_t defaultLightsCount = 4;
+
+    uint32_t _viewsCount{1};
+    uint32_t _nodesCount{defaultNodesCount};
+    bool _sharedVisibility{true};
+    uint32_t _materialsCount{defaultMaterialsCount};
+    uint32_t _lightsCount{defaultLightsCount};
+    bool _instancing{true};
+    uint8_t _recordingThreadCount{1};
+
+    std::string _loadFilename;
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Resource> _loadedResource;
+
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Scene::Scene> _scene;
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Mesh> _sphereMesh;
+
+    uint32_t _framesCount{0};
+    uint32_t _warmupFrames{0};
+    int64_t _measureBegin{0};
+    std::vector<float> _cpuFrameTimes;
+    std::vector<float> _gpuFrameTimes;
+    std::vector<float> _latencies;
+};
@@ -0,0 +1,490 @@
+#include "Application.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <lug/Graphics/Builder/Camera.hpp>
+#include <lug/Graphics/Builder/Light.hpp>
+#include <lug/Graphics/Builder/Material.hpp>
+#include <lug/Graphics/Builder/Mesh.hpp>
+#include <lug/Graphics/Builder/Scene.hpp>
+#include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
+#include <lug/Graphics/Vulkan/Render/Window.hpp>
+#include <lug/Math/Geometry/Trigonometry.hpp>
+#include <lug/System/Clock.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
+
+constexpr uint32_t Application::warmupFramesCount;
+constexpr uint32_t Application::defaultFramesCount;
+constexpr uint32_t Application::defaultNodesCount;
+constexpr uint32_t Application::defaultMaterialsCount;
+constexpr uint32_t Application::defaultLightsCount;
+
+Application::Application() : lug::Core::Application::Application{{"benchmark", {0, 1, 0}}} {
+    getRenderWindowInfo().windowInitInfo.title = "Benchmark";
+}
+
+bool Application::init(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--views") == 0 && i + 1 < argc) {
+            _viewsCount = std::max<uint32_t>(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1);
+        } else if (std::strcmp(argv[i], "--nodes") == 0 && i + 1 < argc) {
+            _nodesCount = std::max<uint32_t>(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1);
+        } else if (std::strcmp(argv[i], "--visibility") == 0 && i + 1 < argc) {
+            const char* visibility = argv[++i];
+
+            if (std::strcmp(visibility, "shared") == 0) {
+                _sharedVisibility = true;
+            } else if (std::strcmp(visibility, "per-view") == 0) {
+                _sharedVisibility = false;
+            } else {
+                LUG_LOG.warn("Application: Unknown visibility {}, the shared one is used", visibility);
+            }
+        } else if (std::strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            _loadFilename = argv[++i];
+        } else if (std::strcmp(argv[i], "--materials") == 0 && i + 1 < argc) {
+            _materialsCount = std::max<uint32_t>(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1);
+        } else if (std::strcmp(argv[i], "--lights") == 0 && i + 1 < argc) {
+            _lightsCount = std::max<uint32_t>(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1);
+        } else if (std::strcmp(argv[i], "--recording-threads") == 0 && i + 1 < argc) {
+            _recordingThreadCount = static_cast<uint8_t>(std::max<unsigned long>(std::strtoul(argv[++i], nullptr, 10), 1));
+        } else if (std::strcmp(argv[i], "--instancing") == 0 && i + 1 < argc) {
+            const char* instancing = argv[++i];
+
+            if (std::strcmp(instancing, "on") == 0) {
+                _instancing = true;
+            } else if (std::strcmp(instancing, "off") == 0) {
+                _instancing = false;
+            } else {
+                LUG_LOG.warn("Application: Unknown instancing {}, it is enabled", instancing);
+            }
+        }
+    }
+
+    // The views are created with the window
+    initRenderViews();
+
+    if (!lug::Core::Application::init(argc, argv)) {
+        return false;
+    }
+
+    // The frames limit of lug::Core::Application includes the warmup frames
+    _framesCount = getFramesLimit() > warmupFramesCount ? getFramesLimit() - warmupFramesCount : defaultFramesCount;
+
+    _cpuFrameTimes.reserve(_framesCount);
+    _gpuFrameTimes.reserve(_framesCount);
+    _latencies.reserve(_framesCount);
+
+    lug::Graphics::Renderer* renderer = _graphics.getRenderer();
+
+    auto& preferences = static_cast<lug::Graphics::Vulkan::Renderer*>(renderer)->getPreferences();
+    preferences.visibility.shared = _sharedVisibility;
+    preferences.instancing.enabled = _instancing;
+    preferences.recording.threadCount = _recordingThreadCount;
+
+    // The CPU times of the uniform uploads and of the recording are read from the zones of the profiler
+    lug::System::Profiler::Profiler::getInstance().setEnabled(true);
+
+    // Time the load of a file, e.g. a glTF file and the package cooked from it by lug-asset-cooker
+    if (!_loadFilename.empty()) {
+        const uint64_t copiedBytes = lug::Graphics::Builder::Mesh::getCopiedBytes();
+        const uint64_t submitsCount = lug::Graphics::Vulkan::Render::UploadBatch::getSubmitsCount();
+        const uint64_t stagingAllocationsCount = lug::Graphics::Vulkan::Render::UploadBatch::getStagingAllocationsCount();
+        lug::System::Clock clock;
+
+        _loadedResource = renderer->getResourceManager()->loadFile(_loadFilename);
+        if (!_loadedResource) {
+            LUG_LOG.error("Application: Can't load {}", _loadFilename);
+            return false;
+        }
+
+        LUG_LOG.info(
+            "Application: Loaded {} in {} ms, {} bytes of vertex data copied, {} upload submits, {} staging allocations",
+            _loadFilename,
+            clock.getElapsedTime().getMilliseconds(),
+            lug::Graphics::Builder::Mesh::getCopiedBytes() - copiedBytes,
+            lug::Graphics::Vulkan::Render::UploadBatch::getSubmitsCount() - submitsCount,
+            lug::Graphics::Vulkan::Render::UploadBatch::getStagingAllocationsCount() - stagingAllocationsCount
+        );
+    }
+
+    // Build the scene
+    {
+        lug::Graphics::Builder::Scene sceneBuilder(*renderer);
+        sceneBuilder.setName("scene");
+
+        _scene = sceneBuilder.build();
+        if (!_scene) {
+            LUG_LOG.error("Application: Can't create the scene");
+            return false;
+        }
+    }
+
+    // Build the sphere, with less triangles for the large scenes
+    if (!initSphereMesh(_nodesCount > defaultNodesCount ? 8 : 64)) {
+        return false;
+    }
+
+    // The spheres fill a cube, a 7x7 grid with the default number of nodes
+    const uint32_t gridSize = std::max<uint32_t>(static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<float>(_nodesCount)))), 7);
+    const float spacing = 2.5f;
+    const float gridExtent = (gridSize - 1) * spacing / 2.0f;
+
+    // Attach the spheres
+    {
+        const int nbRows = 7;
+        const int nbColumns = 7;
+
+        lug::Graphics::Builder::Material materialBuilder(*renderer);
+        materialBuilder.setBaseColorFactor({1.0f, 0.0f, 0.0f, 1.0f});
+
+        // One material per cell of the 7x7 grid by default, shared by the spheres of the large scenes
+        std::vector<lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Material>> materials;
+        materials.reserve(_materialsCount);
+
+        for (uint32_t i = 0; i < _materialsCount; ++i) {
+            const int row = static_cast<int>(i / nbColumns) % nbRows;
+            const int col = static_cast<int>(i % nbColumns);
+
+            materialBuilder.setMetallicFactor((float)row / (float)nbRows);
+
+            if (col == 0) {
+                materialBuilder.setRoughnessFactor(0.05f);
+            } else {
+                materialBuilder.setRoughnessFactor((float)col / (float)nbColumns);
+            }
+
+            // Each material has its own uniforms, even with the same factors
+            materials.push_back(materialBuilder.build());
+            if (!materials.back()) {
+                LUG_LOG.error("Application: Can't create the material {}", i);
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < _nodesCount; ++i) {
+            const uint32_t col = i % gridSize;
+            const uint32_t row = (i / gridSize) % gridSize;
+            const uint32_t layer = i / (gridSize * gridSize);
+
+            lug::Graphics::Scene::Node* node = _scene->createSceneNode("sphere" + std::to_string(i));
+            _scene->getRoot().attachChild(*node);
+
+            // The default materials follow the cells of the grid, the others are spread over the spheres
+            const uint32_t material = _materialsCount == defaultMaterialsCount ? (row % nbRows) * nbColumns + col % nbColumns : i % _materialsCount;
+            node->attachMeshInstance(_sphereMesh, materials[material]);
+
+            node->setPosition({
+                (float)col * spacing - gridExtent,
+                (float)row * spacing - gridExtent,
+                -(float)layer * spacing
+            }, lug::Graphics::Node::TransformSpace::World);
+        }
+    }
+
+    // Attach one camera per view, around the scene
+    {
+        auto& renderViews = _graphics.getRenderer()->getWindow()->getRenderViews();
+
+        LUG_ASSERT(renderViews.size() > 0, "There should be at least 1 render view");
+
+        const float distance = gridExtent * 2.0f + 10.0f;
+        const float depth = static_cast<float>((_nodesCount - 1) / (gridSize * gridSize)) * spacing;
+
+        for (uint32_t i = 0; i < renderViews.size(); ++i) {
+            lug::Graphics::Builder::Camera cameraBuilder(*renderer);
+
+            cameraBuilder.setFovY(45.0f);
+            cameraBuilder.setZNear(0.1f);
+            cameraBuilder.setZFar(std::max(100.0f, distance * 3.0f));
+
+            lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Camera::Camera> camera = cameraBuilder.build();
+            if (!camera) {
+                LUG_LOG.error("Application: Can't create the camera {}", i);
+                return false;
+            }
+
+            lug::Graphics::Scene::Node* node = _scene->createSceneNode("camera" + std::to_string(i));
+            _scene->getRoot().attachChild(*node);
+
+            node->attachCamera(camera);
+
+            // Around the center of the spheres, the first camera in front of them
+            const lug::Math::Vec3f center{0.0f, 0.0f, -depth / 2.0f};
+            const float angle = 2.0f * lug::Math::pi<float>() * i / renderViews.size();
+
+            node->setPosition({
+                center.x() + std::sin(angle) * distance,
+                center.y(),
+                center.z() + std::cos(angle) * distance
+            }, lug::Graphics::Node::TransformSpace::World);
+            camera->lookAt(center, {0.0f, 1.0f, 0.0f}, lug::Graphics::Node::TransformSpace::World);
+
+            renderViews[i]->attachCamera(camera);
+        }
+    }
+
+    const lug::Math::Vec3f lightPositions[] = {
+        lug::Math::Vec3f{-10.0f,  10.0f, 10.0f},
+        lug::Math::Vec3f{ 10.0f,  10.0f, 10.0f},
+        lug::Math::Vec3f{-10.0f, -10.0f, 10.0f},
+        lug::Math::Vec3f{ 10.0f, -10.0f, 10.0f},
+    };
+
+    // The same total intensity whatever the number of lights
+    const float lightIntensity = 300.0f * defaultLightsCount / _lightsCount;
+
+    for (uint32_t i = 0; i < _lightsCount; ++i) {
+        lug::Graphics::Builder::Light lightBuilder(*renderer);
+
+        lightBuilder.setType(lug::Graphics::Render::Light::Type::Point);
+        lightBuilder.setColor({lightIntensity, lightIntensity, lightIntensity, 1.0f});
+        lightBuilder.setLinearAttenuation(0.0f);
+
+        lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Light> light = lightBuilder.build();
+        if (!light) {
+            LUG_LOG.error("Application: Can't create the point light {}", i);
+            return false;
+        }
+
+        lug::Graphics::Scene::Node* node = _scene->createSceneNode("light" + std::to_string(i));
+        _scene->getRoot().attachChild(*node);
+
+        // The additional lights are a bit further away each time around the 4 corners
+        const float distance = 1.0f + static_cast<float>(i / defaultLightsCount) * 0.1f;
+        node->setPosition(lightPositions[i % defaultLightsCount] * distance);
+        node->attachLight(light);
+    }
+
+    return true;
+}
+
+void Application::initRenderViews() {
+    if (_viewsCount == 1) {
+        return;
+    }
+
+    // Split the window in a grid of views
+    const uint32_t columnsCount = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(_viewsCount))));
+    const uint32_t rowsCount = (_viewsCount + columnsCount - 1) / columnsCount;
+
+    const float width = 1.0f / columnsCount;
+    const float height = 1.0f / rowsCount;
+
+    auto& renderViewsInitInfo = getRenderWindowInfo().renderViewsInitInfo;
+
+    for (uint32_t i = 0; i < _viewsCount; ++i) {
+        const float x = (i % columnsCount) * width;
+        const float y = (i / columnsCount) * height;
+
+        renderViewsInitInfo.push_back({
+            {                                                   // viewport
+                {                                               // offset
+                    x,                                          // x
+                    y                                           // y
+                },
+
+                {                                               // extent
+                    width,                                      // width
+                    height                                      // height
+                },
+
+                0.0f,                                           // minDepth
+                1.0f                                            // maxDepth
+            },
+            {                                                   // scissor
+                {                                               // offset
+                    x,                                          // x
+                    y                                           // y
+                },
+                {                                               // extent
+                    width,                                      // width
+                    height                                      // height
+                }
+            },
+            nullptr                                             // camera
+        });
+    }
+}
+
+bool Application::initSphereMesh(int segmentsCount) {
+    std::vector<lug::Math::Vec3f> positions;
+    std::vector<lug::Math::Vec3f> normals;
+    std::vector<uint16_t> indices;
+
+    // Generate positions / normals / indices
+    {
+        const int X_SEGMENTS = segmentsCount;
+        const int Y_SEGMENTS = segmentsCount;
+        for (int y = 0; y <= Y_SEGMENTS; ++y) {
+            for (int x = 0; x <= X_SEGMENTS; ++x) {
+                float xSegment = (float)x / (float)X_SEGMENTS;
+                float ySegment = (float)y / (float)Y_SEGMENTS;
+                float xPos = std::cos(xSegment * 2.0f * lug::Math::pi<float>()) * std::sin(ySegment * lug::Math::pi<float>());
+                float yPos = std::cos(ySegment * lug::Math::pi<float>());
+                float zPos = std::sin(xSegment * 2.0f * lug::Math::pi<float>()) * std::sin(ySegment * lug::Math::pi<float>());
+
+                positions.push_back({xPos, yPos, zPos});
+                normals.push_back({xPos, yPos, zPos});
+            }
+        }
+
+        bool oddRow = false;
+        for (int y = 0; y < Y_SEGMENTS; ++y) {
+            if (!oddRow) { // even rows: y == 0, y == 2; and so on
+                for (int x = 0; x <= X_SEGMENTS; ++x) {
+                    indices.push_back(static_cast<uint16_t>((y + 1) * (X_SEGMENTS + 1) + x));
+                    indices.push_back(static_cast<uint16_t>(y       * (X_SEGMENTS + 1) + x));
+                }
+            } else {
+                for (int x = X_SEGMENTS; x >= 0; --x)
+                {
+                    indices.push_back(static_cast<uint16_t>(y       * (X_SEGMENTS + 1) + x));
+                    indices.push_back(static_cast<uint16_t>((y + 1) * (X_SEGMENTS + 1) + x));
+                }
+            }
+
+            oddRow = !oddRow;
+        }
+    }
+
+    // Build the mesh
+    {
+        lug::Graphics::Builder::Mesh meshBuilder(*_graphics.getRenderer());
+        meshBuilder.setName("sphere");
+
+        lug::Graphics::Builder::Mesh::PrimitiveSet* primitiveSet = meshBuilder.addPrimitiveSet();
+
+        primitiveSet->setMode(lug::Graphics::Render::Mesh::PrimitiveSet::Mode::TriangleStrip);
+
+        primitiveSet->addAttributeBuffer(
+            indices.data(),
+            sizeof(uint16_t),
+            static_cast<uint32_t>(indices.size()),
+            lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Indice
+        );
+
+        primitiveSet->addAttributeBuffer(
+            positions.data(),
+            sizeof(lug::Math::Vec3f),
+            static_cast<uint32_t>(positions.size()),
+            lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Position
+        );
+
+        primitiveSet->addAttributeBuffer(
+            normals.data(),
+            sizeof(lug::Math::Vec3f),
+            static_cast<uint32_t>(normals.size()),
+            lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Normal
+        );
+
+        _sphereMesh = meshBuilder.build();
+
+        if (!_sphereMesh) {
+            LUG_LOG.error("Application: Can't create the sphere mesh");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Application::onEvent(const lug::Window::Event& event) {
+    if (event.type == lug::Window::Event::Type::Close) {
+        close();
+    }
+}
+
+void Application::onFrame(const lug::System::Time& elapsedTime) {
+    // The first frames compile the pipelines and upload the resources
+    if (_warmupFrames < warmupFramesCount) {
+        ++_warmupFrames;
+        return;
+    }
+
+    // The zones of the profiler ending after this timestamp are measured
+    if (_cpuFrameTimes.empty()) {
+        _measureBegin = lug::System::Clock::getTimestamp();
+    }
+
+    _cpuFrameTimes.push_back(elapsedTime.getMilliseconds<float>());
+
+    // The GPU time is the one of a previous frame, 0 until the first timestamps are available
+    const auto window = static_cast<const lug::Graphics::Vulkan::Render::Window*>(getWindow());
+    if (window->getGpuFrameTime() > 0.0f) {
+        _gpuFrameTimes.push_back(window->getGpuFrameTime());
+    }
+
+    // From the beginning of the CPU frame to the completion of the GPU frame, for the last finished frame
+    if (window->getLatency().total > 0.0f) {
+        _latencies.push_back(window->getLatency().total);
+    }
+
+    if (_cpuFrameTimes.size() >= _framesCount) {
+        close();
+    }
+}
+
+void Application::printResults() const {
+    const auto window = static_cast<const lug::Graphics::Vulkan::Render::Window*>(getWindow());
+
+    LUG_LOG.info("Benchmark: {} frames measured after {} warmup frames", _cpuFrameTimes.size(), warmupFramesCount);
+    LUG_LOG.info("Benchmark: {} frames in flight", window->getFramesInFlight());
+    LUG_LOG.info("Benchmark: {} views, {} nodes, {} visibility", _viewsCount, _nodesCount, _sharedVisibility ? "shared" : "per-view");
+    LUG_LOG.info(
+        "Benchmark: {} materials, {} lights, instancing {}, {} recording threads",
+        _materialsCount,
+        _lightsCount,
+        _instancing ? "on" : "off",
+        static_cast<uint32_t>(_recordingThreadCount)
+    );
+
+    printPercentiles("CPU frame time", _cpuFrameTimes);
+    printPercentiles("GPU frame time", _gpuFrameTimes);
+    printPercentiles("Latency", _latencies);
+
+    // Per view and per frame
+    printPercentiles("Light uniforms upload", getZoneTimes("Forward::prepareLights"));
+    printPercentiles("Material uniforms upload and draws preparation", getZoneTimes("Forward::prepareDrawCalls"));
+    printPercentiles("Draws recording", getZoneTimes("Forward::recordDrawCalls"));
+}
+
+std::vector<float> Application::getZoneTimes(const char* name) const {
+    std::vector<float> times;
+
+    for (const lug::System::Profiler::Event& event : getTraceEvents()) {
+        if (event.end >= _measureBegin && std::strcmp(event.name, name) == 0) {
+            times.push_back(static_cast<float>(event.end - event.begin) / 1000000.0f);
+        }
+    }
+
+    return times;
+}
+
+void Application::printPercentiles(const std::string& name, std::vector<float> samples) {
+    if (samples.empty()) {
+        LUG_LOG.info("Benchmark: {}: no samples", name);
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    // Nearest-rank percentile
+    const auto percentile = [&samples](float p) {
+        const size_t rank = static_cast<size_t>(std::ceil(p / 100.0f * samples.size()));
+        return samples[std::max<size_t>(rank, 1) - 1];
+    };
+
+    LUG_LOG.info(
+        "Benchmark: {} (ms): p50 {:.3f}, p90 {:.3f}, p99 {:.3f}, max {:.3f}",
+        name,
+        percentile(50.0f),
+        percentile(90.0f),
+        percentile(99.0f),
+        samples.back()
+    );
+}
@@ -1,7 +1,11 @@
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <lug/Core/Application.hpp>
 #include <lug/System/Clock.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Profiler/Exporter.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 namespace lug {
 namespace Core {
@@ -13,9 +17,43 @@ bool Application::init(int argc, char* argv[]) {
 }
 
 bool Application::beginInit(int argc, char* argv[]) {
-    // TODO: Use argc and argv to parse the command line
-    (void)(argc);
-    (void)(argv);
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            _renderWindowInitInfo.headless.enabled = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            _framesLimit = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            _traceFilename = argv[++i];
+        } else if (std::strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc) {
+            _renderWindowInitInfo.framesInFlight = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--present-mode") == 0 && i + 1 < argc) {
+            const char* presentMode = argv[++i];
+
+            if (std::strcmp(presentMode, "fifo") == 0) {
+                _renderWindowInitInfo.presentMode = Graphics::Render::Window::PresentMode::Fifo;
+            } else if (std::strcmp(presentMode, "mailbox") == 0) {
+                _renderWindowInitInfo.presentMode = Graphics::Render::Window::PresentMode::Mailbox;
+            } else if (std::strcmp(presentMode, "immediate") == 0) {
+                _renderWindowInitInfo.presentMode = Graphics::Render::Window::PresentMode::Immediate;
+            } else {
+                LUG_LOG.warn("Application::beginInit: Unknown present mode {}, the default one is used", presentMode);
+            }
+        } else if (std::strcmp(argv[i], "--bloom") == 0 && i + 1 < argc) {
+            const char* technique = argv[++i];
+
+            if (std::strcmp(technique, "blur") == 0) {
+                _graphicsInitInfo.rendererInitInfo.bloomOptions.technique = Graphics::Renderer::BloomTechnique::Blur;
+            } else if (std::strcmp(technique, "mip-chain") == 0) {
+                _graphicsInitInfo.rendererInitInfo.bloomOptions.technique = Graphics::Renderer::BloomTechnique::MipChain;
+            } else {
+                LUG_LOG.warn("Application::beginInit: Unknown bloom technique {}, the default one is used", technique);
+            }
+        }
+    }
+
+    if (!_traceFilename.empty()) {
+        System::Profiler::Profiler::getInstance().setEnabled(true);
+    }
 
     if (!_graphics.beginInit(_graphicsInitInfo)) {
         return false;
@@ -41,14 +79,21 @@ bool Application::finishInit() {
 bool Application::run() {
     float elapsed = 0;
     uint32_t frames = 0;
+    uint32_t totalFrames = 0;
 
     System::Clock clock;
 
+    System::Profiler::Profiler& profiler = System::Profiler::Profiler::getInstance();
+
     while (!_closed && _window && _window->isOpen()) {
+        LUG_PROFILE_SCOPE("Application::frame");
+
         const auto elapsedTime = clock.reset();
 
         // Poll events
         {
+            LUG_PROFILE_SCOPE("Application::pollEvents");
+
             lug::Window::Event event;
 
             while (_window->pollEvent(event)) {
@@ -61,7 +106,10 @@ bool Application::run() {
             return false;
         }
 
-        onFrame(elapsedTime);
+        {
+            LUG_PROFILE_SCOPE("Application::onFrame");
+            onFrame(elapsedTime);
+        }
 
         if (!endFrame()) {
             LUG_LOG.error("Application::run: Can't end frame");
@@ -71,14 +119,23 @@ bool Application::run() {
         elapsed += elapsedTime.getSeconds<float>();
         frames++;
 
+        if (_framesLimit && ++totalFrames >= _framesLimit) {
+            close();
+        }
+
         if (elapsed >= 1.0f) {
             LUG_LOG.info("FPS: {}", frames / elapsed);
             frames = 0;
             elapsed = 0;
         }
+
+        // Empty the buffers of the profiler each frame so that they never overflow
+        if (profiler.isEnabled()) {
+            profiler.collect(_traceEvents);
+        }
     }
 
-    return true;
+    return writeTrace();
 }
 
 void Application::close() {
@@ -93,5 +150,23 @@ bool Application::endFrame() {
     return _graphics.getRenderer()->endFrame();
 }
 
+bool Application::writeTrace() const {
+    if (_traceFilename.empty()) {
+        return true;
+    }
+
+    const uint64_t droppedCount = System::Profiler::Profiler::getInstance().getDroppedCount();
+    if (droppedCount) {
+        LUG_LOG.warn("Application::writeTrace: {} profiler zones have been dropped", droppedCount);
+    }
+
+    const std::string extension = ".json";
+    if (_traceFilename.size() >= extension.size() && _traceFilename.compare(_traceFilename.size() - extension.size(), extension.size(), extension) == 0) {
+        return System::Profiler::Exporter::writeChromeTrace(_traceFilename, _traceEvents);
+    }
+
+    return System::Profiler::Exporter::writeBinary(_traceFilename, _traceEvents);
+}
+
 } // Core
 } // lug
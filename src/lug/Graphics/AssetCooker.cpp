@@ -0,0 +1,577 @@
+#include <lug/Graphics/AssetCooker.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <gltf2/Exceptions.hpp>
+#include <gltf2/glTF2.hpp>
+
+#include <lug/Graphics/GltfBufferSource.hpp>
+#include <lug/Graphics/GltfLoader.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Render/Mesh.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/Graphics/TextureCompression.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace AssetCooker {
+
+namespace {
+
+struct Context {
+    const gltf2::Asset& asset;
+    GltfBufferSource& buffers;
+    AssetPackage::Writer& writer;
+    Statistics& statistics;
+    bool compressTextures;
+
+    // Images of the textures by image index, decoded in parallel before the textures are cooked
+    std::vector<ImageDecoder::Image> images;
+
+    // Index in the package of the glTF textures, materials and meshes already cooked
+    std::vector<uint32_t> textures;
+    std::vector<uint32_t> materials;
+    std::vector<uint32_t> meshes;
+};
+
+uint8_t toFilter(gltf2::Sampler::MagFilter filter, Render::Texture::Filter defaultFilter) {
+    switch (filter) {
+        case gltf2::Sampler::MagFilter::None:
+            break;
+        case gltf2::Sampler::MagFilter::Nearest:
+            return static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+        case gltf2::Sampler::MagFilter::Linear:
+            return static_cast<uint8_t>(Render::Texture::Filter::Linear);
+    }
+
+    return static_cast<uint8_t>(defaultFilter);
+}
+
+uint8_t toWrappingMode(gltf2::Sampler::WrappingMode wrappingMode) {
+    switch (wrappingMode) {
+        case gltf2::Sampler::WrappingMode::ClampToEdge:
+            return static_cast<uint8_t>(Render::Texture::WrappingMode::ClampToEdge);
+        case gltf2::Sampler::WrappingMode::MirroredRepeat:
+            return static_cast<uint8_t>(Render::Texture::WrappingMode::MirroredRepeat);
+        case gltf2::Sampler::WrappingMode::Repeat:
+            return static_cast<uint8_t>(Render::Texture::WrappingMode::Repeat);
+    }
+
+    return static_cast<uint8_t>(Render::Texture::WrappingMode::ClampToEdge);
+}
+
+// Same defaults and conversions as GltfLoader::createTexture
+void setSampler(AssetPackage::Texture& texture, const gltf2::Sampler& sampler) {
+    texture.magFilter = toFilter(sampler.magFilter, static_cast<Render::Texture::Filter>(texture.magFilter));
+
+    switch (sampler.minFilter) {
+        case gltf2::Sampler::MinFilter::None:
+            break;
+        case gltf2::Sampler::MinFilter::Nearest:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+            break;
+        case gltf2::Sampler::MinFilter::Linear:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Linear);
+            break;
+        case gltf2::Sampler::MinFilter::NearestMipMapNearest:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+            texture.mipMapFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+            break;
+        case gltf2::Sampler::MinFilter::LinearMipMapNearest:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Linear);
+            texture.mipMapFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+            break;
+        case gltf2::Sampler::MinFilter::NearestMipMapLinear:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+            texture.mipMapFilter = static_cast<uint8_t>(Render::Texture::Filter::Linear);
+            break;
+        case gltf2::Sampler::MinFilter::LinearMipMapLinear:
+            texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Linear);
+            texture.mipMapFilter = static_cast<uint8_t>(Render::Texture::Filter::Linear);
+            break;
+    }
+
+    texture.wrapS = toWrappingMode(sampler.wrapS);
+    texture.wrapT = toWrappingMode(sampler.wrapT);
+}
+
+bool cookTexture(Context& context, int32_t index, uint32_t& packageIndex) {
+    if (context.textures[index] != AssetPackage::none) {
+        packageIndex = context.textures[index];
+        return true;
+    }
+
+    const gltf2::Texture& gltfTexture = context.asset.textures[index];
+
+    AssetPackage::Texture texture{};
+    texture.format = static_cast<uint8_t>(Render::Texture::Format::R8G8B8A8_UNORM);
+    texture.magFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+    texture.minFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+    texture.mipMapFilter = static_cast<uint8_t>(Render::Texture::Filter::Nearest);
+    texture.wrapS = static_cast<uint8_t>(Render::Texture::WrappingMode::ClampToEdge);
+    texture.wrapT = static_cast<uint8_t>(Render::Texture::WrappingMode::ClampToEdge);
+
+    // TODO: Handle the images stored in a bufferView, like GltfLoader
+    if (gltfTexture.source == -1) {
+        LUG_LOG.error("AssetCooker::cook: The texture {} has no image", index);
+        return false;
+    }
+
+    const ImageDecoder::Image& image = context.images[gltfTexture.source];
+    if (!image.pixels) {
+        LUG_LOG.error("AssetCooker::cook: Can't load the texture \"{}\"", context.asset.images[gltfTexture.source].uri);
+        return false;
+    }
+
+    texture.width = image.width;
+    texture.height = image.height;
+
+    std::size_t textureSize = 0;
+
+    if (image.format != Render::Texture::Format::R8G8B8A8_UNORM || image.mipLevels > 1) {
+        // The KTX 2.0 textures are already in their final format, with their mip levels
+        texture.format = static_cast<uint8_t>(image.format);
+        texture.mipLevels = image.mipLevels;
+
+        textureSize = Render::Texture::getMipLevelsSize(texture.width, texture.height, image.format, texture.mipLevels);
+        texture.blob = context.writer.addBlob(image.pixels.get(), textureSize);
+    } else {
+        texture.mipLevels = getMipLevelsCount(texture.width, texture.height);
+
+        std::vector<uint8_t> mipLevels = generateMipLevels(image.pixels.get(), image.width, image.height);
+
+        if (context.compressTextures) {
+            const Render::Texture::Format format = TextureCompression::selectEncodeFormat(image.pixels.get(), image.width, image.height);
+
+            texture.format = static_cast<uint8_t>(format);
+            mipLevels = TextureCompression::encode(mipLevels.data(), texture.width, texture.height, texture.mipLevels, format);
+        }
+
+        textureSize = mipLevels.size();
+        texture.blob = context.writer.addBlob(mipLevels.data(), textureSize);
+    }
+
+    if (gltfTexture.sampler != -1) {
+        setSampler(texture, context.asset.samplers[gltfTexture.sampler]);
+    }
+
+    context.statistics.texturesSize += textureSize;
+    context.statistics.uncompressedTexturesSize += Render::Texture::getMipLevelsSize(texture.width, texture.height, Render::Texture::Format::R8G8B8A8_UNORM, texture.mipLevels);
+    ++context.statistics.texturesCount;
+
+    packageIndex = static_cast<uint32_t>(context.writer.textures.size());
+    context.writer.textures.push_back(texture);
+    context.textures[index] = packageIndex;
+
+    return true;
+}
+
+bool cookTextureInfo(Context& context, int32_t index, uint32_t texCoord, AssetPackage::TextureInfo& textureInfo) {
+    textureInfo.texture = AssetPackage::none;
+    textureInfo.texCoord = texCoord;
+
+    return index == -1 || cookTexture(context, index, textureInfo.texture);
+}
+
+bool cookMaterial(Context& context, int32_t index, uint32_t& packageIndex) {
+    if (index == -1) {
+        packageIndex = AssetPackage::none;
+        return true;
+    }
+
+    if (context.materials[index] != AssetPackage::none) {
+        packageIndex = context.materials[index];
+        return true;
+    }
+
+    const gltf2::Material& gltfMaterial = context.asset.materials[index];
+
+    AssetPackage::Material material{};
+    material.name = context.writer.addString(gltfMaterial.name);
+
+    std::copy(gltfMaterial.pbr.baseColorFactor, gltfMaterial.pbr.baseColorFactor + 4, material.baseColorFactor);
+    material.metallicFactor = gltfMaterial.pbr.metallicFactor;
+    material.roughnessFactor = gltfMaterial.pbr.roughnessFactor;
+    std::copy(gltfMaterial.emissiveFactor, gltfMaterial.emissiveFactor + 3, material.emissiveFactor);
+
+    if (!cookTextureInfo(context, gltfMaterial.pbr.baseColorTexture.index, gltfMaterial.pbr.baseColorTexture.texCoord, material.baseColorTexture)
+        || !cookTextureInfo(context, gltfMaterial.pbr.metallicRoughnessTexture.index, gltfMaterial.pbr.metallicRoughnessTexture.texCoord, material.metallicRoughnessTexture)
+        || !cookTextureInfo(context, gltfMaterial.normalTexture.index, gltfMaterial.normalTexture.texCoord, material.normalTexture)
+        || !cookTextureInfo(context, gltfMaterial.occlusionTexture.index, gltfMaterial.occlusionTexture.texCoord, material.occlusionTexture)
+        || !cookTextureInfo(context, gltfMaterial.emissiveTexture.index, gltfMaterial.emissiveTexture.texCoord, material.emissiveTexture)) {
+        return false;
+    }
+
+    packageIndex = static_cast<uint32_t>(context.writer.materials.size());
+    context.writer.materials.push_back(material);
+    context.materials[index] = packageIndex;
+
+    return true;
+}
+
+void addAttribute(Context& context, Render::Mesh::PrimitiveSet::Attribute::Type type, const void* data, uint32_t elementSize, uint32_t elementsCount) {
+    AssetPackage::Attribute attribute{};
+
+    attribute.type = static_cast<uint32_t>(type);
+    attribute.blob = context.writer.addBlob(data, static_cast<std::size_t>(elementSize) * elementsCount);
+    attribute.elementSize = elementSize;
+    attribute.elementsCount = elementsCount;
+
+    context.statistics.buffersSize += static_cast<uint64_t>(elementSize) * elementsCount;
+    context.writer.attributes.push_back(attribute);
+}
+
+bool cookPrimitiveSet(Context& context, const gltf2::Primitive& gltfPrimitive) {
+    AssetPackage::PrimitiveSet primitiveSet{};
+
+    switch (gltfPrimitive.mode) {
+        case gltf2::Primitive::Mode::Points:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::Points);
+            break;
+        case gltf2::Primitive::Mode::Lines:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::Lines);
+            break;
+        case gltf2::Primitive::Mode::LineLoop:
+            LUG_LOG.error("AssetCooker::cook: Unsupported mode LineLoop");
+            return false;
+        case gltf2::Primitive::Mode::LineStrip:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::LineStrip);
+            break;
+        case gltf2::Primitive::Mode::Triangles:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::Triangles);
+            break;
+        case gltf2::Primitive::Mode::TriangleStrip:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::TriangleStrip);
+            break;
+        case gltf2::Primitive::Mode::TriangleFan:
+            primitiveSet.mode = static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::TriangleFan);
+            break;
+    }
+
+    primitiveSet.firstAttribute = static_cast<uint32_t>(context.writer.attributes.size());
+
+    // Indices, the 8 bits ones are widened to 16 bits as the renderer only supports 16 and 32 bits indices
+    std::vector<uint32_t> indices;
+
+    if (gltfPrimitive.indices != -1) {
+        const gltf2::Accessor& accessor = context.asset.accessors[gltfPrimitive.indices];
+
+        const uint32_t elementSize = GltfLoader::getAttributeSize(accessor);
+        const void* data = GltfLoader::getBufferViewData(context.asset, context.buffers, accessor);
+        if (!data) {
+            return false;
+        }
+
+        indices.resize(accessor.count);
+        for (uint32_t i = 0; i < accessor.count; ++i) {
+            switch (elementSize) {
+                case 1:
+                    indices[i] = static_cast<const uint8_t*>(data)[i];
+                    break;
+                case 2: {
+                    uint16_t index;
+                    std::memcpy(&index, static_cast<const uint8_t*>(data) + i * sizeof(index), sizeof(index));
+                    indices[i] = index;
+                    break;
+                }
+                default:
+                    std::memcpy(&indices[i], static_cast<const uint8_t*>(data) + i * sizeof(uint32_t), sizeof(uint32_t));
+                    break;
+            }
+        }
+
+        if (elementSize == 1) {
+            const std::vector<uint16_t> widenedIndices(indices.begin(), indices.end());
+            addAttribute(context, Render::Mesh::PrimitiveSet::Attribute::Type::Indice, widenedIndices.data(), sizeof(uint16_t), accessor.count);
+        } else {
+            addAttribute(context, Render::Mesh::PrimitiveSet::Attribute::Type::Indice, data, elementSize, accessor.count);
+        }
+    }
+
+    // Attributes
+    const float* positions = nullptr;
+    uint32_t verticesCount = 0;
+    bool hasNormals = false;
+
+    for (const auto& gltfAttribute : gltfPrimitive.attributes) {
+        Render::Mesh::PrimitiveSet::Attribute::Type type;
+        if (gltfAttribute.first == "POSITION") {
+            type = Render::Mesh::PrimitiveSet::Attribute::Type::Position;
+        } else if (gltfAttribute.first == "NORMAL") {
+            type = Render::Mesh::PrimitiveSet::Attribute::Type::Normal;
+            hasNormals = true;
+        } else if (gltfAttribute.first == "TANGENT") {
+            type = Render::Mesh::PrimitiveSet::Attribute::Type::Tangent;
+        } else if (gltfAttribute.first.find("TEXCOORD_") != std::string::npos) {
+            type = Render::Mesh::PrimitiveSet::Attribute::Type::TexCoord;
+        } else if (gltfAttribute.first.find("COLOR_") != std::string::npos) {
+            type = Render::Mesh::PrimitiveSet::Attribute::Type::Color;
+        } else {
+            LUG_LOG.warn("AssetCooker::cook: Unsupported attribute {}", gltfAttribute.first);
+            continue;
+        }
+
+        const gltf2::Accessor& accessor = context.asset.accessors[gltfAttribute.second];
+
+        const uint32_t elementSize = GltfLoader::getAttributeSize(accessor);
+        const void* data = GltfLoader::getBufferViewData(context.asset, context.buffers, accessor);
+        if (!data) {
+            return false;
+        }
+
+        if (type == Render::Mesh::PrimitiveSet::Attribute::Type::Position) {
+            positions = static_cast<const float*>(data);
+            verticesCount = accessor.count;
+        }
+
+        addAttribute(context, type, data, elementSize, accessor.count);
+    }
+
+    // Generate the normals if there is not any, once and for all
+    if (!hasNormals && positions) {
+        const std::vector<float> normals = generateNormals(positions, verticesCount, indices);
+        addAttribute(context, Render::Mesh::PrimitiveSet::Attribute::Type::Normal, normals.data(), sizeof(float) * 3, verticesCount);
+    }
+
+    primitiveSet.attributesCount = static_cast<uint32_t>(context.writer.attributes.size()) - primitiveSet.firstAttribute;
+
+    if (!cookMaterial(context, gltfPrimitive.material, primitiveSet.material)) {
+        return false;
+    }
+
+    context.writer.primitiveSets.push_back(primitiveSet);
+
+    return true;
+}
+
+bool cookMesh(Context& context, int32_t index, uint32_t& packageIndex) {
+    if (context.meshes[index] != AssetPackage::none) {
+        packageIndex = context.meshes[index];
+        return true;
+    }
+
+    const gltf2::Mesh& gltfMesh = context.asset.meshes[index];
+
+    AssetPackage::Mesh mesh{};
+    mesh.name = context.writer.addString(gltfMesh.name);
+    mesh.firstPrimitiveSet = static_cast<uint32_t>(context.writer.primitiveSets.size());
+
+    for (const gltf2::Primitive& gltfPrimitive : gltfMesh.primitives) {
+        if (!cookPrimitiveSet(context, gltfPrimitive)) {
+            return false;
+        }
+    }
+
+    mesh.primitiveSetsCount = static_cast<uint32_t>(context.writer.primitiveSets.size()) - mesh.firstPrimitiveSet;
+
+    ++context.statistics.meshesCount;
+
+    packageIndex = static_cast<uint32_t>(context.writer.meshes.size());
+    context.writer.meshes.push_back(mesh);
+    context.meshes[index] = packageIndex;
+
+    return true;
+}
+
+bool cookNode(Context& context, int32_t index, uint32_t parent) {
+    const gltf2::Node& gltfNode = context.asset.nodes[index];
+
+    AssetPackage::Node node{};
+    node.name = context.writer.addString(gltfNode.name);
+    node.parent = parent;
+    node.mesh = AssetPackage::none;
+
+    if (gltfNode.mesh != -1 && !cookMesh(context, gltfNode.mesh, node.mesh)) {
+        return false;
+    }
+
+    std::copy(gltfNode.translation, gltfNode.translation + 3, node.translation);
+    std::copy(gltfNode.rotation, gltfNode.rotation + 4, node.rotation);
+    std::copy(gltfNode.scale, gltfNode.scale + 3, node.scale);
+
+    // The parents are before their children
+    const uint32_t nodeIdx = static_cast<uint32_t>(context.writer.nodes.size());
+    context.writer.nodes.push_back(node);
+    ++context.statistics.nodesCount;
+
+    for (uint32_t childIdx : gltfNode.children) {
+        if (!cookNode(context, childIdx, nodeIdx)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // anonymous
+
+bool cook(const std::string& filename, AssetPackage::Writer& writer, Statistics& statistics, bool compressTextures) {
+#if defined(LUG_SYSTEM_ANDROID)
+    (void)writer;
+    (void)statistics;
+    (void)compressTextures;
+
+    LUG_LOG.error("AssetCooker::cook: Can't cook \"{}\", the assets are cooked offline", filename);
+    return false;
+#else
+    gltf2::Asset asset;
+    try {
+        asset = gltf2::load(filename);
+    } catch (gltf2::MisformattedException& e) {
+        LUG_LOG.error("AssetCooker::cook: Can't load the file \"{}\": {}", filename, e.what());
+        return false;
+    }
+
+    if (asset.scene == -1) {
+        LUG_LOG.error("AssetCooker::cook: The file \"{}\" has no scene", filename);
+        return false;
+    }
+
+    GltfBufferSource buffers;
+    buffers.open(filename);
+
+    statistics = Statistics{};
+
+    Context context{asset, buffers, writer, statistics, compressTextures, {}, {}, {}, {}};
+    context.textures.resize(asset.textures.size(), AssetPackage::none);
+    context.materials.resize(asset.materials.size(), AssetPackage::none);
+    context.meshes.resize(asset.meshes.size(), AssetPackage::none);
+
+    // The images are relative to the glTF file
+    const std::string::size_type separatorPos = filename.find_last_of("/\\");
+    const std::string directory = separatorPos == std::string::npos ? "" : filename.substr(0, separatorPos + 1);
+
+    // Each image is decoded once, even if several textures use it
+    std::vector<ImageDecoder::Source> sources(asset.images.size());
+    for (const gltf2::Texture& texture : asset.textures) {
+        if (texture.source != -1) {
+            sources[texture.source].filename = directory + asset.images[texture.source].uri;
+        }
+    }
+
+    context.images = ImageDecoder().decode(sources);
+
+    const gltf2::Scene& gltfScene = asset.scenes[asset.scene];
+    writer.setName(gltfScene.name);
+
+    for (uint32_t nodeIdx : gltfScene.nodes) {
+        if (!cookNode(context, nodeIdx, AssetPackage::none)) {
+            return false;
+        }
+    }
+
+    return true;
+#endif
+}
+
+uint32_t getMipLevelsCount(uint32_t width, uint32_t height) {
+    uint32_t mipLevels = 1;
+
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1) {
+        ++mipLevels;
+    }
+
+    return mipLevels;
+}
+
+std::vector<uint8_t> generateMipLevels(const uint8_t* pixels, uint32_t width, uint32_t height) {
+    const uint32_t mipLevels = getMipLevelsCount(width, height);
+
+    std::vector<uint8_t> data(Render::Texture::getMipLevelsSize(width, height, Render::Texture::Format::R8G8B8A8_UNORM, mipLevels));
+    std::memcpy(data.data(), pixels, static_cast<std::size_t>(width) * height * 4);
+
+    std::size_t srcOffset = 0;
+    std::size_t dstOffset = static_cast<std::size_t>(width) * height * 4;
+
+    for (uint32_t level = 1; level < mipLevels; ++level) {
+        const uint32_t srcWidth = std::max(width >> (level - 1), 1u);
+        const uint32_t srcHeight = std::max(height >> (level - 1), 1u);
+        const uint32_t dstWidth = std::max(width >> level, 1u);
+        const uint32_t dstHeight = std::max(height >> level, 1u);
+
+        const uint8_t* src = data.data() + srcOffset;
+        uint8_t* dst = data.data() + dstOffset;
+
+        // Average the 2x2 texels of the previous level, the last row or column is repeated for the odd sizes of 1
+        for (uint32_t y = 0; y < dstHeight; ++y) {
+            const uint32_t y0 = std::min(y * 2, srcHeight - 1);
+            const uint32_t y1 = std::min(y * 2 + 1, srcHeight - 1);
+
+            for (uint32_t x = 0; x < dstWidth; ++x) {
+                const uint32_t x0 = std::min(x * 2, srcWidth - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, srcWidth - 1);
+
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    const uint32_t sum = src[(y0 * srcWidth + x0) * 4 + channel] + src[(y0 * srcWidth + x1) * 4 + channel]
+                                       + src[(y1 * srcWidth + x0) * 4 + channel] + src[(y1 * srcWidth + x1) * 4 + channel];
+
+                    dst[(y * dstWidth + x) * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        srcOffset = dstOffset;
+        dstOffset += static_cast<std::size_t>(dstWidth) * dstHeight * 4;
+    }
+
+    return data;
+}
+
+std::vector<float> generateNormals(const float* positions, uint32_t verticesCount, const std::vector<uint32_t>& indices) {
+    std::vector<float> normals(static_cast<std::size_t>(verticesCount) * 3, 0.0f);
+
+    const uint32_t trianglesCount = static_cast<uint32_t>(indices.empty() ? verticesCount / 3 : indices.size() / 3);
+
+    for (uint32_t i = 0; i < trianglesCount; ++i) {
+        uint32_t triangle[3];
+        for (uint32_t j = 0; j < 3; ++j) {
+            triangle[j] = indices.empty() ? i * 3 + j : indices[i * 3 + j];
+        }
+
+        if (triangle[0] >= verticesCount || triangle[1] >= verticesCount || triangle[2] >= verticesCount) {
+            continue;
+        }
+
+        const float* a = positions + triangle[0] * 3;
+        const float* b = positions + triangle[1] * 3;
+        const float* c = positions + triangle[2] * 3;
+
+        const float edge1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const float edge2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+
+        // The length of the cross product is twice the area of the triangle
+        const float normal[3] = {
+            edge1[1] * edge2[2] - edge1[2] * edge2[1],
+            edge1[2] * edge2[0] - edge1[0] * edge2[2],
+            edge1[0] * edge2[1] - edge1[1] * edge2[0]
+        };
+
+        for (uint32_t vertex : triangle) {
+            for (uint32_t axis = 0; axis < 3; ++axis) {
+                normals[vertex * 3 + axis] += normal[axis];
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < verticesCount; ++i) {
+        float* normal = normals.data() + i * 3;
+        const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+        if (length > 0.0f) {
+            normal[0] /= length;
+            normal[1] /= length;
+            normal[2] /= length;
+        } else {
+            normal[2] = 1.0f;
+        }
+    }
+
+    return normals;
+}
+
+} // AssetCooker
+} // Graphics
+} // lug
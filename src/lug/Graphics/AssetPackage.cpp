@@ -0,0 +1,280 @@
+#include <lug/Graphics/AssetPackage.hpp>
+
+#include <cstring>
+#include <fstream>
+
+#include <lug/Graphics/Render/Mesh.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+
+constexpr uint32_t AssetPackage::magic;
+constexpr uint32_t AssetPackage::version;
+constexpr uint32_t AssetPackage::blobAlignment;
+constexpr uint32_t AssetPackage::none;
+
+// The tables are read in place, their layout is part of the format
+static_assert(sizeof(AssetPackage::Header) == 40, "The layout of AssetPackage::Header changed");
+static_assert(sizeof(AssetPackage::Blob) == 16, "The layout of AssetPackage::Blob changed");
+static_assert(sizeof(AssetPackage::Texture) == 24, "The layout of AssetPackage::Texture changed");
+static_assert(sizeof(AssetPackage::Material) == 80, "The layout of AssetPackage::Material changed");
+static_assert(sizeof(AssetPackage::Mesh) == 12, "The layout of AssetPackage::Mesh changed");
+static_assert(sizeof(AssetPackage::PrimitiveSet) == 16, "The layout of AssetPackage::PrimitiveSet changed");
+static_assert(sizeof(AssetPackage::Attribute) == 16, "The layout of AssetPackage::Attribute changed");
+static_assert(sizeof(AssetPackage::Node) == 52, "The layout of AssetPackage::Node changed");
+
+namespace {
+
+uint64_t align(uint64_t offset, uint64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+template <typename T>
+void setTable(AssetPackage::Table<T>& table, const uint8_t* data, uint64_t offset, uint32_t count) {
+    table.data = reinterpret_cast<const T*>(data + offset);
+    table.count = count;
+}
+
+bool isValidIndex(uint32_t index, uint32_t count) {
+    return index == AssetPackage::none || index < count;
+}
+
+bool isValidRange(uint32_t first, uint32_t count, uint32_t tableCount) {
+    return static_cast<uint64_t>(first) + count <= tableCount;
+}
+
+} // anonymous
+
+uint32_t AssetPackage::Writer::addBlob(const void* data, std::size_t size) {
+    const std::size_t offset = static_cast<std::size_t>(align(_data.size(), blobAlignment));
+
+    _data.resize(offset + size);
+    if (size) {
+        std::memcpy(_data.data() + offset, data, size);
+    }
+
+    _blobs.push_back({offset, size});
+
+    return static_cast<uint32_t>(_blobs.size() - 1);
+}
+
+uint32_t AssetPackage::Writer::addString(const std::string& text) {
+    return addBlob(text.data(), text.size());
+}
+
+void AssetPackage::Writer::setName(const std::string& name) {
+    _name = addString(name);
+}
+
+bool AssetPackage::Writer::save(const std::string& filename) const {
+    Header header{};
+
+    header.magic = magic;
+    header.version = version;
+    header.name = _name;
+    header.blobsCount = static_cast<uint32_t>(_blobs.size());
+    header.texturesCount = static_cast<uint32_t>(textures.size());
+    header.materialsCount = static_cast<uint32_t>(materials.size());
+    header.meshesCount = static_cast<uint32_t>(meshes.size());
+    header.primitiveSetsCount = static_cast<uint32_t>(primitiveSets.size());
+    header.attributesCount = static_cast<uint32_t>(attributes.size());
+    header.nodesCount = static_cast<uint32_t>(nodes.size());
+
+    uint64_t offsets[8];
+    getOffsets(header, offsets);
+
+    // The blobs are relative to the data until they are written
+    std::vector<Blob> blobs = _blobs;
+    for (auto& blob : blobs) {
+        blob.offset += offsets[7];
+    }
+
+    std::vector<uint8_t> file(static_cast<std::size_t>(offsets[7]), 0);
+
+    const auto writeTable = [&file](uint64_t offset, const void* data, std::size_t size) {
+        if (size) {
+            std::memcpy(file.data() + offset, data, size);
+        }
+    };
+
+    writeTable(0, &header, sizeof(header));
+    writeTable(offsets[0], blobs.data(), blobs.size() * sizeof(Blob));
+    writeTable(offsets[1], textures.data(), textures.size() * sizeof(Texture));
+    writeTable(offsets[2], materials.data(), materials.size() * sizeof(Material));
+    writeTable(offsets[3], meshes.data(), meshes.size() * sizeof(Mesh));
+    writeTable(offsets[4], primitiveSets.data(), primitiveSets.size() * sizeof(PrimitiveSet));
+    writeTable(offsets[5], attributes.data(), attributes.size() * sizeof(Attribute));
+    writeTable(offsets[6], nodes.data(), nodes.size() * sizeof(Node));
+
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    if (!stream.good()) {
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(file.data()), file.size());
+    stream.write(reinterpret_cast<const char*>(_data.data()), _data.size());
+
+    return stream.good();
+}
+
+bool AssetPackage::open(const std::string& filename) {
+    _blobs = {};
+    _textures = {};
+    _materials = {};
+    _meshes = {};
+    _primitiveSets = {};
+    _attributes = {};
+    _nodes = {};
+
+    if (!_file.open(filename)) {
+        LUG_LOG.error("AssetPackage::open: Can't map package {}", filename);
+        return false;
+    }
+
+    if (_file.getSize() < sizeof(Header) || getHeader().magic != magic || getHeader().version != version) {
+        LUG_LOG.error("AssetPackage::open: Invalid header for package {}", filename);
+        _file.close();
+        return false;
+    }
+
+    const Header& header = getHeader();
+
+    uint64_t offsets[8];
+    getOffsets(header, offsets);
+
+    if (offsets[7] > _file.getSize()) {
+        LUG_LOG.error("AssetPackage::open: Truncated package {}", filename);
+        _file.close();
+        return false;
+    }
+
+    const uint8_t* data = _file.getData();
+
+    setTable(_blobs, data, offsets[0], header.blobsCount);
+    setTable(_textures, data, offsets[1], header.texturesCount);
+    setTable(_materials, data, offsets[2], header.materialsCount);
+    setTable(_meshes, data, offsets[3], header.meshesCount);
+    setTable(_primitiveSets, data, offsets[4], header.primitiveSetsCount);
+    setTable(_attributes, data, offsets[5], header.attributesCount);
+    setTable(_nodes, data, offsets[6], header.nodesCount);
+
+    if (!check(filename)) {
+        *this = AssetPackage();
+        return false;
+    }
+
+    return true;
+}
+
+std::string AssetPackage::getString(uint32_t blob) const {
+    if (blob == none) {
+        return "";
+    }
+
+    return std::string(reinterpret_cast<const char*>(getBlobData(blob)), static_cast<std::size_t>(_blobs[blob].size));
+}
+
+void AssetPackage::getOffsets(const Header& header, uint64_t (&offsets)[8]) {
+    offsets[0] = align(sizeof(Header), 8);
+    offsets[1] = align(offsets[0] + static_cast<uint64_t>(header.blobsCount) * sizeof(Blob), 8);
+    offsets[2] = align(offsets[1] + static_cast<uint64_t>(header.texturesCount) * sizeof(Texture), 8);
+    offsets[3] = align(offsets[2] + static_cast<uint64_t>(header.materialsCount) * sizeof(Material), 8);
+    offsets[4] = align(offsets[3] + static_cast<uint64_t>(header.meshesCount) * sizeof(Mesh), 8);
+    offsets[5] = align(offsets[4] + static_cast<uint64_t>(header.primitiveSetsCount) * sizeof(PrimitiveSet), 8);
+    offsets[6] = align(offsets[5] + static_cast<uint64_t>(header.attributesCount) * sizeof(Attribute), 8);
+    offsets[7] = align(offsets[6] + static_cast<uint64_t>(header.nodesCount) * sizeof(Node), blobAlignment);
+}
+
+bool AssetPackage::check(const std::string& filename) const {
+    const Header& header = getHeader();
+
+    uint64_t offsets[8];
+    getOffsets(header, offsets);
+
+    for (const Blob& blob : _blobs) {
+        if (blob.offset < offsets[7] || blob.offset > _file.getSize() || blob.size > _file.getSize() - blob.offset) {
+            LUG_LOG.error("AssetPackage::open: Invalid blob in package {}", filename);
+            return false;
+        }
+    }
+
+    if (!isValidIndex(header.name, _blobs.count)) {
+        LUG_LOG.error("AssetPackage::open: Invalid name in package {}", filename);
+        return false;
+    }
+
+    for (const Texture& texture : _textures) {
+        const Render::Texture::Format format = static_cast<Render::Texture::Format>(texture.format);
+
+        if (texture.blob >= _blobs.count || !texture.width || !texture.height || !texture.mipLevels || texture.mipLevels > 32
+            || !Render::Texture::formatToSize(format)
+            || _blobs[texture.blob].size < Render::Texture::getMipLevelsSize(texture.width, texture.height, format, texture.mipLevels)) {
+            LUG_LOG.error("AssetPackage::open: Invalid texture in package {}", filename);
+            return false;
+        }
+    }
+
+    for (const Material& material : _materials) {
+        const TextureInfo* textures[] = {
+            &material.baseColorTexture,
+            &material.metallicRoughnessTexture,
+            &material.normalTexture,
+            &material.occlusionTexture,
+            &material.emissiveTexture
+        };
+
+        bool valid = isValidIndex(material.name, _blobs.count);
+        for (const TextureInfo* textureInfo : textures) {
+            valid = valid && isValidIndex(textureInfo->texture, _textures.count);
+        }
+
+        if (!valid) {
+            LUG_LOG.error("AssetPackage::open: Invalid material in package {}", filename);
+            return false;
+        }
+    }
+
+    for (const Mesh& mesh : _meshes) {
+        if (!isValidIndex(mesh.name, _blobs.count) || !isValidRange(mesh.firstPrimitiveSet, mesh.primitiveSetsCount, _primitiveSets.count)) {
+            LUG_LOG.error("AssetPackage::open: Invalid mesh in package {}", filename);
+            return false;
+        }
+    }
+
+    for (const PrimitiveSet& primitiveSet : _primitiveSets) {
+        if (primitiveSet.mode > static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::TriangleFan)
+            || !isValidIndex(primitiveSet.material, _materials.count)
+            || !isValidRange(primitiveSet.firstAttribute, primitiveSet.attributesCount, _attributes.count)) {
+            LUG_LOG.error("AssetPackage::open: Invalid primitive set in package {}", filename);
+            return false;
+        }
+    }
+
+    for (const Attribute& attribute : _attributes) {
+        if (attribute.type > static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Attribute::Type::Color)
+            || attribute.blob >= _blobs.count
+            || static_cast<uint64_t>(attribute.elementSize) * attribute.elementsCount > _blobs[attribute.blob].size
+            || static_cast<uint64_t>(attribute.elementSize) * attribute.elementsCount > 0xFFFFFFFF) {
+            LUG_LOG.error("AssetPackage::open: Invalid attribute in package {}", filename);
+            return false;
+        }
+    }
+
+    // The parents are before their children
+    for (uint32_t i = 0; i < _nodes.count; ++i) {
+        const Node& node = _nodes[i];
+
+        if (!isValidIndex(node.name, _blobs.count) || !isValidIndex(node.mesh, _meshes.count)
+            || (node.parent != none && node.parent >= i)) {
+            LUG_LOG.error("AssetPackage::open: Invalid node in package {}", filename);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,232 @@
+#include <lug/Graphics/AssetPackageLoader.hpp>
+
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/Graphics/Builder/Scene.hpp>
+#include <lug/Graphics/Builder/Material.hpp>
+#include <lug/Graphics/Builder/Mesh.hpp>
+#include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
+
+namespace lug {
+namespace Graphics {
+
+AssetPackageLoader::AssetPackageLoader(Renderer& renderer): Loader(renderer) {}
+
+Resource::SharedPtr<Render::Texture> AssetPackageLoader::createTexture(const AssetPackage& package, AssetPackageLoader::LoadedAssets& loadedAssets, const AssetPackage::Texture& packageTexture) {
+    Builder::Texture textureBuilder(_renderer);
+    textureBuilder.setUploadBatch(&loadedAssets.uploadBatch);
+
+    textureBuilder.setMipLevels(packageTexture.mipLevels);
+    textureBuilder.setMagFilter(static_cast<Render::Texture::Filter>(packageTexture.magFilter));
+    textureBuilder.setMinFilter(static_cast<Render::Texture::Filter>(packageTexture.minFilter));
+    textureBuilder.setMipMapFilter(static_cast<Render::Texture::Filter>(packageTexture.mipMapFilter));
+    textureBuilder.setWrapS(static_cast<Render::Texture::WrappingMode>(packageTexture.wrapS));
+    textureBuilder.setWrapT(static_cast<Render::Texture::WrappingMode>(packageTexture.wrapT));
+
+    // The mip levels are uploaded from the mapped package
+    if (!textureBuilder.addExternalLayer(
+        packageTexture.width,
+        packageTexture.height,
+        static_cast<Render::Texture::Format>(packageTexture.format),
+        package.getBlobData(packageTexture.blob)
+    )) {
+        return nullptr;
+    }
+
+    return textureBuilder.build();
+}
+
+Resource::SharedPtr<Render::Material> AssetPackageLoader::createMaterial(const AssetPackage& package, AssetPackageLoader::LoadedAssets& loadedAssets, const AssetPackage::Material& packageMaterial) {
+    Builder::Material materialBuilder(_renderer);
+
+    materialBuilder.setName(package.getString(packageMaterial.name));
+
+    materialBuilder.setBaseColorFactor({
+        packageMaterial.baseColorFactor[0],
+        packageMaterial.baseColorFactor[1],
+        packageMaterial.baseColorFactor[2],
+        packageMaterial.baseColorFactor[3]
+    });
+
+    materialBuilder.setMetallicFactor(packageMaterial.metallicFactor);
+    materialBuilder.setRoughnessFactor(packageMaterial.roughnessFactor);
+
+    materialBuilder.setEmissiveFactor({
+        packageMaterial.emissiveFactor[0],
+        packageMaterial.emissiveFactor[1],
+        packageMaterial.emissiveFactor[2]
+    });
+
+    const AssetPackage::TextureInfo& baseColorTexture = packageMaterial.baseColorTexture;
+    if (baseColorTexture.texture != AssetPackage::none) {
+        materialBuilder.setBaseColorTexture(loadedAssets.textures[baseColorTexture.texture], baseColorTexture.texCoord);
+    }
+
+    const AssetPackage::TextureInfo& metallicRoughnessTexture = packageMaterial.metallicRoughnessTexture;
+    if (metallicRoughnessTexture.texture != AssetPackage::none) {
+        materialBuilder.setMetallicRoughnessTexture(loadedAssets.textures[metallicRoughnessTexture.texture], metallicRoughnessTexture.texCoord);
+    }
+
+    const AssetPackage::TextureInfo& normalTexture = packageMaterial.normalTexture;
+    if (normalTexture.texture != AssetPackage::none) {
+        materialBuilder.setNormalTexture(loadedAssets.textures[normalTexture.texture], normalTexture.texCoord);
+    }
+
+    const AssetPackage::TextureInfo& occlusionTexture = packageMaterial.occlusionTexture;
+    if (occlusionTexture.texture != AssetPackage::none) {
+        materialBuilder.setOcclusionTexture(loadedAssets.textures[occlusionTexture.texture], occlusionTexture.texCoord);
+    }
+
+    const AssetPackage::TextureInfo& emissiveTexture = packageMaterial.emissiveTexture;
+    if (emissiveTexture.texture != AssetPackage::none) {
+        materialBuilder.setEmissiveTexture(loadedAssets.textures[emissiveTexture.texture], emissiveTexture.texCoord);
+    }
+
+    return materialBuilder.build();
+}
+
+Resource::SharedPtr<Render::Material> AssetPackageLoader::createDefaultMaterial(AssetPackageLoader::LoadedAssets& loadedAssets) {
+    if (loadedAssets.defaultMaterial) {
+        return loadedAssets.defaultMaterial;
+    }
+
+    Builder::Material materialBuilder(_renderer);
+
+    loadedAssets.defaultMaterial = materialBuilder.build();
+    return loadedAssets.defaultMaterial;
+}
+
+Resource::SharedPtr<Render::Mesh> AssetPackageLoader::createMesh(const AssetPackage& package, AssetPackageLoader::LoadedAssets& loadedAssets, const AssetPackage::Mesh& packageMesh) {
+    Builder::Mesh meshBuilder(_renderer);
+    meshBuilder.setName(package.getString(packageMesh.name));
+
+    for (uint32_t i = 0; i < packageMesh.primitiveSetsCount; ++i) {
+        const AssetPackage::PrimitiveSet& packagePrimitiveSet = package.getPrimitiveSets()[packageMesh.firstPrimitiveSet + i];
+
+        Builder::Mesh::PrimitiveSet* primitiveSet = meshBuilder.addPrimitiveSet();
+        primitiveSet->setMode(static_cast<Render::Mesh::PrimitiveSet::Mode>(packagePrimitiveSet.mode));
+
+        // The buffers are uploaded from the mapped package, the normals are already generated
+        for (uint32_t j = 0; j < packagePrimitiveSet.attributesCount; ++j) {
+            const AssetPackage::Attribute& attribute = package.getAttributes()[packagePrimitiveSet.firstAttribute + j];
+
+            primitiveSet->addExternalAttributeBuffer(
+                package.getBlobData(attribute.blob),
+                attribute.elementSize,
+                attribute.elementsCount,
+                static_cast<Render::Mesh::PrimitiveSet::Attribute::Type>(attribute.type)
+            );
+        }
+
+        Resource::SharedPtr<Render::Material> material = packagePrimitiveSet.material == AssetPackage::none
+            ? createDefaultMaterial(loadedAssets)
+            : loadedAssets.materials[packagePrimitiveSet.material];
+        if (!material) {
+            LUG_LOG.error("AssetPackageLoader::createMesh Can't create the material resource");
+            return nullptr;
+        }
+
+        primitiveSet->setMaterial(material);
+    }
+
+    return meshBuilder.build();
+}
+
+Resource::SharedPtr<Resource> AssetPackageLoader::loadFile(const std::string& filename) {
+    // The package is only needed until the data is uploaded
+    AssetPackage package;
+    if (!package.open(filename)) {
+        return nullptr;
+    }
+
+    // The package is checked on open and its tables are sorted, so the resources are created in order
+    LoadedAssets loadedAssets(_renderer);
+
+    loadedAssets.textures.reserve(package.getTextures().count);
+    for (const AssetPackage::Texture& packageTexture : package.getTextures()) {
+        loadedAssets.textures.push_back(createTexture(package, loadedAssets, packageTexture));
+        if (!loadedAssets.textures.back()) {
+            LUG_LOG.error("AssetPackageLoader::loadFile Can't create the texture resource");
+            return nullptr;
+        }
+    }
+
+    // Upload all the textures at once, while the other resources are created
+    if (!loadedAssets.uploadBatch.submit()) {
+        LUG_LOG.error("AssetPackageLoader::loadFile Can't upload the textures");
+        return nullptr;
+    }
+
+    loadedAssets.materials.reserve(package.getMaterials().count);
+    for (const AssetPackage::Material& packageMaterial : package.getMaterials()) {
+        loadedAssets.materials.push_back(createMaterial(package, loadedAssets, packageMaterial));
+        if (!loadedAssets.materials.back()) {
+            LUG_LOG.error("AssetPackageLoader::loadFile Can't create the material resource");
+            return nullptr;
+        }
+    }
+
+    loadedAssets.meshes.reserve(package.getMeshes().count);
+    for (const AssetPackage::Mesh& packageMesh : package.getMeshes()) {
+        loadedAssets.meshes.push_back(createMesh(package, loadedAssets, packageMesh));
+        if (!loadedAssets.meshes.back()) {
+            LUG_LOG.error("AssetPackageLoader::loadFile Can't create the mesh resource");
+            return nullptr;
+        }
+    }
+
+    Builder::Scene sceneBuilder(_renderer);
+    sceneBuilder.setName(package.getString(package.getHeader().name));
+
+    Resource::SharedPtr<lug::Graphics::Scene::Scene> scene = sceneBuilder.build();
+    if (!scene) {
+        LUG_LOG.error("AssetPackageLoader::loadFile Can't create the scene resource");
+        return nullptr;
+    }
+
+    // The parents are before their children
+    std::vector<Scene::Node*> nodes;
+    nodes.reserve(package.getNodes().count);
+
+    for (const AssetPackage::Node& packageNode : package.getNodes()) {
+        Scene::Node& parent = packageNode.parent == AssetPackage::none ? scene->getRoot() : *nodes[packageNode.parent];
+
+        Scene::Node* node = parent.createSceneNode(package.getString(packageNode.name));
+        parent.attachChild(*node);
+
+        if (packageNode.mesh != AssetPackage::none) {
+            node->attachMeshInstance(loadedAssets.meshes[packageNode.mesh]);
+        }
+
+        node->setPosition({
+            packageNode.translation[0],
+            packageNode.translation[1],
+            packageNode.translation[2]
+        }, Node::TransformSpace::Parent);
+
+        node->setRotation(Math::Quatf{
+            packageNode.rotation[3],
+            packageNode.rotation[0],
+            packageNode.rotation[1],
+            packageNode.rotation[2]
+        }, Node::TransformSpace::Parent);
+
+        node->scale({
+            packageNode.scale[0],
+            packageNode.scale[1],
+            packageNode.scale[2]
+        });
+
+        nodes.push_back(node);
+    }
+
+    if (!loadedAssets.uploadBatch.wait()) {
+        LUG_LOG.error("AssetPackageLoader::loadFile Can't upload the textures");
+        return nullptr;
+    }
+
+    return Resource::SharedPtr<Resource>::cast(scene);
+}
+
+} // Graphics
+} // lug
@@ -1,11 +1,16 @@
 #include <lug/Graphics/Builder/Mesh.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 #include <lug/Graphics/Renderer.hpp>
 
 namespace lug {
 namespace Graphics {
 namespace Builder {
 
+std::atomic<uint64_t> Mesh::_copiedBytes{0};
+
 Mesh::Mesh(Renderer& renderer) : _renderer(renderer) {}
 
 void Mesh::PrimitiveSet::addAttributeBuffer(const void* data, uint32_t elementSize, uint32_t elementsCount, Render::Mesh::PrimitiveSet::Attribute::Type type) {
@@ -17,11 +22,136 @@ void Mesh::PrimitiveSet::addAttributeBuffer(const void* data, uint32_t elementSi
     attribute.buffer.elementsCount = elementsCount;
 
     std::memcpy(attribute.buffer.data, static_cast<const char*>(data), attribute.buffer.size);
+    _copiedBytes += attribute.buffer.size;
+
+    _attributes.push_back(std::move(attribute));
+}
+
+void Mesh::PrimitiveSet::addExternalAttributeBuffer(const void* data, uint32_t elementSize, uint32_t elementsCount, Render::Mesh::PrimitiveSet::Attribute::Type type) {
+    Render::Mesh::PrimitiveSet::Attribute attribute;
+
+    attribute.type = type;
+    attribute.buffer.size = elementSize * elementsCount;
+    attribute.buffer.data = const_cast<char*>(static_cast<const char*>(data));
+    attribute.buffer.elementsCount = elementsCount;
+    attribute.buffer.external = true;
 
     _attributes.push_back(std::move(attribute));
 }
 
+bool Mesh::PrimitiveSet::optimize(MeshOptimizer::Statistics* before, MeshOptimizer::Statistics* after) {
+    if (_mode != Render::Mesh::PrimitiveSet::Mode::Triangles) {
+        return false;
+    }
+
+    Render::Mesh::PrimitiveSet::Attribute* indicesAttribute = nullptr;
+    Render::Mesh::PrimitiveSet::Attribute* positionsAttribute = nullptr;
+    uint32_t verticesCount = 0;
+
+    for (auto& attribute : _attributes) {
+        if (attribute.type == Render::Mesh::PrimitiveSet::Attribute::Type::Indice) {
+            indicesAttribute = &attribute;
+            continue;
+        }
+
+        // All the vertex attributes are remapped the same way
+        if (attribute.buffer.elementsCount == 0 || (verticesCount && attribute.buffer.elementsCount != verticesCount)) {
+            return false;
+        }
+        verticesCount = attribute.buffer.elementsCount;
+
+        if (attribute.type == Render::Mesh::PrimitiveSet::Attribute::Type::Position) {
+            positionsAttribute = &attribute;
+        }
+    }
+
+    if (!indicesAttribute || !indicesAttribute->buffer.elementsCount || indicesAttribute->buffer.elementsCount % 3
+        || !positionsAttribute || positionsAttribute->buffer.size / verticesCount != sizeof(float) * 3) {
+        return false;
+    }
+
+    // Indices of 1, 2 or 4 bytes, like the glTF accessors
+    std::vector<uint32_t> indices(indicesAttribute->buffer.elementsCount);
+    switch (indicesAttribute->buffer.size / indicesAttribute->buffer.elementsCount) {
+        case sizeof(uint8_t):
+            std::copy_n(reinterpret_cast<const uint8_t*>(indicesAttribute->buffer.data), indices.size(), indices.begin());
+            break;
+        case sizeof(uint16_t):
+            std::copy_n(reinterpret_cast<const uint16_t*>(indicesAttribute->buffer.data), indices.size(), indices.begin());
+            break;
+        case sizeof(uint32_t):
+            std::memcpy(indices.data(), indicesAttribute->buffer.data, indices.size() * sizeof(uint32_t));
+            break;
+        default:
+            return false;
+    }
+
+    if (std::any_of(indices.begin(), indices.end(), [verticesCount](uint32_t index) { return index >= verticesCount; })) {
+        return false;
+    }
+
+    if (before) {
+        *before = MeshOptimizer::getCacheStatistics(indices, verticesCount);
+    }
+
+    MeshOptimizer::optimizeVertexCache(indices, verticesCount);
+    MeshOptimizer::optimizeOverdraw(indices, reinterpret_cast<const float*>(positionsAttribute->buffer.data), verticesCount);
+
+    std::vector<uint32_t> remap;
+    const uint32_t newVerticesCount = MeshOptimizer::optimizeVertexFetch(indices, verticesCount, remap);
+
+    if (after) {
+        *after = MeshOptimizer::getCacheStatistics(indices, newVerticesCount);
+    }
+
+    const auto setBuffer = [](Render::Mesh::PrimitiveSet::Attribute& attribute, char* data, uint32_t size, uint32_t elementsCount) {
+        if (!attribute.buffer.external) {
+            delete[] attribute.buffer.data;
+        }
+
+        attribute.buffer.data = data;
+        attribute.buffer.size = size;
+        attribute.buffer.elementsCount = elementsCount;
+        attribute.buffer.external = false;
+
+        _copiedBytes += size;
+    };
+
+    for (auto& attribute : _attributes) {
+        if (attribute.type == Render::Mesh::PrimitiveSet::Attribute::Type::Indice) {
+            continue;
+        }
+
+        const uint32_t elementSize = attribute.buffer.size / attribute.buffer.elementsCount;
+        char* data = new char[elementSize * newVerticesCount];
+        MeshOptimizer::remapVertices(data, attribute.buffer.data, elementSize, remap);
+
+        setBuffer(attribute, data, elementSize * newVerticesCount, newVerticesCount);
+    }
+
+    // 16 bits indices when possible, without 0xFFFF which restarts the primitives
+    if (newVerticesCount <= 0xFFFF) {
+        char* data = new char[indices.size() * sizeof(uint16_t)];
+        std::copy(indices.begin(), indices.end(), reinterpret_cast<uint16_t*>(data));
+
+        setBuffer(*indicesAttribute, data, static_cast<uint32_t>(indices.size() * sizeof(uint16_t)), static_cast<uint32_t>(indices.size()));
+    } else {
+        char* data = new char[indices.size() * sizeof(uint32_t)];
+        std::memcpy(data, indices.data(), indices.size() * sizeof(uint32_t));
+
+        setBuffer(*indicesAttribute, data, static_cast<uint32_t>(indices.size() * sizeof(uint32_t)), static_cast<uint32_t>(indices.size()));
+    }
+
+    return true;
+}
+
 Resource::SharedPtr<Render::Mesh> Mesh::build() {
+    if (_optimized) {
+        for (PrimitiveSet& primitiveSet : _primitiveSets) {
+            primitiveSet.optimize();
+        }
+    }
+
     switch (_renderer.getType()) {
         case Renderer::Type::Vulkan:
             return lug::Graphics::Vulkan::Builder::Mesh::build(*this);
@@ -1,23 +1,7 @@
 #include <lug/Graphics/Builder/Texture.hpp>
 
-#if defined(LUG_SYSTEM_WINDOWS)
-    #pragma warning(push)
-    #pragma warning(disable : 4244)
-    #pragma warning(disable : 4456)
-
-#endif
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
-#if defined(LUG_SYSTEM_WINDOWS)
-    #pragma warning(pop)
-#endif
-
-#if defined(LUG_SYSTEM_ANDROID)
-    #include <android/asset_manager.h>
-
-    #include <lug/Window/Android/WindowImplAndroid.hpp>
-    #include <lug/Window/Window.hpp>
-#endif
+#include <cstdlib>
+#include <cstring>
 
 #include <lug/Graphics/Renderer.hpp>
 
@@ -27,13 +11,6 @@ namespace Builder {
 
 Texture::Texture(Renderer& renderer) : _renderer(renderer) {}
 
-Texture::~Texture() {
-    for (auto& layer : _layers) {
-        delete[] layer.data;
-        layer.data = nullptr;
-    }
-}
-
 Resource::SharedPtr<Render::Texture> Texture::build() {
     Resource::SharedPtr<Render::Texture> texture{nullptr};
 
@@ -59,99 +36,98 @@ Resource::SharedPtr<Render::Texture> Texture::build() {
 }
 
 bool Texture::addLayer(uint32_t width, uint32_t height, Render::Texture::Format format, const unsigned char* data) {
-    if (!_width && !_height) {
-        _width = width;
-        _height = height;
-    } else if (width != _width || height != _height) {
-        return false;
-    }
-
-    if (format == Render::Texture::Format::Undefined) {
-        return false;
-    } else if (_format == Render::Texture::Format::Undefined) {
-        _format = format;
-    } else if (_format != format) {
+    if (!checkLayer(width, height, format)) {
         return false;
     }
 
     if (!data) {
-        _layers.push_back({data});
+        _layers.push_back({data, false, nullptr});
         return true;
     }
 
-    const size_t sizePixel = Render::Texture::formatToSize(format);
+    const size_t size = Render::Texture::getImageSize(width, height, format);
 
-    unsigned char* newData = new unsigned char[width * height * sizePixel];
+    ImageDecoder::Pixels pixels{static_cast<unsigned char*>(std::malloc(size))};
 
-    if (!newData) {
+    if (!pixels) {
         return false;
-
     }
-    std::memcpy(newData, data, width * height * sizePixel);
 
-    _layers.push_back({newData});
+    std::memcpy(pixels.get(), data, size);
+
+    _layers.push_back({pixels.get(), false, std::move(pixels)});
 
     return true;
 }
 
+bool Texture::addLayer(ImageDecoder::Image&& image) {
+    if (!image.pixels || !checkLayer(image.width, image.height, image.format)) {
+        return false;
+    }
 
-bool Texture::addLayer(const std::string& filename, bool hdr) {
-    int texWidth{0};
-    int texHeight{0};
-    int texChannels{0};
+    if (image.mipLevels > 1) {
+        _mipLevels = image.mipLevels;
+    }
 
-    stbi_uc* pixels = nullptr;
+    _layers.push_back({image.pixels.get(), image.mipLevels > 1, std::move(image.pixels)});
 
-#if defined(LUG_SYSTEM_ANDROID)
-    // Load shader from compressed asset
-    AAsset* asset = AAssetManager_open((lug::Window::priv::WindowImpl::activity)->assetManager, filename.c_str(), AASSET_MODE_STREAMING);
+    return true;
+}
 
-    if (!asset) {
-        LUG_LOG.error("Vulkan::Texture::build: Can't open Android asset \"{}\"", filename);
+bool Texture::addLayer(const ImageDecoder::Image& image) {
+    if (!image.pixels || !checkLayer(image.width, image.height, image.format)) {
         return false;
     }
 
-    uint32_t size = AAsset_getLength(asset);
-
-    if (size <= 0) {
-        LUG_LOG.error("Vulkan::Texture::build: Android asset \"{}\" is empty", filename);
-        return false;
+    if (image.mipLevels > 1) {
+        _mipLevels = image.mipLevels;
     }
 
-    unsigned char* data = new unsigned char[size];
+    _layers.push_back({image.pixels.get(), image.mipLevels > 1, nullptr});
 
-    AAsset_read(asset, reinterpret_cast<char*>(data), size);
-    AAsset_close(asset);
+    return true;
+}
 
-    if (hdr) {
-        pixels = reinterpret_cast<unsigned char*>(stbi_loadf_from_memory(data, size, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha));
-    } else {
-        pixels = stbi_load_from_memory(data, size, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+bool Texture::addExternalLayer(uint32_t width, uint32_t height, Render::Texture::Format format, const unsigned char* data) {
+    if (!data || !checkLayer(width, height, format)) {
+        return false;
     }
 
-    delete[] data;
-#else
-    if (hdr) {
-        pixels = reinterpret_cast<unsigned char*>(stbi_loadf(filename.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha));
-    } else {
-        pixels = stbi_load(filename.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-    }
-#endif
+    _layers.push_back({data, true, nullptr});
 
-    if (!pixels) {
+    return true;
+}
+
+bool Texture::checkLayer(uint32_t width, uint32_t height, Render::Texture::Format format) {
+    if (!_width && !_height) {
+        _width = width;
+        _height = height;
+    } else if (width != _width || height != _height) {
         return false;
     }
 
-    Render::Texture::Format format = hdr ? Render::Texture::Format::R32G32B32A32_SFLOAT : Render::Texture::Format::R8G8B8A8_UNORM;
-    if (!addLayer(texWidth, texHeight, format, pixels)) {
-        stbi_image_free(pixels);
+    if (format == Render::Texture::Format::Undefined) {
+        return false;
+    } else if (_format == Render::Texture::Format::Undefined) {
+        _format = format;
+    } else if (_format != format) {
         return false;
     }
 
-    stbi_image_free(pixels);
     return true;
 }
 
+
+bool Texture::addLayer(const std::string& filename, bool hdr) {
+    ImageDecoder::Image image;
+
+    if (!ImageDecoder(1).decode({filename, hdr}, image)) {
+        return false;
+    }
+
+    return addLayer(std::move(image));
+}
+
 } // Builder
 } // Graphics
 } // lug
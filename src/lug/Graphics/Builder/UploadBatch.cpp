@@ -0,0 +1,40 @@
+#include <lug/Graphics/Builder/UploadBatch.hpp>
+
+#include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Builder {
+
+UploadBatch::UploadBatch(Renderer& renderer) : _renderer(renderer) {
+    switch (_renderer.getType()) {
+        case Renderer::Type::Vulkan:
+            lug::Graphics::Vulkan::Builder::UploadBatch::init(*this);
+    }
+}
+
+// Defined here, where Vulkan::Render::UploadBatch is complete
+UploadBatch::~UploadBatch() = default;
+
+bool UploadBatch::submit() {
+    switch (_renderer.getType()) {
+        case Renderer::Type::Vulkan:
+            return lug::Graphics::Vulkan::Builder::UploadBatch::submit(*this);
+    }
+
+    return false;
+}
+
+bool UploadBatch::wait() {
+    switch (_renderer.getType()) {
+        case Renderer::Type::Vulkan:
+            return lug::Graphics::Vulkan::Builder::UploadBatch::wait(*this);
+    }
+
+    return false;
+}
+
+} // Builder
+} // Graphics
+} // lug
@@ -0,0 +1,142 @@
+#include <lug/Graphics/GltfBufferSource.hpp>
+
+#include <cstring>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+constexpr uint32_t glbMagic = 0x46546C67;       // "glTF"
+constexpr uint32_t glbVersion = 2;
+constexpr uint32_t glbJsonChunkType = 0x4E4F534A; // "JSON"
+constexpr uint32_t glbBinChunkType = 0x004E4942;  // "BIN\0"
+constexpr std::size_t glbHeaderSize = 12;
+constexpr std::size_t glbChunkHeaderSize = 8;
+
+uint32_t readUint32(const uint8_t* data) {
+    // The .glb files are little endian
+    return static_cast<uint32_t>(data[0])
+        | static_cast<uint32_t>(data[1]) << 8
+        | static_cast<uint32_t>(data[2]) << 16
+        | static_cast<uint32_t>(data[3]) << 24;
+}
+
+bool isGlbFilename(const std::string& filename) {
+    const std::size_t dot = filename.find_last_of('.');
+    if (dot == std::string::npos) {
+        return false;
+    }
+
+    std::string extension = filename.substr(dot + 1);
+    for (char& character : extension) {
+        if (character >= 'A' && character <= 'Z') {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+    }
+
+    return extension == "glb";
+}
+
+} // anonymous
+
+bool GltfBufferSource::open(const std::string& filename) {
+    const std::size_t separator = filename.find_last_of("/\\");
+    _directory = separator == std::string::npos ? "" : filename.substr(0, separator + 1);
+
+    _glb.close();
+    _glbBin = Chunk{};
+    _buffers.clear();
+
+    if (!isGlbFilename(filename)) {
+        return true;
+    }
+
+    Chunk json;
+    if (!_glb.open(filename) || !parseGlb(_glb.getData(), _glb.getSize(), json, _glbBin)) {
+        _glb.close();
+        _glbBin = Chunk{};
+        return false;
+    }
+
+    return true;
+}
+
+const char* GltfBufferSource::getBufferData(uint32_t index, const std::string& uri, std::size_t byteLength) {
+    // Only the first buffer of a .glb file can omit its uri
+    if (uri.empty()) {
+        if (index != 0 || !_glb.isOpen() || byteLength > _glbBin.size) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<const char*>(_glb.getData() + _glbBin.offset);
+    }
+
+    // The data URIs are decoded by the glTF parser
+    if (uri.compare(0, 5, "data:") == 0) {
+        return nullptr;
+    }
+
+    if (index >= _buffers.size()) {
+        _buffers.resize(index + 1);
+    }
+
+    Buffer& buffer = _buffers[index];
+
+    if (!buffer.opened) {
+        buffer.opened = true;
+        buffer.file.open(_directory + uri);
+    }
+
+    if (!buffer.file.isOpen() || byteLength > buffer.file.getSize()) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const char*>(buffer.file.getData());
+}
+
+bool GltfBufferSource::parseGlb(const uint8_t* data, std::size_t size, Chunk& json, Chunk& bin) {
+    json = Chunk{};
+    bin = Chunk{};
+
+    if (!data || size < glbHeaderSize
+        || readUint32(data) != glbMagic
+        || readUint32(data + 4) != glbVersion
+        || readUint32(data + 8) > size) {
+        return false;
+    }
+
+    // The length of the header may be smaller than the file, the rest is ignored
+    const std::size_t length = readUint32(data + 8);
+    std::size_t offset = glbHeaderSize;
+
+    for (uint32_t chunkIdx = 0; offset + glbChunkHeaderSize <= length; ++chunkIdx) {
+        const std::size_t chunkSize = readUint32(data + offset);
+        const uint32_t chunkType = readUint32(data + offset + 4);
+
+        offset += glbChunkHeaderSize;
+
+        if (chunkSize > length - offset) {
+            return false;
+        }
+
+        // The first chunk is the JSON, the second one is the optional BIN chunk, the others are ignored
+        if (chunkIdx == 0) {
+            if (chunkType != glbJsonChunkType) {
+                return false;
+            }
+
+            json = Chunk{offset, chunkSize};
+        } else if (chunkIdx == 1 && chunkType == glbBinChunkType) {
+            bin = Chunk{offset, chunkSize};
+        }
+
+        // The chunks are aligned on 4 bytes
+        offset += (chunkSize + 3) & ~static_cast<std::size_t>(3);
+    }
+
+    return json.size != 0;
+}
+
+} // Graphics
+} // lug
@@ -21,20 +21,15 @@ namespace Graphics {
 
 GltfLoader::GltfLoader(Renderer& renderer): Loader(renderer) {}
 
-static void* getBufferViewData(const gltf2::Asset& asset, const gltf2::Accessor& accessor) {
-    const gltf2::BufferView& bufferView = asset.bufferViews[accessor.bufferView];
-    const gltf2::Buffer& buffer = asset.buffers[bufferView.buffer];
-
-    if (!buffer.data) {
-        LUG_LOG.error("GltfLoader::createMesh Buffer data can't be null");
-        return nullptr;
-    }
+ImageDecoder& GltfLoader::getImageDecoder() {
+    return _imageDecoder;
+}
 
-    // TODO(nokitoo): handle uri
-    return buffer.data + bufferView.byteOffset + accessor.byteOffset;
+void GltfLoader::setOptimizeMeshes(bool optimizeMeshes) {
+    _optimizeMeshes = optimizeMeshes;
 }
 
-static uint32_t getAttributeSize(const gltf2::Accessor& accessor) {
+uint32_t GltfLoader::getAttributeSize(const gltf2::Accessor& accessor) {
     uint32_t componentSize = 0;
     switch (accessor.componentType) {
         case gltf2::Accessor::ComponentType::Byte:
@@ -78,6 +73,44 @@ static uint32_t getAttributeSize(const gltf2::Accessor& accessor) {
     return componentSize;
 }
 
+const void* GltfLoader::getBufferViewData(const gltf2::Asset& asset, GltfBufferSource& buffers, const gltf2::Accessor& accessor) {
+    const gltf2::BufferView& bufferView = asset.bufferViews[accessor.bufferView];
+    const gltf2::Buffer& buffer = asset.buffers[bufferView.buffer];
+
+    if (static_cast<std::size_t>(bufferView.byteOffset) + accessor.byteOffset + static_cast<std::size_t>(getAttributeSize(accessor)) * accessor.count > buffer.byteLength) {
+        LUG_LOG.error("GltfLoader::getBufferViewData Accessor out of the bounds of its buffer");
+        return nullptr;
+    }
+
+    // Point directly into the mapped file when possible, to avoid copying the buffer
+    const char* data = buffers.getBufferData(bufferView.buffer, buffer.uri, buffer.byteLength);
+    if (!data) {
+        data = buffer.data;
+    }
+
+    if (!data) {
+        LUG_LOG.error("GltfLoader::getBufferViewData Buffer data can't be null");
+        return nullptr;
+    }
+
+    return data + bufferView.byteOffset + accessor.byteOffset;
+}
+
+void GltfLoader::decodeImages(const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets) {
+    // One source per image, shared by the textures using it with different samplers.
+    // The images without texture have an empty filename, which is skipped
+    std::vector<ImageDecoder::Source> sources(asset.images.size());
+
+    // TODO: Handle correctly the load with bufferView / uri data
+    for (const gltf2::Texture& texture : asset.textures) {
+        if (texture.source != -1) {
+            sources[texture.source].filename = asset.images[texture.source].uri;
+        }
+    }
+
+    loadedAssets.images = _imageDecoder.decode(sources);
+}
+
 Resource::SharedPtr<Render::Texture> GltfLoader::createTexture(Renderer& renderer, const gltf2::Asset& asset, GltfLoader::LoadedAssets& loadedAssets, int32_t index) {
     const gltf2::Texture& gltfTexture = asset.textures[index];
 
@@ -86,10 +119,11 @@ Resource::SharedPtr<Render::Texture> GltfLoader::createTexture(Renderer& rendere
     }
 
     Builder::Texture textureBuilder(renderer);
+    textureBuilder.setUploadBatch(&loadedAssets.uploadBatch);
 
     if (gltfTexture.source != -1) {
-        // TODO: Handle correctly the load with bufferView / uri data
-        if (!textureBuilder.addLayer(asset.images[gltfTexture.source].uri)) {
+        // The image is already decoded by decodeImages(), and kept until the upload batch is submitted
+        if (!textureBuilder.addLayer(loadedAssets.images[gltfTexture.source])) {
             LUG_LOG.error("GltfLoader::createTexture: Can't load the texture \"{}\"", asset.images[gltfTexture.source].uri);
             return nullptr;
         }
@@ -261,7 +295,7 @@ Resource::SharedPtr<Render::Material> GltfLoader::createDefaultMaterial(Renderer
     return loadedAssets.defaultMaterial;
 }
 
-static void* generateNormals(float* positions, uint32_t accessorCount) {
+static void* generateNormals(const float* positions, uint32_t accessorCount) {
     Math::Vec3f* data = new Math::Vec3f[accessorCount];
 
     uint32_t trianglesCount = accessorCount / 3;
@@ -288,6 +322,7 @@ Resource::SharedPtr<Render::Mesh> GltfLoader::createMesh(Renderer& renderer, con
 
     Builder::Mesh meshBuilder(renderer);
     meshBuilder.setName(gltfMesh.name);
+    meshBuilder.setOptimized(_optimizeMeshes);
 
     for (const gltf2::Primitive& gltfPrimitive : gltfMesh.primitives) {
         Builder::Mesh::PrimitiveSet* primitiveSet = meshBuilder.addPrimitiveSet();
@@ -322,11 +357,11 @@ Resource::SharedPtr<Render::Mesh> GltfLoader::createMesh(Renderer& renderer, con
             const gltf2::Accessor& accessor = asset.accessors[gltfPrimitive.indices]; // Get the accessor from its index (directly from indices)
 
             uint32_t componentSize = getAttributeSize(accessor);
-            void* data = getBufferViewData(asset, accessor);
+            const void* data = getBufferViewData(asset, loadedAssets.buffers, accessor);
             if (!data) {
                 return nullptr;
             }
-            primitiveSet->addAttributeBuffer(
+            primitiveSet->addExternalAttributeBuffer(
                 data,
                 componentSize,
                 accessor.count,
@@ -336,7 +371,7 @@ Resource::SharedPtr<Render::Mesh> GltfLoader::createMesh(Renderer& renderer, con
 
         // Attributes
         struct {
-            void* data{nullptr};
+            const void* data{nullptr};
             uint32_t accessorCount{0};
         } positions; // Store positions for normals generation
         bool hasNormals = false;
@@ -363,7 +398,7 @@ Resource::SharedPtr<Render::Mesh> GltfLoader::createMesh(Renderer& renderer, con
             const gltf2::Accessor& accessor = asset.accessors[attribute.second]; // Get the accessor from its index (second in the pair)
 
             uint32_t componentSize = getAttributeSize(accessor);
-            void* data = getBufferViewData(asset, accessor);
+            const void* data = getBufferViewData(asset, loadedAssets.buffers, accessor);
             if (!data) {
                 return nullptr;
             }
@@ -371,12 +406,13 @@ Resource::SharedPtr<Render::Mesh> GltfLoader::createMesh(Renderer& renderer, con
                 positions.data = data;
                 positions.accessorCount = accessor.count;
             }
-            primitiveSet->addAttributeBuffer(data, componentSize, accessor.count, type);
+            // The asset and its mapped buffers outlive the build of the mesh
+            primitiveSet->addExternalAttributeBuffer(data, componentSize, accessor.count, type);
         }
 
         // Generate flat normals if there is not any
         if (!hasNormals) {
-            void* data = generateNormals((float*)positions.data, positions.accessorCount);
+            void* data = generateNormals((const float*)positions.data, positions.accessorCount);
             if (!data) {
                 return nullptr;
             }
@@ -461,7 +497,11 @@ Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename)
     }
 
     // Create the container for the already loaded assets
-    GltfLoader::LoadedAssets loadedAssets;
+    GltfLoader::LoadedAssets loadedAssets(_renderer);
+
+    if (!loadedAssets.buffers.open(filename)) {
+        LUG_LOG.warn("GltfLoader::loadFile Can't map the file \"{}\", its buffers are read from memory", filename);
+    }
 
     loadedAssets.textures.resize(asset.textures.size());
     loadedAssets.materials.resize(asset.materials.size());
@@ -471,6 +511,10 @@ Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename)
     if (asset.scene == -1) { // No scene to load
         return nullptr;
     }
+
+    // Decode all the images at once, the materials need them one after another
+    decodeImages(asset, loadedAssets);
+
     const gltf2::Scene& gltfScene = asset.scenes[asset.scene];
 
     Builder::Scene sceneBuilder(_renderer);
@@ -488,6 +532,12 @@ Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename)
         }
     }
 
+    // Upload all the textures at once
+    if (!loadedAssets.uploadBatch.submit() || !loadedAssets.uploadBatch.wait()) {
+        LUG_LOG.error("GltfLoader::loadFile Can't upload the textures");
+        return nullptr;
+    }
+
     return Resource::SharedPtr<Resource>::cast(scene);
 }
 
@@ -0,0 +1,179 @@
+#include <lug/Graphics/ImageDecoder.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <thread>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #pragma warning(push)
+    #pragma warning(disable : 4244)
+    #pragma warning(disable : 4456)
+
+#endif
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#if defined(LUG_SYSTEM_WINDOWS)
+    #pragma warning(pop)
+#endif
+
+#if defined(LUG_SYSTEM_ANDROID)
+    #include <android/asset_manager.h>
+
+    #include <lug/Window/Android/WindowImplAndroid.hpp>
+    #include <lug/Window/Window.hpp>
+#else
+    #include <lug/System/MappedFile.hpp>
+#endif
+
+#include <lug/Graphics/Ktx2.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/ThreadPool.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+std::string getExtension(const std::string& filename) {
+    const std::string::size_type extensionPos = filename.find_last_of(".");
+    if (extensionPos == std::string::npos) {
+        return "";
+    }
+
+    std::string extension = filename.substr(extensionPos + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    return extension;
+}
+
+} // anonymous
+
+void ImageDecoder::Deleter::operator()(unsigned char* pixels) const {
+    std::free(pixels);
+}
+
+ImageDecoder::ImageDecoder(uint8_t threadsCount) : _threadsCount(threadsCount) {
+    setDecoder("ktx2", Ktx2::read);
+}
+
+void ImageDecoder::setDecoder(const std::string& extension, Decoder decoder) {
+    _decoders[getExtension("." + extension)] = std::move(decoder);
+}
+
+bool ImageDecoder::decode(const Source& source, Image& image) const {
+    image = Image{};
+
+    const auto decoder = _decoders.find(getExtension(source.filename));
+
+    const auto decodeData = [&](const unsigned char* data, std::size_t size) {
+        if (decoder != _decoders.end()) {
+            return decoder->second(data, size, source.hdr, image);
+        }
+
+        return decodeWithStb(data, size, source.hdr, image);
+    };
+
+    bool success = false;
+
+#if defined(LUG_SYSTEM_ANDROID)
+    // Load the image from the compressed asset
+    AAsset* asset = AAssetManager_open((lug::Window::priv::WindowImpl::activity)->assetManager, source.filename.c_str(), AASSET_MODE_STREAMING);
+
+    if (!asset) {
+        LUG_LOG.error("ImageDecoder::decode: Can't open Android asset \"{}\"", source.filename);
+        return false;
+    }
+
+    std::vector<unsigned char> data(AAsset_getLength(asset));
+    AAsset_read(asset, reinterpret_cast<char*>(data.data()), data.size());
+    AAsset_close(asset);
+
+    success = !data.empty() && decodeData(data.data(), data.size());
+#else
+    // The encoded file is read by the decoder from the page cache, without copy
+    System::MappedFile file;
+    if (!file.open(source.filename)) {
+        LUG_LOG.error("ImageDecoder::decode: Can't open \"{}\"", source.filename);
+        return false;
+    }
+
+    success = decodeData(file.getData(), file.getSize());
+#endif
+
+    if (!success || !image.pixels) {
+        LUG_LOG.error("ImageDecoder::decode: Can't decode \"{}\"", source.filename);
+        image = Image{};
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<ImageDecoder::Image> ImageDecoder::decode(const std::vector<Source>& sources) const {
+    std::vector<Image> images(sources.size());
+
+    // The thread pool takes at most 255 workers
+    const uint32_t maxThreadsCount = _threadsCount ? _threadsCount : std::min(std::max(std::thread::hardware_concurrency(), 1u), 255u);
+    const uint32_t threadsCount = std::min(maxThreadsCount, static_cast<uint32_t>(std::count_if(sources.begin(), sources.end(), [](const Source& source) {
+        return !source.filename.empty();
+    })));
+
+    const auto decodeSource = [this, &sources, &images](size_t i) {
+        if (!sources[i].filename.empty()) {
+            decode(sources[i], images[i]);
+        }
+    };
+
+    // Not worth a thread for one image
+    if (threadsCount <= 1) {
+        for (size_t i = 0; i < sources.size(); ++i) {
+            decodeSource(i);
+        }
+
+        return images;
+    }
+
+    {
+        System::ThreadPool threadPool(static_cast<uint8_t>(threadsCount));
+
+        for (size_t i = 0; i < sources.size(); ++i) {
+            threadPool.enqueue(decodeSource, i);
+        }
+
+        // The destructor of the thread pool waits for all the tasks
+    }
+
+    return images;
+}
+
+bool ImageDecoder::decodeWithStb(const unsigned char* data, std::size_t size, bool hdr, Image& image) {
+    int width{0};
+    int height{0};
+    int channels{0};
+
+    unsigned char* pixels = nullptr;
+
+    if (hdr) {
+        pixels = reinterpret_cast<unsigned char*>(stbi_loadf_from_memory(data, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha));
+    } else {
+        pixels = stbi_load_from_memory(data, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha);
+    }
+
+    if (!pixels) {
+        return false;
+    }
+
+    // stb_image allocates with malloc, so the pixels are given to the image without copy
+    image.width = static_cast<uint32_t>(width);
+    image.height = static_cast<uint32_t>(height);
+    image.format = hdr ? Render::Texture::Format::R32G32B32A32_SFLOAT : Render::Texture::Format::R8G8B8A8_UNORM;
+    image.pixels.reset(pixels);
+
+    return true;
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,323 @@
+#include <lug/Graphics/Ktx2.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Ktx2 {
+
+namespace {
+
+constexpr uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+// All the fields are little-endian
+struct Header {
+    uint8_t identifier[12];
+
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+};
+
+struct LevelIndex {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(Header) == 80, "The layout of the KTX 2.0 header changed");
+static_assert(sizeof(LevelIndex) == 24, "The layout of the KTX 2.0 level index changed");
+
+constexpr std::size_t levelIndexOffset = sizeof(Header);
+
+// Values of the VkFormat and of the data format descriptor, so that they don't depend on the Vulkan headers
+struct FormatDescription {
+    Render::Texture::Format format;
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint8_t colorModel;
+
+    struct Sample {
+        uint8_t channelType;    ///< Channel id and qualifiers
+        uint16_t bitOffset;
+        uint8_t bitLength;
+        uint32_t lower;
+        uint32_t upper;
+    };
+
+    std::vector<Sample> samples;
+};
+
+constexpr uint8_t modelRgbsda = 1;
+constexpr uint8_t modelBc1a = 128;
+constexpr uint8_t modelBc3 = 130;
+constexpr uint8_t modelBc7 = 134;
+constexpr uint8_t modelEtc2 = 161;
+constexpr uint8_t modelAstc = 162;
+
+constexpr uint8_t channelFloat = 0x80 | 0x40;   // Float and signed qualifiers
+constexpr uint32_t floatLower = 0xBF800000;     // -1.0f
+constexpr uint32_t floatUpper = 0x3F800000;     // 1.0f
+
+const std::vector<FormatDescription>& getFormatDescriptions() {
+    static const std::vector<FormatDescription> descriptions{
+        {Render::Texture::Format::R8G8B8A8_UNORM, 37, 1, modelRgbsda, {
+            {0, 0, 8, 0, 255}, {1, 8, 8, 0, 255}, {2, 16, 8, 0, 255}, {15, 24, 8, 0, 255}
+        }},
+        {Render::Texture::Format::R16G16_SFLOAT, 83, 2, modelRgbsda, {
+            {0 | channelFloat, 0, 16, floatLower, floatUpper}, {1 | channelFloat, 16, 16, floatLower, floatUpper}
+        }},
+        {Render::Texture::Format::R16G16B16_SFLOAT, 90, 2, modelRgbsda, {
+            {0 | channelFloat, 0, 16, floatLower, floatUpper}, {1 | channelFloat, 16, 16, floatLower, floatUpper},
+            {2 | channelFloat, 32, 16, floatLower, floatUpper}
+        }},
+        {Render::Texture::Format::R32G32B32A32_SFLOAT, 109, 4, modelRgbsda, {
+            {0 | channelFloat, 0, 32, floatLower, floatUpper}, {1 | channelFloat, 32, 32, floatLower, floatUpper},
+            {2 | channelFloat, 64, 32, floatLower, floatUpper}, {15 | channelFloat, 96, 32, floatLower, floatUpper}
+        }},
+        {Render::Texture::Format::BC1_RGBA_UNORM, 133, 1, modelBc1a, {
+            {1, 0, 64, 0, 0xFFFFFFFF}
+        }},
+        {Render::Texture::Format::BC3_UNORM, 137, 1, modelBc3, {
+            {15, 0, 64, 0, 0xFFFFFFFF}, {0, 64, 64, 0, 0xFFFFFFFF}
+        }},
+        {Render::Texture::Format::BC7_UNORM, 145, 1, modelBc7, {
+            {0, 0, 128, 0, 0xFFFFFFFF}
+        }},
+        {Render::Texture::Format::ETC2_R8G8B8A8_UNORM, 151, 1, modelEtc2, {
+            {15, 0, 64, 0, 0xFFFFFFFF}, {2, 64, 64, 0, 0xFFFFFFFF}
+        }},
+        {Render::Texture::Format::ASTC_4x4_UNORM, 157, 1, modelAstc, {
+            {0, 0, 128, 0, 0xFFFFFFFF}
+        }}
+    };
+
+    return descriptions;
+}
+
+const FormatDescription* findFormatDescription(Render::Texture::Format format) {
+    for (const FormatDescription& description : getFormatDescriptions()) {
+        if (description.format == format) {
+            return &description;
+        }
+    }
+
+    return nullptr;
+}
+
+const FormatDescription* findFormatDescription(uint32_t vkFormat) {
+    for (const FormatDescription& description : getFormatDescriptions()) {
+        if (description.vkFormat == vkFormat) {
+            return &description;
+        }
+    }
+
+    return nullptr;
+}
+
+// Data format descriptor with a single basic block
+std::vector<uint32_t> getDataFormatDescriptor(const FormatDescription& description) {
+    const uint32_t blockExtent = Render::Texture::formatToBlockExtent(description.format);
+    const uint32_t blockSize = static_cast<uint32_t>(24 + 16 * description.samples.size());
+
+    std::vector<uint32_t> dfd{
+        /* dfdTotalSize */ 4 + blockSize,
+        /* vendorId, descriptorType */ 0,
+        /* versionNumber, descriptorBlockSize */ 2 | (blockSize << 16),
+        /* colorModel, colorPrimaries (BT709), transferFunction (linear), flags */ description.colorModel | (1u << 8) | (1u << 16),
+        /* texelBlockDimension0-3 */ (blockExtent - 1) | ((blockExtent - 1) << 8),
+        /* bytesPlane0-3 */ static_cast<uint32_t>(Render::Texture::formatToSize(description.format)),
+        /* bytesPlane4-7 */ 0
+    };
+
+    for (const FormatDescription::Sample& sample : description.samples) {
+        dfd.push_back(sample.bitOffset | ((sample.bitLength - 1u) << 16) | (static_cast<uint32_t>(sample.channelType) << 24));
+        dfd.push_back(0);
+        dfd.push_back(sample.lower);
+        dfd.push_back(sample.upper);
+    }
+
+    return dfd;
+}
+
+std::size_t align(std::size_t offset, std::size_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+std::size_t getLevelAlignment(Render::Texture::Format format) {
+    // Least common multiple of the size of a texel block and 4
+    std::size_t alignment = Render::Texture::formatToSize(format);
+    while (alignment % 4) {
+        alignment += Render::Texture::formatToSize(format);
+    }
+
+    return alignment;
+}
+
+template <typename T>
+void append(std::vector<uint8_t>& file, const T& value) {
+    const std::size_t offset = file.size();
+
+    file.resize(offset + sizeof(T));
+    std::memcpy(file.data() + offset, &value, sizeof(T));
+}
+
+} // anonymous
+
+bool isKtx2(const unsigned char* data, std::size_t size) {
+    return size >= sizeof(identifier) && std::memcmp(data, identifier, sizeof(identifier)) == 0;
+}
+
+bool read(const unsigned char* data, std::size_t size, bool /*hdr*/, ImageDecoder::Image& image) {
+    if (!isKtx2(data, size) || size < levelIndexOffset) {
+        LUG_LOG.error("Ktx2::read: Not a KTX 2.0 file");
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+
+    if (header.supercompressionScheme) {
+        LUG_LOG.error("Ktx2::read: The supercompression scheme {} (BasisLZ, Zstandard or ZLIB) is not supported", header.supercompressionScheme);
+        return false;
+    }
+
+    if (!header.vkFormat) {
+        LUG_LOG.error("Ktx2::read: The Basis Universal UASTC textures are not supported");
+        return false;
+    }
+
+    const FormatDescription* description = findFormatDescription(header.vkFormat);
+    if (!description) {
+        LUG_LOG.error("Ktx2::read: The VkFormat {} is not supported", header.vkFormat);
+        return false;
+    }
+
+    if (!header.pixelWidth || !header.pixelHeight || header.pixelDepth || header.layerCount > 1 || header.faceCount != 1) {
+        LUG_LOG.error("Ktx2::read: Only the 2D textures are supported");
+        return false;
+    }
+
+    // A level count of 0 asks to generate the mip levels, only the first one is stored
+    const uint32_t mipLevels = std::max(header.levelCount, 1u);
+    if (mipLevels > 32 || levelIndexOffset + static_cast<std::size_t>(mipLevels) * sizeof(LevelIndex) > size) {
+        LUG_LOG.error("Ktx2::read: Invalid level index");
+        return false;
+    }
+
+    const Render::Texture::Format format = description->format;
+
+    ImageDecoder::Pixels pixels{static_cast<unsigned char*>(std::malloc(Render::Texture::getMipLevelsSize(header.pixelWidth, header.pixelHeight, format, mipLevels)))};
+    if (!pixels) {
+        return false;
+    }
+
+    // The levels are indexed from the largest one, which is the last one in the file
+    std::size_t pixelsOffset = 0;
+
+    for (uint32_t level = 0; level < mipLevels; ++level) {
+        LevelIndex levelIndex;
+        std::memcpy(&levelIndex, data + levelIndexOffset + level * sizeof(LevelIndex), sizeof(LevelIndex));
+
+        const std::size_t levelSize = Render::Texture::getImageSize(std::max(header.pixelWidth >> level, 1u), std::max(header.pixelHeight >> level, 1u), format);
+
+        if (levelIndex.byteLength < levelSize || levelIndex.byteOffset > size || levelIndex.byteLength > size - levelIndex.byteOffset) {
+            LUG_LOG.error("Ktx2::read: The level {} is out of the bounds of the file", level);
+            return false;
+        }
+
+        std::memcpy(pixels.get() + pixelsOffset, data + levelIndex.byteOffset, levelSize);
+        pixelsOffset += levelSize;
+    }
+
+    image.width = header.pixelWidth;
+    image.height = header.pixelHeight;
+    image.format = format;
+    image.mipLevels = mipLevels;
+    image.pixels = std::move(pixels);
+
+    return true;
+}
+
+std::vector<uint8_t> write(uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format, const uint8_t* data) {
+    const FormatDescription* description = findFormatDescription(format);
+    if (!description || !width || !height || !mipLevels) {
+        return {};
+    }
+
+    const std::vector<uint32_t> dfd = getDataFormatDescriptor(*description);
+
+    // A single key/value pair, the writer of the file
+    const char writerKey[] = "KTXwriter";
+    const char writerValue[] = "Lugdunum";
+    const uint32_t writerLength = static_cast<uint32_t>(sizeof(writerKey) + sizeof(writerValue));
+
+    Header header{};
+    std::memcpy(header.identifier, identifier, sizeof(identifier));
+    header.vkFormat = description->vkFormat;
+    header.typeSize = description->typeSize;
+    header.pixelWidth = width;
+    header.pixelHeight = height;
+    header.faceCount = 1;
+    header.levelCount = mipLevels;
+
+    header.dfdByteOffset = static_cast<uint32_t>(levelIndexOffset + mipLevels * sizeof(LevelIndex));
+    header.dfdByteLength = static_cast<uint32_t>(dfd.size() * sizeof(uint32_t));
+    header.kvdByteOffset = header.dfdByteOffset + header.dfdByteLength;
+    header.kvdByteLength = static_cast<uint32_t>(align(sizeof(uint32_t) + writerLength, 4));
+
+    std::vector<uint8_t> file;
+    append(file, header);
+
+    // The level index is written once the levels are placed
+    file.resize(header.dfdByteOffset);
+
+    for (uint32_t value : dfd) {
+        append(file, value);
+    }
+
+    append(file, writerLength);
+    file.insert(file.end(), writerKey, writerKey + sizeof(writerKey));
+    file.insert(file.end(), writerValue, writerValue + sizeof(writerValue));
+    file.resize(header.kvdByteOffset + header.kvdByteLength);
+
+    // The levels are stored from the smallest one
+    std::vector<LevelIndex> levelIndices(mipLevels);
+    const std::size_t levelAlignment = getLevelAlignment(format);
+
+    for (uint32_t level = mipLevels; level-- > 0;) {
+        const std::size_t levelSize = Render::Texture::getImageSize(std::max(width >> level, 1u), std::max(height >> level, 1u), format);
+        const std::size_t levelOffset = align(file.size(), levelAlignment);
+        const std::size_t dataOffset = Render::Texture::getMipLevelsSize(width, height, format, level);
+
+        file.resize(levelOffset);
+        file.insert(file.end(), data + dataOffset, data + dataOffset + levelSize);
+
+        levelIndices[level] = {levelOffset, levelSize, levelSize};
+    }
+
+    std::memcpy(file.data() + levelIndexOffset, levelIndices.data(), levelIndices.size() * sizeof(LevelIndex));
+
+    return file;
+}
+
+} // Ktx2
+} // Graphics
+} // lug
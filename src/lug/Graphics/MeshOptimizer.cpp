@@ -0,0 +1,413 @@
+#include <lug/Graphics/MeshOptimizer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace lug {
+namespace Graphics {
+namespace MeshOptimizer {
+
+namespace {
+
+// Parameters of the scores of Tom Forsyth, tuned for an LRU cache of 32 vertices
+constexpr uint32_t forsythCacheSize = 32;
+constexpr float cacheDecayPower = 1.5f;
+constexpr float lastTriangleScore = 0.75f;
+constexpr float valenceBoostScale = 2.0f;
+constexpr float valenceBoostPower = 0.5f;
+
+constexpr uint32_t invalidIndex = ~0u;
+
+float getVertexScore(int32_t cachePosition, uint32_t remainingTriangles) {
+    // The vertex is not used anymore
+    if (remainingTriangles == 0) {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+
+    if (cachePosition >= 0) {
+        // The vertices of the last triangle have the same score, to not favor a direction
+        if (cachePosition < 3) {
+            score = lastTriangleScore;
+        } else {
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / (forsythCacheSize - 3), cacheDecayPower);
+        }
+    }
+
+    // Boosts the vertices with few triangles left, to not leave lone triangles behind
+    return score + valenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -valenceBoostPower);
+}
+
+// FIFO cache with timestamps: a vertex is in the cache if it was one of the last cacheSize vertices added
+class FifoCache {
+public:
+    FifoCache(uint32_t verticesCount, uint32_t cacheSize) : _timestamps(verticesCount, 0), _cacheSize(cacheSize), _time(cacheSize + 1) {}
+
+    // Returns true if the vertex was not in the cache
+    bool access(uint32_t index) {
+        if (_time - _timestamps[index] > _cacheSize) {
+            _timestamps[index] = _time++;
+            return true;
+        }
+
+        return false;
+    }
+
+    uint32_t accessTriangle(const uint32_t* triangle) {
+        return access(triangle[0]) + access(triangle[1]) + access(triangle[2]);
+    }
+
+    void flush() {
+        _time += _cacheSize + 1;
+    }
+
+private:
+    std::vector<uint32_t> _timestamps;
+    uint32_t _cacheSize;
+    uint32_t _time;
+};
+
+void getTriangleCentroidAndNormal(const uint32_t* triangle, const float* positions, float centroid[3], float normal[3]) {
+    const float* a = positions + triangle[0] * 3;
+    const float* b = positions + triangle[1] * 3;
+    const float* c = positions + triangle[2] * 3;
+
+    const float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+
+    // The length of the normal is twice the area of the triangle
+    normal[0] = ab[1] * ac[2] - ab[2] * ac[1];
+    normal[1] = ab[2] * ac[0] - ab[0] * ac[2];
+    normal[2] = ab[0] * ac[1] - ab[1] * ac[0];
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        centroid[i] = (a[i] + b[i] + c[i]) / 3.0f;
+    }
+}
+
+} // anonymous
+
+Statistics getCacheStatistics(const std::vector<uint32_t>& indices, uint32_t verticesCount, uint32_t cacheSize) {
+    Statistics statistics;
+
+    const uint32_t trianglesCount = static_cast<uint32_t>(indices.size() / 3);
+    if (trianglesCount == 0 || cacheSize == 0) {
+        return statistics;
+    }
+
+    FifoCache cache(verticesCount, cacheSize);
+    std::vector<bool> referenced(verticesCount, false);
+
+    uint32_t transformedCount = 0;
+    uint32_t referencedCount = 0;
+
+    for (uint32_t i = 0; i < trianglesCount * 3; ++i) {
+        const uint32_t index = indices[i];
+        if (index >= verticesCount) {
+            continue;
+        }
+
+        transformedCount += cache.access(index);
+
+        if (!referenced[index]) {
+            referenced[index] = true;
+            ++referencedCount;
+        }
+    }
+
+    statistics.acmr = static_cast<float>(transformedCount) / trianglesCount;
+    statistics.atvr = referencedCount ? static_cast<float>(transformedCount) / referencedCount : 0.0f;
+
+    return statistics;
+}
+
+void optimizeVertexCache(std::vector<uint32_t>& indices, uint32_t verticesCount) {
+    const uint32_t trianglesCount = static_cast<uint32_t>(indices.size() / 3);
+    if (trianglesCount == 0 || std::any_of(indices.begin(), indices.end(), [verticesCount](uint32_t index) { return index >= verticesCount; })) {
+        return;
+    }
+
+    // Triangles of each vertex, the ones already emitted are moved to the end of the list of the vertex
+    std::vector<uint32_t> remainingTriangles(verticesCount, 0);
+    for (uint32_t i = 0; i < trianglesCount * 3; ++i) {
+        ++remainingTriangles[indices[i]];
+    }
+
+    std::vector<uint32_t> adjacencyOffsets(verticesCount + 1, 0);
+    for (uint32_t i = 0; i < verticesCount; ++i) {
+        adjacencyOffsets[i + 1] = adjacencyOffsets[i] + remainingTriangles[i];
+    }
+
+    std::vector<uint32_t> adjacency(trianglesCount * 3);
+    {
+        std::vector<uint32_t> filled(verticesCount, 0);
+        for (uint32_t i = 0; i < trianglesCount * 3; ++i) {
+            const uint32_t index = indices[i];
+            adjacency[adjacencyOffsets[index] + filled[index]++] = i / 3;
+        }
+    }
+
+    std::vector<int32_t> cachePositions(verticesCount, -1);
+    std::vector<float> vertexScores(verticesCount);
+    for (uint32_t i = 0; i < verticesCount; ++i) {
+        vertexScores[i] = getVertexScore(-1, remainingTriangles[i]);
+    }
+
+    const auto getTriangleScore = [&indices, &vertexScores](uint32_t triangle) {
+        return vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] + vertexScores[indices[triangle * 3 + 2]];
+    };
+
+    // The first triangle is the one with the best score
+    uint32_t bestTriangle = 0;
+    {
+        float bestScore = getTriangleScore(0);
+        for (uint32_t i = 1; i < trianglesCount; ++i) {
+            const float score = getTriangleScore(i);
+            if (score > bestScore) {
+                bestScore = score;
+                bestTriangle = i;
+            }
+        }
+    }
+
+    std::vector<bool> emitted(trianglesCount, false);
+    std::vector<uint32_t> result;
+    result.reserve(trianglesCount * 3);
+
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> newCache;
+    cache.reserve(forsythCacheSize + 3);
+    newCache.reserve(forsythCacheSize + 3);
+
+    uint32_t nextTriangle = 0;
+
+    for (uint32_t i = 0; i < trianglesCount; ++i) {
+        // None of the triangles of the vertices in the cache is left, continue with the next one of the input
+        if (bestTriangle == invalidIndex) {
+            while (emitted[nextTriangle]) {
+                ++nextTriangle;
+            }
+            bestTriangle = nextTriangle;
+        }
+
+        const uint32_t* triangle = indices.data() + bestTriangle * 3;
+        result.insert(result.end(), triangle, triangle + 3);
+        emitted[bestTriangle] = true;
+
+        newCache.clear();
+
+        for (uint8_t j = 0; j < 3; ++j) {
+            const uint32_t index = triangle[j];
+
+            // Removes the triangle from the remaining triangles of the vertex
+            const auto begin = adjacency.begin() + adjacencyOffsets[index];
+            const auto end = begin + remainingTriangles[index];
+            std::iter_swap(std::find(begin, end, bestTriangle), end - 1);
+            --remainingTriangles[index];
+
+            if (std::find(newCache.begin(), newCache.end(), index) == newCache.end()) {
+                newCache.push_back(index);
+            }
+        }
+
+        for (uint32_t index : cache) {
+            if (index != triangle[0] && index != triangle[1] && index != triangle[2]) {
+                newCache.push_back(index);
+            }
+        }
+
+        // Updates the vertices in the cache and the ones removed from it
+        for (uint32_t j = 0; j < newCache.size(); ++j) {
+            const uint32_t index = newCache[j];
+            cachePositions[index] = j < forsythCacheSize ? static_cast<int32_t>(j) : -1;
+            vertexScores[index] = getVertexScore(cachePositions[index], remainingTriangles[index]);
+        }
+
+        // The next triangle is the best one using the vertices updated
+        bestTriangle = invalidIndex;
+        float bestScore = -1.0f;
+
+        for (uint32_t index : newCache) {
+            for (uint32_t j = 0; j < remainingTriangles[index]; ++j) {
+                const uint32_t adjacentTriangle = adjacency[adjacencyOffsets[index] + j];
+                const float score = getTriangleScore(adjacentTriangle);
+
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = adjacentTriangle;
+                }
+            }
+        }
+
+        if (newCache.size() > forsythCacheSize) {
+            newCache.resize(forsythCacheSize);
+        }
+        std::swap(cache, newCache);
+    }
+
+    indices.swap(result);
+}
+
+void optimizeOverdraw(std::vector<uint32_t>& indices, const float* positions, uint32_t verticesCount, float threshold) {
+    const uint32_t trianglesCount = static_cast<uint32_t>(indices.size() / 3);
+    if (trianglesCount == 0 || std::any_of(indices.begin(), indices.end(), [verticesCount](uint32_t index) { return index >= verticesCount; })) {
+        return;
+    }
+
+    FifoCache cache(verticesCount, defaultCacheSize);
+
+    // Hard boundaries: the triangles where the three vertices are not in the cache, reordering from them adds few misses
+    std::vector<uint32_t> hardBoundaries;
+    std::vector<uint32_t> hardClustersMisses;
+    for (uint32_t i = 0; i < trianglesCount; ++i) {
+        const uint32_t misses = cache.accessTriangle(indices.data() + i * 3);
+
+        if (misses == 3 || i == 0) {
+            hardBoundaries.push_back(i);
+            hardClustersMisses.push_back(0);
+        }
+
+        hardClustersMisses.back() += misses;
+    }
+    hardBoundaries.push_back(trianglesCount);
+
+    // Soft boundaries: splits the clusters where their ACMR, from an empty cache, is below the threshold of the ACMR
+    // they have in the current order
+    std::vector<uint32_t> boundaries;
+    for (uint32_t i = 0; i + 1 < hardBoundaries.size(); ++i) {
+        const uint32_t begin = hardBoundaries[i];
+        const uint32_t end = hardBoundaries[i + 1];
+        const float clusterThreshold = threshold * hardClustersMisses[i] / (end - begin);
+
+        cache.flush();
+        boundaries.push_back(begin);
+
+        uint32_t start = begin;
+        uint32_t misses = 0;
+        for (uint32_t j = begin; j < end; ++j) {
+            misses += cache.accessTriangle(indices.data() + j * 3);
+
+            if (j + 1 < end && static_cast<float>(misses) / (j + 1 - start) <= clusterThreshold) {
+                cache.flush();
+                boundaries.push_back(j + 1);
+                start = j + 1;
+                misses = 0;
+            }
+        }
+
+        // The last triangles of the cluster are above the threshold, they stay with the previous ones
+        if (start != begin && static_cast<float>(misses) / (end - start) > clusterThreshold) {
+            boundaries.pop_back();
+        }
+    }
+
+    const uint32_t clustersCount = static_cast<uint32_t>(boundaries.size());
+    boundaries.push_back(trianglesCount);
+
+    // Centroid and normal of the clusters, weighted by the areas of their triangles
+    std::vector<float> clusterCentroids(clustersCount * 3, 0.0f);
+    std::vector<float> clusterNormals(clustersCount * 3, 0.0f);
+    float meshCentroid[3] = {0.0f, 0.0f, 0.0f};
+    float meshArea = 0.0f;
+
+    for (uint32_t i = 0; i < clustersCount; ++i) {
+        float* clusterCentroid = clusterCentroids.data() + i * 3;
+        float* clusterNormal = clusterNormals.data() + i * 3;
+        float clusterArea = 0.0f;
+
+        for (uint32_t j = boundaries[i]; j < boundaries[i + 1]; ++j) {
+            float centroid[3];
+            float normal[3];
+            getTriangleCentroidAndNormal(indices.data() + j * 3, positions, centroid, normal);
+
+            const float area = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+            for (uint8_t k = 0; k < 3; ++k) {
+                clusterCentroid[k] += centroid[k] * area;
+                clusterNormal[k] += normal[k];
+                meshCentroid[k] += centroid[k] * area;
+            }
+
+            clusterArea += area;
+        }
+
+        if (clusterArea > 0.0f) {
+            for (uint8_t k = 0; k < 3; ++k) {
+                clusterCentroid[k] /= clusterArea;
+            }
+        }
+
+        meshArea += clusterArea;
+    }
+
+    if (meshArea > 0.0f) {
+        for (uint8_t k = 0; k < 3; ++k) {
+            meshCentroid[k] /= meshArea;
+        }
+    }
+
+    // The clusters facing outward are drawn first
+    std::vector<float> sortKeys(clustersCount, 0.0f);
+    for (uint32_t i = 0; i < clustersCount; ++i) {
+        const float* clusterCentroid = clusterCentroids.data() + i * 3;
+        const float* clusterNormal = clusterNormals.data() + i * 3;
+
+        const float length = std::sqrt(clusterNormal[0] * clusterNormal[0] + clusterNormal[1] * clusterNormal[1] + clusterNormal[2] * clusterNormal[2]);
+        if (length > 0.0f) {
+            for (uint8_t k = 0; k < 3; ++k) {
+                sortKeys[i] += (clusterCentroid[k] - meshCentroid[k]) * clusterNormal[k] / length;
+            }
+        }
+    }
+
+    std::vector<uint32_t> clusters(clustersCount);
+    for (uint32_t i = 0; i < clustersCount; ++i) {
+        clusters[i] = i;
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(), [&sortKeys](uint32_t lhs, uint32_t rhs) {
+        return sortKeys[lhs] > sortKeys[rhs];
+    });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    for (uint32_t cluster : clusters) {
+        result.insert(result.end(), indices.begin() + boundaries[cluster] * 3, indices.begin() + boundaries[cluster + 1] * 3);
+    }
+
+    indices.swap(result);
+}
+
+uint32_t optimizeVertexFetch(std::vector<uint32_t>& indices, uint32_t verticesCount, std::vector<uint32_t>& remap) {
+    remap.assign(verticesCount, invalidIndex);
+
+    uint32_t newVerticesCount = 0;
+    for (uint32_t& index : indices) {
+        if (index >= verticesCount) {
+            continue;
+        }
+
+        if (remap[index] == invalidIndex) {
+            remap[index] = newVerticesCount++;
+        }
+
+        index = remap[index];
+    }
+
+    return newVerticesCount;
+}
+
+void remapVertices(void* destination, const void* source, uint32_t elementSize, const std::vector<uint32_t>& remap) {
+    for (uint32_t i = 0; i < remap.size(); ++i) {
+        if (remap[i] != invalidIndex) {
+            std::memcpy(static_cast<char*>(destination) + remap[i] * elementSize, static_cast<const char*>(source) + i * elementSize, elementSize);
+        }
+    }
+}
+
+} // MeshOptimizer
+} // Graphics
+} // lug
@@ -0,0 +1,196 @@
+#include <lug/Graphics/Render/Bloom.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace Bloom {
+
+namespace {
+
+void addWeighted(float destination[4], const float color[4], float weight) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        destination[i] += color[i] * weight;
+    }
+}
+
+} // anonymous
+
+Image::Image(uint32_t width, uint32_t height) : width(width), height(height), data(width * height * 4, 0.0f) {}
+
+float* Image::at(uint32_t x, uint32_t y) {
+    return &data[(y * width + x) * 4];
+}
+
+const float* Image::at(uint32_t x, uint32_t y) const {
+    return &data[(y * width + x) * 4];
+}
+
+std::vector<Extent> computeMipChain(uint32_t width, uint32_t height, uint32_t maxMipLevelsCount) {
+    std::vector<Extent> extents;
+
+    Extent extent{width / 2, height / 2};
+
+    while (extents.size() < maxMipLevelsCount && extent.width >= minMipLevelSize && extent.height >= minMipLevelSize) {
+        extents.push_back(extent);
+
+        extent.width /= 2;
+        extent.height /= 2;
+    }
+
+    return extents;
+}
+
+void sample(const Image& image, float u, float v, float color[4]) {
+    // Texel centers are at half integers
+    const float x = u * image.width - 0.5f;
+    const float y = v * image.height - 0.5f;
+
+    const float x0 = std::floor(x);
+    const float y0 = std::floor(y);
+
+    const float fx = x - x0;
+    const float fy = y - y0;
+
+    const auto clampX = [&image](float value) {
+        return static_cast<uint32_t>(std::min(std::max(value, 0.0f), static_cast<float>(image.width - 1)));
+    };
+
+    const auto clampY = [&image](float value) {
+        return static_cast<uint32_t>(std::min(std::max(value, 0.0f), static_cast<float>(image.height - 1)));
+    };
+
+    const uint32_t ix0 = clampX(x0);
+    const uint32_t ix1 = clampX(x0 + 1.0f);
+    const uint32_t iy0 = clampY(y0);
+    const uint32_t iy1 = clampY(y0 + 1.0f);
+
+    std::fill(color, color + 4, 0.0f);
+
+    addWeighted(color, image.at(ix0, iy0), (1.0f - fx) * (1.0f - fy));
+    addWeighted(color, image.at(ix1, iy0), fx * (1.0f - fy));
+    addWeighted(color, image.at(ix0, iy1), (1.0f - fx) * fy);
+    addWeighted(color, image.at(ix1, iy1), fx * fy);
+}
+
+void applyThreshold(float color[4], float threshold, float knee) {
+    const float brightness = color[0] * 0.2126f + color[1] * 0.7152f + color[2] * 0.0722f;
+
+    // Quadratic curve between threshold - knee and threshold + knee, linear above
+    float soft = std::min(std::max(brightness - threshold + knee, 0.0f), 2.0f * knee);
+    soft = soft * soft / (4.0f * knee + 0.00001f);
+
+    const float contribution = std::max(soft, brightness - threshold) / std::max(brightness, 0.00001f);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        color[i] *= contribution;
+    }
+}
+
+Image downsample(const Image& source, const Extent& extent, float threshold, float knee) {
+    // Offsets of the taps in texels of the source, the inner box is centered on the pixel
+    // A . B . C
+    // . D . E .
+    // F . G . H
+    // . I . J .
+    // K . L . M
+    static const float offsets[13][2] = {
+        {-2.0f, -2.0f}, {0.0f, -2.0f}, {2.0f, -2.0f},
+        {-1.0f, -1.0f}, {1.0f, -1.0f},
+        {-2.0f, 0.0f}, {0.0f, 0.0f}, {2.0f, 0.0f},
+        {-1.0f, 1.0f}, {1.0f, 1.0f},
+        {-2.0f, 2.0f}, {0.0f, 2.0f}, {2.0f, 2.0f}
+    };
+
+    // The inner box DEIJ weights 0.5, the four outer boxes 0.125 each
+    static const float weights[13] = {
+        0.03125f, 0.0625f, 0.03125f,
+        0.125f, 0.125f,
+        0.0625f, 0.125f, 0.0625f,
+        0.125f, 0.125f,
+        0.03125f, 0.0625f, 0.03125f
+    };
+
+    Image destination(extent.width, extent.height);
+
+    const float texelWidth = 1.0f / source.width;
+    const float texelHeight = 1.0f / source.height;
+
+    for (uint32_t y = 0; y < extent.height; ++y) {
+        for (uint32_t x = 0; x < extent.width; ++x) {
+            const float u = (x + 0.5f) / extent.width;
+            const float v = (y + 0.5f) / extent.height;
+
+            float* color = destination.at(x, y);
+
+            for (uint32_t i = 0; i < 13; ++i) {
+                float tap[4];
+                sample(source, u + offsets[i][0] * texelWidth, v + offsets[i][1] * texelHeight, tap);
+                addWeighted(color, tap, weights[i]);
+            }
+
+            if (threshold >= 0.0f) {
+                applyThreshold(color, threshold, knee);
+            }
+        }
+    }
+
+    return destination;
+}
+
+void upsampleAdd(const Image& source, Image& destination, float radius) {
+    static const float weights[3][3] = {
+        {1.0f / 16.0f, 2.0f / 16.0f, 1.0f / 16.0f},
+        {2.0f / 16.0f, 4.0f / 16.0f, 2.0f / 16.0f},
+        {1.0f / 16.0f, 2.0f / 16.0f, 1.0f / 16.0f}
+    };
+
+    const float offsetX = radius / source.width;
+    const float offsetY = radius / source.height;
+
+    for (uint32_t y = 0; y < destination.height; ++y) {
+        for (uint32_t x = 0; x < destination.width; ++x) {
+            const float u = (x + 0.5f) / destination.width;
+            const float v = (y + 0.5f) / destination.height;
+
+            float* color = destination.at(x, y);
+
+            for (int j = -1; j <= 1; ++j) {
+                for (int i = -1; i <= 1; ++i) {
+                    float tap[4];
+                    sample(source, u + i * offsetX, v + j * offsetY, tap);
+                    addWeighted(color, tap, weights[j + 1][i + 1]);
+                }
+            }
+        }
+    }
+}
+
+Image compute(const Image& glow, float threshold, uint32_t maxMipLevelsCount, float knee, float radius) {
+    const std::vector<Extent> extents = computeMipChain(glow.width, glow.height, maxMipLevelsCount);
+
+    if (extents.empty()) {
+        return Image{};
+    }
+
+    std::vector<Image> levels(extents.size());
+
+    levels[0] = downsample(glow, extents[0], threshold, knee);
+    for (uint32_t i = 1; i < extents.size(); ++i) {
+        levels[i] = downsample(levels[i - 1], extents[i]);
+    }
+
+    // Each level already contains the smaller ones
+    for (uint32_t i = static_cast<uint32_t>(extents.size()) - 1; i > 0; --i) {
+        upsampleAdd(levels[i], levels[i - 1], radius);
+    }
+
+    return levels[0];
+}
+
+} // Bloom
+} // Render
+} // Graphics
+} // lug
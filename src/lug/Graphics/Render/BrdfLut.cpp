@@ -0,0 +1,141 @@
+#include <lug/Graphics/Render/BrdfLut.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <lug/Math/Constant.hpp>
+#include <lug/Math/Half.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace BrdfLut {
+
+namespace {
+
+// Same pseudo random function as the shader, used to jitter the samples
+float random(float x, float y) {
+    const float dt = x * 12.9898f + y * 78.233f;
+    const float sn = std::fmod(dt, 3.14f);
+    const float value = std::sin(sn) * 43758.5453f;
+
+    return value - std::floor(value);
+}
+
+// Second coordinate of the Hammersley point set, the first one is i / samplesCount
+float radicalInverse(uint32_t i) {
+    uint32_t bits = (i << 16u) | (i >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+float geometrySchlickGGX(float NoL, float NoV, float roughness) {
+    const float k = (roughness * roughness) / 2.0f;
+    const float GL = NoL / (NoL * (1.0f - k) + k);
+    const float GV = NoV / (NoV * (1.0f - k) + k);
+
+    return GL * GV;
+}
+
+} // anonymous
+
+Math::Vec2f integrate(float NoV, float roughness, uint32_t samplesCount) {
+    // The normal is the z axis and the view vector is in the xz plane
+    const float Vx = std::sqrt(1.0f - NoV * NoV);
+    const float Vz = NoV;
+
+    const float alpha = roughness * roughness;
+    const float jitter = random(0.0f, 1.0f) * 0.1f;
+
+    float scale = 0.0f;
+    float bias = 0.0f;
+
+    for (uint32_t i = 0; i < samplesCount; ++i) {
+        const float Xi1 = static_cast<float>(i) / static_cast<float>(samplesCount);
+        const float Xi2 = radicalInverse(i);
+
+        // GGX importance sampling of the half vector, in the tangent space of the shader (x = -y, y = x)
+        const float phi = Math::twoPi<float>() * Xi1 + jitter;
+        const float cosTheta = std::sqrt((1.0f - Xi2) / (1.0f + (alpha * alpha - 1.0f) * Xi2));
+        const float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+
+        const float Hx = sinTheta * std::sin(phi);
+        const float Hz = cosTheta;
+
+        const float VoH = Vx * Hx + Vz * Hz;
+
+        // L = 2 * dot(V, H) * H - V
+        const float NoL = std::max(2.0f * VoH * Hz - Vz, 0.0f);
+        const float NoH = std::max(Hz, 0.0f);
+
+        if (NoL > 0.0f) {
+            const float G = geometrySchlickGGX(NoL, NoV, roughness);
+            const float GVis = (G * std::max(VoH, 0.0f)) / (NoH * NoV);
+            const float Fc = std::pow(1.0f - std::max(VoH, 0.0f), 5.0f);
+
+            scale += (1.0f - Fc) * GVis;
+            bias += Fc * GVis;
+        }
+    }
+
+    return {scale / static_cast<float>(samplesCount), bias / static_cast<float>(samplesCount)};
+}
+
+std::vector<Math::Vec2f> compute(uint32_t size, uint32_t samplesCount) {
+    std::vector<Math::Vec2f> lut(size * size);
+
+    for (uint32_t y = 0; y < size; ++y) {
+        const float roughness = 1.0f - (static_cast<float>(y) + 0.5f) / static_cast<float>(size);
+
+        for (uint32_t x = 0; x < size; ++x) {
+            const float NoV = (static_cast<float>(x) + 0.5f) / static_cast<float>(size);
+
+            lut[y * size + x] = integrate(NoV, roughness, samplesCount);
+        }
+    }
+
+    return lut;
+}
+
+uint64_t getKey(uint32_t size, uint32_t samplesCount) {
+    const char name[] = "brdf_lut";
+    const uint32_t parameters[] = {size, samplesCount};
+
+    const uint64_t key = IblCache::hash(name, sizeof(name));
+    return IblCache::hash(parameters, sizeof(parameters), key);
+}
+
+IblCache::Entry createEntry(uint32_t size, uint32_t samplesCount) {
+    const std::vector<Math::Vec2f> lut = compute(size, samplesCount);
+
+    IblCache::Entry entry{};
+
+    entry.key = getKey(size, samplesCount);
+    entry.width = size;
+    entry.height = size;
+    entry.layersCount = 1;
+    entry.mipLevels = 1;
+    entry.format = Texture::Format::R16G16_SFLOAT;
+    entry.data.resize(IblCache::getDataSize(entry));
+
+    for (size_t i = 0; i < lut.size(); ++i) {
+        const uint16_t texel[] = {
+            Math::toHalf(lut[i].x()),
+            Math::toHalf(lut[i].y())
+        };
+
+        std::memcpy(entry.data.data() + i * sizeof(texel), texel, sizeof(texel));
+    }
+
+    return entry;
+}
+
+} // BrdfLut
+} // Render
+} // Graphics
+} // lug
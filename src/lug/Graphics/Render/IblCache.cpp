@@ -0,0 +1,194 @@
+#include <lug/Graphics/Render/IblCache.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace IblCache {
+
+namespace {
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t keyLow;
+    uint32_t keyHigh;
+    uint32_t width;
+    uint32_t height;
+    uint32_t layersCount;
+    uint32_t mipLevels;
+    uint32_t format;
+    uint32_t reserved;
+};
+
+} // anonymous
+
+uint64_t hash(const void* data, size_t size, uint64_t seed) {
+    constexpr uint64_t prime = 0x100000001B3ull;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t result = seed;
+
+    for (size_t i = 0; i < size; ++i) {
+        result ^= bytes[i];
+        result *= prime;
+    }
+
+    return result;
+}
+
+bool hashFile(const std::string& filename, uint64_t& hash) {
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.good()) {
+        LUG_LOG.error("IblCache::hashFile: Can't open {}", filename);
+        return false;
+    }
+
+    std::vector<char> buffer(1 << 16);
+    hash = hashSeed;
+
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        hash = IblCache::hash(buffer.data(), static_cast<size_t>(file.gcount()), hash);
+    }
+
+    if (!file.eof()) {
+        LUG_LOG.error("IblCache::hashFile: Can't read {}", filename);
+        return false;
+    }
+
+    return true;
+}
+
+std::string getFilename(const std::string& directory, uint64_t key) {
+    static const char digits[] = "0123456789abcdef";
+
+    std::string filename(16, '0');
+    for (int i = 15; i >= 0; --i) {
+        filename[i] = digits[key & 0xF];
+        key >>= 4;
+    }
+
+    if (directory.empty()) {
+        return filename + ".iblcache";
+    }
+
+    const char last = directory.back();
+    return directory + (last == '/' || last == '\\' ? "" : "/") + filename + ".iblcache";
+}
+
+size_t getMipLevelSize(const Entry& entry, uint32_t mipLevel) {
+    const size_t width = std::max(entry.width >> mipLevel, 1u);
+    const size_t height = std::max(entry.height >> mipLevel, 1u);
+
+    return width * height * entry.layersCount * Texture::formatToSize(entry.format);
+}
+
+size_t getDataSize(const Entry& entry) {
+    size_t size = 0;
+
+    for (uint32_t mipLevel = 0; mipLevel < entry.mipLevels; ++mipLevel) {
+        size += getMipLevelSize(entry, mipLevel);
+    }
+
+    return size;
+}
+
+bool load(const std::string& filename, uint64_t key, Entry& entry) {
+    std::ifstream file(filename, std::ios::binary);
+
+    // Not an error, the entry is not in the cache yet
+    if (!file.good()) {
+        return false;
+    }
+
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        LUG_LOG.error("IblCache::load: Can't read the header of {}", filename);
+        return false;
+    }
+
+    if (header.magic != magic || header.version != version) {
+        LUG_LOG.warn("IblCache::load: Invalid or outdated cache file {}", filename);
+        return false;
+    }
+
+    const uint64_t fileKey = static_cast<uint64_t>(header.keyHigh) << 32 | header.keyLow;
+    if (fileKey != key) {
+        LUG_LOG.warn("IblCache::load: The cache file {} doesn't match the key {:x}", filename, key);
+        return false;
+    }
+
+    Entry fileEntry{};
+
+    fileEntry.key = fileKey;
+    fileEntry.width = header.width;
+    fileEntry.height = header.height;
+    fileEntry.layersCount = header.layersCount;
+    fileEntry.mipLevels = header.mipLevels;
+    fileEntry.format = static_cast<Texture::Format>(header.format);
+
+    if (!fileEntry.width || !fileEntry.height || !fileEntry.layersCount || !fileEntry.mipLevels || fileEntry.mipLevels > 32
+        || !Texture::formatToSize(fileEntry.format)) {
+        LUG_LOG.error("IblCache::load: Invalid header for {}", filename);
+        return false;
+    }
+
+    fileEntry.data.resize(getDataSize(fileEntry));
+
+    if (!file.read(reinterpret_cast<char*>(fileEntry.data.data()), fileEntry.data.size())) {
+        LUG_LOG.error("IblCache::load: Truncated cache file {}", filename);
+        return false;
+    }
+
+    entry = std::move(fileEntry);
+
+    return true;
+}
+
+bool save(const std::string& filename, const Entry& entry) {
+    if (entry.data.size() != getDataSize(entry)) {
+        LUG_LOG.error("IblCache::save: Invalid data size for {}", filename);
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+    if (!file.good()) {
+        LUG_LOG.error("IblCache::save: Can't open {}", filename);
+        return false;
+    }
+
+    const Header header{
+        /* header.magic         */ magic,
+        /* header.version       */ version,
+        /* header.keyLow        */ static_cast<uint32_t>(entry.key),
+        /* header.keyHigh       */ static_cast<uint32_t>(entry.key >> 32),
+        /* header.width         */ entry.width,
+        /* header.height        */ entry.height,
+        /* header.layersCount   */ entry.layersCount,
+        /* header.mipLevels     */ entry.mipLevels,
+        /* header.format        */ static_cast<uint32_t>(entry.format),
+        /* header.reserved      */ 0
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entry.data.data()), entry.data.size());
+
+    if (!file.good()) {
+        LUG_LOG.error("IblCache::save: Can't write {}", filename);
+        return false;
+    }
+
+    return true;
+}
+
+} // IblCache
+} // Render
+} // Graphics
+} // lug
@@ -1,5 +1,7 @@
 #include <lug/Graphics/Render/Mesh.hpp>
 
+#include <cstring>
+
 namespace lug {
 namespace Graphics {
 namespace Render {
@@ -9,12 +11,32 @@ Mesh::Mesh(const std::string& name) : Resource(Resource::Type::Mesh, name) {}
 Mesh::~Mesh() {
     for (auto& primitiveSet : _primitiveSets) {
         for (auto& attribute : primitiveSet.attributes) {
-            delete[] attribute.buffer.data;
+            if (!attribute.buffer.external) {
+                delete[] attribute.buffer.data;
+            }
             attribute.buffer.data = nullptr;
         }
     }
 }
 
+void Mesh::computeBoundingBox() {
+    _boundingBox = BoundingBox{};
+
+    for (const auto& primitiveSet : _primitiveSets) {
+        if (!primitiveSet.position || !primitiveSet.position->buffer.data) {
+            continue;
+        }
+
+        const char* data = primitiveSet.position->buffer.data;
+        for (uint32_t i = 0; i < primitiveSet.position->buffer.elementsCount; ++i) {
+            float position[3];
+            std::memcpy(position, data + i * sizeof(position), sizeof(position));
+
+            _boundingBox.extend(Math::Vec3f{position[0], position[1], position[2]});
+        }
+    }
+}
+
 } // Render
 } // Graphics
 } // lug
@@ -0,0 +1,180 @@
+#include <lug/Graphics/Render/Visibility.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define LUG_GRAPHICS_VISIBILITY_SSE
+    #include <xmmintrin.h>
+#endif
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+Frustum::Frustum(const Math::Mat4x4f& viewProjection) {
+    const auto row = [&viewProjection](uint8_t idx) {
+        return Math::Vec4f{
+            viewProjection(idx, 0),
+            viewProjection(idx, 1),
+            viewProjection(idx, 2),
+            viewProjection(idx, 3)
+        };
+    };
+
+    const Math::Vec4f row0 = row(0);
+    const Math::Vec4f row1 = row(1);
+    const Math::Vec4f row2 = row(2);
+    const Math::Vec4f row3 = row(3);
+
+    // -w <= x <= w, -w <= y <= w and 0 <= z <= w in clip space
+    _planes[static_cast<uint8_t>(Plane::Left)] = row3 + row0;
+    _planes[static_cast<uint8_t>(Plane::Right)] = row3 - row0;
+    _planes[static_cast<uint8_t>(Plane::Bottom)] = row3 + row1;
+    _planes[static_cast<uint8_t>(Plane::Top)] = row3 - row1;
+    _planes[static_cast<uint8_t>(Plane::Near)] = row2;
+    _planes[static_cast<uint8_t>(Plane::Far)] = row3 - row2;
+
+    for (auto& plane : _planes) {
+        const float length = std::sqrt(plane.x() * plane.x() + plane.y() * plane.y() + plane.z() * plane.z());
+
+        if (length > 0.0f) {
+            plane = plane / length;
+        }
+    }
+}
+
+bool Frustum::intersects(const BoundingBox& box) const {
+    if (!box.isValid()) {
+        return true;
+    }
+
+    const Math::Vec3f center = box.getCenter();
+    const Math::Vec3f extent = box.getExtent();
+
+    // The box is outside if its nearest corner is behind one of the planes
+    for (const auto& plane : _planes) {
+        const float distance = plane.x() * center.x() + plane.y() * center.y() + plane.z() * center.z() + plane.w();
+        const float radius = std::abs(plane.x()) * extent.x() + std::abs(plane.y()) * extent.y() + std::abs(plane.z()) * extent.z();
+
+        if (distance + radius < 0.0f) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Visibility::compute(const std::vector<Frustum>& frustums, const std::vector<BoundingBox>& boundingBoxes) {
+    const uint32_t viewsCount = static_cast<uint32_t>(frustums.size());
+    const uint32_t wordsCount = static_cast<uint32_t>((boundingBoxes.size() + 63) / 64);
+
+    _objectsCount = static_cast<uint32_t>(boundingBoxes.size());
+    _bitsets.resize(viewsCount);
+
+    for (auto& bitset : _bitsets) {
+        bitset.assign(wordsCount, 0);
+    }
+
+    // Transpose the planes, 4 frustums per group
+    // The unused lanes of the last group keep a plane that every box is in front of
+    _frustumGroups.resize((viewsCount + 3) / 4);
+
+    for (uint32_t groupIdx = 0; groupIdx < _frustumGroups.size(); ++groupIdx) {
+        FrustumGroup& group = _frustumGroups[groupIdx];
+
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+            const uint32_t viewIdx = groupIdx * 4 + lane;
+
+            for (uint8_t planeIdx = 0; planeIdx < Frustum::planesCount; ++planeIdx) {
+                Math::Vec4f plane{0.0f, 0.0f, 0.0f, 1.0f};
+                if (viewIdx < viewsCount) {
+                    plane = frustums[viewIdx].getPlane(static_cast<Frustum::Plane>(planeIdx));
+                }
+
+                for (uint8_t axis = 0; axis < 3; ++axis) {
+                    group.normals[planeIdx][axis][lane] = plane(axis);
+                    group.absNormals[planeIdx][axis][lane] = std::abs(plane(axis));
+                }
+
+                group.distances[planeIdx][lane] = plane.w();
+            }
+        }
+    }
+
+    for (uint32_t objectIdx = 0; objectIdx < _objectsCount; ++objectIdx) {
+        const BoundingBox& box = boundingBoxes[objectIdx];
+        const uint64_t bit = uint64_t(1) << (objectIdx % 64);
+        const uint32_t wordIdx = objectIdx / 64;
+
+        if (!box.isValid()) {
+            for (auto& bitset : _bitsets) {
+                bitset[wordIdx] |= bit;
+            }
+
+            continue;
+        }
+
+        const Math::Vec3f center = box.getCenter();
+        const Math::Vec3f extent = box.getExtent();
+
+        for (uint32_t groupIdx = 0; groupIdx < _frustumGroups.size(); ++groupIdx) {
+            const FrustumGroup& group = _frustumGroups[groupIdx];
+
+            // One bit per lane, set if the box is visible from the frustum of the lane
+            uint32_t mask = 0xF;
+
+#if defined(LUG_GRAPHICS_VISIBILITY_SSE)
+            const __m128 centerX = _mm_set1_ps(center.x());
+            const __m128 centerY = _mm_set1_ps(center.y());
+            const __m128 centerZ = _mm_set1_ps(center.z());
+            const __m128 extentX = _mm_set1_ps(extent.x());
+            const __m128 extentY = _mm_set1_ps(extent.y());
+            const __m128 extentZ = _mm_set1_ps(extent.z());
+            const __m128 zero = _mm_setzero_ps();
+
+            for (uint8_t planeIdx = 0; planeIdx < Frustum::planesCount && mask; ++planeIdx) {
+                // Same order of operations as Frustum::intersects()
+                __m128 distance = _mm_mul_ps(_mm_loadu_ps(group.normals[planeIdx][0]), centerX);
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_loadu_ps(group.normals[planeIdx][1]), centerY));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_loadu_ps(group.normals[planeIdx][2]), centerZ));
+                distance = _mm_add_ps(distance, _mm_loadu_ps(group.distances[planeIdx]));
+
+                __m128 radius = _mm_mul_ps(_mm_loadu_ps(group.absNormals[planeIdx][0]), extentX);
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_loadu_ps(group.absNormals[planeIdx][1]), extentY));
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_loadu_ps(group.absNormals[planeIdx][2]), extentZ));
+
+                mask &= static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(distance, radius), zero)));
+            }
+#else
+            for (uint8_t planeIdx = 0; planeIdx < Frustum::planesCount && mask; ++planeIdx) {
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    const float distance = group.normals[planeIdx][0][lane] * center.x()
+                                         + group.normals[planeIdx][1][lane] * center.y()
+                                         + group.normals[planeIdx][2][lane] * center.z()
+                                         + group.distances[planeIdx][lane];
+
+                    const float radius = group.absNormals[planeIdx][0][lane] * extent.x()
+                                       + group.absNormals[planeIdx][1][lane] * extent.y()
+                                       + group.absNormals[planeIdx][2][lane] * extent.z();
+
+                    if (distance + radius < 0.0f) {
+                        mask &= ~(1u << lane);
+                    }
+                }
+            }
+#endif
+
+            const uint32_t lanesCount = std::min(4u, viewsCount - groupIdx * 4);
+            for (uint32_t lane = 0; lane < lanesCount; ++lane) {
+                if (mask & (1u << lane)) {
+                    _bitsets[groupIdx * 4 + lane][wordIdx] |= bit;
+                }
+            }
+        }
+    }
+}
+
+} // Render
+} // Graphics
+} // lug
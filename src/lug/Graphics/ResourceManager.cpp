@@ -1,5 +1,6 @@
 #include <lug/Graphics/ResourceManager.hpp>
 
+#include <lug/Graphics/AssetPackageLoader.hpp>
 #include <lug/Graphics/GltfLoader.hpp>
 #include <lug/Graphics/Renderer.hpp>
 #include <lug/System/Logger/Logger.hpp>
@@ -11,6 +12,7 @@ ResourceManager::ResourceManager(Renderer& renderer) : _renderer(renderer) {
     if (_renderer.getType() == Renderer::Type::Vulkan) {
         _loaders["gltf"] = std::make_unique<GltfLoader>(_renderer);
         _loaders["glb"] = std::make_unique<GltfLoader>(_renderer);
+        _loaders["lugpack"] = std::make_unique<AssetPackageLoader>(_renderer);
     }
 }
 
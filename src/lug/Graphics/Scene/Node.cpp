@@ -1,6 +1,5 @@
 #include <lug/Graphics/Scene/Node.hpp>
 #include <lug/Graphics/Scene/Scene.hpp>
-#include <lug/Graphics/Render/Queue.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -18,12 +17,13 @@ void Node::attachLight(Resource::SharedPtr<Render::Light> light) {
 
 void Node::attachMeshInstance(Resource::SharedPtr<Render::Mesh> mesh, Resource::SharedPtr<Render::Material> material) {
     _meshInstance.mesh = mesh;
+    std::atomic_store(&_meshInstance.drawItems, std::shared_ptr<const MeshInstance::DrawItems>());
 
     const auto& primitiveSets = mesh->getPrimitiveSets();
     if (material) {
-        _meshInstance.materials.resize(primitiveSets.size(), material);
+        _meshInstance.materials.assign(primitiveSets.size(), material);
     } else {
-        _meshInstance.materials.resize(primitiveSets.size());
+        _meshInstance.materials.assign(primitiveSets.size(), nullptr);
         for (uint32_t i = 0; i < primitiveSets.size(); ++i) {
             _meshInstance.materials[i] = primitiveSets[i].material;
         }
@@ -35,21 +35,26 @@ void Node::attachCamera(Resource::SharedPtr<Render::Camera::Camera> camera) {
     _camera = std::move(camera);
 }
 
-void Node::fetchVisibleObjects(const Renderer& renderer, const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const {
+void Node::fetchObjects(std::vector<Node*>& meshNodes, std::vector<Render::BoundingBox>& boundingBoxes, std::vector<Node*>& lightNodes) {
     for (const auto& child : _children) {
-        static_cast<const Node*>(child)->fetchVisibleObjects(renderer, renderView, camera, renderQueue);
+        static_cast<Node*>(child)->fetchObjects(meshNodes, boundingBoxes, lightNodes);
     }
 
     if (_meshInstance.mesh) {
-        renderQueue.addMeshInstance(*const_cast<Node*>(this), renderer);
+        meshNodes.push_back(this);
+        boundingBoxes.push_back(_meshInstance.mesh->getBoundingBox().transform(getTransform()));
     }
 
-    // Check the distance with the light
-    if (_light && (_light->getDistance() == 0.0f || _light->getDistance() >= fabs((Math::Vec3f(const_cast<Node*>(this)->getAbsolutePosition() - camera.getParent()->getAbsolutePosition())).length()))) {
-        renderQueue.addLight(*const_cast<Node*>(this));
+    if (_light) {
+        lightNodes.push_back(this);
     }
 }
 
+bool Node::isLightInRange(const Render::Camera::Camera& camera) const {
+    // Check the distance with the light
+    return _light && (_light->getDistance() == 0.0f || _light->getDistance() >= fabs((Math::Vec3f(const_cast<Node*>(this)->getAbsolutePosition() - camera.getParent()->getAbsolutePosition())).length()));
+}
+
 void Node::needUpdate() {
     ::lug::Graphics::Node::needUpdate();
     ::lug::Graphics::Render::DirtyObject::setDirty();
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <lug/Graphics/Render/Light.hpp>
+#include <lug/Graphics/Render/Queue.hpp>
+#include <lug/Graphics/Render/View.hpp>
 #include <lug/Graphics/Scene/Scene.hpp>
 #include <lug/System/Logger/Logger.hpp>
 
@@ -24,9 +27,61 @@ const Node* Scene::getSceneNode(const std::string& name) const {
     return _root.getNode(name);
 }
 
+void Scene::computeVisibility(const std::vector<const Render::View*>& renderViews) {
+    computeVisibility(_visibilityCache, renderViews);
+}
+
 void Scene::fetchVisibleObjects(const Renderer& renderer, const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const {
     renderQueue.addSkyBox(_skyBox);
-    _root.fetchVisibleObjects(renderer, renderView, camera, renderQueue);
+
+    const auto& renderViews = _visibilityCache.renderViews;
+    const auto it = std::find(renderViews.begin(), renderViews.end(), &renderView);
+
+    if (it != renderViews.end()) {
+        fetchVisibleObjects(_visibilityCache, static_cast<uint32_t>(it - renderViews.begin()), renderer, camera, renderQueue);
+        return;
+    }
+
+    // The visibility of this view was not computed with the others
+    VisibilityCache cache;
+    const_cast<Scene*>(this)->computeVisibility(cache, {&renderView});
+    fetchVisibleObjects(cache, 0, renderer, camera, renderQueue);
+}
+
+void Scene::computeVisibility(VisibilityCache& cache, const std::vector<const Render::View*>& renderViews) {
+    cache.renderViews = renderViews;
+    cache.meshNodes.clear();
+    cache.boundingBoxes.clear();
+    cache.lightNodes.clear();
+
+    if (renderViews.empty()) {
+        cache.visibility.compute({}, {});
+        return;
+    }
+
+    _root.fetchObjects(cache.meshNodes, cache.boundingBoxes, cache.lightNodes);
+
+    std::vector<Render::Frustum> frustums;
+    frustums.reserve(renderViews.size());
+
+    for (const Render::View* renderView : renderViews) {
+        Render::Camera::Camera* camera = renderView->getCamera().get();
+        frustums.emplace_back(camera->getProjectionMatrix() * camera->getViewMatrix());
+    }
+
+    cache.visibility.compute(frustums, cache.boundingBoxes);
+}
+
+void Scene::fetchVisibleObjects(const VisibilityCache& cache, uint32_t viewIdx, const Renderer& renderer, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const {
+    cache.visibility.forEachVisible(viewIdx, [&cache, &renderer, &renderQueue](uint32_t objectIdx) {
+        renderQueue.addMeshInstance(*cache.meshNodes[objectIdx], renderer);
+    });
+
+    for (Node* lightNode : cache.lightNodes) {
+        if (lightNode->isLightInRange(camera)) {
+            renderQueue.addLight(*lightNode);
+        }
+    }
 }
 
 } // Scene
@@ -0,0 +1,511 @@
+#include <lug/Graphics/TextureCompression.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace lug {
+namespace Graphics {
+namespace TextureCompression {
+
+namespace {
+
+// The texels of a 4x4 block, R8G8B8A8
+using Block = uint8_t[16][4];
+
+uint16_t packColor(const float color[3]) {
+    const auto quantize = [](float value, float max) {
+        return static_cast<uint16_t>(std::min(std::max(std::lround(value * max / 255.0f), 0l), static_cast<long>(max)));
+    };
+
+    return static_cast<uint16_t>((quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5) | quantize(color[2], 31.0f));
+}
+
+void unpackColor(uint16_t packed, int color[3]) {
+    const int r = (packed >> 11) & 0x1F;
+    const int g = (packed >> 5) & 0x3F;
+    const int b = packed & 0x1F;
+
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+// Same palettes as the decoders: 4 colors if color0 > color1 (or always for BC3), otherwise 3 colors and transparent black
+void getColorPalette(uint16_t color0, uint16_t color1, bool forceFourColors, int palette[4][4]) {
+    unpackColor(color0, palette[0]);
+    unpackColor(color1, palette[1]);
+    palette[0][3] = 255;
+    palette[1][3] = 255;
+
+    if (forceFourColors || color0 > color1) {
+        for (int channel = 0; channel < 3; ++channel) {
+            palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+            palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+        }
+
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    } else {
+        for (int channel = 0; channel < 3; ++channel) {
+            palette[2][channel] = (palette[0][channel] + palette[1][channel]) / 2;
+            palette[3][channel] = 0;
+        }
+
+        palette[2][3] = 255;
+        palette[3][3] = 0;
+    }
+}
+
+int getDistance(const uint8_t texel[4], const int color[4]) {
+    int distance = 0;
+
+    for (int channel = 0; channel < 3; ++channel) {
+        distance += (texel[channel] - color[channel]) * (texel[channel] - color[channel]);
+    }
+
+    return distance;
+}
+
+// Chooses the closest color of the palette for each texel, returns the total error
+int selectColorIndices(const Block& block, const bool (&transparent)[16], const int (&palette)[4][4], uint32_t colorsCount, uint32_t& indices) {
+    int error = 0;
+    indices = 0;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        uint32_t index = 3;
+
+        if (!transparent[i]) {
+            int bestDistance = getDistance(block[i], palette[0]);
+            index = 0;
+
+            for (uint32_t j = 1; j < colorsCount; ++j) {
+                const int distance = getDistance(block[i], palette[j]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    index = j;
+                }
+            }
+
+            error += bestDistance;
+        }
+
+        indices |= index << (i * 2);
+    }
+
+    return error;
+}
+
+// Endpoints minimizing the squared error for the indices of the four colors mode
+bool refineEndpoints(const Block& block, uint32_t indices, float endpoint0[3], float endpoint1[3]) {
+    // Weight of the first endpoint for each index, the second one is weighted by 1 - weight
+    constexpr float weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+
+    float aa = 0.0f;
+    float ab = 0.0f;
+    float bb = 0.0f;
+    float ax[3] = {0.0f, 0.0f, 0.0f};
+    float bx[3] = {0.0f, 0.0f, 0.0f};
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        const float a = weights[(indices >> (i * 2)) & 3];
+        const float b = 1.0f - a;
+
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+
+        for (int channel = 0; channel < 3; ++channel) {
+            ax[channel] += a * block[i][channel];
+            bx[channel] += b * block[i][channel];
+        }
+    }
+
+    const float determinant = aa * bb - ab * ab;
+    if (std::fabs(determinant) < 1e-6f) {
+        return false;
+    }
+
+    for (int channel = 0; channel < 3; ++channel) {
+        endpoint0[channel] = (ax[channel] * bb - bx[channel] * ab) / determinant;
+        endpoint1[channel] = (bx[channel] * aa - ax[channel] * ab) / determinant;
+    }
+
+    return true;
+}
+
+void writeColorBlock(uint16_t color0, uint16_t color1, uint32_t indices, uint8_t* output) {
+    output[0] = static_cast<uint8_t>(color0 & 0xFF);
+    output[1] = static_cast<uint8_t>(color0 >> 8);
+    output[2] = static_cast<uint8_t>(color1 & 0xFF);
+    output[3] = static_cast<uint8_t>(color1 >> 8);
+
+    for (int i = 0; i < 4; ++i) {
+        output[4 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+    }
+}
+
+// Range fit along the principal axis of the colors, then one least squares refinement of the endpoints
+void encodeColorBlock(const Block& block, bool allowTransparent, uint8_t* output) {
+    bool transparent[16];
+    bool hasTransparent = false;
+    uint32_t opaqueCount = 0;
+    float mean[3] = {0.0f, 0.0f, 0.0f};
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        transparent[i] = allowTransparent && block[i][3] < 128;
+        hasTransparent |= transparent[i];
+
+        if (!transparent[i]) {
+            for (int channel = 0; channel < 3; ++channel) {
+                mean[channel] += block[i][channel];
+            }
+            ++opaqueCount;
+        }
+    }
+
+    if (!opaqueCount) {
+        // Three colors mode, all the texels are transparent black
+        writeColorBlock(0, 0, 0xFFFFFFFF, output);
+        return;
+    }
+
+    for (int channel = 0; channel < 3; ++channel) {
+        mean[channel] /= static_cast<float>(opaqueCount);
+    }
+
+    float covariance[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            continue;
+        }
+
+        const float r = block[i][0] - mean[0];
+        const float g = block[i][1] - mean[1];
+        const float b = block[i][2] - mean[2];
+
+        covariance[0] += r * r;
+        covariance[1] += r * g;
+        covariance[2] += r * b;
+        covariance[3] += g * g;
+        covariance[4] += g * b;
+        covariance[5] += b * b;
+    }
+
+    // Principal axis by power iteration, from the covariances of the channel which varies the most
+    float axis[3] = {covariance[0], covariance[1], covariance[2]};
+    if (covariance[3] > covariance[0] && covariance[3] >= covariance[5]) {
+        axis[0] = covariance[1];
+        axis[1] = covariance[3];
+        axis[2] = covariance[4];
+    } else if (covariance[5] > covariance[0] && covariance[5] > covariance[3]) {
+        axis[0] = covariance[2];
+        axis[1] = covariance[4];
+        axis[2] = covariance[5];
+    }
+
+    for (int iteration = 0; iteration < 8; ++iteration) {
+        const float x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+        const float y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+        const float z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+
+        const float length = std::max({std::fabs(x), std::fabs(y), std::fabs(z)});
+        if (length < 1e-6f) {
+            break;
+        }
+
+        axis[0] = x / length;
+        axis[1] = y / length;
+        axis[2] = z / length;
+    }
+
+    // The texels at both ends of the axis are the endpoints
+    float minProjection = 0.0f;
+    float maxProjection = 0.0f;
+    uint32_t minTexel = 0;
+    uint32_t maxTexel = 0;
+    bool first = true;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            continue;
+        }
+
+        const float projection = block[i][0] * axis[0] + block[i][1] * axis[1] + block[i][2] * axis[2];
+
+        if (first || projection < minProjection) {
+            minProjection = projection;
+            minTexel = i;
+        }
+
+        if (first || projection > maxProjection) {
+            maxProjection = projection;
+            maxTexel = i;
+        }
+
+        first = false;
+    }
+
+    float endpoint0[3];
+    float endpoint1[3];
+    for (int channel = 0; channel < 3; ++channel) {
+        endpoint0[channel] = block[maxTexel][channel];
+        endpoint1[channel] = block[minTexel][channel];
+    }
+
+    int palette[4][4];
+    uint32_t indices = 0;
+
+    if (hasTransparent) {
+        // Three colors mode, color0 <= color1
+        uint16_t color0 = packColor(endpoint0);
+        uint16_t color1 = packColor(endpoint1);
+        if (color0 > color1) {
+            std::swap(color0, color1);
+        }
+
+        getColorPalette(color0, color1, false, palette);
+        selectColorIndices(block, transparent, palette, 3, indices);
+        writeColorBlock(color0, color1, indices, output);
+        return;
+    }
+
+    // Four colors mode, color0 > color1
+    const auto encodeEndpoints = [&block, &transparent, &palette](const float (&first)[3], const float (&second)[3], uint16_t& color0, uint16_t& color1, uint32_t& blockIndices) {
+        color0 = packColor(first);
+        color1 = packColor(second);
+
+        if (color0 < color1) {
+            std::swap(color0, color1);
+        }
+
+        // With a single color, the index 0 is the color in both modes
+        getColorPalette(color0, color1, true, palette);
+        return selectColorIndices(block, transparent, palette, color0 == color1 ? 1 : 4, blockIndices);
+    };
+
+    uint16_t color0 = 0;
+    uint16_t color1 = 0;
+    const int error = encodeEndpoints(endpoint0, endpoint1, color0, color1, indices);
+
+    if (error && color0 != color1 && refineEndpoints(block, indices, endpoint0, endpoint1)) {
+        uint16_t refinedColor0 = 0;
+        uint16_t refinedColor1 = 0;
+        uint32_t refinedIndices = 0;
+
+        if (encodeEndpoints(endpoint0, endpoint1, refinedColor0, refinedColor1, refinedIndices) < error) {
+            color0 = refinedColor0;
+            color1 = refinedColor1;
+            indices = refinedIndices;
+        }
+    }
+
+    writeColorBlock(color0, color1, indices, output);
+}
+
+void encodeAlphaBlock(const Block& block, uint8_t* output) {
+    uint8_t alpha0 = 0;
+    uint8_t alpha1 = 255;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        alpha0 = std::max(alpha0, block[i][3]);
+        alpha1 = std::min(alpha1, block[i][3]);
+    }
+
+    output[0] = alpha0;
+    output[1] = alpha1;
+
+    // Eight values mode, alpha0 > alpha1, the indices 0 and 1 are the endpoints and 2 to 7 the interpolated values
+    uint64_t indices = 0;
+
+    if (alpha0 != alpha1) {
+        for (uint32_t i = 0; i < 16; ++i) {
+            // Position of the texel between alpha0 (0) and alpha1 (7)
+            const int step = (7 * (alpha0 - block[i][3]) + (alpha0 - alpha1) / 2) / (alpha0 - alpha1);
+            const uint64_t index = step == 0 ? 0 : (step == 7 ? 1 : static_cast<uint64_t>(step + 1));
+
+            indices |= index << (i * 3);
+        }
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        output[2 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+    }
+}
+
+void decodeColorBlock(const uint8_t* input, bool forceFourColors, Block& block) {
+    const uint16_t color0 = static_cast<uint16_t>(input[0] | (input[1] << 8));
+    const uint16_t color1 = static_cast<uint16_t>(input[2] | (input[3] << 8));
+    const uint32_t indices = static_cast<uint32_t>(input[4]) | (static_cast<uint32_t>(input[5]) << 8)
+                           | (static_cast<uint32_t>(input[6]) << 16) | (static_cast<uint32_t>(input[7]) << 24);
+
+    int palette[4][4];
+    getColorPalette(color0, color1, forceFourColors, palette);
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        const int* color = palette[(indices >> (i * 2)) & 3];
+
+        for (int channel = 0; channel < 4; ++channel) {
+            block[i][channel] = static_cast<uint8_t>(color[channel]);
+        }
+    }
+}
+
+void decodeAlphaBlock(const uint8_t* input, Block& block) {
+    const int alpha0 = input[0];
+    const int alpha1 = input[1];
+
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i) {
+        indices |= static_cast<uint64_t>(input[2 + i]) << (i * 8);
+    }
+
+    int palette[8] = {alpha0, alpha1};
+    if (alpha0 > alpha1) {
+        for (int i = 2; i < 8; ++i) {
+            palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+        }
+    } else {
+        for (int i = 2; i < 6; ++i) {
+            palette[i] = ((6 - i) * alpha0 + (i - 1) * alpha1) / 5;
+        }
+
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        block[i][3] = static_cast<uint8_t>(palette[(indices >> (i * 3)) & 7]);
+    }
+}
+
+void readBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, Block& block) {
+    for (uint32_t y = 0; y < 4; ++y) {
+        const uint32_t pixelY = std::min(blockY * 4 + y, height - 1);
+
+        for (uint32_t x = 0; x < 4; ++x) {
+            const uint32_t pixelX = std::min(blockX * 4 + x, width - 1);
+
+            std::memcpy(block[y * 4 + x], pixels + (static_cast<std::size_t>(pixelY) * width + pixelX) * 4, 4);
+        }
+    }
+}
+
+void writeBlock(const Block& block, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* pixels) {
+    for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y) {
+        for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; ++x) {
+            std::memcpy(pixels + (static_cast<std::size_t>(blockY * 4 + y) * width + blockX * 4 + x) * 4, block[y * 4 + x], 4);
+        }
+    }
+}
+
+} // anonymous
+
+bool canEncode(Render::Texture::Format format) {
+    return format == Render::Texture::Format::BC1_RGBA_UNORM || format == Render::Texture::Format::BC3_UNORM;
+}
+
+bool canDecode(Render::Texture::Format format) {
+    return format == Render::Texture::Format::BC1_RGBA_UNORM || format == Render::Texture::Format::BC3_UNORM;
+}
+
+bool hasAlpha(const uint8_t* pixels, uint32_t width, uint32_t height) {
+    const std::size_t texelsCount = static_cast<std::size_t>(width) * height;
+
+    for (std::size_t i = 0; i < texelsCount; ++i) {
+        if (pixels[i * 4 + 3] != 255) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Render::Texture::Format selectEncodeFormat(const uint8_t* pixels, uint32_t width, uint32_t height) {
+    return hasAlpha(pixels, width, height) ? Render::Texture::Format::BC3_UNORM : Render::Texture::Format::BC1_RGBA_UNORM;
+}
+
+Render::Texture::Format selectTranscodeFormat(Render::Texture::Format format, const std::function<bool(Render::Texture::Format)>& isSupported) {
+    if (isSupported(format)) {
+        return format;
+    }
+
+    if (canDecode(format) && isSupported(Render::Texture::Format::R8G8B8A8_UNORM)) {
+        return Render::Texture::Format::R8G8B8A8_UNORM;
+    }
+
+    return Render::Texture::Format::Undefined;
+}
+
+std::vector<uint8_t> encode(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format) {
+    if (!canEncode(format)) {
+        return {};
+    }
+
+    std::vector<uint8_t> data(Render::Texture::getMipLevelsSize(width, height, format, mipLevels));
+
+    const std::size_t blockSize = Render::Texture::formatToSize(format);
+    uint8_t* output = data.data();
+
+    for (uint32_t level = 0; level < mipLevels; ++level) {
+        const uint32_t levelWidth = std::max(width >> level, 1u);
+        const uint32_t levelHeight = std::max(height >> level, 1u);
+
+        for (uint32_t blockY = 0; blockY < (levelHeight + 3) / 4; ++blockY) {
+            for (uint32_t blockX = 0; blockX < (levelWidth + 3) / 4; ++blockX) {
+                Block block;
+                readBlock(pixels, levelWidth, levelHeight, blockX, blockY, block);
+
+                if (format == Render::Texture::Format::BC3_UNORM) {
+                    encodeAlphaBlock(block, output);
+                    encodeColorBlock(block, false, output + 8);
+                } else {
+                    encodeColorBlock(block, true, output);
+                }
+
+                output += blockSize;
+            }
+        }
+
+        pixels += Render::Texture::getImageSize(levelWidth, levelHeight, Render::Texture::Format::R8G8B8A8_UNORM);
+    }
+
+    return data;
+}
+
+bool decode(const uint8_t* data, uint32_t width, uint32_t height, uint32_t mipLevels, Render::Texture::Format format, uint8_t* pixels) {
+    if (!canDecode(format)) {
+        return false;
+    }
+
+    const std::size_t blockSize = Render::Texture::formatToSize(format);
+
+    for (uint32_t level = 0; level < mipLevels; ++level) {
+        const uint32_t levelWidth = std::max(width >> level, 1u);
+        const uint32_t levelHeight = std::max(height >> level, 1u);
+
+        for (uint32_t blockY = 0; blockY < (levelHeight + 3) / 4; ++blockY) {
+            for (uint32_t blockX = 0; blockX < (levelWidth + 3) / 4; ++blockX) {
+                Block block;
+
+                if (format == Render::Texture::Format::BC3_UNORM) {
+                    decodeColorBlock(data + 8, true, block);
+                    decodeAlphaBlock(data, block);
+                } else {
+                    decodeColorBlock(data, false, block);
+                }
+
+                writeBlock(block, levelWidth, levelHeight, blockX, blockY, pixels);
+                data += blockSize;
+            }
+        }
+
+        pixels += Render::Texture::getImageSize(levelWidth, levelHeight, Render::Texture::Format::R8G8B8A8_UNORM);
+    }
+
+    return true;
+}
+
+} // TextureCompression
+} // Graphics
+} // lug
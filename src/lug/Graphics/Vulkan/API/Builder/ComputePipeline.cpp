@@ -0,0 +1,58 @@
+#include <lug/Graphics/Vulkan/API/Builder/ComputePipeline.hpp>
+
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+namespace Builder {
+
+ComputePipeline::ComputePipeline(const API::Device& device) : _device(device) {}
+
+bool ComputePipeline::build(API::ComputePipeline& computePipeline, VkResult* returnResult) {
+    const VkComputePipelineCreateInfo createInfo{
+        /* createInfo.sType */ VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        /* createInfo.pNext */ nullptr,
+        /* createInfo.flags */ 0,
+        /* createInfo.stage */ {
+            /* createInfo.stage.sType */ VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            /* createInfo.stage.pNext */ nullptr,
+            /* createInfo.stage.flags */ 0,
+            /* createInfo.stage.stage */ VK_SHADER_STAGE_COMPUTE_BIT,
+            /* createInfo.stage.module */ static_cast<VkShaderModule>(_shaderModule),
+            /* createInfo.stage.pName */ _entry,
+            /* createInfo.stage.pSpecializationInfo */ _specializationInfo
+        },
+        /* createInfo.layout */ static_cast<VkPipelineLayout>(_pipelineLayout),
+        /* createInfo.basePipelineHandle */ VK_NULL_HANDLE,
+        /* createInfo.basePipelineIndex */ 0
+    };
+
+    // Create the compute pipeline
+    VkPipeline vkComputePipeline = VK_NULL_HANDLE;
+    VkResult result = vkCreateComputePipelines(static_cast<VkDevice>(_device), _pipelineCache, 1, &createInfo, nullptr, &vkComputePipeline);
+
+    if (returnResult) {
+        *returnResult = result;
+    }
+
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+
+    computePipeline = API::ComputePipeline(vkComputePipeline, &_device, std::move(_pipelineLayout));
+
+    return true;
+}
+
+std::unique_ptr<API::ComputePipeline> ComputePipeline::build(VkResult* returnResult) {
+    std::unique_ptr<API::ComputePipeline> computePipeline = std::make_unique<API::ComputePipeline>();
+    return build(*computePipeline, returnResult) ? std::move(computePipeline) : nullptr;
+}
+
+} // Builder
+} // API
+} // Vulkan
+} // Graphics
+} // lug
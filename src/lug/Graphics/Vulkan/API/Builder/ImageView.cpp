@@ -23,7 +23,7 @@ bool ImageView::build(API::ImageView& imageView, VkResult* returnResult) {
         /* createInfo.components */ {VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A},
         /* createInfo.subresourceRange */ {
             /* createInfo.subresourceRange.aspectMask */ _aspectFlags,
-            /* createInfo.subresourceRange.baseMipLevel */ 0,
+            /* createInfo.subresourceRange.baseMipLevel */ _baseMipLevel,
             /* createInfo.subresourceRange.levelCount */ _levelCount,
             /* createInfo.subresourceRange.baseArrayLayer */ 0,
             /* createInfo.subresourceRange.layerCount */ _layerCount
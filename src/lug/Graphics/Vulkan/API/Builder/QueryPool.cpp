@@ -0,0 +1,57 @@
+#include <lug/Graphics/Vulkan/API/Builder/QueryPool.hpp>
+
+#include <bitset>
+
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+namespace Builder {
+
+QueryPool::QueryPool(const API::Device& device) : _device{device} {}
+
+bool QueryPool::build(API::QueryPool& queryPool, VkResult* returnResult) {
+    const bool pipelineStatistics = _queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS;
+
+    // Create the query pool creation information for vkCreateQueryPool
+    const VkQueryPoolCreateInfo createInfo{
+        /* createInfo.sType              */ VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        /* createInfo.pNext              */ nullptr,
+        /* createInfo.flags              */ 0,
+        /* createInfo.queryType          */ _queryType,
+        /* createInfo.queryCount         */ _queryCount,
+        /* createInfo.pipelineStatistics */ pipelineStatistics ? _pipelineStatistics : 0
+    };
+
+    // Create the query pool
+    VkQueryPool vkQueryPool{VK_NULL_HANDLE};
+    VkResult result = vkCreateQueryPool(static_cast<VkDevice>(_device), &createInfo, nullptr, &vkQueryPool);
+
+    if (returnResult) {
+        *returnResult = result;
+    }
+
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+
+    // A pipeline statistics query writes one value per enabled statistic
+    const uint32_t valuesPerQuery = pipelineStatistics ? static_cast<uint32_t>(std::bitset<32>(_pipelineStatistics).count()) : 1;
+
+    queryPool = API::QueryPool(vkQueryPool, &_device, _queryType, _queryCount, valuesPerQuery);
+
+    return true;
+}
+
+std::unique_ptr<API::QueryPool> QueryPool::build(VkResult* returnResult) {
+    std::unique_ptr<API::QueryPool> queryPool = std::make_unique<API::QueryPool>();
+    return build(*queryPool, returnResult) ? std::move(queryPool) : nullptr;
+}
+
+} // Builder
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,5 +1,7 @@
 #include <lug/Graphics/Vulkan/API/Builder/Swapchain.hpp>
 
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/Image.hpp>
 #include <lug/Graphics/Vulkan/API/RTTI/Enum.hpp>
 #include <lug/System/Logger/Logger.hpp>
 
@@ -83,6 +85,10 @@ bool Swapchain::setFromPreferences() {
 }
 
 bool Swapchain::build(API::Swapchain& swapchain, VkResult* returnResult) {
+    if (_offscreen) {
+        return buildOffscreen(swapchain, returnResult);
+    }
+
     const PhysicalDeviceInfo* info = _device.getPhysicalDeviceInfo();
 
     std::vector<uint32_t> queueFamilyIndices(_queueFamilyIndices.begin(), _queueFamilyIndices.end());
@@ -141,6 +147,68 @@ bool Swapchain::build(API::Swapchain& swapchain, VkResult* returnResult) {
     return swapchain.init();
 }
 
+bool Swapchain::buildOffscreen(API::Swapchain& swapchain, VkResult* returnResult) {
+    // Without surface, use the first format of the preferences supported as color attachment
+    std::set<VkFormat> imageFormats;
+
+    if (_imageFormat != VK_FORMAT_MAX_ENUM) {
+        imageFormats.insert(_imageFormat);
+    } else if (_preferences != nullptr) {
+        imageFormats.insert(_preferences->formats.begin(), _preferences->formats.end());
+    }
+
+    if (imageFormats.empty()) {
+        LUG_LOG.error("Swapchain::build: Missing imageFormat parameter for offscreen swapchain. Call Builder::Swapchain::setImageFormat()");
+        return false;
+    }
+
+    if (_minImageCount == 0) {
+        LUG_LOG.error("Swapchain::build: Missing minImageCount parameter for offscreen swapchain. Call Builder::Swapchain::setMinImageCount()");
+        return false;
+    }
+
+    swapchain = API::Swapchain(VK_NULL_HANDLE, &_device, {VK_FORMAT_UNDEFINED, _imageColorSpace}, _imageExtent);
+    swapchain._offscreen = true;
+    swapchain._images.resize(_minImageCount);
+
+    // Create the images
+    {
+        API::Builder::Image imageBuilder(_device);
+
+        imageBuilder.setUsage(_imageUsage);
+        imageBuilder.setPreferedFormats(imageFormats);
+        imageBuilder.setFeatureFlags(VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT);
+        imageBuilder.setExtent({_imageExtent.width, _imageExtent.height, 1});
+        imageBuilder.setExclusive(_exclusive);
+        imageBuilder.setQueueFamilyIndices(_queueFamilyIndices);
+
+        API::Builder::DeviceMemory deviceMemoryBuilder(_device);
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        for (auto& image : swapchain._images) {
+            if (!imageBuilder.build(image, returnResult)) {
+                LUG_LOG.error("Swapchain::build: Can't create offscreen image");
+                return false;
+            }
+
+            if (!deviceMemoryBuilder.addImage(image)) {
+                LUG_LOG.error("Swapchain::build: Can't add offscreen image to device memory");
+                return false;
+            }
+        }
+
+        if (!deviceMemoryBuilder.build(swapchain._imagesMemory, returnResult)) {
+            LUG_LOG.error("Swapchain::build: Can't create offscreen images device memory");
+            return false;
+        }
+    }
+
+    swapchain._format.format = swapchain._images.front().getFormat();
+    LUG_LOG.info("Swapchain::build: Use offscreen format {}", API::RTTI::toStr(swapchain._format.format));
+
+    return swapchain.initImagesViews();
+}
+
 std::unique_ptr<API::Swapchain> Swapchain::build(VkResult* returnResult) {
     std::unique_ptr<API::Swapchain> swapchain = std::make_unique<API::Swapchain>();
     return build(*swapchain, returnResult) ? std::move(swapchain) : nullptr;
@@ -35,12 +35,12 @@ CommandBuffer::~CommandBuffer() {
     destroy();
 }
 
-bool CommandBuffer::begin(VkCommandBufferUsageFlags flags) const {
+bool CommandBuffer::begin(VkCommandBufferUsageFlags flags, const VkCommandBufferInheritanceInfo* inheritanceInfo) const {
     VkCommandBufferBeginInfo beginInfo{
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         beginInfo.pNext = nullptr,
         beginInfo.flags = flags,
-        beginInfo.pInheritanceInfo = nullptr // TODO: handle pInheritanceInfo for secondary command buffers
+        beginInfo.pInheritanceInfo = inheritanceInfo
     };
 
     VkResult result = vkBeginCommandBuffer(_commandBuffer, &beginInfo);
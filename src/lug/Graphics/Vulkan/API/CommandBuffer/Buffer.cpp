@@ -11,6 +11,16 @@ void CommandBuffer::updateBuffer(const API::Buffer& buffer, const void* data, Vk
     vkCmdUpdateBuffer(_commandBuffer, static_cast<VkBuffer>(buffer), offset, size, data);
 }
 
+void CommandBuffer::copyBuffer(const CommandBuffer::CmdCopyBuffer& parameters) const {
+    vkCmdCopyBuffer(
+        _commandBuffer,
+        static_cast<VkBuffer>(parameters.srcBuffer),
+        static_cast<VkBuffer>(parameters.dstBuffer),
+        static_cast<uint32_t>(parameters.regions.size()),
+        parameters.regions.data()
+    );
+}
+
 } // API
 } // Vulkan
 } // Graphics
@@ -1,5 +1,6 @@
 #include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
 
 namespace lug {
@@ -32,6 +33,28 @@ void CommandBuffer::blitImage(const CommandBuffer::CmdBlitImage& parameters) con
         );
 }
 
+void CommandBuffer::copyImageToBuffer(const CommandBuffer::CmdCopyImageToBuffer& parameters) const {
+    vkCmdCopyImageToBuffer(
+        _commandBuffer,
+        static_cast<VkImage>(parameters.srcImage),
+        parameters.srcImageLayout,
+        static_cast<VkBuffer>(parameters.dstBuffer),
+        static_cast<uint32_t>(parameters.regions.size()),
+        parameters.regions.data()
+    );
+}
+
+void CommandBuffer::copyBufferToImage(const CommandBuffer::CmdCopyBufferToImage& parameters) const {
+    vkCmdCopyBufferToImage(
+        _commandBuffer,
+        static_cast<VkBuffer>(parameters.srcBuffer),
+        static_cast<VkImage>(parameters.dstImage),
+        parameters.dstImageLayout,
+        static_cast<uint32_t>(parameters.regions.size()),
+        parameters.regions.data()
+    );
+}
+
 } // API
 } // Vulkan
 } // Graphics
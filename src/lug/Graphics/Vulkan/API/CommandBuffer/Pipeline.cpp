@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/ComputePipeline.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
 #include <lug/Graphics/Vulkan/API/GraphicsPipeline.hpp>
 
@@ -154,6 +155,14 @@ void CommandBuffer::bindPipeline(const API::GraphicsPipeline& pipeline, VkPipeli
     );
 }
 
+void CommandBuffer::bindPipeline(const API::ComputePipeline& pipeline) const {
+    vkCmdBindPipeline(
+        _commandBuffer,
+        VK_PIPELINE_BIND_POINT_COMPUTE,
+        static_cast<VkPipeline>(pipeline)
+    );
+}
+
 void CommandBuffer::bindVertexBuffers(
     const std::vector<const API::Buffer*>& buffers,
     const std::vector<VkDeviceSize>& offsets,
@@ -218,6 +227,15 @@ void CommandBuffer::pushConstants(const CmdPushConstants& parameters) const {
     );
 }
 
+void CommandBuffer::dispatch(const CmdDispatch& parameters) const {
+    vkCmdDispatch(
+        _commandBuffer,
+        parameters.groupCountX,
+        parameters.groupCountY,
+        parameters.groupCountZ
+    );
+}
+
 } // API
 } // Vulkan
 } // Graphics
@@ -0,0 +1,29 @@
+#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
+
+#include <lug/Graphics/Vulkan/API/QueryPool.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+void CommandBuffer::resetQueryPool(const API::QueryPool& queryPool, uint32_t firstQuery, uint32_t queryCount) const {
+    vkCmdResetQueryPool(_commandBuffer, static_cast<VkQueryPool>(queryPool), firstQuery, queryCount);
+}
+
+void CommandBuffer::beginQuery(const API::QueryPool& queryPool, uint32_t query, VkQueryControlFlags flags) const {
+    vkCmdBeginQuery(_commandBuffer, static_cast<VkQueryPool>(queryPool), query, flags);
+}
+
+void CommandBuffer::endQuery(const API::QueryPool& queryPool, uint32_t query) const {
+    vkCmdEndQuery(_commandBuffer, static_cast<VkQueryPool>(queryPool), query);
+}
+
+void CommandBuffer::writeTimestamp(VkPipelineStageFlagBits pipelineStage, const API::QueryPool& queryPool, uint32_t query) const {
+    vkCmdWriteTimestamp(_commandBuffer, pipelineStage, static_cast<VkQueryPool>(queryPool), query);
+}
+
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -51,6 +51,20 @@ void CommandBuffer::drawIndexed(const CmdDrawIndexed& params) const {
     );
 }
 
+void CommandBuffer::executeCommands(const std::vector<const API::CommandBuffer*>& commandBuffers) const {
+    std::vector<VkCommandBuffer> vkCommandBuffers(commandBuffers.size());
+
+    for (size_t i = 0; i < commandBuffers.size(); ++i) {
+        vkCommandBuffers[i] = static_cast<VkCommandBuffer>(*commandBuffers[i]);
+    }
+
+    vkCmdExecuteCommands(
+        static_cast<VkCommandBuffer>(_commandBuffer),
+        static_cast<uint32_t>(vkCommandBuffers.size()),
+        vkCommandBuffers.data()
+    );
+}
+
 } // API
 } // Vulkan
 } // Graphics
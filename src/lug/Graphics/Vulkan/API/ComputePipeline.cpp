@@ -0,0 +1,53 @@
+#include <lug/Graphics/Vulkan/API/ComputePipeline.hpp>
+
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+ComputePipeline::ComputePipeline(VkPipeline pipeline, const Device* device, PipelineLayout pipelineLayout) :
+    _pipeline(pipeline), _device(device), _pipelineLayout(std::move(pipelineLayout)) {}
+
+ComputePipeline::ComputePipeline(ComputePipeline&& pipeline) {
+    _pipeline = pipeline._pipeline;
+    _device = pipeline._device;
+    _pipelineLayout = std::move(pipeline._pipelineLayout);
+    pipeline._pipeline = VK_NULL_HANDLE;
+    pipeline._device = nullptr;
+}
+
+ComputePipeline& ComputePipeline::operator=(ComputePipeline&& pipeline) {
+    destroy();
+
+    _pipeline = pipeline._pipeline;
+    _device = pipeline._device;
+    _pipelineLayout = std::move(pipeline._pipelineLayout);
+    pipeline._pipeline = VK_NULL_HANDLE;
+    pipeline._device = nullptr;
+
+    return *this;
+}
+
+ComputePipeline::~ComputePipeline() {
+    destroy();
+}
+
+void ComputePipeline::destroy() {
+    _pipelineLayout.destroy();
+
+    if (_pipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(static_cast<VkDevice>(*_device), _pipeline, nullptr);
+        _pipeline = VK_NULL_HANDLE;
+    }
+}
+
+const PipelineLayout* ComputePipeline::getLayout() const {
+    return &_pipelineLayout;
+}
+
+} // API
+} // Vulkan
+} // Graphics
+} // lug
@@ -90,6 +90,21 @@ bool Device::waitIdle() const {
     return true;
 }
 
+bool Device::flushMappedMemoryRanges(const std::vector<VkMappedMemoryRange>& ranges) const {
+    if (ranges.empty()) {
+        return true;
+    }
+
+    VkResult result = vkFlushMappedMemoryRanges(_device, static_cast<uint32_t>(ranges.size()), ranges.data());
+
+    if (result != VK_SUCCESS) {
+        LUG_LOG.error("Device::flushMappedMemoryRanges: Can't flush memory: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
 void Device::destroy() {
     _queueFamilies.clear();
 
@@ -0,0 +1,84 @@
+#include <lug/Graphics/Vulkan/API/QueryPool.hpp>
+
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace API {
+
+QueryPool::QueryPool(VkQueryPool queryPool, const Device* device, VkQueryType queryType, uint32_t queryCount, uint32_t valuesPerQuery) :
+    _queryPool(queryPool), _device(device), _queryType(queryType), _queryCount(queryCount), _valuesPerQuery(valuesPerQuery) {}
+
+QueryPool::QueryPool(QueryPool&& queryPool) {
+    _queryPool = queryPool._queryPool;
+    _device = queryPool._device;
+    _queryType = queryPool._queryType;
+    _queryCount = queryPool._queryCount;
+    _valuesPerQuery = queryPool._valuesPerQuery;
+    queryPool._queryPool = VK_NULL_HANDLE;
+    queryPool._device = nullptr;
+    queryPool._queryCount = 0;
+}
+
+QueryPool& QueryPool::operator=(QueryPool&& queryPool) {
+    destroy();
+
+    _queryPool = queryPool._queryPool;
+    _device = queryPool._device;
+    _queryType = queryPool._queryType;
+    _queryCount = queryPool._queryCount;
+    _valuesPerQuery = queryPool._valuesPerQuery;
+    queryPool._queryPool = VK_NULL_HANDLE;
+    queryPool._device = nullptr;
+    queryPool._queryCount = 0;
+
+    return *this;
+}
+
+QueryPool::~QueryPool() {
+    destroy();
+}
+
+bool QueryPool::getResults(uint32_t firstQuery, uint32_t queryCount, std::vector<uint64_t>& results, bool wait) const {
+    results.resize(queryCount * _valuesPerQuery);
+
+    VkResult result = vkGetQueryPoolResults(
+        static_cast<VkDevice>(*_device),
+        _queryPool,
+        firstQuery,
+        queryCount,
+        results.size() * sizeof(uint64_t),
+        results.data(),
+        _valuesPerQuery * sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT | (wait ? VK_QUERY_RESULT_WAIT_BIT : 0)
+    );
+
+    // The queries are not all available yet
+    if (result == VK_NOT_READY) {
+        return false;
+    }
+
+    if (result != VK_SUCCESS) {
+        LUG_LOG.error("QueryPool::getResults: Can't get the query results: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
+void QueryPool::destroy() {
+    if (_queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(static_cast<VkDevice>(*_device), _queryPool, nullptr);
+        _queryPool = VK_NULL_HANDLE;
+    }
+
+    _device = nullptr;
+    _queryCount = 0;
+}
+
+} // API
+} // Vulkan
+} // Graphics
+} // lug
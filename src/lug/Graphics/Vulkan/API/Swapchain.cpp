@@ -20,8 +20,12 @@ Swapchain::Swapchain(Swapchain&& swapchain) {
     _imagesViews = std::move(swapchain._imagesViews);
     _format = swapchain._format;
     _extent = swapchain._extent;
+    _offscreen = swapchain._offscreen;
+    _imagesMemory = std::move(swapchain._imagesMemory);
+    _nextImageIndex = swapchain._nextImageIndex;
     swapchain._swapchain = VK_NULL_HANDLE;
     swapchain._device = nullptr;
+    swapchain._offscreen = false;
 }
 
 Swapchain& Swapchain::operator=(Swapchain&& swapchain) {
@@ -33,8 +37,12 @@ Swapchain& Swapchain::operator=(Swapchain&& swapchain) {
     _imagesViews = std::move(swapchain._imagesViews);
     _format = swapchain._format;
     _extent = swapchain._extent;
+    _offscreen = swapchain._offscreen;
+    _imagesMemory = std::move(swapchain._imagesMemory);
+    _nextImageIndex = swapchain._nextImageIndex;
     swapchain._swapchain = VK_NULL_HANDLE;
     swapchain._device = nullptr;
+    swapchain._offscreen = false;
 
     return *this;
 }
@@ -50,6 +58,14 @@ void Swapchain::destroy() {
     _imagesViews.clear();
     _images.clear();
 
+    // Delete the memory of the offscreen images
+    if (_offscreen) {
+        _imagesMemory.destroy();
+        _nextImageIndex = 0;
+        _offscreen = false;
+        _device = nullptr;
+    }
+
     // Delete swapchain
     if (_swapchain != VK_NULL_HANDLE) {
         vkDestroySwapchainKHR(static_cast<VkDevice>(*_device), _swapchain, nullptr);
@@ -88,20 +104,21 @@ bool Swapchain::init() {
         }
     }
 
-    // Create image views
-    {
-        _imagesViews.resize(_images.size());
+    return initImagesViews();
+}
+
+bool Swapchain::initImagesViews() {
+    _imagesViews.resize(_images.size());
 
-        for (uint8_t i = 0; i < _images.size(); ++i) {
-            VkResult result{VK_SUCCESS};
-            API::Builder::ImageView imageViewBuilder(*_device, _images[i]);
+    for (uint8_t i = 0; i < _images.size(); ++i) {
+        VkResult result{VK_SUCCESS};
+        API::Builder::ImageView imageViewBuilder(*_device, _images[i]);
 
-            imageViewBuilder.setFormat(_format.format);
+        imageViewBuilder.setFormat(_format.format);
 
-            if (!imageViewBuilder.build(_imagesViews[i], &result)) {
-                LUG_LOG.error("Forward::initDepthBuffers: Can't create swapchain image view: {}", result);
-                return false;
-            }
+        if (!imageViewBuilder.build(_imagesViews[i], &result)) {
+            LUG_LOG.error("Forward::initDepthBuffers: Can't create swapchain image view: {}", result);
+            return false;
         }
     }
 
@@ -109,6 +126,13 @@ bool Swapchain::init() {
 }
 
 bool Swapchain::getNextImage(uint32_t* imageIndex, VkSemaphore semaphore) {
+    // The offscreen images are used in turn, the semaphore can't be signaled without a swapchain
+    if (_offscreen) {
+        *imageIndex = _nextImageIndex;
+        _nextImageIndex = (_nextImageIndex + 1) % static_cast<uint32_t>(_images.size());
+        return true;
+    }
+
     // Get next image
     // TODO: remove UINT64_MAX timeout and ask next image later if VK_NOT_READY is returned
     VkResult result = vkAcquireNextImageKHR(static_cast<VkDevice>(*_device), _swapchain, UINT64_MAX, semaphore, VK_NULL_HANDLE, imageIndex);
@@ -125,6 +149,11 @@ bool Swapchain::getNextImage(uint32_t* imageIndex, VkSemaphore semaphore) {
 }
 
 bool Swapchain::present(const Queue* presentQueue, uint32_t imageIndex, VkSemaphore semaphore) const {
+    // Nothing to present to
+    if (_offscreen) {
+        return true;
+    }
+
     // Present image
     const VkPresentInfoKHR presentInfo{
         /* presentInfo.sType */ VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
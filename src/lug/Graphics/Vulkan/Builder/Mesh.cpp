@@ -112,6 +112,8 @@ Resource::SharedPtr<::lug::Graphics::Render::Mesh> build(const ::lug::Graphics::
         ++i;
     }
 
+    mesh->computeBoundingBox();
+
     // Bind attributes buffers to mesh device memory
     {
         API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
@@ -143,10 +145,15 @@ Resource::SharedPtr<::lug::Graphics::Render::Mesh> build(const ::lug::Graphics::
             uint32_t attributesNb = static_cast<uint32_t>(primitiveSet.attributes.size());
 
             for (i = 0; i < attributesNb; ++i) {
-                primitiveSetData->buffers[i].updateData(
-                    primitiveSet.attributes[i].buffer.data,
-                    primitiveSet.attributes[i].buffer.size
-                );
+                lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Buffer& buffer = primitiveSet.attributes[i].buffer;
+
+                primitiveSetData->buffers[i].updateData(buffer.data, buffer.size);
+                ::lug::Graphics::Builder::Mesh::_copiedBytes += buffer.size;
+
+                // The external data is only valid during the build
+                if (buffer.external) {
+                    buffer.data = nullptr;
+                }
             }
         }
     }
@@ -10,6 +10,9 @@
 #include <lug/Graphics/Vulkan/API/Builder/RenderPass.hpp>
 #include <lug/Graphics/Builder/SkyBox.hpp>
 #include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Render/BrdfLut.hpp>
+#include <lug/Graphics/Render/IblCache.hpp>
 #include <lug/Graphics/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Render/SkyBox.hpp>
@@ -120,8 +123,46 @@ static bool initMesh(Renderer& renderer, lug::Graphics::Resource::SharedPtr<lug:
     return true;
 }
 
+static bool loadBrdfLut(Renderer& renderer, lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture>& brdfLut) {
+    const std::string& filename = static_cast<Vulkan::Renderer&>(renderer).getPreferences().ibl.brdfLut;
+
+    lug::Graphics::Render::IblCache::Entry entry{};
+    if (filename.empty() || !lug::Graphics::Render::IblCache::load(filename, lug::Graphics::Render::BrdfLut::getKey(), entry)) {
+        return false;
+    }
+
+    if (entry.layersCount != 1 || entry.mipLevels != 1 || entry.format != lug::Graphics::Render::Texture::Format::R16G16_SFLOAT) {
+        LUG_LOG.warn("Skybox::loadBrdfLut: Invalid brdf lut {}", filename);
+        return false;
+    }
+
+    // TODO: Set sampler borderColor to VK_BORDER_COOLOR_FLOAT_OPAQUE_WHITE
+    lug::Graphics::Builder::Texture textureBuilder(renderer);
+
+    textureBuilder.setMagFilter(lug::Graphics::Render::Texture::Filter::Linear);
+    textureBuilder.setMinFilter(lug::Graphics::Render::Texture::Filter::Linear);
+
+    if (!textureBuilder.addLayer(entry.width, entry.height, entry.format, entry.data.data())) {
+        LUG_LOG.error("Skybox::loadBrdfLut: Can't create the brdf lut texture layer");
+        return false;
+    }
+
+    brdfLut = textureBuilder.build();
+    if (!brdfLut) {
+        LUG_LOG.error("Skybox::loadBrdfLut: Can't create the brdf lut texture");
+        return false;
+    }
+
+    return true;
+}
+
 static bool initBrdfLut(Renderer& renderer, lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture>& brdfLut) {
-    constexpr uint32_t brdfLutSize = 512;
+    constexpr uint32_t brdfLutSize = lug::Graphics::Render::BrdfLut::defaultSize;
+
+    // The precomputed brdf lut is the same as the generated one, see Render::BrdfLut
+    if (loadBrdfLut(renderer, brdfLut)) {
+        return true;
+    }
 
     Vulkan::Renderer& vkRenderer = static_cast<Vulkan::Renderer&>(renderer);
     auto brdfLutPipeline = vkRenderer.getPipeline(Render::Pipeline::getBrdfLutBaseId());
@@ -337,6 +378,12 @@ Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics
 
     Vulkan::Renderer& renderer = static_cast<Vulkan::Renderer&>(builder._renderer);
 
+    // Decode the background and environnement images in parallel
+    std::vector<lug::Graphics::ImageDecoder::Image> images = lug::Graphics::ImageDecoder().decode({
+        {builder._backgroundFilename, false},
+        {builder._environnementFilename, true}
+    });
+
     // Load background image
     if (builder._backgroundFilename.size())
     {
@@ -348,7 +395,7 @@ Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics
         textureBuilder.setWrapS(builder._wrapS);
         textureBuilder.setWrapT(builder._wrapT);
 
-        if (!textureBuilder.addLayer(builder._backgroundFilename)) {
+        if (!textureBuilder.addLayer(std::move(images[0]))) {
             LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't create skybox layers");
             return nullptr;
         }
@@ -371,7 +418,7 @@ Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics
         textureBuilder.setWrapS(builder._wrapS);
         textureBuilder.setWrapT(builder._wrapT);
 
-        if (!textureBuilder.addLayer(builder._environnementFilename, true)) {
+        if (!textureBuilder.addLayer(std::move(images[1]))) {
             LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't create skybox layers");
             return nullptr;
         }
@@ -381,6 +428,12 @@ Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics
             LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't create skyBox texture");
             return nullptr;
         }
+
+        // The maps generated from the environment are cached by content, not by filename
+        if (renderer.getPreferences().ibl.cache && !lug::Graphics::Render::IblCache::hashFile(builder._environnementFilename, skyBox->_environnementHash)) {
+            LUG_LOG.warn("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't hash {}, the IBL cache is disabled for this skybox", builder._environnementFilename);
+            skyBox->_environnementHash = 0;
+        }
     }
 
     // Init the skyBox pipeline and mesh only one time
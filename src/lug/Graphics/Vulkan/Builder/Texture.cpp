@@ -1,12 +1,16 @@
 #include <lug/Graphics/Vulkan/Builder/Texture.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/Builder/UploadBatch.hpp>
 #include <lug/Graphics/Renderer.hpp>
-#include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
-#include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
+#include <lug/Graphics/TextureCompression.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Sampler.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Render/Texture.hpp>
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -14,7 +18,45 @@ namespace Vulkan {
 namespace Builder {
 namespace Texture {
 
-Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphics::Builder::Texture& builder) {
+namespace {
+
+VkFormat toVulkanFormat(Render::Texture::Format format) {
+    switch(format) {
+        case Render::Texture::Format::R8G8B8A8_UNORM:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+
+        case Render::Texture::Format::R16G16_SFLOAT:
+            return VK_FORMAT_R16G16_SFLOAT;
+
+        case Render::Texture::Format::R16G16B16_SFLOAT:
+            return VK_FORMAT_R16G16B16_SFLOAT;
+
+        case Render::Texture::Format::R32G32B32A32_SFLOAT:
+            return VK_FORMAT_R32G32B32A32_SFLOAT;
+
+        case Render::Texture::Format::BC1_RGBA_UNORM:
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+
+        case Render::Texture::Format::BC3_UNORM:
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+
+        case Render::Texture::Format::BC7_UNORM:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+
+        case Render::Texture::Format::ETC2_R8G8B8A8_UNORM:
+            return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+
+        case Render::Texture::Format::ASTC_4x4_UNORM:
+            return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+
+        default:
+            return VK_FORMAT_UNDEFINED;
+    };
+}
+
+} // anonymous
+
+Resource::SharedPtr<::lug::Graphics::Render::Texture> build(::lug::Graphics::Builder::Texture& builder) {
     // Constructor of Texture is private, we can't use std::make_unique
     std::unique_ptr<Resource> resource{new Vulkan::Render::Texture(builder._name)};
     Vulkan::Render::Texture* texture = static_cast<Vulkan::Render::Texture*>(resource.get());
@@ -37,42 +79,55 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
         }
     }
 
-    // Create command pool of transfer queue
-    API::CommandPool transferQueueCommandPool;
+    // Upload the texture in the best format the device can sample, decoding it on the CPU if needed
     {
-        VkResult result{VK_SUCCESS};
-        API::Builder::CommandPool commandPoolBuilder(device, *transferQueue->getQueueFamily());
-        if (!commandPoolBuilder.build(transferQueueCommandPool, &result)) {
-            LUG_LOG.error("Vulkan::Texture::build: Can't create a command pool: {}", result);
+        const Render::Texture::Format format = TextureCompression::selectTranscodeFormat(builder._format, [&device](Render::Texture::Format candidate) {
+            return API::Image::findSupportedFormat(device, {toVulkanFormat(candidate)}, VK_IMAGE_TILING_OPTIMAL, VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != VK_FORMAT_UNDEFINED;
+        });
+
+        if (format == Render::Texture::Format::Undefined) {
+            LUG_LOG.error("Vulkan::Texture::build: The format of the texture is not supported by the device");
             return nullptr;
         }
-    }
 
-    // Create the API::Image
-    {
-        API::Builder::Image imageBuilder(device);
+        if (format != builder._format) {
+            LUG_LOG.warn("Vulkan::Texture::build: The compressed format of the texture is not supported by the device, it is decoded on the CPU");
 
-        const VkFormat format = [](Render::Texture::Format format) {
-            switch(format) {
-                case Render::Texture::Format::R8G8B8A8_UNORM:
-                    return VK_FORMAT_R8G8B8A8_UNORM;
+            for (auto& layer : builder._layers) {
+                if (!layer.data) {
+                    continue;
+                }
+
+                const uint32_t mipLevels = layer.allMipLevels ? builder._mipLevels : 1;
 
-                case Render::Texture::Format::R16G16_SFLOAT:
-                    return VK_FORMAT_R16G16_SFLOAT;
+                ImageDecoder::Pixels pixels{static_cast<unsigned char*>(std::malloc(Render::Texture::getMipLevelsSize(builder._width, builder._height, format, mipLevels)))};
 
-                case Render::Texture::Format::R16G16B16_SFLOAT:
-                    return VK_FORMAT_R16G16B16_SFLOAT;
+                if (!pixels || !TextureCompression::decode(layer.data, builder._width, builder._height, mipLevels, builder._format, pixels.get())) {
+                    LUG_LOG.error("Vulkan::Texture::build: Can't decode the texture");
+                    return nullptr;
+                }
 
-                case Render::Texture::Format::R32G32B32A32_SFLOAT:
-                    return VK_FORMAT_R32G32B32A32_SFLOAT;
+                layer.data = pixels.get();
+                layer.pixels = std::move(pixels);
+            }
 
-                default:
-                    return VK_FORMAT_UNDEFINED;
-            };
-        }(builder._format);
+            builder._format = format;
+        }
+    }
+
+    // Create the API::Image
+    {
+        API::Builder::Image imageBuilder(device);
+
+        const VkFormat format = toVulkanFormat(builder._format);
 
         // TODO: Take the usage from the builder (TRANSFER_DST only if we want to copy image to it, etc)
-        imageBuilder.setUsage(VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        // The compressed images can't be rendered to
+        if (Render::Texture::isCompressed(builder._format)) {
+            imageBuilder.setUsage(VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+        } else {
+            imageBuilder.setUsage(VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        }
         imageBuilder.setPreferedFormats({format});
         imageBuilder.setFeatureFlags(VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
         imageBuilder.setQueueFamilyIndices({ transferQueue->getQueueFamily()->getIdx() });
@@ -135,187 +190,74 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
         }
     }
 
-    uint32_t nbLayersWithData = 0;
-    for (const auto& layer : builder._layers) {
-        if (layer.data) {
-            ++nbLayersWithData;
-        }
-    }
-
-    // Create staging buffers for image upload
-    // The number of layers is not neccessarily equals to builder._layers.size() (5 layers and 2 filenames)
-    if (nbLayersWithData)
-    {
-        const VkDeviceSize layerSize = builder._width * builder._height * Render::Texture::formatToSize(builder._format);
-        const VkDeviceSize bufferSize = layerSize * nbLayersWithData;
+    // The layers added with data only have their first mip level, the external layers and the decoded KTX 2.0 images have all of them
+    const VkDeviceSize formatSize = Render::Texture::formatToSize(builder._format);
+    const VkDeviceSize layerSize = Render::Texture::getImageSize(builder._width, builder._height, builder._format);
+    const VkDeviceSize allMipLevelsSize = Render::Texture::getMipLevelsSize(builder._width, builder._height, builder._format, builder._mipLevels);
 
-        API::Buffer stagingBuffer;
-        API::DeviceMemory stagingBufferMemory;
-        std::set<uint32_t> queueFamilyIndices = { transferQueue->getQueueFamily()->getIdx() };
+    // Without upload batch, the texture is uploaded alone and is ready once built
+    Vulkan::Render::UploadBatch textureUploadBatch;
+    Vulkan::Render::UploadBatch& uploadBatch = builder._uploadBatch ? *builder._uploadBatch->_vulkanUploadBatch : textureUploadBatch;
 
-        // Create staging buffer
-        {
-            API::Builder::Buffer bufferBuilder(device);
-            bufferBuilder.setQueueFamilyIndices(queueFamilyIndices);
-            bufferBuilder.setSize(bufferSize);
-            bufferBuilder.setUsage(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
-            bufferBuilder.setExclusive(VK_SHARING_MODE_EXCLUSIVE);
-
-            VkResult result{VK_SUCCESS};
-            if (!bufferBuilder.build(stagingBuffer, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create staging buffer: {}", result);
-                return nullptr;
-            }
-        }
-
-        // Create staging buffer memory
-        {
-            API::Builder::DeviceMemory deviceMemoryBuilder(device);
-            deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-            deviceMemoryBuilder.addBuffer(stagingBuffer);
+    // The number of layers is not neccessarily equals to builder._layers.size() (5 layers and 2 filenames)
+    std::vector<VkBufferImageCopy> bufferCopyRegions;
+    for (uint32_t layerNb = 0; layerNb < builder._layers.size(); ++layerNb) {
+        auto& layer = builder._layers[layerNb];
 
-            VkResult result{VK_SUCCESS};
-            if (!deviceMemoryBuilder.build(stagingBufferMemory, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create staging buffer device memory: {}", result);
-                return nullptr;
-            }
+        if (!layer.data) {
+            continue;
         }
 
-        // Update buffer data
-        {
-            VkDeviceSize pixelsOffset{0};
-            for (const auto& layer : builder._layers) {
-                if (!layer.data) {
-                    continue;
+        // The pixels owned by the builder are kept by the batch until it is submitted
+        const VkDeviceSize size = layer.allMipLevels ? allMipLevelsSize : layerSize;
+        VkDeviceSize pixelsOffset = layer.pixels ? uploadBatch.addData(std::move(layer.pixels), size, formatSize) : uploadBatch.addData(layer.data, size, formatSize);
+
+        const uint32_t mipLevels = layer.allMipLevels ? builder._mipLevels : 1;
+
+        for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel) {
+            const uint32_t width = std::max(builder._width >> mipLevel, 1u);
+            const uint32_t height = std::max(builder._height >> mipLevel, 1u);
+
+            // Copy
+            bufferCopyRegions.push_back({
+                /* bufferCopyRegion.bufferOffset */ pixelsOffset,
+                /* bufferCopyRegion.bufferRowLength */ 0,
+                /* bufferCopyRegion.bufferImageHeight */ 0,
+                {
+                    /* bufferCopyRegion.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                    /* bufferCopyRegion.imageSubresource.mipLevel */ mipLevel,
+                    /* bufferCopyRegion.imageSubresource.baseArrayLayer */ layerNb,
+                    /* bufferCopyRegion.imageSubresource.layerCount */ 1
+                },
+                {
+                    /* bufferCopyRegion.imageOffset.x */ 0,
+                    /* bufferCopyRegion.imageOffset.y */ 0,
+                    /* bufferCopyRegion.imageOffset.z */ 0,
+                },
+                {
+                    /* bufferCopyRegion.imageExtent.width */ width,
+                    /* bufferCopyRegion.imageExtent.height */ height,
+                    /* bufferCopyRegion.imageExtent.depth */ 1
                 }
+            });
 
-                stagingBuffer.updateData(layer.data, layerSize, pixelsOffset);
-                pixelsOffset += layerSize;
-            }
+            pixelsOffset += Render::Texture::getImageSize(width, height, builder._format);
         }
+    }
 
+    if (!bufferCopyRegions.empty()) {
+        uploadBatch.addImage(texture->_image, builder._mipLevels, static_cast<uint32_t>(builder._layers.size()), std::move(bufferCopyRegions));
 
-        // Copy buffer data to font image
-        {
-            VkResult result{VK_SUCCESS};
-            API::CommandBuffer commandBuffer;
-
-            API::Builder::CommandBuffer commandBufferBuilder(device, transferQueueCommandPool);
-            commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-
-            if (!commandBufferBuilder.build(commandBuffer, &result)) {
-                LUG_LOG.error("Gui::init: Can't create the command buffer: {}", result);
-                return nullptr;
-            }
-
-            // Create fence
-            API::Fence fence;
-            {
-                API::Builder::Fence fenceBuilder(device);
-
-                if (!fenceBuilder.build(fence, &result)) {
-                    LUG_LOG.error("Vulkan::Texture::build: Can't create swapchain fence: {}", result);
-                    return nullptr;
-                }
-            }
-
-            commandBuffer.begin();
-
-            // Prepare for transfer
-            {
-                API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
-                pipelineBarrier.imageMemoryBarriers.resize(1);
-                pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = 0;
-                pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-                pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].image = &texture->_image;
-                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = static_cast<uint32_t>(builder._layers.size());
-
-                commandBuffer.pipelineBarrier(pipelineBarrier);
-            }
-
-            std::vector<VkBufferImageCopy> bufferCopyRegions(nbLayersWithData);
-            VkDeviceSize pixelsOffset{0};
-            uint32_t i = 0;
-            for (uint32_t layerNb = 0; layerNb < builder._layers.size(); ++layerNb) {
-                if (!builder._layers[layerNb].data) {
-                    continue;
-                }
-
-                // Copy
-                bufferCopyRegions[i++] = {
-                    /* bufferCopyRegion.bufferOffset */ pixelsOffset,
-                    /* bufferCopyRegion.bufferRowLength */ 0,
-                    /* bufferCopyRegion.bufferImageHeight */ 0,
-                    {
-                        /* bufferCopyRegion.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
-                        /* bufferCopyRegion.imageSubresource.mipLevel */ 0,
-                        /* bufferCopyRegion.imageSubresource.baseArrayLayer */ layerNb,
-                        /* bufferCopyRegion.imageSubresource.layerCount */ 1
-                    },
-                    {
-                        /* bufferCopyRegion.imageOffset.x */ 0,
-                        /* bufferCopyRegion.imageOffset.y */ 0,
-                        /* bufferCopyRegion.imageOffset.z */ 0,
-                    },
-                    {
-                        /* bufferCopyRegion.imageExtent.width */ static_cast<uint32_t>(builder._width),
-                        /* bufferCopyRegion.imageExtent.height */ static_cast<uint32_t>(builder._height),
-                        /* bufferCopyRegion.imageExtent.depth */ 1
-                    }
-                };
-
-                pixelsOffset += layerSize;
-            }
-
-
-            // TODO write this function commandBuffer.copyBufferToImage();
-
-            vkCmdCopyBufferToImage(
-                static_cast<VkCommandBuffer>(commandBuffer),
-                static_cast<VkBuffer>(stagingBuffer),
-                static_cast<VkImage>(texture->_image),
-                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                static_cast<uint32_t>(bufferCopyRegions.size()),
-                bufferCopyRegions.data()
-            );
-
-            // Prepare for shader read
-            {
-                API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
-                pipelineBarrier.imageMemoryBarriers.resize(1);
-                pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].image = &texture->_image;
-                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = static_cast<uint32_t>(builder._layers.size());
-
-                commandBuffer.pipelineBarrier(pipelineBarrier);
-            }
-
-            if (commandBuffer.end() == false) {
-                LUG_LOG.error("Vulkan::Texture::build: Failed to end commandBuffer");
-                return nullptr;
-            }
-
-            if (transferQueue->submit(commandBuffer, {}, {}, {}, static_cast<VkFence>(fence)) == false) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't submit commandBuffer");
+        if (!builder._uploadBatch) {
+            if (!uploadBatch.submit(device, *transferQueue)) {
+                LUG_LOG.error("Vulkan::Texture::build: Can't submit the upload of the texture");
                 return nullptr;
             }
 
-            // TODO(saveman71): set a define for the fence timeout
-            if (!fence.wait()) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't vkWaitForFences");
+            if (!uploadBatch.wait()) {
+                LUG_LOG.error("Vulkan::Texture::build: Can't wait for the upload of the texture");
                 return nullptr;
             }
-
-            // Properly destroy everything in the right order
-            fence.destroy();
-            stagingBufferMemory.destroy();
-            stagingBuffer.destroy();
-            commandBuffer.destroy();
         }
     }
 
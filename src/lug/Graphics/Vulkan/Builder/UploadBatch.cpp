@@ -0,0 +1,39 @@
+#include <lug/Graphics/Vulkan/Builder/UploadBatch.hpp>
+
+#include <lug/Graphics/Builder/UploadBatch.hpp>
+#include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Builder {
+namespace UploadBatch {
+
+void init(::lug::Graphics::Builder::UploadBatch& builder) {
+    builder._vulkanUploadBatch = std::make_unique<Render::UploadBatch>();
+}
+
+bool submit(::lug::Graphics::Builder::UploadBatch& builder) {
+    Vulkan::Renderer& renderer = static_cast<Vulkan::Renderer&>(builder._renderer);
+    const API::Device& device = renderer.getDevice();
+
+    const API::Queue* transferQueue = device.getQueue("queue_transfer");
+    if (!transferQueue) {
+        LUG_LOG.error("Vulkan::UploadBatch::submit: Can't find transfer queue");
+        return false;
+    }
+
+    return builder._vulkanUploadBatch->submit(device, *transferQueue);
+}
+
+bool wait(::lug::Graphics::Builder::UploadBatch& builder) {
+    return builder._vulkanUploadBatch->wait();
+}
+
+} // UploadBatch
+} // Builder
+} // Vulkan
+} // Graphics
+} // lug
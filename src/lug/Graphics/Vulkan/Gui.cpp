@@ -15,9 +15,11 @@
 #include <lug/Graphics/Vulkan/API/Builder/Sampler.hpp>
 #include <lug/Graphics/Builder/Texture.hpp>
 #include <lug/Graphics/Vulkan/Render/Texture.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/GuiTexture.hpp>
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -98,6 +100,8 @@ bool Gui::init(const std::vector<API::ImageView>& imageViews) {
         }
     }
 
+    _gpuProfilerScope = _window.getGpuProfiler().addScope("GUI");
+
     API::Builder::CommandBuffer commandBufferBuilder(_renderer.getDevice(), _graphicQueueCommandPool);
     commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
@@ -422,13 +426,24 @@ io.MouseDown[0] = _window._touchScreenState.drag && _window._touchScreenState.st
 }
 
 bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t currentImageIndex) {
+    LUG_PROFILE_SCOPE("Gui::endFrame");
+
+    if (_renderer.getPreferences().profiling.overlay) {
+        drawGpuProfilerOverlay();
+    }
+
     ImGui::Render();
     FrameData& frameData = _framesData[currentImageIndex];
 
-    if (!frameData.fence.wait()) {
-        return false;
+    {
+        LUG_PROFILE_SCOPE("Gui::waitFence");
+
+        if (!frameData.fence.wait()) {
+            return false;
+        }
+        frameData.fence.reset();
     }
-    frameData.fence.reset();
+
     if (updateBuffers(currentImageIndex) == false) {
         LUG_LOG.error("Gui::endFrame: Failed to update buffers");
         return false;
@@ -466,6 +481,9 @@ bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t curr
     beginRenderPass.renderArea.offset = { 0, 0 };
     beginRenderPass.renderArea.extent = { _window.getWidth(), _window.getHeight() };
 
+    const Render::GpuProfiler& gpuProfiler = _window.getGpuProfiler();
+    gpuProfiler.begin(frameData.commandBuffer, _gpuProfilerScope, currentImageIndex, true);
+
     frameData.commandBuffer.beginRenderPass(*renderPass, beginRenderPass);
 
     frameData.commandBuffer.bindPipeline(_pipeline);
@@ -568,6 +586,9 @@ bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t curr
     }
 
     frameData.commandBuffer.endRenderPass();
+
+    gpuProfiler.end(frameData.commandBuffer, _gpuProfilerScope, currentImageIndex, true);
+
     frameData.commandBuffer.end();
 
     std::vector<VkPipelineStageFlags> waitDstStageMasks(waitSemaphores.size(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
@@ -579,6 +600,52 @@ bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t curr
     return true;
 }
 
+void Gui::drawGpuProfilerOverlay() const {
+    const Render::GpuProfiler& gpuProfiler = _window.getGpuProfiler();
+
+    if (!gpuProfiler.isEnabled()) {
+        return;
+    }
+
+    const auto& pipelineStatisticsNames = Render::GpuProfiler::getPipelineStatisticsNames();
+
+    ImGui::Begin("GPU profiler", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+    ImGui::Text("%-12s %8s %8s %8s %8s %8s", "(ms)", "avg", "p50", "p90", "p99", "max");
+    ImGui::Separator();
+
+    for (uint32_t scope = 0; scope < gpuProfiler.getScopesCount(); ++scope) {
+        const Render::GpuProfiler::Statistics statistics = gpuProfiler.getStatistics(scope);
+
+        ImGui::Text(
+            "%-12s %8.3f %8.3f %8.3f %8.3f %8.3f",
+            gpuProfiler.getScopeName(scope).c_str(),
+            statistics.average,
+            statistics.p50,
+            statistics.p90,
+            statistics.p99,
+            statistics.max
+        );
+
+        const auto& pipelineStatistics = gpuProfiler.getPipelineStatistics(scope);
+        for (size_t i = 0; i < pipelineStatistics.size() && i < pipelineStatisticsNames.size(); ++i) {
+            ImGui::Text("    %s: %llu", pipelineStatisticsNames[i].c_str(), static_cast<unsigned long long>(pipelineStatistics[i]));
+        }
+    }
+
+    const auto& descriptorSetStatistics = Render::DescriptorSetPool::DescriptorSetPool::getStatistics();
+
+    ImGui::Separator();
+    ImGui::Text(
+        "Descriptor sets: %u allocated, %u hits, %u misses, %u pools",
+        descriptorSetStatistics.allocations,
+        descriptorSetStatistics.cacheHits,
+        descriptorSetStatistics.cacheMisses,
+        descriptorSetStatistics.poolsCount
+    );
+
+    ImGui::End();
+}
+
 bool Gui::processEvent(const lug::Window::Event event) {
     ImGuiIO& io = ImGui::GetIO();
 
@@ -1,5 +1,7 @@
 #include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/ComputePipeline.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/GraphicsPipeline.hpp>
@@ -16,6 +18,7 @@
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/BloomSampler.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -53,6 +56,25 @@ bool BloomPass::init() {
         }
     }
 
+    // Get the bloom technique, the mip chain is dispatched on the graphics queue
+    {
+        _technique = _renderer.getBloomTechnique();
+
+        if (_technique == ::lug::Graphics::Renderer::BloomTechnique::MipChain && !(_graphicsQueue->getQueueFamily()->getFlags() & VK_QUEUE_COMPUTE_BIT)) {
+            LUG_LOG.warn("BloomPass::init: The graphics queue doesn't support compute, fallback to the blur technique");
+            _technique = ::lug::Graphics::Renderer::BloomTechnique::Blur;
+        }
+    }
+
+    // Profiling scopes
+    {
+        GpuProfiler& gpuProfiler = _window.getGpuProfiler();
+
+        _blurScope = gpuProfiler.addScope(_technique == ::lug::Graphics::Renderer::BloomTechnique::MipChain ? "Bloom mip chain" : "Bloom blur");
+        _blendScope = gpuProfiler.addScope("Bloom blend");
+        _hdrScope = gpuProfiler.addScope("HDR");
+    }
+
     // Create command pools
     {
         // Transfer
@@ -151,6 +173,8 @@ bool BloomPass::init() {
 void BloomPass::destroy() {
     _horizontalPipeline.destroy();
     _verticalPipeline.destroy();
+    _downsamplePipeline.destroy();
+    _upsamplePipeline.destroy();
 
     for (const auto& frameData: _framesData) {
         for (const auto& descriptorSet : frameData.texturesDescriptorSets) {
@@ -160,6 +184,8 @@ void BloomPass::destroy() {
 
     _framesData.clear();
 
+    _mipChainDescriptorPool.destroy();
+
     _texturesDescriptorSetPool.reset();
 
     _transferQueueCommandPool.destroy();
@@ -203,16 +229,25 @@ bool BloomPass::renderHdr(
         const std::vector<VkSemaphore>& waitSemaphores,
         uint32_t currentImageIndex
 ) {
+    LUG_PROFILE_SCOPE("BloomPass::renderHdr");
+
     FrameData& frameData = _framesData[currentImageIndex];
 
-    if (!frameData.hdrPass.fence.wait()) {
-        return false;
+    {
+        LUG_PROFILE_SCOPE("BloomPass::waitFence");
+
+        if (!frameData.hdrPass.fence.wait()) {
+            return false;
+        }
+        frameData.hdrPass.fence.reset();
     }
-    frameData.hdrPass.fence.reset();
 
     frameData.hdrCmdBuffer.reset();
     frameData.hdrCmdBuffer.begin();
 
+    const GpuProfiler& gpuProfiler = _window.getGpuProfiler();
+    gpuProfiler.begin(frameData.hdrCmdBuffer, _hdrScope, currentImageIndex, true);
+
     // Temporary array of descriptor sets use to render this frame
     // they will replace frameData.texturesDescriptorSets atfer the rendering
     std::vector<const Render::DescriptorSetPool::DescriptorSet*> texturesDescriptorSets;
@@ -299,6 +334,8 @@ bool BloomPass::renderHdr(
     frameData.hdrCmdBuffer.draw(cmdDraw);
     frameData.hdrCmdBuffer.endRenderPass();
 
+    gpuProfiler.end(frameData.hdrCmdBuffer, _hdrScope, currentImageIndex, true);
+
     frameData.hdrCmdBuffer.end();
 
     // Free and replace previous texturesDescriptorSets
@@ -328,12 +365,18 @@ const Vulkan::API::Semaphore& BloomPass::getHdrSemaphore(uint32_t currentImageIn
 }
 
 bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
+    LUG_PROFILE_SCOPE("BloomPass::renderBlurPass");
+
     FrameData& frameData = _framesData[currentImageIndex];
 
-    if (!frameData.fence.wait()) {
-        return false;
+    {
+        LUG_PROFILE_SCOPE("BloomPass::waitFence");
+
+        if (!frameData.fence.wait()) {
+            return false;
+        }
+        frameData.fence.reset();
     }
-    frameData.fence.reset();
 
     if (frameData.freeDescriptorSets) {
         for (const auto& descriptorSet : frameData.texturesDescriptorSets) {
@@ -350,7 +393,10 @@ bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
     // they will replace frameData.texturesDescriptorSets atfer the rendering
     std::vector<const Render::DescriptorSetPool::DescriptorSet*> texturesDescriptorSets;
 
+    const GpuProfiler& gpuProfiler = _window.getGpuProfiler();
+
     // Blur passes
+    gpuProfiler.begin(frameData.graphicsCmdBuffer, _blurScope, currentImageIndex, true);
     {
         for (auto& blurPass: frameData.blurPasses) {
             // Set viewport/scissor
@@ -544,6 +590,12 @@ bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
         }
     }
 
+    if (!_mipChainExtents.empty()) {
+        renderMipChain(frameData);
+    }
+
+    gpuProfiler.end(frameData.graphicsCmdBuffer, _blurScope, currentImageIndex, true);
+
     // Change images layout for blend pass
     {
 
@@ -588,6 +640,7 @@ bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
     }
 
     // Blend pass
+    gpuProfiler.begin(frameData.graphicsCmdBuffer, _blendScope, currentImageIndex, true);
     {
         const API::RenderPass* renderPass = _blendPipeline.getRenderPass();
 
@@ -685,9 +738,51 @@ bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
             }
         }
 
+        // Draw the level 0 of the mip chain, which contains all the levels
+        if (!_mipChainExtents.empty()) {
+            // Get the new (or old) textures descriptor set
+            const Render::DescriptorSetPool::DescriptorSet* texturesDescriptorSet = _texturesDescriptorSetPool->allocate(
+                _blendPipeline,
+                frameData.mipChain.image,
+                frameData.mipChain.imagesViews[0],
+                frameData.mipChain.sampler
+            );
+
+            if (!texturesDescriptorSet) {
+                LUG_LOG.error("BloomPass::renderBlurPass: Can't allocate textures descriptor set");
+                return false;
+            }
+
+            texturesDescriptorSets.push_back(texturesDescriptorSet);
+
+            // Bind descriptor set of the texture
+            {
+                const API::CommandBuffer::CmdBindDescriptors texturesBind{
+                    /* texturesBind.pipelineLayout     */ *_blendPipeline.getLayout(),
+                    /* texturesBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    /* texturesBind.firstSet           */ 0,
+                    /* texturesBind.descriptorSets     */ {&texturesDescriptorSet->getDescriptorSet()},
+                    /* texturesBind.dynamicOffsets     */ {}
+                };
+
+                frameData.graphicsCmdBuffer.bindDescriptorSets(texturesBind);
+            }
+
+            const API::CommandBuffer::CmdDraw cmdDraw {
+                /* cmdDraw.vertexCount */ 3,
+                /* cmdDraw.instanceCount */ 1,
+                /* cmdDraw.firstVertex */ 0,
+                /* cmdDraw.firstInstance */ 0
+            };
+
+            frameData.graphicsCmdBuffer.draw(cmdDraw);
+        }
+
         frameData.graphicsCmdBuffer.endRenderPass();
     }
 
+    gpuProfiler.end(frameData.graphicsCmdBuffer, _blendScope, currentImageIndex, true);
+
     // Change images layout for hdr pass
     {
         // Prepare blend image for read in shader
@@ -724,6 +819,130 @@ bool BloomPass::renderBlurPass(uint32_t currentImageIndex) {
     return renderHdr(frameData.blendPass.image, frameData.blendPass.imageView, { static_cast<VkSemaphore>(frameData.hdrPass.hdrFinishedSemaphore) }, { static_cast<VkSemaphore>(frameData.blurFinishedSemaphore) }, currentImageIndex);
 }
 
+void BloomPass::renderMipChain(FrameData& frameData) {
+    API::CommandBuffer& cmdBuffer = frameData.graphicsCmdBuffer;
+    MipChain& mipChain = frameData.mipChain;
+
+    const uint32_t levelsCount = static_cast<uint32_t>(_mipChainExtents.size());
+
+    // Make the writes of a level visible to the next dispatch
+    const auto levelBarrier = [&cmdBuffer, &mipChain](uint32_t level) {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
+        pipelineBarrier.imageMemoryBarriers.resize(1);
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.imageMemoryBarriers[0].image = &mipChain.image;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.baseMipLevel = level;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    };
+
+    const auto dispatch = [&cmdBuffer](const ::lug::Graphics::Render::Bloom::Extent& extent) {
+        // The shaders have a local size of 8x8
+        const API::CommandBuffer::CmdDispatch cmdDispatch{
+            /* cmdDispatch.groupCountX */ (extent.width + 7) / 8,
+            /* cmdDispatch.groupCountY */ (extent.height + 7) / 8,
+            /* cmdDispatch.groupCountZ */ 1
+        };
+
+        cmdBuffer.dispatch(cmdDispatch);
+    };
+
+    // The content of the previous frame is discarded
+    {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
+        pipelineBarrier.imageMemoryBarriers.resize(1);
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.imageMemoryBarriers[0].image = &mipChain.image;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.levelCount = levelsCount;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    }
+
+    // Downsample, only the first level applies the threshold
+    cmdBuffer.bindPipeline(_downsamplePipeline);
+    for (uint32_t level = 0; level < levelsCount; ++level) {
+        const API::CommandBuffer::CmdBindDescriptors descriptorsBind{
+            /* descriptorsBind.pipelineLayout     */ *_downsamplePipeline.getLayout(),
+            /* descriptorsBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_COMPUTE,
+            /* descriptorsBind.firstSet           */ 0,
+            /* descriptorsBind.descriptorSets     */ {&mipChain.downsampleDescriptorSets[level]},
+            /* descriptorsBind.dynamicOffsets     */ {}
+        };
+
+        cmdBuffer.bindDescriptorSets(descriptorsBind);
+
+        const float threshold[2]{
+            level == 0 ? _renderer.getBlurThreshold() : -1.0f,
+            ::lug::Graphics::Render::Bloom::defaultKnee
+        };
+
+        const API::CommandBuffer::CmdPushConstants cmdPushConstants{
+            /* cmdPushConstants.layout */ static_cast<VkPipelineLayout>(*_downsamplePipeline.getLayout()),
+            /* cmdPushConstants.stageFlags */ VK_SHADER_STAGE_COMPUTE_BIT,
+            /* cmdPushConstants.offset */ 0,
+            /* cmdPushConstants.size */ sizeof(threshold),
+            /* cmdPushConstants.values */ threshold
+        };
+
+        cmdBuffer.pushConstants(cmdPushConstants);
+
+        dispatch(_mipChainExtents[level]);
+        levelBarrier(level);
+    }
+
+    // Upsample from the smallest level, each level is added to the previous one
+    cmdBuffer.bindPipeline(_upsamplePipeline);
+    for (uint32_t level = levelsCount - 1; level > 0; --level) {
+        const API::CommandBuffer::CmdBindDescriptors descriptorsBind{
+            /* descriptorsBind.pipelineLayout     */ *_upsamplePipeline.getLayout(),
+            /* descriptorsBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_COMPUTE,
+            /* descriptorsBind.firstSet           */ 0,
+            /* descriptorsBind.descriptorSets     */ {&mipChain.upsampleDescriptorSets[level - 1]},
+            /* descriptorsBind.dynamicOffsets     */ {}
+        };
+
+        cmdBuffer.bindDescriptorSets(descriptorsBind);
+
+        const float radius = ::lug::Graphics::Render::Bloom::defaultRadius;
+
+        const API::CommandBuffer::CmdPushConstants cmdPushConstants{
+            /* cmdPushConstants.layout */ static_cast<VkPipelineLayout>(*_upsamplePipeline.getLayout()),
+            /* cmdPushConstants.stageFlags */ VK_SHADER_STAGE_COMPUTE_BIT,
+            /* cmdPushConstants.offset */ 0,
+            /* cmdPushConstants.size */ sizeof(radius),
+            /* cmdPushConstants.values */ &radius
+        };
+
+        cmdBuffer.pushConstants(cmdPushConstants);
+
+        dispatch(_mipChainExtents[level - 1]);
+
+        // The level 0 is transitioned below for the blend pass
+        if (level > 1) {
+            levelBarrier(level - 1);
+        }
+    }
+
+    // Prepare the level 0 for read in the blend pass
+    {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
+        pipelineBarrier.imageMemoryBarriers.resize(1);
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].image = &mipChain.image;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+    }
+}
+
 bool BloomPass::initHdrPipeline() {
  API::Device &device = _renderer.getDevice();
 
@@ -1181,7 +1400,90 @@ bool BloomPass::initBlurPipeline(API::GraphicsPipeline& pipeline, int blurDirect
     return true;
 }
 
+bool BloomPass::initMipChainPipeline(API::ComputePipeline& pipeline, const std::string& shaderFile, uint32_t pushConstantsSize) {
+    API::Device& device = _renderer.getDevice();
+
+    API::Builder::ComputePipeline computePipelineBuilder(device);
+
+    if (!computePipelineBuilder.setShaderFromFile("main", _renderer.getInfo().shadersRoot + shaderFile)) {
+        LUG_LOG.error("BloomPass::initMipChainPipeline: Can't create pipeline's shader.");
+        return false;
+    }
+
+    std::vector<Vulkan::API::DescriptorSetLayout> descriptorSetLayouts;
+    {
+        // descriptorSetLayout
+        {
+            API::Builder::DescriptorSetLayout descriptorSetLayoutBuilder(device);
+
+            // Source level
+            const VkDescriptorSetLayoutBinding sourceBinding{
+                /* sourceBinding.binding */ 0,
+                /* sourceBinding.descriptorType */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                /* sourceBinding.descriptorCount */ 1,
+                /* sourceBinding.stageFlags */ VK_SHADER_STAGE_COMPUTE_BIT,
+                /* sourceBinding.pImmutableSamplers */ nullptr
+            };
+
+            // Destination level
+            const VkDescriptorSetLayoutBinding destinationBinding{
+                /* destinationBinding.binding */ 1,
+                /* destinationBinding.descriptorType */ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                /* destinationBinding.descriptorCount */ 1,
+                /* destinationBinding.stageFlags */ VK_SHADER_STAGE_COMPUTE_BIT,
+                /* destinationBinding.pImmutableSamplers */ nullptr
+            };
+
+            descriptorSetLayoutBuilder.setBindings({ sourceBinding, destinationBinding });
+
+            // create descriptor set
+            VkResult result{VK_SUCCESS};
+            descriptorSetLayouts.resize(1);
+            if (!descriptorSetLayoutBuilder.build(descriptorSetLayouts[0], &result)) {
+                LUG_LOG.error("BloomPass::initMipChainPipeline: Can't create pipeline descriptor: {}", result);
+                return false;
+            }
+        }
+
+        const VkPushConstantRange pushConstant{
+            /* pushConstant.stageFlags */ VK_SHADER_STAGE_COMPUTE_BIT,
+            /* pushConstant.offset */ 0,
+            /* pushConstant.size */ pushConstantsSize
+        };
+
+        API::Builder::PipelineLayout pipelineLayoutBuilder(device);
+
+        pipelineLayoutBuilder.setPushConstants({pushConstant});
+        pipelineLayoutBuilder.setDescriptorSetLayouts(std::move(descriptorSetLayouts));
+
+        API::PipelineLayout pipelineLayout;
+        VkResult result{VK_SUCCESS};
+        if (!pipelineLayoutBuilder.build(pipelineLayout, &result)) {
+            LUG_LOG.error("BloomPass::initMipChainPipeline: Can't create pipeline layout: {}", result);
+            return false;
+        }
+        computePipelineBuilder.setPipelineLayout(std::move(pipelineLayout));
+    }
+
+    // Create pipeline
+    {
+        VkResult result{VK_SUCCESS};
+        if (!computePipelineBuilder.build(pipeline, &result)) {
+            LUG_LOG.error("BloomPass::initMipChainPipeline: Can't create pipeline: {}", result);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool BloomPass::initPipelines() {
+    if (_technique == ::lug::Graphics::Renderer::BloomTechnique::MipChain) {
+        return initMipChainPipeline(_downsamplePipeline, "bloom-downsample.comp.spv", 2 * sizeof(float)) &&
+            initMipChainPipeline(_upsamplePipeline, "bloom-upsample.comp.spv", sizeof(float)) &&
+            initBlendPipeline() && initHdrPipeline();
+    }
+
     return initBlurPipeline(_horizontalPipeline, 1) && initBlurPipeline(_verticalPipeline, 0) && initBlendPipeline() && initHdrPipeline();
 }
 
@@ -1205,6 +1507,20 @@ bool BloomPass::initBlurPass() {
         frameData.freeDescriptorSets = true;
     }
 
+    // The mip chain starts at half the size of the glow image
+    _mipChainExtents.clear();
+    if (_technique == ::lug::Graphics::Renderer::BloomTechnique::MipChain) {
+        _mipChainExtents = ::lug::Graphics::Render::Bloom::computeMipChain(
+            _forward.getGlowOffscreenImage(0).getExtent().width,
+            _forward.getGlowOffscreenImage(0).getExtent().height,
+            ::lug::Graphics::Render::Bloom::defaultMipLevelsCount
+        );
+
+        if (_mipChainExtents.empty()) {
+            LUG_LOG.warn("BloomPass::initBlurPass: The window is too small for the bloom mip chain");
+        }
+    }
+
     // Create images
     {
         const VkSampleCountFlagBits nbSamples = VK_SAMPLE_COUNT_1_BIT;
@@ -1221,7 +1537,7 @@ bool BloomPass::initBlurPass() {
         for (uint8_t i = 0; i < frameDataSize; ++i) {
 
             // Blur images
-            {
+            if (_technique == ::lug::Graphics::Renderer::BloomTechnique::Blur) {
                 _framesData[i].blurPasses.resize(2);
                 // 0
                 {
@@ -1258,6 +1574,31 @@ bool BloomPass::initBlurPass() {
                 }
             }
 
+            // Mip chain image
+            if (!_mipChainExtents.empty()) {
+                API::Builder::Image mipChainImageBuilder(device);
+
+                mipChainImageBuilder.setUsage(VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+                mipChainImageBuilder.setPreferedFormats({VK_FORMAT_R16G16B16A16_SFLOAT});
+                mipChainImageBuilder.setFeatureFlags(VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT);
+                mipChainImageBuilder.setQueueFamilyIndices({ _graphicsQueue->getQueueFamily()->getIdx() });
+                mipChainImageBuilder.setTiling(VK_IMAGE_TILING_OPTIMAL);
+                mipChainImageBuilder.setMipLevels(static_cast<uint32_t>(_mipChainExtents.size()));
+
+                VkExtent3D extent{
+                    /* extent.width */ _mipChainExtents[0].width,
+                    /* extent.height */ _mipChainExtents[0].height,
+                    /* extent.depth */ 1
+                };
+                mipChainImageBuilder.setExtent(extent);
+
+                VkResult result{VK_SUCCESS};
+                if (!mipChainImageBuilder.build(_framesData[i].mipChain.image, &result)) {
+                    LUG_LOG.error("BloomPass::initBlurPass: Can't create mip chain image: {}", result);
+                    return false;
+                }
+            }
+
             // Blend image
             {
                 VkExtent3D extent{
@@ -1288,6 +1629,11 @@ bool BloomPass::initBlurPass() {
                         return false;
                     }
                 }
+
+                if (!_mipChainExtents.empty() && !deviceMemoryBuilder.addImage(_framesData[i].mipChain.image)) {
+                    LUG_LOG.error("BloomPass::initBlurPass: Can't add mip chain image to device memory");
+                    return false;
+                }
             }
 
             // Change images layout
@@ -1368,6 +1714,25 @@ bool BloomPass::initBlurPass() {
                 }
             }
 
+            // Mip chain image views, one per level
+            {
+                MipChain& mipChain = _framesData[i].mipChain;
+
+                mipChain.imagesViews.resize(_mipChainExtents.size());
+                for (uint32_t level = 0; level < _mipChainExtents.size(); ++level) {
+                    VkResult result{VK_SUCCESS};
+                    API::Builder::ImageView imageViewBuilder(device, mipChain.image);
+
+                    imageViewBuilder.setFormat(mipChain.image.getFormat());
+                    imageViewBuilder.setBaseMipLevel(level);
+
+                    if (!imageViewBuilder.build(mipChain.imagesViews[level], &result)) {
+                        LUG_LOG.error("BloomPass::initBlurPass: Can't create mip chain image view: {}", result);
+                        return false;
+                    }
+                }
+            }
+
             // Blend image view
             {
                 VkResult result{VK_SUCCESS};
@@ -1415,6 +1780,15 @@ bool BloomPass::initBlurPass() {
                 }
             }
 
+            // Mip chain sampler
+            if (!_mipChainExtents.empty()) {
+                VkResult result{VK_SUCCESS};
+                if (!samplerBuilder.build(_framesData[i].mipChain.sampler, &result)) {
+                    LUG_LOG.error("BloomPass::initBlurPass: Can't create mip chain sampler: {}", result);
+                    return false;
+                }
+            }
+
             // Blend sampler
             {
                 VkResult result{VK_SUCCESS};
@@ -1539,11 +1913,145 @@ bool BloomPass::initBlurPass() {
         return false;
     }
 
+    return initMipChainDescriptorSets();
+}
+
+bool BloomPass::initMipChainDescriptorSets() {
+    API::Device& device = _renderer.getDevice();
+
+    // The descriptor sets of the previous size are freed with their pool
+    for (auto& frameData: _framesData) {
+        frameData.mipChain.downsampleDescriptorSets.clear();
+        frameData.mipChain.upsampleDescriptorSets.clear();
+    }
+
+    _mipChainDescriptorPool.destroy();
+
+    if (_mipChainExtents.empty()) {
+        return true;
+    }
+
+    const uint32_t levelsCount = static_cast<uint32_t>(_mipChainExtents.size());
+    const uint32_t descriptorSetsCount = static_cast<uint32_t>(_framesData.size()) * levelsCount * 2;
+
+    // Descriptor pool
+    {
+        API::Builder::DescriptorPool descriptorPoolBuilder(device);
+
+        descriptorPoolBuilder.setFlags(0);
+        descriptorPoolBuilder.setMaxSets(descriptorSetsCount);
+
+        std::vector<VkDescriptorPoolSize> poolSizes{
+            {
+                /* poolSize.type            */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                /* poolSize.descriptorCount */ descriptorSetsCount
+            },
+            {
+                /* poolSize.type            */ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                /* poolSize.descriptorCount */ descriptorSetsCount
+            }
+        };
+        descriptorPoolBuilder.setPoolSizes(poolSizes);
+
+        VkResult result{VK_SUCCESS};
+        if (!descriptorPoolBuilder.build(_mipChainDescriptorPool, &result)) {
+            LUG_LOG.error("BloomPass::initMipChainDescriptorSets: Can't create the descriptor pool: {}", result);
+            return false;
+        }
+    }
+
+    API::Builder::DescriptorSet downsampleDescriptorSetBuilder(device, _mipChainDescriptorPool);
+    downsampleDescriptorSetBuilder.setDescriptorSetLayouts({static_cast<VkDescriptorSetLayout>(_downsamplePipeline.getLayout()->getDescriptorSetLayouts()[0])});
+
+    API::Builder::DescriptorSet upsampleDescriptorSetBuilder(device, _mipChainDescriptorPool);
+    upsampleDescriptorSetBuilder.setDescriptorSetLayouts({static_cast<VkDescriptorSetLayout>(_upsamplePipeline.getLayout()->getDescriptorSetLayouts()[0])});
+
+    for (uint32_t i = 0; i < _framesData.size(); ++i) {
+        MipChain& mipChain = _framesData[i].mipChain;
+
+        // Downsample: the level 0 reads the glow image, the others read the previous level
+        mipChain.downsampleDescriptorSets.resize(levelsCount);
+        for (uint32_t level = 0; level < levelsCount; ++level) {
+            API::DescriptorSet& descriptorSet = mipChain.downsampleDescriptorSets[level];
+
+            VkResult result{VK_SUCCESS};
+            if (!downsampleDescriptorSetBuilder.build(descriptorSet, &result)) {
+                LUG_LOG.error("BloomPass::initMipChainDescriptorSets: Can't create descriptor set: {}", result);
+                return false;
+            }
+
+            descriptorSet.updateImages(
+                0,
+                0,
+                VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                {
+                    {
+                        /* sampler       */ static_cast<VkSampler>(mipChain.sampler),
+                        /* imageView     */ static_cast<VkImageView>(level == 0 ? _forward.getGlowOffscreenImageView(i) : mipChain.imagesViews[level - 1]),
+                        /* imageLayout   */ level == 0 ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL
+                    }
+                }
+            );
+
+            descriptorSet.updateImages(
+                1,
+                0,
+                VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                {
+                    {
+                        /* sampler       */ VK_NULL_HANDLE,
+                        /* imageView     */ static_cast<VkImageView>(mipChain.imagesViews[level]),
+                        /* imageLayout   */ VK_IMAGE_LAYOUT_GENERAL
+                    }
+                }
+            );
+        }
+
+        // Upsample: each level but the last one adds the next level
+        mipChain.upsampleDescriptorSets.resize(levelsCount - 1);
+        for (uint32_t level = 0; level < levelsCount - 1; ++level) {
+            API::DescriptorSet& descriptorSet = mipChain.upsampleDescriptorSets[level];
+
+            VkResult result{VK_SUCCESS};
+            if (!upsampleDescriptorSetBuilder.build(descriptorSet, &result)) {
+                LUG_LOG.error("BloomPass::initMipChainDescriptorSets: Can't create descriptor set: {}", result);
+                return false;
+            }
+
+            descriptorSet.updateImages(
+                0,
+                0,
+                VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                {
+                    {
+                        /* sampler       */ static_cast<VkSampler>(mipChain.sampler),
+                        /* imageView     */ static_cast<VkImageView>(mipChain.imagesViews[level + 1]),
+                        /* imageLayout   */ VK_IMAGE_LAYOUT_GENERAL
+                    }
+                }
+            );
+
+            descriptorSet.updateImages(
+                1,
+                0,
+                VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                {
+                    {
+                        /* sampler       */ VK_NULL_HANDLE,
+                        /* imageView     */ static_cast<VkImageView>(mipChain.imagesViews[level]),
+                        /* imageLayout   */ VK_IMAGE_LAYOUT_GENERAL
+                    }
+                }
+            );
+        }
+    }
+
     return true;
 }
 
 bool BloomPass::buildEndCommandBuffer() {
     uint32_t frameDataSize = (uint32_t)_window.getSwapchain().getImages().size();
+    const bool mipChain = _technique == ::lug::Graphics::Renderer::BloomTechnique::MipChain;
 
     for (uint32_t i = 0; i < frameDataSize; ++i) {
 
@@ -1557,14 +2065,14 @@ bool BloomPass::buildEndCommandBuffer() {
                 return false;
             }
 
-            // Prepare glow image for copying
+            // Prepare glow image for copying (blur) or for read in the downsample shader (mip chain)
             {
                 API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
                 pipelineBarrier.imageMemoryBarriers.resize(1);
                 pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-                pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = mipChain ? VK_ACCESS_SHADER_READ_BIT : VK_ACCESS_TRANSFER_READ_BIT;
                 pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                pipelineBarrier.imageMemoryBarriers[0].newLayout = mipChain ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
                 pipelineBarrier.imageMemoryBarriers[0].image = &_forward.getGlowOffscreenImage(i);
 
                 cmdBuffer.pipelineBarrier(pipelineBarrier, VK_DEPENDENCY_BY_REGION_BIT);
@@ -1745,9 +2253,9 @@ bool BloomPass::buildEndCommandBuffer() {
             {
                 API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
                 pipelineBarrier.imageMemoryBarriers.resize(1);
-                pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = mipChain ? VK_ACCESS_SHADER_READ_BIT : VK_ACCESS_TRANSFER_READ_BIT;
                 pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-                pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                pipelineBarrier.imageMemoryBarriers[0].oldLayout = mipChain ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
                 pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
                 pipelineBarrier.imageMemoryBarriers[0].image = &_forward.getGlowOffscreenImage(i);
 
@@ -1,6 +1,5 @@
 #include <lug/Graphics/Vulkan/Render/BufferPool/Bloom.hpp>
 
-#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
 namespace lug {
@@ -14,11 +13,14 @@ Bloom::Bloom(Renderer& renderer) : BufferPool(renderer, {
     renderer.getDevice().getQueue("queue_transfer")->getQueueFamily()->getIdx()
 }) {}
 
-const SubBuffer* Bloom::allocate(const API::CommandBuffer& cmdBuffer, float blurThreshold, bool dirty) {
+const SubBuffer* Bloom::allocate(float blurThreshold, bool dirty) {
+    // Until the threshold is written
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = BufferPool::allocate(0, dirty);
 
     if (std::get<0>(result) && std::get<1>(result)) {
-        cmdBuffer.updateBuffer(*std::get<1>(result)->getBuffer(), &blurThreshold, sizeof(blurThreshold), std::get<1>(result)->getOffset());
+        std::get<1>(result)->update(&blurThreshold, sizeof(blurThreshold));
     }
 
     return std::get<1>(result);
@@ -1,6 +1,5 @@
 #include <lug/Graphics/Vulkan/Render/BufferPool/Camera.hpp>
 
-#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
 namespace lug {
@@ -14,7 +13,10 @@ Camera::Camera(Renderer& renderer) : BufferPool(renderer, {
     renderer.getDevice().getQueue("queue_transfer")->getQueueFamily()->getIdx()
 }) {}
 
-const SubBuffer* Camera::allocate(const API::CommandBuffer& cmdBuffer, ::lug::Graphics::Render::Camera::Camera& camera) {
+const SubBuffer* Camera::allocate(::lug::Graphics::Render::Camera::Camera& camera) {
+    // Until the matrices are written, see BufferPool::allocate()
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = BufferPool::allocate(camera.getHandle().value, camera.isDirty());
     camera.clearDirty();
 
@@ -25,7 +27,7 @@ const SubBuffer* Camera::allocate(const API::CommandBuffer& cmdBuffer, ::lug::Gr
             camera.getProjectionMatrix()
         };
 
-        cmdBuffer.updateBuffer(*std::get<1>(result)->getBuffer(), cameraData, sizeof(cameraData), std::get<1>(result)->getOffset());
+        std::get<1>(result)->update(cameraData, sizeof(cameraData));
     }
 
     return std::get<1>(result);
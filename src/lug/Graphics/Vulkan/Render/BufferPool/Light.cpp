@@ -1,7 +1,6 @@
 #include <lug/Graphics/Vulkan/Render/BufferPool/Light.hpp>
 
 #include <lug/Graphics/Scene/Node.hpp>
-#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
 namespace lug {
@@ -15,7 +14,10 @@ Light::Light(Renderer& renderer) : BufferPool(renderer, {
     renderer.getDevice().getQueue("queue_transfer")->getQueueFamily()->getIdx()
 }) {}
 
-const SubBuffer* Light::allocate(uint32_t currentFrame, const API::CommandBuffer& cmdBuffer, const std::vector<::lug::Graphics::Scene::Node*> nodes) {
+const SubBuffer* Light::allocate(uint32_t currentFrame, const std::vector<::lug::Graphics::Scene::Node*> nodes) {
+    // Until the lights are written
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     // Generate hash
     size_t hash = nodes.size() * 2;
     for (auto node : nodes) {
@@ -40,18 +42,11 @@ const SubBuffer* Light::allocate(uint32_t currentFrame, const API::CommandBuffer
             ::lug::Graphics::Render::Light::Data lightData;
             light->getData(lightData, *nodes[i]);
 
-            cmdBuffer.updateBuffer(
-                *std::get<1>(result)->getBuffer(),
-                &lightData, sizeof(lightData),
-                std::get<1>(result)->getOffset() + ::lug::Graphics::Render::Light::strideShader * i
-            );
+            std::get<1>(result)->update(&lightData, sizeof(lightData), ::lug::Graphics::Render::Light::strideShader * i);
         }
 
         const uint32_t lightsNb = static_cast<uint32_t>(nodes.size());
-        cmdBuffer.updateBuffer(
-            *std::get<1>(result)->getBuffer(),
-            &lightsNb, sizeof(uint32_t),
-            std::get<1>(result)->getOffset() + ::lug::Graphics::Render::Light::strideShader * 50);
+        std::get<1>(result)->update(&lightsNb, sizeof(uint32_t), ::lug::Graphics::Render::Light::strideShader * 50);
     }
 
     return std::get<1>(result);
@@ -18,6 +18,8 @@ const DescriptorSet* BloomSampler::allocate(
     const ::lug::Graphics::Vulkan::API::ImageView& imageView,
     const ::lug::Graphics::Vulkan::API::Sampler& sampler
 ) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkImage>(image)),
         pipeline.getLayout()->getDescriptorSetLayouts()[0]
@@ -12,6 +12,9 @@ namespace DescriptorSetPool {
 Camera::Camera(Renderer& renderer) : DescriptorSetPool(renderer) {}
 
 const DescriptorSet* Camera::allocate(const BufferPool::SubBuffer& cameraSubBuffer, const BufferPool::SubBuffer& bloomSubBuffer) {
+    // Until both buffers are written in the descriptor set, see DescriptorSetPool::allocate()
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkBuffer>(*cameraSubBuffer.getBuffer())) + reinterpret_cast<size_t>(static_cast<VkBuffer>(*bloomSubBuffer.getBuffer())),
         _renderer.getPipeline(Pipeline::getModelBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[0]
@@ -0,0 +1,172 @@
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorPoolChain.hpp>
+
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+namespace DescriptorSetPool {
+
+constexpr uint32_t DescriptorPoolChain::setsPerPool;
+constexpr uint32_t DescriptorPoolChain::uniformBuffersPerSet;
+constexpr uint32_t DescriptorPoolChain::combinedImageSamplersPerSet;
+
+DescriptorPoolChain::DescriptorPoolChain() : _backend(getVulkanBackend()) {}
+
+DescriptorPoolChain::DescriptorPoolChain(Backend backend) : _backend(std::move(backend)) {}
+
+bool DescriptorPoolChain::init(const API::Device& device) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    if (!_descriptorPools.empty()) {
+        return true;
+    }
+
+    _currentDescriptorPool = addPool(device);
+    return _currentDescriptorPool != nullptr;
+}
+
+bool DescriptorPoolChain::allocate(
+    const API::Device& device,
+    const API::DescriptorSetLayout& descriptorSetLayout,
+    API::DescriptorSet& descriptorSet,
+    const API::DescriptorPool*& descriptorPool
+) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    const auto tryAllocate = [&](API::DescriptorPool* pool) {
+        // A full pool returns VK_ERROR_OUT_OF_POOL_MEMORY or VK_ERROR_FRAGMENTED_POOL, but without
+        // VK_KHR_maintenance1 any error can be returned, so every failure means "try another pool"
+        if (!_backend.allocateSet(device, *pool, descriptorSetLayout, descriptorSet, nullptr)) {
+            _fullDescriptorPools.insert(pool);
+            return false;
+        }
+
+        _currentDescriptorPool = pool;
+        descriptorPool = pool;
+
+        return true;
+    };
+
+    const auto isFull = [this](const API::DescriptorPool* pool) {
+        return _fullDescriptorPools.find(pool) != _fullDescriptorPools.end();
+    };
+
+    // Try the current pool first, then the other ones which have free space left by vkFreeDescriptorSets
+    if (_currentDescriptorPool && !isFull(_currentDescriptorPool) && tryAllocate(_currentDescriptorPool)) {
+        return true;
+    }
+
+    for (auto& pool : _descriptorPools) {
+        if (&pool != _currentDescriptorPool && !isFull(&pool) && tryAllocate(&pool)) {
+            return true;
+        }
+    }
+
+    // All the pools are full, grow the chain
+    API::DescriptorPool* pool = addPool(device);
+    if (!pool) {
+        return false;
+    }
+
+    VkResult result{VK_SUCCESS};
+    if (!_backend.allocateSet(device, *pool, descriptorSetLayout, descriptorSet, &result)) {
+        LUG_LOG.error("DescriptorPoolChain: Can't create descriptor set: {}", result);
+        return false;
+    }
+
+    _currentDescriptorPool = pool;
+    descriptorPool = pool;
+
+    return true;
+}
+
+void DescriptorPoolChain::free(const API::Device& device, const API::DescriptorPool& descriptorPool, API::DescriptorSet& descriptorSet) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    _backend.freeSet(device, descriptorPool, descriptorSet);
+    _fullDescriptorPools.erase(&descriptorPool);
+}
+
+void DescriptorPoolChain::destroy() {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    _currentDescriptorPool = nullptr;
+    _fullDescriptorPools.clear();
+    _descriptorPools.clear();
+}
+
+API::DescriptorPool* DescriptorPoolChain::addPool(const API::Device& device) {
+    _descriptorPools.emplace_back();
+
+    VkResult result{VK_SUCCESS};
+    if (!_backend.createPool(device, _descriptorPools.back(), &result)) {
+        LUG_LOG.error("DescriptorPoolChain: Can't create the descriptor pool: {}", result);
+        _descriptorPools.pop_back();
+        return nullptr;
+    }
+
+    return &_descriptorPools.back();
+}
+
+DescriptorPoolChain::Backend DescriptorPoolChain::getVulkanBackend() {
+    Backend backend;
+
+    backend.createPool = [](const API::Device& device, API::DescriptorPool& descriptorPool, VkResult* result) {
+        API::Builder::DescriptorPool descriptorPoolBuilder(device);
+
+        // Use VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT to individually free descritors sets
+        descriptorPoolBuilder.setFlags(VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+        descriptorPoolBuilder.setMaxSets(setsPerPool);
+
+        std::vector<VkDescriptorPoolSize> poolSizes{
+            {
+                /* poolSize.type            */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                /* poolSize.descriptorCount */ setsPerPool * uniformBuffersPerSet
+            },
+            {
+                /* poolSize.type            */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                /* poolSize.descriptorCount */ setsPerPool * combinedImageSamplersPerSet
+            }
+        };
+        descriptorPoolBuilder.setPoolSizes(poolSizes);
+
+        return descriptorPoolBuilder.build(descriptorPool, result);
+    };
+
+    backend.allocateSet = [](
+        const API::Device& device,
+        const API::DescriptorPool& descriptorPool,
+        const API::DescriptorSetLayout& descriptorSetLayout,
+        API::DescriptorSet& descriptorSet,
+        VkResult* result
+    ) {
+        API::Builder::DescriptorSet descriptorSetBuilder(device, descriptorPool);
+        descriptorSetBuilder.setDescriptorSetLayouts({static_cast<VkDescriptorSetLayout>(descriptorSetLayout)});
+
+        return descriptorSetBuilder.build(descriptorSet, result);
+    };
+
+    backend.freeSet = [](const API::Device& device, const API::DescriptorPool& descriptorPool, API::DescriptorSet& descriptorSet) {
+        VkDescriptorSet vkDescriptorSet = static_cast<VkDescriptorSet>(descriptorSet);
+
+        if (vkDescriptorSet == VK_NULL_HANDLE) {
+            return;
+        }
+
+        vkFreeDescriptorSets(static_cast<VkDevice>(device), static_cast<VkDescriptorPool>(descriptorPool), 1, &vkDescriptorSet);
+        descriptorSet.destroy();
+    };
+
+    return backend;
+}
+
+} // DescriptorSetPool
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,14 +1,130 @@
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
 
+#include <atomic>
+
+#include <lug/System/Logger/Logger.hpp>
+
 namespace lug {
 namespace Graphics {
 namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-API::DescriptorPool descriptorPool;
+DescriptorPoolChain descriptorPoolChain;
 uint32_t poolCount = 0;
 
+namespace {
+
+// Counters of the current frame, the views render in parallel
+std::atomic<uint32_t> allocationsCount{0};
+std::atomic<uint32_t> cacheHitsCount{0};
+std::atomic<uint32_t> cacheMissesCount{0};
+
+} // anonymous
+
+DescriptorSetPool::Statistics DescriptorSetPool::_previousFrameStatistics;
+
+DescriptorSetPool::DescriptorSetPool(Renderer& renderer) : _renderer(renderer) {
+    ++poolCount;
+}
+
+DescriptorSetPool::~DescriptorSetPool() {
+    --poolCount;
+
+    // Destroying the pools frees all their descriptor sets at once
+    if (poolCount == 0) {
+        descriptorPoolChain.destroy();
+    }
+}
+
+bool DescriptorSetPool::init() {
+    if (!descriptorPoolChain.init(_renderer.getDevice())) {
+        LUG_LOG.error("DescriptorSetPool: Can't create the descriptor pool");
+        return false;
+    }
+
+    return true;
+}
+
+std::tuple<bool, const DescriptorSet*> DescriptorSetPool::allocate(size_t hash, const API::DescriptorSetLayout& descriptorSetLayout) {
+    auto it = _descriptorSetsInUse.find(hash);
+    if (it == _descriptorSetsInUse.end()) {
+        cacheMissesCount.fetch_add(1, std::memory_order_relaxed);
+
+        DescriptorSet* descriptorSet = allocateNewDescriptorSet(descriptorSetLayout);
+
+        if (!descriptorSet) {
+            return std::make_tuple(false, nullptr);
+        }
+
+        descriptorSet->setHash(hash);
+        descriptorSet->_referenceCount += 1;
+
+        _descriptorSetsInUse[hash] = descriptorSet;
+
+        return std::make_tuple(true, descriptorSet);
+    }
+
+    cacheHitsCount.fetch_add(1, std::memory_order_relaxed);
+
+    it->second->_referenceCount += 1;
+    return std::make_tuple(false, it->second);
+}
+
+void DescriptorSetPool::free(const DescriptorSet* descriptorSet) {
+    if (!descriptorSet) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    DescriptorSet* mutableDescriptorSet = const_cast<DescriptorSet*>(descriptorSet);
+    mutableDescriptorSet->_referenceCount -= 1;
+
+    const auto it = _descriptorSetsInUse.find(descriptorSet->getHash());
+    if (descriptorSet->_referenceCount == 0) {
+        if (it != _descriptorSetsInUse.end() && it->second == descriptorSet) {
+            _descriptorSetsInUse.erase(descriptorSet->getHash());
+        }
+
+        if (mutableDescriptorSet->_descriptorPool) {
+            descriptorPoolChain.free(_renderer.getDevice(), *mutableDescriptorSet->_descriptorPool, mutableDescriptorSet->_descriptorSet);
+            mutableDescriptorSet->_descriptorPool = nullptr;
+        }
+
+        _freeDescriptorSets.push_back(mutableDescriptorSet);
+    }
+}
+
+DescriptorSet* DescriptorSetPool::allocateNewDescriptorSet(const API::DescriptorSetLayout& descriptorSetLayout) {
+    DescriptorSet* descriptorSet = nullptr;
+
+    if (!_freeDescriptorSets.empty()) {
+        descriptorSet = _freeDescriptorSets.back();
+        _freeDescriptorSets.pop_back();
+    } else {
+        _descriptorSets.emplace_back();
+        descriptorSet = &_descriptorSets.back();
+    }
+
+    if (!descriptorPoolChain.allocate(_renderer.getDevice(), descriptorSetLayout, descriptorSet->_descriptorSet, descriptorSet->_descriptorPool)) {
+        LUG_LOG.error("DescriptorSetPool: Can't create descriptor set");
+        _freeDescriptorSets.push_back(descriptorSet);
+        return nullptr;
+    }
+
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+    return descriptorSet;
+}
+
+void DescriptorSetPool::newFrame() {
+    _previousFrameStatistics.allocations = allocationsCount.exchange(0, std::memory_order_relaxed);
+    _previousFrameStatistics.cacheHits = cacheHitsCount.exchange(0, std::memory_order_relaxed);
+    _previousFrameStatistics.cacheMisses = cacheMissesCount.exchange(0, std::memory_order_relaxed);
+    _previousFrameStatistics.poolsCount = descriptorPoolChain.getPoolsCount();
+}
+
 } // DescriptorSetPool
 } // Render
 } // Vulkan
@@ -13,6 +13,8 @@ namespace DescriptorSetPool {
 GuiTexture::GuiTexture(Renderer& renderer) : DescriptorSetPool(renderer) {}
 
 const DescriptorSet* GuiTexture::allocate(const API::GraphicsPipeline& pipeline, const ::lug::Graphics::Vulkan::Render::Texture* texture) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkImage>(texture->getImage())),
         pipeline.getLayout()->getDescriptorSetLayouts()[0]
@@ -12,6 +12,8 @@ namespace DescriptorSetPool {
 Light::Light(Renderer& renderer) : DescriptorSetPool(renderer) {}
 
 const DescriptorSet* Light::allocate(const BufferPool::SubBuffer& subBuffer) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkBuffer>(*subBuffer.getBuffer())),
         _renderer.getPipeline(Pipeline::getModelBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[1]
@@ -12,6 +12,8 @@ namespace DescriptorSetPool {
 Material::Material(Renderer& renderer) : DescriptorSetPool(renderer) {}
 
 const DescriptorSet* Material::allocate(const BufferPool::SubBuffer& subBuffer) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkBuffer>(*subBuffer.getBuffer())),
         _renderer.getPipeline(Pipeline::getModelBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[2]
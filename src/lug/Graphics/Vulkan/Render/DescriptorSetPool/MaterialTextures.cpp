@@ -17,6 +17,9 @@ const DescriptorSet* MaterialTextures::allocate(const API::GraphicsPipeline& pip
         hash ^= textures[i]->getHandle().value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
     }
 
+    // The images are written in the descriptor set below, under the same lock
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         hash,
         pipeline.getLayout()->getDescriptorSetLayouts()[3]
@@ -13,6 +13,8 @@ namespace DescriptorSetPool {
 SkyBox::SkyBox(Renderer& renderer) : DescriptorSetPool(renderer) {}
 
 const DescriptorSet* SkyBox::allocate(const ::lug::Graphics::Vulkan::Render::Texture* skyBox) {
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkImage>(skyBox->getImage())),
         _renderer.getPipeline(Pipeline::getSkyboxBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[1]
@@ -0,0 +1,216 @@
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <lug/Graphics/Vulkan/API/Builder/QueryPool.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+constexpr uint32_t GpuProfiler::maxScopesCount;
+constexpr uint32_t GpuProfiler::invalidScope;
+constexpr uint32_t GpuProfiler::historySize;
+constexpr VkQueryPipelineStatisticFlags GpuProfiler::pipelineStatisticsFlags;
+
+bool GpuProfiler::init(const API::Device& device, const PhysicalDeviceInfo& physicalDeviceInfo, uint32_t queueFamilyIdx, uint32_t framesCount, bool pipelineStatistics) {
+    destroy();
+
+    const uint32_t validBits = physicalDeviceInfo.queueFamilies[queueFamilyIdx].timestampValidBits;
+
+    if (validBits == 0) {
+        LUG_LOG.warn("GpuProfiler::init: Timestamps are not supported by the queue family {}, the profiler is disabled", queueFamilyIdx);
+        return true;
+    }
+
+    // Timestamps, two per scope
+    {
+        VkResult result{VK_SUCCESS};
+        API::Builder::QueryPool queryPoolBuilder(device);
+
+        queryPoolBuilder.setQueryType(VK_QUERY_TYPE_TIMESTAMP);
+        queryPoolBuilder.setQueryCount(framesCount * maxScopesCount * 2);
+
+        if (!queryPoolBuilder.build(_timestampsQueryPool, &result)) {
+            LUG_LOG.error("GpuProfiler::init: Can't create the timestamps query pool: {}", result);
+            return false;
+        }
+    }
+
+    // Pipeline statistics, one per scope
+    if (pipelineStatistics) {
+        VkResult result{VK_SUCCESS};
+        API::Builder::QueryPool queryPoolBuilder(device);
+
+        queryPoolBuilder.setQueryType(VK_QUERY_TYPE_PIPELINE_STATISTICS);
+        queryPoolBuilder.setQueryCount(framesCount * maxScopesCount);
+        queryPoolBuilder.setPipelineStatistics(pipelineStatisticsFlags);
+
+        if (!queryPoolBuilder.build(_pipelineStatisticsQueryPool, &result)) {
+            LUG_LOG.error("GpuProfiler::init: Can't create the pipeline statistics query pool: {}", result);
+            return false;
+        }
+    }
+
+    _submittedFrames.assign(framesCount, false);
+
+    _timestampPeriod = physicalDeviceInfo.properties.limits.timestampPeriod;
+    _timestampMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+
+    return true;
+}
+
+void GpuProfiler::destroy() {
+    _timestampsQueryPool.destroy();
+    _pipelineStatisticsQueryPool.destroy();
+
+    _scopes.clear();
+    _submittedFrames.clear();
+}
+
+uint32_t GpuProfiler::addScope(const std::string& name) {
+    if (!isEnabled()) {
+        return invalidScope;
+    }
+
+    if (_scopes.size() == maxScopesCount) {
+        LUG_LOG.warn("GpuProfiler::addScope: Too many scopes, {} is not profiled", name);
+        return invalidScope;
+    }
+
+    _scopes.emplace_back();
+    _scopes.back().name = name;
+    _scopes.back().history.reserve(historySize);
+
+    return static_cast<uint32_t>(_scopes.size() - 1);
+}
+
+void GpuProfiler::reset(const API::CommandBuffer& cmdBuffer, uint32_t frameIndex) const {
+    if (!isEnabled()) {
+        return;
+    }
+
+    cmdBuffer.resetQueryPool(_timestampsQueryPool, frameIndex * maxScopesCount * 2, maxScopesCount * 2);
+
+    if (hasPipelineStatistics()) {
+        cmdBuffer.resetQueryPool(_pipelineStatisticsQueryPool, frameIndex * maxScopesCount, maxScopesCount);
+    }
+}
+
+void GpuProfiler::begin(const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics) const {
+    if (scope == invalidScope) {
+        return;
+    }
+
+    cmdBuffer.writeTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, _timestampsQueryPool, (frameIndex * maxScopesCount + scope) * 2);
+
+    if (pipelineStatistics && hasPipelineStatistics()) {
+        cmdBuffer.beginQuery(_pipelineStatisticsQueryPool, frameIndex * maxScopesCount + scope);
+    }
+}
+
+void GpuProfiler::end(const API::CommandBuffer& cmdBuffer, uint32_t scope, uint32_t frameIndex, bool pipelineStatistics) const {
+    if (scope == invalidScope) {
+        return;
+    }
+
+    if (pipelineStatistics && hasPipelineStatistics()) {
+        cmdBuffer.endQuery(_pipelineStatisticsQueryPool, frameIndex * maxScopesCount + scope);
+    }
+
+    cmdBuffer.writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, _timestampsQueryPool, (frameIndex * maxScopesCount + scope) * 2 + 1);
+}
+
+void GpuProfiler::markSubmitted(uint32_t frameIndex) {
+    if (frameIndex < _submittedFrames.size()) {
+        _submittedFrames[frameIndex] = true;
+    }
+}
+
+void GpuProfiler::resolve(uint32_t frameIndex) {
+    // The queries of a frame that was never submitted have never been reset
+    if (!isEnabled() || frameIndex >= _submittedFrames.size() || !_submittedFrames[frameIndex]) {
+        return;
+    }
+
+    std::vector<uint64_t> results;
+
+    for (uint32_t scope = 0; scope < _scopes.size(); ++scope) {
+        ScopeData& scopeData = _scopes[scope];
+
+        // Not ready if the scope wasn't recorded this frame or if the GPU is late, the sample is skipped
+        if (_timestampsQueryPool.getResults((frameIndex * maxScopesCount + scope) * 2, 2, results)) {
+            const uint64_t ticks = (results[1] - results[0]) & _timestampMask;
+            scopeData.lastTime = static_cast<float>(static_cast<double>(ticks) * _timestampPeriod / 1000000.0);
+
+            if (scopeData.history.size() < historySize) {
+                scopeData.history.push_back(scopeData.lastTime);
+            } else {
+                scopeData.history[scopeData.historyIndex] = scopeData.lastTime;
+            }
+
+            scopeData.historyIndex = (scopeData.historyIndex + 1) % historySize;
+        }
+
+        if (hasPipelineStatistics() && _pipelineStatisticsQueryPool.getResults(frameIndex * maxScopesCount + scope, 1, results)) {
+            scopeData.pipelineStatistics = results;
+        }
+    }
+}
+
+GpuProfiler::Statistics GpuProfiler::getStatistics(uint32_t scope) const {
+    if (scope >= _scopes.size()) {
+        return computeStatistics({});
+    }
+
+    return computeStatistics(_scopes[scope].history);
+}
+
+const std::vector<std::string>& GpuProfiler::getPipelineStatisticsNames() {
+    static const std::vector<std::string> names{
+        "Input assembly primitives",
+        "Vertex shader invocations",
+        "Clipping primitives",
+        "Fragment shader invocations"
+    };
+
+    return names;
+}
+
+GpuProfiler::Statistics GpuProfiler::computeStatistics(std::vector<float> samples) {
+    Statistics statistics{};
+
+    if (samples.empty()) {
+        return statistics;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    // Nearest-rank percentile
+    const auto percentile = [&samples](float p) {
+        const size_t rank = static_cast<size_t>(std::ceil(p / 100.0f * static_cast<float>(samples.size())));
+        return samples[std::max<size_t>(rank, 1) - 1];
+    };
+
+    float sum = 0.0f;
+    for (const float sample : samples) {
+        sum += sample;
+    }
+
+    statistics.average = sum / static_cast<float>(samples.size());
+    statistics.p50 = percentile(50.0f);
+    statistics.p90 = percentile(90.0f);
+    statistics.p99 = percentile(99.0f);
+    statistics.max = samples.back();
+    statistics.samplesCount = static_cast<uint32_t>(samples.size());
+
+    return statistics;
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,116 @@
+#include <lug/Graphics/Vulkan/Render/InstanceBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <lug/Graphics/Scene/Node.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+bool InstanceBuffer::update(Renderer& renderer, const std::vector<Scene::Node*>& instances) {
+    if (instances.empty()) {
+        return true;
+    }
+
+    if (!reserve(renderer, static_cast<uint32_t>(instances.size()))) {
+        return false;
+    }
+
+    for (size_t i = 0; i < instances.size(); ++i) {
+        std::memcpy(_mappedData + i, &instances[i]->getTransform(), sizeof(Math::Mat4x4f));
+    }
+
+    _dirty = true;
+
+    return true;
+}
+
+void InstanceBuffer::flush(std::vector<VkMappedMemoryRange>& ranges) {
+    if (!_dirty) {
+        return;
+    }
+
+    ranges.push_back({
+        /* range.sType  */ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+        /* range.pNext  */ nullptr,
+        /* range.memory */ static_cast<VkDeviceMemory>(_bufferMemory),
+        /* range.offset */ 0,
+        /* range.size   */ VK_WHOLE_SIZE
+    });
+
+    _dirty = false;
+}
+
+void InstanceBuffer::destroy() {
+    _mappedData = nullptr;
+    _capacity = 0;
+    _dirty = false;
+
+    _buffer.destroy();
+    _bufferMemory.destroy();
+}
+
+bool InstanceBuffer::reserve(Renderer& renderer, uint32_t instancesCount) {
+    if (instancesCount <= _capacity) {
+        return true;
+    }
+
+    // Grow geometrically to avoid reallocating every time a few instances are added
+    const uint32_t capacity = std::max(instancesCount, std::max(_capacity * 2, 64u));
+
+    destroy();
+
+    // Create buffer
+    {
+        API::Builder::Buffer bufferBuilder(renderer.getDevice());
+
+        bufferBuilder.setSize(capacity * sizeof(Math::Mat4x4f));
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+        VkResult result{VK_SUCCESS};
+        if (!bufferBuilder.build(_buffer, &result)) {
+            LUG_LOG.error("InstanceBuffer: Can't create buffer: {}", result);
+            return false;
+        }
+    }
+
+    // Create buffer memory
+    {
+        API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+        if (!deviceMemoryBuilder.addBuffer(_buffer)) {
+            LUG_LOG.error("InstanceBuffer: Can't add buffer to device memory");
+            return false;
+        }
+
+        VkResult result{VK_SUCCESS};
+        if (!deviceMemoryBuilder.build(_bufferMemory, &result)) {
+            LUG_LOG.error("InstanceBuffer: Can't create device memory: {}", result);
+            return false;
+        }
+    }
+
+    // Map the memory
+    _mappedData = static_cast<Math::Mat4x4f*>(_bufferMemory.mapBuffer(_buffer));
+    if (!_mappedData) {
+        LUG_LOG.error("InstanceBuffer: Can't map device memory");
+        return false;
+    }
+
+    _capacity = capacity;
+
+    return true;
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
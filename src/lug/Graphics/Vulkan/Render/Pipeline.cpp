@@ -39,8 +39,9 @@ bool Pipeline::init() {
 }
 
 Resource::SharedPtr<Pipeline> Pipeline::create(Renderer& renderer, Id id) {
-    if (renderer.containsPipeline(id)) {
-        return renderer.getPipeline(id);
+    Resource::SharedPtr<Pipeline> existingPipeline = renderer.findPipeline(id);
+    if (existingPipeline) {
+        return existingPipeline;
     }
 
     std::unique_ptr<Resource> resource{new Pipeline(renderer, id)};
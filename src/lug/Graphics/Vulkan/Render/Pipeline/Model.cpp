@@ -95,6 +95,15 @@ bool Pipeline::initModel() {
             auto uvBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec4f), VK_VERTEX_INPUT_RATE_VERTEX);
             uvBinding.addAttributes(VK_FORMAT_R32G32B32A32_SFLOAT, 0);
         }
+
+        // The model transform of each instance, a mat4 takes one location per column
+        if (extraPart.instanced) {
+            auto instanceBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Mat4x4f), VK_VERTEX_INPUT_RATE_INSTANCE);
+
+            for (uint32_t column = 0; column < 4; ++column) {
+                instanceBinding.addAttributes(VK_FORMAT_R32G32B32A32_SFLOAT, column * sizeof(Math::Vec4f));
+            }
+        }
     }
 
     // Set input assembly state
@@ -358,7 +367,7 @@ bool Pipeline::initModel() {
             }
         }
 
-        // Model transformation
+        // Model transformation (unused by the instanced pipelines, kept for a common layout)
         const VkPushConstantRange pushConstant{
             /* pushConstant.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT,
             /* pushConstant.offset */ 0,
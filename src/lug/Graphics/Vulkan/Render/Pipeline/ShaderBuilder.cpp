@@ -1,6 +1,10 @@
 #include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #if defined(LUG_SYSTEM_ANDROID)
     #include <android/asset_manager.h>
@@ -9,8 +13,11 @@
     #include <lug/Window/Window.hpp>
 #endif
 
-#include <shaderc/shaderc.hpp>
+#if !defined(LUG_SHADERC_DISABLED)
+    #include <shaderc/shaderc.hpp>
+#endif
 
+#include <lug/Graphics/Vulkan/Render/ShaderArchive.hpp>
 #include <lug/System/Exception.hpp>
 
 namespace lug {
@@ -18,11 +25,46 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
+#if !defined(LUG_SYSTEM_ANDROID)
+// Archives are loaded once and kept for the lifetime of the program.
+// A null archive means that there is no (valid) archive at this path.
+static const ShaderArchive* getShaderArchive(const std::string& filename) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<ShaderArchive>> archives;
+
+    std::lock_guard<std::mutex> lockGuard(mutex);
+
+    auto it = archives.find(filename);
+    if (it == archives.end()) {
+        std::unique_ptr<ShaderArchive> archive = std::make_unique<ShaderArchive>();
+
+        if (!archive->load(filename)) {
+            archive.reset();
+        }
+
+        it = archives.emplace(filename, std::move(archive)).first;
+    }
+
+    return it->second.get();
+}
+#endif
+
 std::vector<uint32_t> Pipeline::ShaderBuilder::buildShader(
     std::string shaderRoot,
     ::lug::Graphics::Render::Technique::Type technique,
     Pipeline::ShaderBuilder::Type type,
     Pipeline::Id id) {
+#if !defined(LUG_SYSTEM_ANDROID)
+    {
+        const ShaderArchive* archive = getShaderArchive(getArchiveFilename(shaderRoot, technique));
+
+        std::vector<uint32_t> spirv;
+        if (archive && archive->find(id, type, spirv)) {
+            return spirv;
+        }
+    }
+#endif
+
     switch (technique) {
         case ::lug::Graphics::Render::Technique::Type::Forward:
             switch (type) {
@@ -36,6 +78,87 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShader(
     return {};
 }
 
+std::string Pipeline::ShaderBuilder::getArchiveFilename(std::string shaderRoot, ::lug::Graphics::Render::Technique::Type technique) {
+    switch (technique) {
+        case ::lug::Graphics::Render::Technique::Type::Forward:
+            return shaderRoot + "forward/shaders.lsa";
+    }
+
+    return {};
+}
+
+std::vector<Pipeline::Id> Pipeline::ShaderBuilder::getModelPermutations(
+    uint8_t maxTexCoords,
+    uint8_t maxColors,
+    const std::vector<::lug::Graphics::Renderer::DisplayMode>& displayModes) {
+    std::vector<Pipeline::Id> pipelineIds{};
+
+    maxTexCoords = std::min<uint8_t>(maxTexCoords, 3);
+    maxColors = std::min<uint8_t>(maxColors, 3);
+
+    // The primitive mode and the antialiasing don't change the shaders
+    Pipeline::Id::Model::PrimitivePart primitivePart = getModelBaseId().getModelPrimitivePart();
+    Pipeline::Id::Model::MaterialPart materialPart = getModelBaseId().getModelMaterialPart();
+    Pipeline::Id::Model::ExtraPart extraPart = getModelBaseId().getModelExtraPart();
+
+    // For each texture, the UV set it uses or 0b11 when there is no texture
+    const auto getTextureInfo = [](uint8_t info, uint8_t countTexCoord) {
+        return info != countTexCoord ? info : 0b11;
+    };
+
+    for (const auto displayMode : displayModes) {
+        extraPart.displayMode = static_cast<uint32_t>(displayMode);
+
+        for (uint8_t irradianceMapInfo = 0; irradianceMapInfo <= 1; ++irradianceMapInfo) {
+            extraPart.irradianceMapInfo = irradianceMapInfo;
+
+            for (uint8_t prefilteredMapInfo = 0; prefilteredMapInfo <= 1; ++prefilteredMapInfo) {
+                extraPart.prefilteredMapInfo = prefilteredMapInfo;
+
+                for (uint8_t instanced = 0; instanced <= 1; ++instanced) {
+                    extraPart.instanced = instanced;
+
+                    for (uint8_t tangentVertexData = 0; tangentVertexData <= 1; ++tangentVertexData) {
+                        primitivePart.tangentVertexData = tangentVertexData;
+
+                        for (uint8_t countColor = 0; countColor <= maxColors; ++countColor) {
+                            primitivePart.countColor = countColor;
+
+                            for (uint8_t countTexCoord = 0; countTexCoord <= maxTexCoords; ++countTexCoord) {
+                                primitivePart.countTexCoord = countTexCoord;
+
+                                for (uint8_t baseColorInfo = 0; baseColorInfo <= countTexCoord; ++baseColorInfo) {
+                                    materialPart.baseColorInfo = getTextureInfo(baseColorInfo, countTexCoord);
+
+                                    for (uint8_t metallicRoughnessInfo = 0; metallicRoughnessInfo <= countTexCoord; ++metallicRoughnessInfo) {
+                                        materialPart.metallicRoughnessInfo = getTextureInfo(metallicRoughnessInfo, countTexCoord);
+
+                                        for (uint8_t normalInfo = 0; normalInfo <= countTexCoord; ++normalInfo) {
+                                            materialPart.normalInfo = getTextureInfo(normalInfo, countTexCoord);
+
+                                            for (uint8_t occlusionInfo = 0; occlusionInfo <= countTexCoord; ++occlusionInfo) {
+                                                materialPart.occlusionInfo = getTextureInfo(occlusionInfo, countTexCoord);
+
+                                                for (uint8_t emissiveInfo = 0; emissiveInfo <= countTexCoord; ++emissiveInfo) {
+                                                    materialPart.emissiveInfo = getTextureInfo(emissiveInfo, countTexCoord);
+
+                                                    pipelineIds.push_back(Pipeline::Id::createModel(primitivePart, materialPart, extraPart));
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return pipelineIds;
+}
+
 std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromFile(std::string filename, Pipeline::ShaderBuilder::Type type, Pipeline::Id id) {
 #if defined(LUG_SYSTEM_ANDROID)
     // Load shader from compressed asset
@@ -72,6 +195,14 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromFile(std::string f
 }
 
 std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string filename, std::string content, Pipeline::ShaderBuilder::Type type, Pipeline::Id id) {
+#if defined(LUG_SHADERC_DISABLED)
+    (void)content;
+    (void)type;
+    (void)id;
+
+    // Only the permutations of the archive are available (see LUG_SHADERC)
+    LUG_EXCEPT(InternalErrorException, "Can't compile " + filename + ", Lugdunum is built without shaderc");
+#else
     shaderc::Compiler compiler;
     shaderc::CompileOptions options;
 
@@ -84,6 +215,9 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
         // Set bloom enabled
         options.AddMacroDefinition("DISPLAY_MODE", std::to_string(extraPart.displayMode));
 
+        // Set where the model transform comes from
+        options.AddMacroDefinition("INSTANCED", extraPart.instanced ? "1" : "0");
+
         // Primitive part
         {
             options.AddMacroDefinition("IN_POSITION", std::to_string(primitivePart.positionVertexData));
@@ -133,6 +267,11 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
                 options.AddMacroDefinition("IN_COLOR_" + std::to_string(i) + "_LOCATION", std::to_string(location++));
             }
 
+            // The per-instance transform is only a vertex input, it can share its locations with the outputs
+            if (extraPart.instanced) {
+                options.AddMacroDefinition("IN_INSTANCE_TRANSFORM_LOCATION", std::to_string(location));
+            }
+
             options.AddMacroDefinition("IN_FREE_LOCATION", std::to_string(location++));
         }
 
@@ -190,6 +329,7 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
 
     std::vector<uint32_t> result(module.cbegin(), module.cend());
     return result;
+#endif
 }
 
 } // Render
@@ -0,0 +1,160 @@
+#include <lug/Graphics/Vulkan/Render/PipelineCompiler.hpp>
+
+#include <algorithm>
+
+#include <lug/System/Clock.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+PipelineCompiler::PipelineCompiler(Factory factory, uint8_t workerCount) : _factory(std::move(factory)) {
+    _threadPool = std::make_unique<System::ThreadPool>(workerCount);
+}
+
+PipelineCompiler::~PipelineCompiler() {
+    waitIdle();
+}
+
+bool PipelineCompiler::request(Pipeline::Id id) {
+    // Shared with the task, a std::function must be copyable
+    std::shared_ptr<std::promise<bool>> promise;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(_mutex);
+
+        // Don't try again to compile a pipeline which is broken
+        if (_failed.find(id) != _failed.end()) {
+            return false;
+        }
+
+        // Already compiling
+        if (_pending.find(id) != _pending.end()) {
+            return true;
+        }
+
+        promise = std::make_shared<std::promise<bool>>();
+        _pending.emplace(id, promise->get_future().share());
+
+        ++_statistics.requested;
+    }
+
+    _threadPool->enqueue([this, id, promise]() {
+        compile(id, *promise);
+    });
+
+    return true;
+}
+
+bool PipelineCompiler::compile(Pipeline::Id id) {
+    std::promise<bool> promise;
+    std::shared_future<bool> result;
+    bool inFlight = false;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(_mutex);
+
+        if (_failed.find(id) != _failed.end()) {
+            return false;
+        }
+
+        const auto it = _pending.find(id);
+        inFlight = it != _pending.end();
+
+        if (inFlight) {
+            result = it->second;
+        } else {
+            result = promise.get_future().share();
+            _pending.emplace(id, result);
+
+            ++_statistics.requested;
+        }
+    }
+
+    // Not compiled by a worker or by another thread, compile it here
+    if (!inFlight) {
+        compile(id, promise);
+    }
+
+    return result.get();
+}
+
+void PipelineCompiler::prewarm(const std::vector<Pipeline::Id>& ids) {
+    for (const auto id : ids) {
+        request(id);
+    }
+}
+
+bool PipelineCompiler::wait(Pipeline::Id id) {
+    std::shared_future<bool> result;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(_mutex);
+
+        const auto it = _pending.find(id);
+        if (it == _pending.end()) {
+            return false;
+        }
+
+        result = it->second;
+    }
+
+    result.wait();
+    return true;
+}
+
+void PipelineCompiler::waitIdle() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    _condition.wait(lock, [this]() {
+        return _pending.empty();
+    });
+}
+
+uint32_t PipelineCompiler::getLatencyBucket(int64_t latency) {
+    uint32_t bucket = 0;
+    for (int64_t upperBound = 1000; latency >= upperBound && bucket < Statistics::latencyBucketsCount - 1; upperBound *= 2) {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+void PipelineCompiler::compile(Pipeline::Id id, std::promise<bool>& promise) {
+    System::Clock clock;
+
+    const bool success = _factory(id);
+    const int64_t latency = clock.getElapsedTime().getMicroseconds();
+
+    if (!success) {
+        LUG_LOG.error("PipelineCompiler::compile: Can't compile the pipeline {:#010x}", id.value);
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(_mutex);
+
+        if (success) {
+            ++_statistics.compiled;
+
+            _statistics.totalLatency += latency;
+            _statistics.maxLatency = std::max(_statistics.maxLatency, latency);
+
+            ++_statistics.latencyHistogram[getLatencyBucket(latency)];
+        } else {
+            ++_statistics.failed;
+            _failed.insert(id);
+        }
+
+        _pending.erase(id);
+    }
+
+    promise.set_value(success);
+    _condition.notify_all();
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,5 +1,9 @@
 #include <lug/Graphics/Vulkan/Render/Queue.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 #include <lug/Graphics/Vulkan/Render/Material.hpp>
 #include <lug/Graphics/Scene/Node.hpp>
 
@@ -8,17 +12,45 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
-void Queue::addMeshInstance(Scene::Node& node, const lug::Graphics::Renderer& renderer) {
-    auto meshInstance = node.getMeshInstance();
+namespace {
+
+// Serializes the resolution of the draw items, the same node can be added to the queues of several views at once
+std::mutex drawItemsMutex;
+
+using DrawItems = Scene::Node::MeshInstance::DrawItems;
+
+bool areDrawItemsResolved(const DrawItems* drawItems, const lug::Graphics::Renderer& renderer) {
+    if (!drawItems || drawItems->version != renderer.getPipelineSettingsVersion()) {
+        return false;
+    }
+
+    for (const auto& drawItem : drawItems->items) {
+        if (drawItem.materialVersion != drawItem.material->getPipelineVersion()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Builds new draw items, the previous ones may still be read by other views
+std::shared_ptr<const DrawItems> resolveDrawItems(const Scene::Node::MeshInstance& meshInstance, const lug::Graphics::Renderer& renderer) {
+    auto drawItems = std::make_shared<DrawItems>();
+    drawItems->version = renderer.getPipelineSettingsVersion();
+
+    const auto& primitiveSets = meshInstance.mesh->getPrimitiveSets();
 
-    uint32_t i = 0;
-    for (auto& primitiveSet : meshInstance->mesh->getPrimitiveSets()) {
-        Resource::SharedPtr<Render::Material> material = Resource::SharedPtr<Render::Material>::cast(meshInstance->materials[i] ? meshInstance->materials[i] : primitiveSet.material);
+    for (uint32_t i = 0; i < primitiveSets.size(); ++i) {
+        const auto& primitiveSet = primitiveSets[i];
+        Resource::SharedPtr<Render::Material> material = Resource::SharedPtr<Render::Material>::cast(meshInstance.materials[i] ? meshInstance.materials[i] : primitiveSet.material);
 
         if (!material) {
             continue;
         }
 
+        // The version is read before the properties it covers, a concurrent change resolves the items again
+        const uint32_t materialVersion = material->getPipelineVersion();
+
         // Determine the pipeline id
         Pipeline::Id pipelineId = 0;
         {
@@ -34,19 +66,57 @@ void Queue::addMeshInstance(Scene::Node& node, const lug::Graphics::Renderer& re
             pipelineId = Pipeline::Id::createModel(pipelineIdPrimitivePart, pipelineIdMaterialPart, pipelineIdExtraPart);
         }
 
-        // Add in the list
-        _primitiveSets[pipelineId].push_back(Queue::PrimitiveSetInstance{
-            /* node */ &node,
+        drawItems->items.push_back(Scene::Node::MeshInstance::DrawItem{
+            /* pipelineId */ static_cast<uint32_t>(pipelineId),
             /* primitiveSet */ &primitiveSet,
-            /* material */ material.get()
+            /* material */ material.get(),
+            /* materialVersion */ materialVersion
         });
+    }
+
+    return drawItems;
+}
+
+} // anonymous
+
+void Queue::addMeshInstance(Scene::Node& node, const lug::Graphics::Renderer& renderer) {
+    const Scene::Node::MeshInstance* meshInstance = node.getMeshInstance();
+
+    // Keeps the draw items alive while they are read, even if another view replaces them
+    std::shared_ptr<const DrawItems> drawItems = std::atomic_load(&meshInstance->drawItems);
+
+    if (!areDrawItemsResolved(drawItems.get(), renderer)) {
+        std::lock_guard<std::mutex> lock(drawItemsMutex);
+
+        drawItems = std::atomic_load(&meshInstance->drawItems);
+        if (!areDrawItemsResolved(drawItems.get(), renderer)) {
+            drawItems = resolveDrawItems(*meshInstance, renderer);
+            std::atomic_store(&meshInstance->drawItems, drawItems);
+        }
+    }
 
-        ++i;
+    // Add in the list
+    for (const auto& drawItem : drawItems->items) {
+        addPrimitiveSetInstance(drawItem.pipelineId, Queue::PrimitiveSetInstance{
+            /* node */ &node,
+            /* primitiveSet */ drawItem.primitiveSet,
+            /* material */ static_cast<Render::Material*>(drawItem.material)
+        });
     }
 }
 
+void Queue::addPrimitiveSetInstance(Pipeline::Id pipelineId, const PrimitiveSetInstance& primitiveSetInstance) {
+    _primitiveSets[pipelineId].push_back(primitiveSetInstance);
+}
+
 void Queue::addLight(Scene::Node& node) {
-    _lights[_lightsCount] = &node;
+    // The lights are drawn by batches of 50, the vector only grows for the scenes with more lights
+    if (_lightsCount < _lights.size()) {
+        _lights[_lightsCount] = &node;
+    } else {
+        _lights.push_back(&node);
+    }
+
     ++_lightsCount;
 }
 
@@ -56,14 +126,81 @@ void Queue::addSkyBox(Resource::SharedPtr<::lug::Graphics::Render::SkyBox> skyBo
 
 void Queue::clear() {
     _primitiveSets.clear();
+    _primitiveSetBatches.clear();
+    _instances.clear();
     _lightsCount = 0;
 }
 
-const std::map<Render::Pipeline::Id, std::vector<Queue::PrimitiveSetInstance>> Queue::getPrimitiveSets() const {
+void Queue::groupInstances(uint32_t minInstancesCount) {
+    const auto isSameDraw = [](const PrimitiveSetInstance& lhs, const PrimitiveSetInstance& rhs) {
+        return lhs.primitiveSet == rhs.primitiveSet && lhs.material == rhs.material;
+    };
+
+    for (auto it = _primitiveSets.begin(); it != _primitiveSets.end();) {
+        // Already instanced
+        if (it->first.modelInfo.instanced) {
+            ++it;
+            continue;
+        }
+
+        auto& primitiveSetInstances = it->second;
+
+        // Make the instances of the same primitive set with the same material contiguous,
+        // keeping the order in which they were added (e.g. front to back)
+        std::stable_sort(primitiveSetInstances.begin(), primitiveSetInstances.end(), [](const PrimitiveSetInstance& lhs, const PrimitiveSetInstance& rhs) {
+            return lhs.primitiveSet < rhs.primitiveSet || (lhs.primitiveSet == rhs.primitiveSet && lhs.material < rhs.material);
+        });
+
+        auto remaining = primitiveSetInstances.begin();
+        for (auto first = primitiveSetInstances.begin(); first != primitiveSetInstances.end();) {
+            auto last = first + 1;
+            while (last != primitiveSetInstances.end() && isSameDraw(*first, *last)) {
+                ++last;
+            }
+
+            const uint32_t instancesCount = static_cast<uint32_t>(last - first);
+
+            if (instancesCount >= minInstancesCount) {
+                _primitiveSetBatches[Pipeline::getModelInstancedId(it->first)].push_back(PrimitiveSetBatch{
+                    /* primitiveSet */ first->primitiveSet,
+                    /* material */ first->material,
+                    /* firstInstance */ static_cast<uint32_t>(_instances.size()),
+                    /* instancesCount */ instancesCount
+                });
+
+                for (auto instance = first; instance != last; ++instance) {
+                    _instances.push_back(instance->node);
+                }
+            } else {
+                remaining = std::move(first, last, remaining);
+            }
+
+            first = last;
+        }
+
+        primitiveSetInstances.erase(remaining, primitiveSetInstances.end());
+
+        if (primitiveSetInstances.empty()) {
+            it = _primitiveSets.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+const std::map<Render::Pipeline::Id, std::vector<Queue::PrimitiveSetInstance>>& Queue::getPrimitiveSets() const {
     return _primitiveSets;
 }
 
-const std::vector<Scene::Node*> Queue::getLights() const {
+const std::map<Render::Pipeline::Id, std::vector<Queue::PrimitiveSetBatch>>& Queue::getPrimitiveSetBatches() const {
+    return _primitiveSetBatches;
+}
+
+const std::vector<Scene::Node*>& Queue::getInstances() const {
+    return _instances;
+}
+
+const std::vector<Scene::Node*>& Queue::getLights() const {
     return _lights;
 }
 
@@ -0,0 +1,177 @@
+#include <lug/Graphics/Vulkan/Render/ShaderArchive.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+constexpr uint32_t ShaderArchive::magic;
+constexpr uint32_t ShaderArchive::version;
+
+bool ShaderArchive::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+
+    if (!file.good()) {
+        return false;
+    }
+
+    const std::streamsize fileSize = file.tellg();
+    if (fileSize < static_cast<std::streamsize>(4 * sizeof(uint32_t)) || fileSize % sizeof(uint32_t)) {
+        LUG_LOG.error("ShaderArchive::load: Invalid size for archive {}", filename);
+        return false;
+    }
+
+    std::vector<uint32_t> words(static_cast<size_t>(fileSize) / sizeof(uint32_t));
+
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(words.data()), fileSize)) {
+        LUG_LOG.error("ShaderArchive::load: Can't read archive {}", filename);
+        return false;
+    }
+
+    if (words[0] != magic || words[1] != version) {
+        LUG_LOG.error("ShaderArchive::load: Invalid header for archive {}", filename);
+        return false;
+    }
+
+    const size_t entriesCount = words[2];
+    const size_t blobsCount = words[3];
+
+    const size_t entriesOffset = 4;
+    const size_t blobsOffset = entriesOffset + entriesCount * sizeof(Entry) / sizeof(uint32_t);
+    const size_t dataOffset = blobsOffset + blobsCount * sizeof(Blob) / sizeof(uint32_t);
+
+    if (dataOffset > words.size()) {
+        LUG_LOG.error("ShaderArchive::load: Truncated archive {}", filename);
+        return false;
+    }
+
+    std::vector<Entry> entries(entriesCount);
+    std::vector<Blob> blobs(blobsCount);
+
+    std::memcpy(entries.data(), words.data() + entriesOffset, entriesCount * sizeof(Entry));
+    std::memcpy(blobs.data(), words.data() + blobsOffset, blobsCount * sizeof(Blob));
+
+    const size_t dataSize = words.size() - dataOffset;
+
+    for (const auto& blob : blobs) {
+        if (static_cast<size_t>(blob.offset) + blob.size > dataSize) {
+            LUG_LOG.error("ShaderArchive::load: Invalid blob in archive {}", filename);
+            return false;
+        }
+    }
+
+    for (const auto& entry : entries) {
+        if (entry.blobIndex >= blobsCount) {
+            LUG_LOG.error("ShaderArchive::load: Invalid entry in archive {}", filename);
+            return false;
+        }
+    }
+
+    _entries = std::move(entries);
+    _blobs = std::move(blobs);
+    _data.assign(words.begin() + dataOffset, words.end());
+
+    return true;
+}
+
+bool ShaderArchive::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+    if (!file.good()) {
+        LUG_LOG.error("ShaderArchive::save: Can't open {}", filename);
+        return false;
+    }
+
+    const uint32_t header[] = {
+        magic,
+        version,
+        static_cast<uint32_t>(_entries.size()),
+        static_cast<uint32_t>(_blobs.size())
+    };
+
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(_entries.data()), _entries.size() * sizeof(Entry));
+    file.write(reinterpret_cast<const char*>(_blobs.data()), _blobs.size() * sizeof(Blob));
+    file.write(reinterpret_cast<const char*>(_data.data()), _data.size() * sizeof(uint32_t));
+
+    if (!file.good()) {
+        LUG_LOG.error("ShaderArchive::save: Can't write {}", filename);
+        return false;
+    }
+
+    return true;
+}
+
+void ShaderArchive::add(Pipeline::Id id, Pipeline::ShaderBuilder::Type type, const std::vector<uint32_t>& spirv) {
+    // Reuse the blob of an identical shader if there is one
+    uint32_t blobIndex = 0;
+    for (; blobIndex < _blobs.size(); ++blobIndex) {
+        const Blob& blob = _blobs[blobIndex];
+
+        if (blob.size == spirv.size() && std::equal(spirv.begin(), spirv.end(), _data.begin() + blob.offset)) {
+            break;
+        }
+    }
+
+    if (blobIndex == _blobs.size()) {
+        _blobs.push_back({
+            /* blob.offset  */ static_cast<uint32_t>(_data.size()),
+            /* blob.size    */ static_cast<uint32_t>(spirv.size())
+        });
+
+        _data.insert(_data.end(), spirv.begin(), spirv.end());
+    }
+
+    const Entry entry{
+        /* entry.key        */ getKey(id),
+        /* entry.type       */ static_cast<uint32_t>(type),
+        /* entry.blobIndex  */ blobIndex
+    };
+
+    const auto compareEntries = [](const Entry& lhs, const Entry& rhs) {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.type < rhs.type);
+    };
+
+    auto it = std::lower_bound(_entries.begin(), _entries.end(), entry, compareEntries);
+
+    if (it != _entries.end() && it->key == entry.key && it->type == entry.type) {
+        it->blobIndex = entry.blobIndex;
+    } else {
+        _entries.insert(it, entry);
+    }
+}
+
+bool ShaderArchive::find(Pipeline::Id id, Pipeline::ShaderBuilder::Type type, std::vector<uint32_t>& spirv) const {
+    const Entry entry{
+        /* entry.key        */ getKey(id),
+        /* entry.type       */ static_cast<uint32_t>(type),
+        /* entry.blobIndex  */ 0
+    };
+
+    const auto compareEntries = [](const Entry& lhs, const Entry& rhs) {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.type < rhs.type);
+    };
+
+    const auto it = std::lower_bound(_entries.begin(), _entries.end(), entry, compareEntries);
+
+    if (it == _entries.end() || it->key != entry.key || it->type != entry.type) {
+        return false;
+    }
+
+    const Blob& blob = _blobs[it->blobIndex];
+    spirv.assign(_data.begin() + blob.offset, _data.begin() + blob.offset + blob.size);
+
+    return true;
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
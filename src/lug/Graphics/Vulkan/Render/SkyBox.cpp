@@ -1,10 +1,17 @@
 #include <lug/Graphics/Vulkan/Render/SkyBox.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
 #include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/Render/IblCache.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandPool.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Framebuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Image.hpp>
@@ -20,6 +27,243 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
+namespace IblCache = ::lug::Graphics::Render::IblCache;
+
+// Increment when the shaders generating the maps change, to invalidate the cache entries
+constexpr uint32_t cacheGeneratorVersion = 1;
+
+static bool submitCommands(Vulkan::Renderer& renderer, const std::function<void(const API::CommandBuffer&)>& record) {
+    const API::Queue* graphicsQueue = renderer.getDevice().getQueue("queue_graphics");
+    if (!graphicsQueue) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't find queue with name queue_graphics");
+        return false;
+    }
+
+    VkResult result{VK_SUCCESS};
+    API::CommandPool commandPool;
+    API::CommandBuffer cmdBuffer;
+    API::Fence fence;
+
+    API::Builder::CommandPool commandPoolBuilder(renderer.getDevice(), *graphicsQueue->getQueueFamily());
+    if (!commandPoolBuilder.build(commandPool, &result)) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't create the graphics command pool: {}", result);
+        return false;
+    }
+
+    API::Builder::CommandBuffer commandBufferBuilder(renderer.getDevice(), commandPool);
+    commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (!commandBufferBuilder.build(cmdBuffer, &result)) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't create the command buffer: {}", result);
+        return false;
+    }
+
+    API::Builder::Fence fenceBuilder(renderer.getDevice());
+    if (!fenceBuilder.build(fence, &result)) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't create the fence: {}", result);
+        return false;
+    }
+
+    if (!cmdBuffer.begin()) {
+        return false;
+    }
+
+    record(cmdBuffer);
+
+    if (!cmdBuffer.end()) {
+        return false;
+    }
+
+    if (!graphicsQueue->submit(cmdBuffer, {}, {}, {}, static_cast<VkFence>(fence))) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't submit work to graphics queue");
+        return false;
+    }
+
+    if (!fence.wait()) {
+        LUG_LOG.error("SkyBox::submitCommands: Can't wait fence");
+        return false;
+    }
+
+    cmdBuffer.destroy();
+    commandPool.destroy();
+    fence.destroy();
+
+    return true;
+}
+
+static bool createHostBuffer(Vulkan::Renderer& renderer, VkDeviceSize size, VkBufferUsageFlags usage, API::Buffer& buffer, API::DeviceMemory& bufferMemory) {
+    const API::Queue* graphicsQueue = renderer.getDevice().getQueue("queue_graphics");
+    if (!graphicsQueue) {
+        LUG_LOG.error("SkyBox::createHostBuffer: Can't find queue with name queue_graphics");
+        return false;
+    }
+
+    VkResult result{VK_SUCCESS};
+
+    API::Builder::Buffer bufferBuilder(renderer.getDevice());
+    bufferBuilder.setQueueFamilyIndices({graphicsQueue->getQueueFamily()->getIdx()});
+    bufferBuilder.setSize(size);
+    bufferBuilder.setUsage(usage);
+
+    if (!bufferBuilder.build(buffer, &result)) {
+        LUG_LOG.error("SkyBox::createHostBuffer: Can't create buffer: {}", result);
+        return false;
+    }
+
+    // Host coherent as the mapped ranges are never flushed nor invalidated
+    API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
+    deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    if (!deviceMemoryBuilder.addBuffer(buffer)) {
+        LUG_LOG.error("SkyBox::createHostBuffer: Can't add buffer to device memory");
+        return false;
+    }
+
+    if (!deviceMemoryBuilder.build(bufferMemory, &result)) {
+        LUG_LOG.error("SkyBox::createHostBuffer: Can't create device memory: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
+// One region per mip level, with all the layers of the mip level, in the layout of IblCache::Entry
+static std::vector<VkBufferImageCopy> getCacheEntryRegions(const IblCache::Entry& entry) {
+    std::vector<VkBufferImageCopy> regions(entry.mipLevels);
+    VkDeviceSize offset{0};
+
+    for (uint32_t mipLevel = 0; mipLevel < entry.mipLevels; ++mipLevel) {
+        regions[mipLevel] = {
+            /* region.bufferOffset */ offset,
+            /* region.bufferRowLength */ 0,
+            /* region.bufferImageHeight */ 0,
+            /* region.imageSubresource */ {
+                /* region.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                /* region.imageSubresource.mipLevel */ mipLevel,
+                /* region.imageSubresource.baseArrayLayer */ 0,
+                /* region.imageSubresource.layerCount */ entry.layersCount
+            },
+            /* region.imageOffset */ {0, 0, 0},
+            /* region.imageExtent */ {std::max(entry.width >> mipLevel, 1u), std::max(entry.height >> mipLevel, 1u), 1}
+        };
+
+        offset += IblCache::getMipLevelSize(entry, mipLevel);
+    }
+
+    return regions;
+}
+
+// Uploads all the mip levels and layers of an entry, the image is left in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+static bool uploadCacheEntry(Vulkan::Renderer& renderer, const API::Image& image, const IblCache::Entry& entry) {
+    API::Buffer stagingBuffer;
+    API::DeviceMemory stagingBufferMemory;
+
+    if (!createHostBuffer(renderer, entry.data.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, stagingBuffer, stagingBufferMemory)) {
+        return false;
+    }
+
+    if (!stagingBuffer.updateData(entry.data.data(), entry.data.size())) {
+        LUG_LOG.error("SkyBox::uploadCacheEntry: Can't update the staging buffer");
+        return false;
+    }
+
+    return submitCommands(renderer, [&](const API::CommandBuffer& cmdBuffer) {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+        pipelineBarrier.imageMemoryBarriers.resize(1);
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = 0;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].image = &image;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.levelCount = entry.mipLevels;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = entry.layersCount;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier);
+
+        const API::CommandBuffer::CmdCopyBufferToImage cmdCopyBufferToImage{
+            /* cmdCopyBufferToImage.srcBuffer */ stagingBuffer,
+            /* cmdCopyBufferToImage.dstImage */ image,
+            /* cmdCopyBufferToImage.dstImageLayout */ VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            /* cmdCopyBufferToImage.regions */ getCacheEntryRegions(entry)
+        };
+
+        cmdBuffer.copyBufferToImage(cmdCopyBufferToImage);
+
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier);
+    });
+}
+
+// Reads back all the mip levels and layers of an image in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+// the geometry of the entry must already be set
+static bool readbackCacheEntry(Vulkan::Renderer& renderer, const API::Image& image, IblCache::Entry& entry) {
+    const VkDeviceSize size = IblCache::getDataSize(entry);
+
+    API::Buffer readbackBuffer;
+    API::DeviceMemory readbackMemory;
+
+    if (!createHostBuffer(renderer, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, readbackBuffer, readbackMemory)) {
+        return false;
+    }
+
+    const bool submitted = submitCommands(renderer, [&](const API::CommandBuffer& cmdBuffer) {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+        pipelineBarrier.imageMemoryBarriers.resize(1);
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].image = &image;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.levelCount = entry.mipLevels;
+        pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = entry.layersCount;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier);
+
+        const API::CommandBuffer::CmdCopyImageToBuffer cmdCopyImageToBuffer{
+            /* cmdCopyImageToBuffer.srcImage */ image,
+            /* cmdCopyImageToBuffer.srcImageLayout */ VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            /* cmdCopyImageToBuffer.dstBuffer */ readbackBuffer,
+            /* cmdCopyImageToBuffer.regions */ getCacheEntryRegions(entry)
+        };
+
+        cmdBuffer.copyImageToBuffer(cmdCopyImageToBuffer);
+
+        pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        // Make the copy visible to the host
+        pipelineBarrier.bufferMemoryBarriers.resize(1);
+        pipelineBarrier.bufferMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pipelineBarrier.bufferMemoryBarriers[0].dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        pipelineBarrier.bufferMemoryBarriers[0].buffer = &readbackBuffer;
+
+        cmdBuffer.pipelineBarrier(pipelineBarrier, VK_DEPENDENCY_BY_REGION_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | VK_PIPELINE_STAGE_HOST_BIT);
+    });
+
+    if (!submitted) {
+        return false;
+    }
+
+    const void* data = readbackMemory.mapBuffer(readbackBuffer);
+    if (!data) {
+        LUG_LOG.error("SkyBox::readbackCacheEntry: Can't map device memory");
+        return false;
+    }
+
+    entry.data.resize(static_cast<size_t>(size));
+    std::memcpy(entry.data.data(), data, entry.data.size());
+
+    readbackMemory.unmap();
+
+    return true;
+}
+
 lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Mesh> SkyBox::_mesh;
 lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> SkyBox::_brdfLut;
 uint32_t SkyBox::_skyBoxCount{0};
@@ -34,6 +278,17 @@ void SkyBox::destroy() {
     --_skyBoxCount;
 }
 
+uint64_t SkyBox::getCacheKey(const Vulkan::Renderer& renderer, const std::string& mapName, uint32_t size, uint32_t mipLevels) const {
+    if (!renderer.getPreferences().ibl.cache || !_environnementHash) {
+        return 0;
+    }
+
+    const uint32_t parameters[] = {cacheGeneratorVersion, size, mipLevels};
+
+    const uint64_t key = IblCache::hash(mapName.data(), mapName.size(), _environnementHash);
+    return IblCache::hash(parameters, sizeof(parameters), key);
+}
+
 Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createIrradianceMap(lug::Graphics::Renderer& renderer) const {
     constexpr uint32_t irradianceMapSize = 64;
 
@@ -43,13 +298,6 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createIrradianceMap(l
 
     Vulkan::Renderer& vkRenderer = static_cast<Vulkan::Renderer&>(renderer);
 
-    auto irradianceMapPipeline = vkRenderer.getPipeline(Render::Pipeline::getIrradianceMapBaseId());
-
-    if (!irradianceMapPipeline) {
-        LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createIrradianceMap: Can't get the irradiance map pipeline");
-        return nullptr;
-    }
-
     const Resource::SharedPtr<lug::Graphics::Vulkan::Render::Texture> texture = Resource::SharedPtr<Render::Texture>::cast(getEnvironnementTexture());
     if (!texture) {
         LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createIrradianceMap: The skybox doesn't have an environnement");
@@ -82,6 +330,38 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createIrradianceMap(l
         return nullptr;
     }
 
+    const API::Image& irradianceMapImage = Resource::SharedPtr<Render::Texture>::cast(irradianceMap->_environnementTexture)->getImage();
+
+    IblCache::Entry cacheEntry{};
+    cacheEntry.key = getCacheKey(vkRenderer, "irradiance_map", irradianceMapSize, 1);
+    cacheEntry.width = irradianceMapSize;
+    cacheEntry.height = irradianceMapSize;
+    cacheEntry.layersCount = 6;
+    cacheEntry.mipLevels = 1;
+    cacheEntry.format = lug::Graphics::Render::Texture::Format::R32G32B32A32_SFLOAT;
+
+    const std::string cacheFilename = IblCache::getFilename(vkRenderer.getPreferences().ibl.cacheDirectory, cacheEntry.key);
+
+    // Reuse the irradiance map generated by a previous run
+    if (cacheEntry.key) {
+        IblCache::Entry cachedEntry{};
+
+        if (IblCache::load(cacheFilename, cacheEntry.key, cachedEntry)) {
+            if (uploadCacheEntry(vkRenderer, irradianceMapImage, cachedEntry)) {
+                return vkRenderer.getResourceManager()->add<::lug::Graphics::Render::SkyBox>(std::move(resource));
+            }
+
+            LUG_LOG.warn("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createIrradianceMap: Can't upload {}, generating the irradiance map", cacheFilename);
+        }
+    }
+
+    auto irradianceMapPipeline = vkRenderer.getPipeline(Render::Pipeline::getIrradianceMapBaseId());
+
+    if (!irradianceMapPipeline) {
+        LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createIrradianceMap: Can't get the irradiance map pipeline");
+        return nullptr;
+    }
+
     // Create Framebuffer for irradiance map generation
     API::CommandPool commandPool;
     API::CommandBuffer cmdBuffer;
@@ -480,6 +760,11 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createIrradianceMap(l
     descriptorPool.destroy();
     fence.destroy();
 
+    // Not fatal, the irradiance map is generated again by the next run
+    if (cacheEntry.key && (!readbackCacheEntry(vkRenderer, irradianceMapImage, cacheEntry) || !IblCache::save(cacheFilename, cacheEntry))) {
+        LUG_LOG.warn("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createIrradianceMap: Can't store the irradiance map in the cache");
+    }
+
     return vkRenderer.getResourceManager()->add<::lug::Graphics::Render::SkyBox>(std::move(resource));
 }
 
@@ -493,13 +778,6 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createPrefilteredMap(
 
     Vulkan::Renderer& vkRenderer = static_cast<Vulkan::Renderer&>(renderer);
 
-    auto prefilteredMapPipeline = vkRenderer.getPipeline(Render::Pipeline::getPrefilteredMapBaseId());
-
-    if (!prefilteredMapPipeline) {
-        LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createPrefilteredMap: Can't get the prefiltered map pipeline");
-        return nullptr;
-    }
-
     lug::Graphics::Builder::Texture textureBuilder(vkRenderer);
 
     const Resource::SharedPtr<lug::Graphics::Vulkan::Render::Texture> texture = Resource::SharedPtr<Render::Texture>::cast(getEnvironnementTexture());
@@ -533,6 +811,38 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createPrefilteredMap(
         return nullptr;
     }
 
+    const API::Image& prefilteredMapImage = Resource::SharedPtr<Render::Texture>::cast(prefilteredMap->_environnementTexture)->getImage();
+
+    IblCache::Entry cacheEntry{};
+    cacheEntry.key = getCacheKey(vkRenderer, "prefiltered_map", prefilteredMapSize, mipMapCount);
+    cacheEntry.width = prefilteredMapSize;
+    cacheEntry.height = prefilteredMapSize;
+    cacheEntry.layersCount = 6;
+    cacheEntry.mipLevels = mipMapCount;
+    cacheEntry.format = lug::Graphics::Render::Texture::Format::R32G32B32A32_SFLOAT;
+
+    const std::string cacheFilename = IblCache::getFilename(vkRenderer.getPreferences().ibl.cacheDirectory, cacheEntry.key);
+
+    // Reuse the prefiltered map generated by a previous run
+    if (cacheEntry.key) {
+        IblCache::Entry cachedEntry{};
+
+        if (IblCache::load(cacheFilename, cacheEntry.key, cachedEntry)) {
+            if (uploadCacheEntry(vkRenderer, prefilteredMapImage, cachedEntry)) {
+                return vkRenderer.getResourceManager()->add<::lug::Graphics::Render::SkyBox>(std::move(resource));
+            }
+
+            LUG_LOG.warn("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createPrefilteredMap: Can't upload {}, generating the prefiltered map", cacheFilename);
+        }
+    }
+
+    auto prefilteredMapPipeline = vkRenderer.getPipeline(Render::Pipeline::getPrefilteredMapBaseId());
+
+    if (!prefilteredMapPipeline) {
+        LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createPrefilteredMap: Can't get the prefiltered map pipeline");
+        return nullptr;
+    }
+
     // Create Framebuffer for prefiltered map generation
     API::CommandPool commandPool;
     API::CommandBuffer cmdBuffer;
@@ -952,6 +1262,11 @@ Resource::SharedPtr<lug::Graphics::Render::SkyBox> SkyBox::createPrefilteredMap(
     descriptorPool.destroy();
     fence.destroy();
 
+    // Not fatal, the prefiltered map is generated again by the next run
+    if (cacheEntry.key && (!readbackCacheEntry(vkRenderer, prefilteredMapImage, cacheEntry) || !IblCache::save(cacheFilename, cacheEntry))) {
+        LUG_LOG.warn("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::createPrefilteredMap: Can't store the prefiltered map in the cache");
+    }
+
     return vkRenderer.getResourceManager()->add<::lug::Graphics::Render::SkyBox>(std::move(resource));
 }
 
@@ -1,6 +1,7 @@
 #include <lug/Graphics/Vulkan/Render/Technique/Forward.hpp>
 
 #include <algorithm>
+#include <future>
 
 #include <lug/Config.hpp>
 #include <lug/Graphics/Render/Light.hpp>
@@ -28,6 +29,7 @@
 #include <lug/Math/Matrix.hpp>
 #include <lug/Math/Vector.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -63,10 +65,20 @@ bool Forward::render(
     const API::Semaphore& drawCompleteSemaphore,
     uint32_t currentImageIndex
 ) {
+    LUG_PROFILE_SCOPE("Forward::render");
+
     FrameData& frameData = _framesData[currentImageIndex];
 
-    frameData.transferFence.wait();
-    frameData.transferFence.reset();
+    // Wait for the previous use of this frame before touching the buffers it may reference
+    {
+        LUG_PROFILE_SCOPE("Forward::waitFences");
+
+        frameData.renderFence.wait();
+        frameData.renderFence.reset();
+
+        frameData.transferFence.wait();
+        frameData.transferFence.reset();
+    }
 
     if (!frameData.transferCmdBuffer.reset() || !frameData.transferCmdBuffer.begin()) {
         return false;
@@ -74,7 +86,7 @@ bool Forward::render(
 
     // Get the new (or old) bloom buffer
     {
-        const BufferPool::SubBuffer* bloomBuffer = _bloomBufferPool->allocate(frameData.transferCmdBuffer, _renderer.getBlurThreshold(), _renderer.isBloomDirty());
+        const BufferPool::SubBuffer* bloomBuffer = _bloomBufferPool->allocate(_renderer.getBlurThreshold(), _renderer.isBloomDirty());
 
         if (!bloomBuffer) {
             LUG_LOG.error("Forward::render: Can't allocate bloom buffer");
@@ -87,7 +99,7 @@ bool Forward::render(
 
     // Get the new (or old) camera buffer
     {
-        const BufferPool::SubBuffer* cameraBuffer = _cameraBufferPool->allocate(frameData.transferCmdBuffer, *_renderView.getCamera());
+        const BufferPool::SubBuffer* cameraBuffer = _cameraBufferPool->allocate(*_renderView.getCamera());
 
         if (!cameraBuffer) {
             LUG_LOG.error("Forward::render: Can't allocate camera buffer");
@@ -98,8 +110,11 @@ bool Forward::render(
         frameData.cameraBuffer = cameraBuffer;
     }
 
-    frameData.renderFence.wait();
-    frameData.renderFence.reset();
+    // Write the model transforms of the instanced draws
+    if (!frameData.instanceBuffer.update(_renderer, renderQueue.getInstances())) {
+        LUG_LOG.error("Forward::render: Can't update the instance buffer");
+        return false;
+    }
 
     if (!frameData.renderCmdBuffer.reset() || !frameData.renderCmdBuffer.begin()) {
         return false;
@@ -115,61 +130,55 @@ bool Forward::render(
         basePipelineId = Pipeline::Id::createModel(basePipelineId.getModelPrimitivePart(), basePipelineId.getModelMaterialPart(), extraPart);
     }
 
-    // Begin of the render pass
-    {
-        // All the pipelines have the same renderPass
-        const API::RenderPass* renderPass = _renderer.getPipeline(basePipelineId)->getPipelineAPI().getRenderPass();
+    Resource::SharedPtr<Render::Pipeline> basePipeline = _renderer.getPipeline(basePipelineId);
 
-        API::CommandBuffer::CmdBeginRenderPass beginRenderPass{
-            /* beginRenderPass.framebuffer  */ frameData.framebuffer.framebuffer,
-            /* beginRenderPass.renderArea   */ {},
-            /* beginRenderPass.clearValues  */ {}
-        };
+    // All the pipelines have the same renderPass
+    const API::RenderPass* renderPass = basePipeline->getPipelineAPI().getRenderPass();
 
-        const auto& viewport = _renderView.getViewport();
-        if (frameData.framebuffer.antialiasing == Renderer::Antialiasing::NoAA) {
-            beginRenderPass.renderArea.offset = {
-                static_cast<int32_t>(viewport.offset.x),
-                static_cast<int32_t>(viewport.offset.y)
-            };
-        }
-        else {
-            beginRenderPass.renderArea.offset = {0, 0};
-        }
-        beginRenderPass.renderArea.extent = {static_cast<uint32_t>(viewport.extent.width), static_cast<uint32_t>(viewport.extent.height)};
-
-        const auto& clearColor = _renderView.getClearColor();
-        beginRenderPass.clearValues.resize(4);
-        beginRenderPass.clearValues[0].color = {{clearColor.r(), clearColor.g(), clearColor.b(), 1.0f}};
-        beginRenderPass.clearValues[1].color = {{clearColor.r(), clearColor.g(), clearColor.b(), 1.0f}};
-        beginRenderPass.clearValues[2].color = {{0.0f, 0.0f, 0.0f, 0.0f}};
-        beginRenderPass.clearValues[3].depthStencil = {1.0f, 0};
-
-        frameData.renderCmdBuffer.beginRenderPass(*renderPass, beginRenderPass);
-
-        const VkViewport vkViewport{
-            /* vkViewport.x         */ static_cast<float>(beginRenderPass.renderArea.offset.x),
-            /* vkViewport.y         */ static_cast<float>(beginRenderPass.renderArea.offset.y),
-            /* vkViewport.width     */ viewport.extent.width,
-            /* vkViewport.height    */ viewport.extent.height,
-            /* vkViewport.minDepth  */ viewport.minDepth,
-            /* vkViewport.maxDepth  */ viewport.maxDepth,
-        };
+    API::CommandBuffer::CmdBeginRenderPass beginRenderPass{
+        /* beginRenderPass.framebuffer  */ frameData.framebuffer.framebuffer,
+        /* beginRenderPass.renderArea   */ {},
+        /* beginRenderPass.clearValues  */ {}
+    };
 
-        const VkRect2D scissor{
-            /* scissor.offset */ {
-               static_cast<int32_t>(_renderView.getScissor().offset.x),
-               static_cast<int32_t>(_renderView.getScissor().offset.y)
-            },
-            /* scissor.extent */ {
-               static_cast<uint32_t>(_renderView.getScissor().extent.width),
-               static_cast<uint32_t>(_renderView.getScissor().extent.height)
-            }
+    const auto& viewport = _renderView.getViewport();
+    if (frameData.framebuffer.antialiasing == Renderer::Antialiasing::NoAA) {
+        beginRenderPass.renderArea.offset = {
+            static_cast<int32_t>(viewport.offset.x),
+            static_cast<int32_t>(viewport.offset.y)
         };
-
-        frameData.renderCmdBuffer.setViewport({vkViewport});
-        frameData.renderCmdBuffer.setScissor({scissor});
     }
+    else {
+        beginRenderPass.renderArea.offset = {0, 0};
+    }
+    beginRenderPass.renderArea.extent = {static_cast<uint32_t>(viewport.extent.width), static_cast<uint32_t>(viewport.extent.height)};
+
+    const auto& clearColor = _renderView.getClearColor();
+    beginRenderPass.clearValues.resize(4);
+    beginRenderPass.clearValues[0].color = {{clearColor.r(), clearColor.g(), clearColor.b(), 1.0f}};
+    beginRenderPass.clearValues[1].color = {{clearColor.r(), clearColor.g(), clearColor.b(), 1.0f}};
+    beginRenderPass.clearValues[2].color = {{0.0f, 0.0f, 0.0f, 0.0f}};
+    beginRenderPass.clearValues[3].depthStencil = {1.0f, 0};
+
+    const VkViewport vkViewport{
+        /* vkViewport.x         */ static_cast<float>(beginRenderPass.renderArea.offset.x),
+        /* vkViewport.y         */ static_cast<float>(beginRenderPass.renderArea.offset.y),
+        /* vkViewport.width     */ viewport.extent.width,
+        /* vkViewport.height    */ viewport.extent.height,
+        /* vkViewport.minDepth  */ viewport.minDepth,
+        /* vkViewport.maxDepth  */ viewport.maxDepth,
+    };
+
+    const VkRect2D scissor{
+        /* scissor.offset */ {
+           static_cast<int32_t>(_renderView.getScissor().offset.x),
+           static_cast<int32_t>(_renderView.getScissor().offset.y)
+        },
+        /* scissor.extent */ {
+           static_cast<uint32_t>(_renderView.getScissor().extent.width),
+           static_cast<uint32_t>(_renderView.getScissor().extent.height)
+        }
+    };
 
     // Get the new (or old) camera descriptor set
     {
@@ -184,18 +193,13 @@ bool Forward::render(
         frameData.cameraDescriptorSet = cameraDescriptorSet;
     }
 
-    // Bind descriptor set of the camera
-    {
-        const API::CommandBuffer::CmdBindDescriptors cameraBind{
-            /* cameraBind.pipelineLayout    */ *_renderer.getPipeline(basePipelineId)->getPipelineAPI().getLayout(),
-            /* cameraBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-            /* cameraBind.firstSet           */ 0,
-            /* cameraBind.descriptorSets     */ {&frameData.cameraDescriptorSet->getDescriptorSet()},
-            /* cameraBind.dynamicOffsets     */ {frameData.cameraBuffer->getOffset(), frameData.bloomBuffer->getOffset()},
-        };
-
-        frameData.renderCmdBuffer.bindDescriptorSets(cameraBind);
-    }
+    const API::CommandBuffer::CmdBindDescriptors cameraBind{
+        /* cameraBind.pipelineLayout    */ *basePipeline->getPipelineAPI().getLayout(),
+        /* cameraBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+        /* cameraBind.firstSet           */ 0,
+        /* cameraBind.descriptorSets     */ {&frameData.cameraDescriptorSet->getDescriptorSet()},
+        /* cameraBind.dynamicOffsets     */ {frameData.cameraBuffer->getOffset(), frameData.bloomBuffer->getOffset()},
+    };
 
     // Temporary array of light and material buffers use to render this frame
     // they will replace frameData.lightBuffers and frameData.materialBuffers atfer the rendering
@@ -208,24 +212,22 @@ bool Forward::render(
     std::vector<const DescriptorSetPool::DescriptorSet*> materialDescriptorSets;
     std::vector<const DescriptorSetPool::DescriptorSet*> materialTexturesDescriptorSets;
 
-    // Bind a default pipeline for the rendering
-    frameData.renderCmdBuffer.bindPipeline(_renderer.getPipeline(basePipelineId)->getPipelineAPI());
+    std::vector<LightBinding> lightBindings;
+
+    // Keep the pipelines of the draw calls alive until they are recorded
+    std::vector<Resource::SharedPtr<Render::Pipeline>> drawPipelines;
 
-    // Render objects
+    _drawCalls.clear();
+
+    // Prepare the lights
     {
-        // Blend constants are used as dst blend factor
-        // We set them to 0 so that there is no blending
-        {
-            const float blendConstants[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            frameData.renderCmdBuffer.setBlendConstants(blendConstants);
-        }
+        LUG_PROFILE_SCOPE("Forward::prepareLights");
 
         auto& lights = renderQueue.getLights();
         for (uint32_t i = 0; i < renderQueue.getLightsCount(); i += 50) {
             // Get the new (or old) light buffer
             const BufferPool::SubBuffer* lightBuffer = _lightBufferPool->allocate(
                 currentImageIndex,
-                frameData.transferCmdBuffer,
                 {lights.begin() + i, i + 50 > renderQueue.getLightsCount() ? lights.begin() + renderQueue.getLightsCount() : lights.begin() + i + 50}
             );
             lightBuffers.push_back(lightBuffer);
@@ -244,186 +246,170 @@ bool Forward::render(
                 return false;
             }
 
-            // Bind descriptor set of the light
-            {
-                const API::CommandBuffer::CmdBindDescriptors lightBind{
-                    /* lightBind.pipelineLayout     */ *_renderer.getPipeline(basePipelineId)->getPipelineAPI().getLayout(),
-                    /* lightBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-                    /* lightBind.firstSet           */ 1,
-                    /* lightBind.descriptorSets     */ {&lightDescriptorSet->getDescriptorSet()},
-                    /* lightBind.dynamicOffsets     */ {lightBuffer->getOffset()},
-                };
+            lightBindings.push_back({lightDescriptorSet, lightBuffer->getOffset()});
+        }
+    }
 
-                frameData.renderCmdBuffer.bindDescriptorSets(lightBind);
-            }
+    // Prepare the draw calls of the objects
+    // Nothing is lit, so nothing is drawn, without lights
+    if (!lightBindings.empty()) {
+        LUG_PROFILE_SCOPE("Forward::prepareDrawCalls");
 
-            // After the first batch of lights we need to re-enable the blend
-            if (i == 50) {
-                const float blendConstants[4] = {1.0f, 1.0f, 1.0f, 1.0f};
-                frameData.renderCmdBuffer.setBlendConstants(blendConstants);
-            }
+        // Returns the pipeline to draw with, or nullptr to skip the draw while the pipeline is compiling
+        const auto getModelPipeline = [this](Pipeline::Id pipelineId) {
+            // Don't wait for the pipeline if it is still compiling
+            Resource::SharedPtr<Render::Pipeline> pipeline = _renderer.getPipelineAsync(pipelineId);
 
-            for (const auto it : renderQueue.getPrimitiveSets()) {
-                // Bind pipeline
-                Resource::SharedPtr<Render::Pipeline> pipeline = _renderer.getPipeline(it.first);
-                frameData.renderCmdBuffer.bindPipeline(pipeline->getPipelineAPI());
-
-                // Display primitive set by primitive set
-                for (const auto primitiveSetInstance : it.second) {
-                    auto& node = *primitiveSetInstance.node;
-                    const auto& primitiveSet = *primitiveSetInstance.primitiveSet;
-                    auto& material = *primitiveSetInstance.material;
-
-                    const Math::Mat4x4f pushConstants[] = {
-                        node.getTransform()
-                    };
-
-                    const API::CommandBuffer::CmdPushConstants cmdPushConstants{
-                        /* cmdPushConstants.layout      */ static_cast<VkPipelineLayout>(*pipeline->getPipelineAPI().getLayout()),
-                        /* cmdPushConstants.stageFlags  */ VK_SHADER_STAGE_VERTEX_BIT,
-                        /* cmdPushConstants.offset      */ 0,
-                        /* cmdPushConstants.size        */ sizeof(pushConstants),
-                        /* cmdPushConstants.values      */ pushConstants
-                    };
-                    frameData.renderCmdBuffer.pushConstants(cmdPushConstants);
-
-                    // Get the new (or old) material buffer
-                    const BufferPool::SubBuffer* materialBuffer = _materialBufferPool->allocate(frameData.transferCmdBuffer, material);
-                    materialBuffers.push_back(materialBuffer);
-
-                    if (!materialBuffer) {
-                        LUG_LOG.error("Forward::render: Can't allocate material buffer");
-                        return false;
-                    }
+            if (!pipeline && _renderer.getPreferences().pipelineCompilation.fallback == PipelineCompiler::Fallback::Base) {
+                pipeline = _renderer.getPipelineAsync(Render::Pipeline::getModelFallbackId(pipelineId));
+            }
 
-                    // Get the new (or old) material descriptor set
-                    const DescriptorSetPool::DescriptorSet* materialDescriptorSet = _materialDescriptorSetPool->allocate(*materialBuffer);
-                    materialDescriptorSets.push_back(materialDescriptorSet);
+            return pipeline;
+        };
 
-                    if (!materialDescriptorSet) {
-                        LUG_LOG.error("Forward::render: Can't allocate material descriptor set");
-                        return false;
-                    }
+        // Allocates the material of a primitive set and adds the draw of instancesCount instances of it
+        // Returns false on fatal error
+        const auto addDrawCall = [&](
+            Render::Pipeline& pipeline,
+            const Render::Mesh::PrimitiveSet& primitiveSet,
+            Render::Material& material,
+            const Math::Mat4x4f& transform,
+            uint32_t instancesCount,
+            uint32_t firstInstance
+        ) {
+            if (!primitiveSet.position || !primitiveSet.normal) {
+                LUG_LOG.warn("Forward::render: Mesh should have positions and normals data");
+                return true;
+            }
 
-                    std::vector<const API::DescriptorSet*> materialDescriptorSetsBind{&materialDescriptorSet->getDescriptorSet()};
+            // Get the new (or old) material buffer
+            const BufferPool::SubBuffer* materialBuffer = _materialBufferPool->allocate(material);
+            materialBuffers.push_back(materialBuffer);
 
-                    if (pipeline->getPipelineAPI().getLayout()->getDescriptorSetLayouts().size() > 3) {
-                        // Get the new (or old) material descriptor set
-                        const DescriptorSetPool::DescriptorSet* materialTexturesDescriptorSet = _materialTexturesDescriptorSetPool->allocate(
-                            pipeline->getPipelineAPI(),
-                            [&material]() {
-                                std::vector<const ::lug::Graphics::Vulkan::Render::Texture*> textures;
+            if (!materialBuffer) {
+                LUG_LOG.error("Forward::render: Can't allocate material buffer");
+                return false;
+            }
 
-                                if (material.getPipelineId().baseColorInfo != 0b11) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getBaseColorTexture().texture.get()));
-                                }
+            // Get the new (or old) material descriptor set
+            const DescriptorSetPool::DescriptorSet* materialDescriptorSet = _materialDescriptorSetPool->allocate(*materialBuffer);
+            materialDescriptorSets.push_back(materialDescriptorSet);
 
-                                if (material.getPipelineId().metallicRoughnessInfo != 0b11) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getMetallicRoughnessTexture().texture.get()));
-                                }
+            if (!materialDescriptorSet) {
+                LUG_LOG.error("Forward::render: Can't allocate material descriptor set");
+                return false;
+            }
 
-                                if (material.getPipelineId().normalInfo != 0b11) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getNormalTexture().texture.get()));
-                                }
+            const DescriptorSetPool::DescriptorSet* materialTexturesDescriptorSet = nullptr;
 
-                                if (material.getPipelineId().occlusionInfo != 0b11) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getOcclusionTexture().texture.get()));
-                                }
+            if (pipeline.getPipelineAPI().getLayout()->getDescriptorSetLayouts().size() > 3) {
+                // Get the new (or old) material descriptor set
+                materialTexturesDescriptorSet = _materialTexturesDescriptorSetPool->allocate(
+                    pipeline.getPipelineAPI(),
+                    [&material]() {
+                        std::vector<const ::lug::Graphics::Vulkan::Render::Texture*> textures;
 
-                                if (material.getPipelineId().emissiveInfo != 0b11) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getEmissiveTexture().texture.get()));
-                                }
+                        if (material.getPipelineId().baseColorInfo != 0b11) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getBaseColorTexture().texture.get()));
+                        }
 
-                                if (material.getIrradianceMap() && material.getIrradianceMap()->getEnvironnementTexture()) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getIrradianceMap()->getEnvironnementTexture().get()));
-                                }
+                        if (material.getPipelineId().metallicRoughnessInfo != 0b11) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getMetallicRoughnessTexture().texture.get()));
+                        }
 
-                                if (material.getPrefilteredMap() && material.getPrefilteredMap()->getEnvironnementTexture()) {
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(Render::SkyBox::getBrdfLut().get()));
-                                    textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getPrefilteredMap()->getEnvironnementTexture().get()));
-                                }
+                        if (material.getPipelineId().normalInfo != 0b11) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getNormalTexture().texture.get()));
+                        }
 
-                                return textures;
-                            }()
-                        );
+                        if (material.getPipelineId().occlusionInfo != 0b11) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getOcclusionTexture().texture.get()));
+                        }
 
-                        if (!materialTexturesDescriptorSet) {
-                            LUG_LOG.error("Forward::render: Can't allocate material textures descriptor set");
-                            return false;
+                        if (material.getPipelineId().emissiveInfo != 0b11) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getEmissiveTexture().texture.get()));
                         }
 
-                        materialTexturesDescriptorSets.push_back(materialTexturesDescriptorSet);
-                        materialDescriptorSetsBind.push_back(&materialTexturesDescriptorSet->getDescriptorSet());
-                    }
+                        if (material.getIrradianceMap() && material.getIrradianceMap()->getEnvironnementTexture()) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getIrradianceMap()->getEnvironnementTexture().get()));
+                        }
 
-                    // Bind descriptor set of the material
-                    {
-                        const API::CommandBuffer::CmdBindDescriptors materialBind{
-                            /* materialBind.pipelineLayout     */ *pipeline->getPipelineAPI().getLayout(),
-                            /* materialBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            /* materialBind.firstSet           */ 2,
-                            /* materialBind.descriptorSets     */ materialDescriptorSetsBind,
-                            /* materialBind.dynamicOffsets     */ {materialBuffer->getOffset()},
-                        };
-
-                        frameData.renderCmdBuffer.bindDescriptorSets(materialBind);
-                    }
+                        if (material.getPrefilteredMap() && material.getPrefilteredMap()->getEnvironnementTexture()) {
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(Render::SkyBox::getBrdfLut().get()));
+                            textures.push_back(static_cast<const ::lug::Graphics::Vulkan::Render::Texture*>(material.getPrefilteredMap()->getEnvironnementTexture().get()));
+                        }
 
+                        return textures;
+                    }()
+                );
 
-                    if (!primitiveSet.position || !primitiveSet.normal) {
-                        LUG_LOG.warn("Forward::render: Mesh should have positions and normals data");
-                        continue;
-                    }
+                if (!materialTexturesDescriptorSet) {
+                    LUG_LOG.error("Forward::render: Can't allocate material textures descriptor set");
+                    return false;
+                }
 
-                    std::vector<const API::Buffer*> vertexBuffers{
-                        static_cast<API::Buffer*>(primitiveSet.position->_data),
-                        static_cast<API::Buffer*>(primitiveSet.normal->_data)
-                    };
+                materialTexturesDescriptorSets.push_back(materialTexturesDescriptorSet);
+            }
 
-                    if (primitiveSet.tangent) {
-                        vertexBuffers.push_back(static_cast<API::Buffer*>(primitiveSet.tangent->_data));
-                    }
+            _drawCalls.push_back({
+                /* drawCall.pipeline                        */ &pipeline,
+                /* drawCall.primitiveSet                    */ &primitiveSet,
+                /* drawCall.materialDescriptorSet           */ materialDescriptorSet,
+                /* drawCall.materialTexturesDescriptorSet   */ materialTexturesDescriptorSet,
+                /* drawCall.materialBufferOffset            */ materialBuffer->getOffset(),
+                /* drawCall.transform                       */ transform,
+                /* drawCall.instancesCount                  */ instancesCount,
+                /* drawCall.firstInstance                   */ firstInstance
+            });
 
-                    for (const auto& texCoord: primitiveSet.texCoords) {
-                        vertexBuffers.push_back(static_cast<API::Buffer*>(texCoord->_data));
-                    }
+            return true;
+        };
 
-                    for (const auto& color: primitiveSet.colors) {
-                        vertexBuffers.push_back(static_cast<API::Buffer*>(color->_data));
-                    }
+        // Draw the primitive sets one by one
+        for (const auto& it : renderQueue.getPrimitiveSets()) {
+            Resource::SharedPtr<Render::Pipeline> pipeline = getModelPipeline(it.first);
 
-                    const std::vector<VkDeviceSize> offsets(vertexBuffers.size());
-                    frameData.renderCmdBuffer.bindVertexBuffers(vertexBuffers, offsets);
+            // Skip the primitive sets until their pipeline is ready
+            if (!pipeline) {
+                continue;
+            }
 
-                    if (primitiveSet.indices) {
-                        API::Buffer* indicesBuffer = static_cast<API::Buffer*>(primitiveSet.indices->_data);
+            for (const auto& primitiveSetInstance : it.second) {
+                if (!addDrawCall(*pipeline, *primitiveSetInstance.primitiveSet, *primitiveSetInstance.material, primitiveSetInstance.node->getTransform(), 1, 0)) {
+                    return false;
+                }
+            }
 
-                        if (primitiveSet.indices->buffer.size / primitiveSet.indices->buffer.elementsCount == 4) {
-                            frameData.renderCmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT32);
-                        } else {
-                            frameData.renderCmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT16);
-                        }
+            drawPipelines.push_back(std::move(pipeline));
+        }
 
-                        const API::CommandBuffer::CmdDrawIndexed cmdDrawIndexed {
-                            /* cmdDrawIndexed.indexCount    */ primitiveSet.indices->buffer.elementsCount,
-                            /* cmdDrawIndexed.instanceCount */ 1,
-                        };
+        // Draw each batch of identical primitive sets with one instanced draw
+        for (const auto& it : renderQueue.getPrimitiveSetBatches()) {
+            Resource::SharedPtr<Render::Pipeline> pipeline = getModelPipeline(it.first);
 
-                        frameData.renderCmdBuffer.drawIndexed(cmdDrawIndexed);
-                    } else {
-                        const API::CommandBuffer::CmdDraw cmdDraw {
-                            /* cmdDrawIndexed.vertexCount   */ primitiveSet.position->buffer.elementsCount,
-                            /* cmdDrawIndexed.instanceCount */ 1,
-                        };
+            // Skip the primitive sets until their pipeline is ready
+            if (!pipeline) {
+                continue;
+            }
 
-                        frameData.renderCmdBuffer.draw(cmdDraw);
-                    }
+            for (const auto& primitiveSetBatch : it.second) {
+                if (!addDrawCall(
+                    *pipeline,
+                    *primitiveSetBatch.primitiveSet,
+                    *primitiveSetBatch.material,
+                    Math::Mat4x4f::identity(),
+                    primitiveSetBatch.instancesCount,
+                    primitiveSetBatch.firstInstance
+                )) {
+                    return false;
                 }
             }
+
+            drawPipelines.push_back(std::move(pipeline));
         }
     }
 
-    // Render skybox
+    // Prepare the skybox
+    Resource::SharedPtr<Render::Pipeline> skyBoxPipeline;
     {
         Resource::SharedPtr<Render::SkyBox> skyBox = renderQueue.getSkyBox();
 
@@ -437,7 +423,7 @@ bool Forward::render(
                 pipelineId = Pipeline::Id::createSkybox(extraPart);
             }
 
-            const auto& pipeline = _renderer.getPipeline(pipelineId);
+            skyBoxPipeline = _renderer.getPipeline(pipelineId);
 
             Resource::SharedPtr<Render::Texture> skyBoxTexture =  Resource::SharedPtr<Render::Texture>::cast(skyBox->getBackgroundTexture());
             // Get the new (or old) skyBox descriptor set
@@ -452,37 +438,175 @@ bool Forward::render(
                 _skyBoxDescriptorSetPool->free(frameData.skyBoxDescriptorSet);
                 frameData.skyBoxDescriptorSet = skyBoxDescriptorSet;
             }
+        }
+    }
 
-            // Bind descriptor set of the skybox
-            {
-                const API::CommandBuffer::CmdBindDescriptors skyBoxBind{
-                    /* skyBoxBind.pipelineLayout     */ *pipeline->getPipelineAPI().getLayout(),
-                    /* skyBoxBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-                    /* skyBoxBind.firstSet           */ 1,
-                    /* skyBoxBind.descriptorSets     */ {&frameData.skyBoxDescriptorSet->getDescriptorSet()},
-                    /* skyBoxBind.dynamicOffsets     */ {},
-                };
+    const GpuProfiler& gpuProfiler = _renderer.getRenderWindow()->getGpuProfiler();
+
+    const auto recordSkyBox = [this, &frameData, &skyBoxPipeline, &gpuProfiler, currentImageIndex](const API::CommandBuffer& cmdBuffer) {
+        GpuProfiler::Scope profilerScope(gpuProfiler, cmdBuffer, _skyBoxScope, currentImageIndex);
+
+        // Bind descriptor set of the skybox
+        {
+            const API::CommandBuffer::CmdBindDescriptors skyBoxBind{
+                /* skyBoxBind.pipelineLayout     */ *skyBoxPipeline->getPipelineAPI().getLayout(),
+                /* skyBoxBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                /* skyBoxBind.firstSet           */ 1,
+                /* skyBoxBind.descriptorSets     */ {&frameData.skyBoxDescriptorSet->getDescriptorSet()},
+                /* skyBoxBind.dynamicOffsets     */ {},
+            };
 
-                frameData.renderCmdBuffer.bindDescriptorSets(skyBoxBind);
+            cmdBuffer.bindDescriptorSets(skyBoxBind);
+        }
+
+        cmdBuffer.bindPipeline(skyBoxPipeline->getPipelineAPI());
+
+        auto& primitiveSet = SkyBox::getMesh()->getPrimitiveSets()[0];
+
+        cmdBuffer.bindVertexBuffers(
+            {static_cast<API::Buffer*>(primitiveSet.position->_data)},
+            {0}
+        );
+
+        API::Buffer* indicesBuffer = static_cast<API::Buffer*>(primitiveSet.indices->_data);
+        cmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT16);
+        const API::CommandBuffer::CmdDrawIndexed cmdDrawIndexed {
+            /* cmdDrawIndexed.indexCount    */ primitiveSet.indices->buffer.elementsCount,
+            /* cmdDrawIndexed.instanceCount */ 1,
+        };
+
+        cmdBuffer.drawIndexed(cmdDrawIndexed);
+    };
+
+    // Only split the draws between threads if each one has enough of them to be worth it
+    const auto& recording = _renderer.getPreferences().recording;
+    const uint32_t recordingThreadCount = static_cast<uint32_t>(
+        std::min<size_t>(recording.threadCount, _drawCalls.size() / std::max(recording.minDrawsPerThread, 1u))
+    );
+
+    // A pipeline statistics query can't stay active while executing secondary command buffers
+    // without the inheritedQueries feature, so they are only counted when recording inline
+    const bool forwardPipelineStatistics = recordingThreadCount <= 1;
+    gpuProfiler.begin(frameData.renderCmdBuffer, _forwardScope, currentImageIndex, forwardPipelineStatistics);
+
+    // Record the draw calls, timed by the benchmark sample
+    {
+        LUG_PROFILE_SCOPE("Forward::recordDrawCalls");
+
+        if (recordingThreadCount <= 1) {
+            frameData.renderCmdBuffer.beginRenderPass(*renderPass, beginRenderPass);
+
+            frameData.renderCmdBuffer.setViewport({vkViewport});
+            frameData.renderCmdBuffer.setScissor({scissor});
+
+            // Bind descriptor set of the camera
+            frameData.renderCmdBuffer.bindDescriptorSets(cameraBind);
+
+            // Render objects
+            recordDrawCalls(frameData.renderCmdBuffer, frameData, *basePipeline, lightBindings, 0, _drawCalls.size());
+
+            // Render skybox
+            if (skyBoxPipeline) {
+                recordSkyBox(frameData.renderCmdBuffer);
+            }
+        } else {
+            // One more secondary command buffer for the skybox
+            if (!initRecording(frameData, recordingThreadCount + 1)) {
+                return false;
+            }
+
+            if (!_recordingThreadPool || _recordingThreadCount != recording.threadCount) {
+                _recordingThreadPool = std::make_unique<System::ThreadPool>(recording.threadCount);
+                _recordingThreadCount = recording.threadCount;
             }
 
-            frameData.renderCmdBuffer.bindPipeline(pipeline->getPipelineAPI());
+            frameData.renderCmdBuffer.beginRenderPass(*renderPass, beginRenderPass, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+            const VkCommandBufferInheritanceInfo inheritanceInfo{
+                /* inheritanceInfo.sType                */ VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+                /* inheritanceInfo.pNext                */ nullptr,
+                /* inheritanceInfo.renderPass           */ static_cast<VkRenderPass>(*renderPass),
+                /* inheritanceInfo.subpass              */ 0,
+                /* inheritanceInfo.framebuffer          */ static_cast<VkFramebuffer>(frameData.framebuffer.framebuffer),
+                /* inheritanceInfo.occlusionQueryEnable */ VK_FALSE,
+                /* inheritanceInfo.queryFlags           */ 0,
+                /* inheritanceInfo.pipelineStatistics   */ 0
+            };
 
-            auto& primitiveSet = SkyBox::getMesh()->getPrimitiveSets()[0];
+            // The secondary command buffers don't inherit any state from the primary one
+            const auto beginSecondary = [&](const API::CommandBuffer& cmdBuffer) {
+                if (!cmdBuffer.reset() || !cmdBuffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &inheritanceInfo)) {
+                    return false;
+                }
 
-            frameData.renderCmdBuffer.bindVertexBuffers(
-                {static_cast<API::Buffer*>(primitiveSet.position->_data)},
-                {0}
-            );
+                cmdBuffer.setViewport({vkViewport});
+                cmdBuffer.setScissor({scissor});
 
-            API::Buffer* indicesBuffer = static_cast<API::Buffer*>(primitiveSet.indices->_data);
-            frameData.renderCmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT16);
-            const API::CommandBuffer::CmdDrawIndexed cmdDrawIndexed {
-                /* cmdDrawIndexed.indexCount    */ primitiveSet.indices->buffer.elementsCount,
-                /* cmdDrawIndexed.instanceCount */ 1,
+                // Bind descriptor set of the camera
+                cmdBuffer.bindDescriptorSets(cameraBind);
+
+                return true;
             };
 
-            frameData.renderCmdBuffer.drawIndexed(cmdDrawIndexed);
+            // Record the objects, each thread records a contiguous range of the draw calls
+            // Each secondary command buffer draws all the batches of lights of its range, which gives the same
+            // result as the primary command buffer because the lights after the first batch are blended additively
+            std::vector<std::future<bool>> recordings;
+            recordings.reserve(recordingThreadCount);
+
+            const size_t drawCallsPerThread = (_drawCalls.size() + recordingThreadCount - 1) / recordingThreadCount;
+            for (uint32_t i = 0; i < recordingThreadCount; ++i) {
+                const size_t first = i * drawCallsPerThread;
+                const size_t last = std::min(first + drawCallsPerThread, _drawCalls.size());
+
+                recordings.push_back(_recordingThreadPool->enqueue([&, i, first, last]() {
+                    LUG_PROFILE_SCOPE("Forward::recordSecondary");
+
+                    const API::CommandBuffer& cmdBuffer = frameData.recordingCmdBuffers[i];
+
+                    if (!beginSecondary(cmdBuffer)) {
+                        return false;
+                    }
+
+                    recordDrawCalls(cmdBuffer, frameData, *basePipeline, lightBindings, first, last);
+
+                    return cmdBuffer.end();
+                }));
+            }
+
+            // Record the skybox in the meantime
+            bool success = true;
+            {
+                const API::CommandBuffer& cmdBuffer = frameData.recordingCmdBuffers[recordingThreadCount];
+
+                if (beginSecondary(cmdBuffer)) {
+                    if (skyBoxPipeline) {
+                        recordSkyBox(cmdBuffer);
+                    }
+
+                    success = cmdBuffer.end();
+                } else {
+                    success = false;
+                }
+            }
+
+            // Wait for all the threads before returning, they reference the locals of this function
+            LUG_PROFILE_SCOPE("Forward::waitRecordings");
+            for (auto& future : recordings) {
+                success = future.get() && success;
+            }
+
+            if (!success) {
+                LUG_LOG.error("Forward::render: Can't record the secondary command buffers");
+                return false;
+            }
+
+            std::vector<const API::CommandBuffer*> cmdBuffers(recordingThreadCount + 1);
+            for (uint32_t i = 0; i <= recordingThreadCount; ++i) {
+                cmdBuffers[i] = &frameData.recordingCmdBuffers[i];
+            }
+
+            frameData.renderCmdBuffer.executeCommands(cmdBuffers);
         }
     }
 
@@ -534,6 +658,8 @@ bool Forward::render(
     // End of the render pass
     frameData.renderCmdBuffer.endRenderPass();
 
+    gpuProfiler.end(frameData.renderCmdBuffer, _forwardScope, currentImageIndex, forwardPipelineStatistics);
+
     // Resolve the image if antialiasing is enabled
     if (frameData.framebuffer.antialiasing != Renderer::Antialiasing::NoAA) {
         const auto& viewport = _renderView.getViewport();
@@ -602,21 +728,42 @@ bool Forward::render(
         return false;
     }
 
-    if (!_transferQueue->submit(
-        frameData.transferCmdBuffer,
-        {static_cast<VkSemaphore>(frameData.transferSemaphore)},
-        {},
-        {},
-        static_cast<VkFence>(frameData.transferFence)
-    ) || !_graphicsQueue->submit(
-        frameData.renderCmdBuffer,
-        {static_cast<VkSemaphore>(frameData.drawPassCompleteSemaphore)},
-        {static_cast<VkSemaphore>(frameData.transferSemaphore), static_cast<VkSemaphore>(imageReadySemaphore)},
-        {VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT},
-        static_cast<VkFence>(frameData.renderFence)
-    )) {
-        LUG_LOG.error("Forward::render: Failed draw pass");
-        return false;
+    // Make the uniform and instance buffers written this frame visible to the device, with only one flush
+    {
+        std::vector<VkMappedMemoryRange> ranges;
+
+        _bloomBufferPool->flush(ranges);
+        _cameraBufferPool->flush(ranges);
+        _lightBufferPool->flush(ranges);
+        _materialBufferPool->flush(ranges);
+        frameData.instanceBuffer.flush(ranges);
+
+        if (!_renderer.getDevice().flushMappedMemoryRanges(ranges)) {
+            LUG_LOG.error("Forward::render: Can't flush the uniform buffers");
+            return false;
+        }
+    }
+
+    // Submit the transfers and the draws
+    {
+        LUG_PROFILE_SCOPE("Forward::submit");
+
+        if (!_transferQueue->submit(
+            frameData.transferCmdBuffer,
+            {static_cast<VkSemaphore>(frameData.transferSemaphore)},
+            {},
+            {},
+            static_cast<VkFence>(frameData.transferFence)
+        ) || !_graphicsQueue->submit(
+            frameData.renderCmdBuffer,
+            {static_cast<VkSemaphore>(frameData.drawPassCompleteSemaphore)},
+            {static_cast<VkSemaphore>(frameData.transferSemaphore), static_cast<VkSemaphore>(imageReadySemaphore)},
+            {VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT},
+            static_cast<VkFence>(frameData.renderFence)
+        )) {
+            LUG_LOG.error("Forward::render: Failed draw pass");
+            return false;
+        }
     }
 
     std::vector<VkSemaphore> waitSemaphores {static_cast<VkSemaphore>(frameData.drawPassCompleteSemaphore)};
@@ -641,6 +788,145 @@ bool Forward::render(
     return true;
 }
 
+void Forward::recordDrawCalls(
+    const API::CommandBuffer& cmdBuffer,
+    const FrameData& frameData,
+    Render::Pipeline& basePipeline,
+    const std::vector<LightBinding>& lightBindings,
+    size_t first,
+    size_t last
+) const {
+    LUG_PROFILE_SCOPE("Forward::recordDrawCalls");
+
+    // Bind a default pipeline for the rendering
+    cmdBuffer.bindPipeline(basePipeline.getPipelineAPI());
+    const Render::Pipeline* boundPipeline = &basePipeline;
+
+    for (uint32_t i = 0; i < lightBindings.size(); ++i) {
+        // Bind descriptor set of the light
+        {
+            const API::CommandBuffer::CmdBindDescriptors lightBind{
+                /* lightBind.pipelineLayout     */ *basePipeline.getPipelineAPI().getLayout(),
+                /* lightBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                /* lightBind.firstSet           */ 1,
+                /* lightBind.descriptorSets     */ {&lightBindings[i].descriptorSet->getDescriptorSet()},
+                /* lightBind.dynamicOffsets     */ {lightBindings[i].offset},
+            };
+
+            cmdBuffer.bindDescriptorSets(lightBind);
+        }
+
+        // Blend constants are used as dst blend factor
+        // We set them to 0 so that there is no blending for the first batch of lights,
+        // and we need to re-enable the blend after it
+        if (i <= 1) {
+            const float blendFactor = i == 0 ? 0.0f : 1.0f;
+            const float blendConstants[4] = {blendFactor, blendFactor, blendFactor, blendFactor};
+            cmdBuffer.setBlendConstants(blendConstants);
+        }
+
+        for (size_t j = first; j < last; ++j) {
+            const DrawCall& drawCall = _drawCalls[j];
+            const API::GraphicsPipeline& pipelineAPI = drawCall.pipeline->getPipelineAPI();
+
+            // Bind pipeline
+            if (drawCall.pipeline != boundPipeline) {
+                cmdBuffer.bindPipeline(pipelineAPI);
+                boundPipeline = drawCall.pipeline;
+            }
+
+            // The model transforms of the instanced pipelines are in the instance buffer
+            const bool instanced = drawCall.pipeline->getId().modelInfo.instanced;
+
+            if (!instanced) {
+                const API::CommandBuffer::CmdPushConstants cmdPushConstants{
+                    /* cmdPushConstants.layout      */ static_cast<VkPipelineLayout>(*pipelineAPI.getLayout()),
+                    /* cmdPushConstants.stageFlags  */ VK_SHADER_STAGE_VERTEX_BIT,
+                    /* cmdPushConstants.offset      */ 0,
+                    /* cmdPushConstants.size        */ sizeof(drawCall.transform),
+                    /* cmdPushConstants.values      */ &drawCall.transform
+                };
+                cmdBuffer.pushConstants(cmdPushConstants);
+            }
+
+            // Bind descriptor set of the material
+            {
+                std::vector<const API::DescriptorSet*> materialDescriptorSetsBind{&drawCall.materialDescriptorSet->getDescriptorSet()};
+
+                if (drawCall.materialTexturesDescriptorSet) {
+                    materialDescriptorSetsBind.push_back(&drawCall.materialTexturesDescriptorSet->getDescriptorSet());
+                }
+
+                const API::CommandBuffer::CmdBindDescriptors materialBind{
+                    /* materialBind.pipelineLayout     */ *pipelineAPI.getLayout(),
+                    /* materialBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    /* materialBind.firstSet           */ 2,
+                    /* materialBind.descriptorSets     */ materialDescriptorSetsBind,
+                    /* materialBind.dynamicOffsets     */ {drawCall.materialBufferOffset},
+                };
+
+                cmdBuffer.bindDescriptorSets(materialBind);
+            }
+
+            const Render::Mesh::PrimitiveSet& primitiveSet = *drawCall.primitiveSet;
+
+            std::vector<const API::Buffer*> vertexBuffers{
+                static_cast<API::Buffer*>(primitiveSet.position->_data),
+                static_cast<API::Buffer*>(primitiveSet.normal->_data)
+            };
+
+            if (primitiveSet.tangent) {
+                vertexBuffers.push_back(static_cast<API::Buffer*>(primitiveSet.tangent->_data));
+            }
+
+            for (const auto& texCoord: primitiveSet.texCoords) {
+                vertexBuffers.push_back(static_cast<API::Buffer*>(texCoord->_data));
+            }
+
+            for (const auto& color: primitiveSet.colors) {
+                vertexBuffers.push_back(static_cast<API::Buffer*>(color->_data));
+            }
+
+            // The model transforms are the last vertex binding of the instanced pipelines
+            if (instanced) {
+                vertexBuffers.push_back(&frameData.instanceBuffer.getBuffer());
+            }
+
+            const std::vector<VkDeviceSize> offsets(vertexBuffers.size());
+            cmdBuffer.bindVertexBuffers(vertexBuffers, offsets);
+
+            if (primitiveSet.indices) {
+                API::Buffer* indicesBuffer = static_cast<API::Buffer*>(primitiveSet.indices->_data);
+
+                if (primitiveSet.indices->buffer.size / primitiveSet.indices->buffer.elementsCount == 4) {
+                    cmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT32);
+                } else {
+                    cmdBuffer.bindIndexBuffer(*indicesBuffer, VK_INDEX_TYPE_UINT16);
+                }
+
+                const API::CommandBuffer::CmdDrawIndexed cmdDrawIndexed {
+                    /* cmdDrawIndexed.indexCount    */ primitiveSet.indices->buffer.elementsCount,
+                    /* cmdDrawIndexed.instanceCount */ drawCall.instancesCount,
+                    /* cmdDrawIndexed.firstIndex    */ 0,
+                    /* cmdDrawIndexed.vertexOffset  */ 0,
+                    /* cmdDrawIndexed.firstInstance */ drawCall.firstInstance
+                };
+
+                cmdBuffer.drawIndexed(cmdDrawIndexed);
+            } else {
+                const API::CommandBuffer::CmdDraw cmdDraw {
+                    /* cmdDrawIndexed.vertexCount   */ primitiveSet.position->buffer.elementsCount,
+                    /* cmdDrawIndexed.instanceCount */ drawCall.instancesCount,
+                    /* cmdDrawIndexed.firstVertex   */ 0,
+                    /* cmdDrawIndexed.firstInstance */ drawCall.firstInstance
+                };
+
+                cmdBuffer.draw(cmdDraw);
+            }
+        }
+    }
+}
+
 bool Forward::init(const std::vector<API::ImageView>& imageViews) {
     VkResult result{VK_SUCCESS};
 
@@ -769,12 +1055,22 @@ bool Forward::init(const std::vector<API::ImageView>& imageViews) {
         }
     }
 
+    // Profiling scopes
+    {
+        GpuProfiler& gpuProfiler = _renderer.getRenderWindow()->getGpuProfiler();
+
+        _forwardScope = gpuProfiler.addScope("Forward");
+        _skyBoxScope = gpuProfiler.addScope("SkyBox");
+    }
+
     return _bloomPass->init() && initFrameDatas(imageViews);
 }
 
 void Forward::destroy() {
     --_forwardCount;
 
+    _recordingThreadPool.reset();
+
     _graphicsQueue->waitIdle();
     _transferQueue->waitIdle();
 
@@ -806,6 +1102,11 @@ void Forward::destroy() {
         }
 
         _skyBoxDescriptorSetPool->free(frameData.skyBoxDescriptorSet);
+
+        frameData.instanceBuffer.destroy();
+
+        frameData.recordingCmdBuffers.clear();
+        frameData.recordingCmdPools.clear();
     }
 
     for (unsigned i = 0; i < _framesData.size(); ++i) {
@@ -1265,6 +1566,40 @@ const API::ImageView& Forward::getSceneOffscreenImageView(uint32_t currentImageI
     return _framesData[currentImageIndex].framebuffer.sceneImage.imageView;
 }
 
+bool Forward::initRecording(FrameData& frameData, uint32_t cmdBuffersCount) {
+    if (frameData.recordingCmdBuffers.size() >= cmdBuffersCount) {
+        return true;
+    }
+
+    // The command buffers keep a pointer to their pool, so recreate everything instead of growing the vectors
+    frameData.recordingCmdBuffers.clear();
+    frameData.recordingCmdPools.clear();
+
+    frameData.recordingCmdPools.resize(cmdBuffersCount);
+    frameData.recordingCmdBuffers.resize(cmdBuffersCount);
+
+    VkResult result{VK_SUCCESS};
+    API::Builder::CommandPool commandPoolBuilder(_renderer.getDevice(), *_graphicsQueue->getQueueFamily());
+
+    for (uint32_t i = 0; i < cmdBuffersCount; ++i) {
+        // Each recording thread needs its own command pool, they are not thread-safe
+        if (!commandPoolBuilder.build(frameData.recordingCmdPools[i], &result)) {
+            LUG_LOG.error("Forward::initRecording: Can't create the recording command pool: {}", result);
+            return false;
+        }
+
+        API::Builder::CommandBuffer commandBufferBuilder(_renderer.getDevice(), frameData.recordingCmdPools[i]);
+        commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+        if (!commandBufferBuilder.build(frameData.recordingCmdBuffers[i], &result)) {
+            LUG_LOG.error("Forward::initRecording: Can't create the secondary command buffer: {}", result);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // Technique
 } // Render
 } // Vulkan
@@ -0,0 +1,333 @@
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
+
+#include <cstring>
+#include <set>
+
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/Graphics/Vulkan/API/Image.hpp>
+#include <lug/Graphics/Vulkan/API/Queue.hpp>
+#include <lug/Graphics/Vulkan/API/QueueFamily.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+std::atomic<uint64_t> UploadBatch::_submitsCount{0};
+std::atomic<uint64_t> UploadBatch::_stagingAllocationsCount{0};
+
+UploadBatch::UploadBatch() : _backend(getVulkanBackend()) {}
+
+UploadBatch::UploadBatch(Backend backend) : _backend(std::move(backend)) {}
+
+UploadBatch::~UploadBatch() {
+    if (_submitted) {
+        wait();
+    }
+}
+
+VkDeviceSize UploadBatch::addData(const void* data, VkDeviceSize size, VkDeviceSize alignment) {
+    // The offsets of the copies must be multiples of 4 and of the size of a texel
+    alignment = alignment ? alignment : 4;
+    while (alignment % 4) {
+        alignment *= 2;
+    }
+
+    const VkDeviceSize offset = (_stagingSize + alignment - 1) / alignment * alignment;
+
+    _data.push_back({data, size, offset});
+    _stagingSize = offset + size;
+
+    return offset;
+}
+
+VkDeviceSize UploadBatch::addData(ImageDecoder::Pixels&& pixels, VkDeviceSize size, VkDeviceSize alignment) {
+    const VkDeviceSize offset = addData(pixels.get(), size, alignment);
+
+    _pixels.push_back(std::move(pixels));
+
+    return offset;
+}
+
+void UploadBatch::addImage(const API::Image& image, uint32_t mipLevels, uint32_t layersCount, std::vector<VkBufferImageCopy> regions) {
+    _images.push_back({&image, mipLevels, layersCount, std::move(regions)});
+}
+
+void UploadBatch::addBuffer(const API::Buffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    const VkDeviceSize stagingOffset = addData(data, size);
+
+    _buffers.push_back({
+        &buffer,
+        {
+            /* region.srcOffset */ stagingOffset,
+            /* region.dstOffset */ offset,
+            /* region.size */ size
+        }
+    });
+}
+
+bool UploadBatch::submit(const API::Device& device, const API::Queue& queue) {
+    if (_submitted) {
+        LUG_LOG.error("UploadBatch::submit: The batch is already submitted");
+        return false;
+    }
+
+    if (isEmpty()) {
+        return true;
+    }
+
+    // One staging buffer for all the uploads
+    if (_stagingSize) {
+        if (!_backend.createStagingBuffer(*this, device, queue)) {
+            release();
+            return false;
+        }
+
+        ++_stagingAllocationsCount;
+    }
+
+    // The data is copied, the pixels are not needed anymore
+    _data.clear();
+    _pixels.clear();
+
+    if (!_backend.submit(*this, device, queue)) {
+        release();
+        return false;
+    }
+
+    ++_submitsCount;
+    _submitted = true;
+
+    return true;
+}
+
+void UploadBatch::copyData(void* stagingData) const {
+    for (const Data& data : _data) {
+        std::memcpy(static_cast<uint8_t*>(stagingData) + data.offset, data.data, static_cast<std::size_t>(data.size));
+    }
+}
+
+bool UploadBatch::isComplete() {
+    if (!_submitted) {
+        return true;
+    }
+
+    if (!_backend.isComplete(*this)) {
+        return false;
+    }
+
+    release();
+    return true;
+}
+
+bool UploadBatch::wait() {
+    if (!_submitted) {
+        return true;
+    }
+
+    if (!_backend.wait(*this)) {
+        LUG_LOG.error("UploadBatch::wait: Can't vkWaitForFences");
+        return false;
+    }
+
+    release();
+    return true;
+}
+
+void UploadBatch::release() {
+    // Properly destroy everything in the right order
+    _fence.destroy();
+    _commandBuffer.destroy();
+    _commandPool.destroy();
+    _stagingBufferMemory.destroy();
+    _stagingBuffer.destroy();
+
+    _data.clear();
+    _pixels.clear();
+    _stagingSize = 0;
+
+    _images.clear();
+    _buffers.clear();
+
+    _submitted = false;
+}
+
+bool UploadBatch::createVulkanStagingBuffer(const API::Device& device, const API::Queue& queue) {
+    VkResult result{VK_SUCCESS};
+
+    API::Builder::Buffer bufferBuilder(device);
+    bufferBuilder.setQueueFamilyIndices(std::set<uint32_t>{queue.getQueueFamily()->getIdx()});
+    bufferBuilder.setSize(_stagingSize);
+    bufferBuilder.setUsage(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    bufferBuilder.setExclusive(true);
+
+    if (!bufferBuilder.build(_stagingBuffer, &result)) {
+        LUG_LOG.error("UploadBatch::submit: Can't create the staging buffer: {}", result);
+        return false;
+    }
+
+    API::Builder::DeviceMemory deviceMemoryBuilder(device);
+    deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    deviceMemoryBuilder.addBuffer(_stagingBuffer);
+
+    if (!deviceMemoryBuilder.build(_stagingBufferMemory, &result)) {
+        LUG_LOG.error("UploadBatch::submit: Can't create the staging buffer device memory: {}", result);
+        return false;
+    }
+
+    // Mapped once for all the data
+    uint8_t* stagingData = static_cast<uint8_t*>(_stagingBufferMemory.mapBuffer(_stagingBuffer));
+    if (!stagingData) {
+        return false;
+    }
+
+    copyData(stagingData);
+
+    _stagingBufferMemory.unmap();
+
+    return true;
+}
+
+bool UploadBatch::submitVulkan(const API::Device& device, const API::Queue& queue) {
+    VkResult result{VK_SUCCESS};
+
+    {
+        API::Builder::CommandPool commandPoolBuilder(device, *queue.getQueueFamily());
+        if (!commandPoolBuilder.build(_commandPool, &result)) {
+            LUG_LOG.error("UploadBatch::submit: Can't create the command pool: {}", result);
+            return false;
+        }
+
+        API::Builder::CommandBuffer commandBufferBuilder(device, _commandPool);
+        commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+        if (!commandBufferBuilder.build(_commandBuffer, &result)) {
+            LUG_LOG.error("UploadBatch::submit: Can't create the command buffer: {}", result);
+            return false;
+        }
+
+        API::Builder::Fence fenceBuilder(device);
+        if (!fenceBuilder.build(_fence, &result)) {
+            LUG_LOG.error("UploadBatch::submit: Can't create the fence: {}", result);
+            return false;
+        }
+    }
+
+    _commandBuffer.begin();
+
+    // Prepare all the images for transfer at once
+    if (!_images.empty()) {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+        pipelineBarrier.imageMemoryBarriers.resize(_images.size());
+
+        for (uint32_t i = 0; i < _images.size(); ++i) {
+            pipelineBarrier.imageMemoryBarriers[i].srcAccessMask = 0;
+            pipelineBarrier.imageMemoryBarriers[i].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            pipelineBarrier.imageMemoryBarriers[i].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            pipelineBarrier.imageMemoryBarriers[i].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            pipelineBarrier.imageMemoryBarriers[i].image = _images[i].image;
+            pipelineBarrier.imageMemoryBarriers[i].subresourceRange.levelCount = _images[i].mipLevels;
+            pipelineBarrier.imageMemoryBarriers[i].subresourceRange.layerCount = _images[i].layersCount;
+        }
+
+        _commandBuffer.pipelineBarrier(pipelineBarrier);
+    }
+
+    for (const ImageUpload& image : _images) {
+        if (image.regions.empty()) {
+            continue;
+        }
+
+        const API::CommandBuffer::CmdCopyBufferToImage cmdCopyBufferToImage{
+            /* cmdCopyBufferToImage.srcBuffer */ _stagingBuffer,
+            /* cmdCopyBufferToImage.dstImage */ *image.image,
+            /* cmdCopyBufferToImage.dstImageLayout */ VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            /* cmdCopyBufferToImage.regions */ image.regions
+        };
+
+        _commandBuffer.copyBufferToImage(cmdCopyBufferToImage);
+    }
+
+    for (const BufferUpload& buffer : _buffers) {
+        const API::CommandBuffer::CmdCopyBuffer cmdCopyBuffer{
+            /* cmdCopyBuffer.srcBuffer */ _stagingBuffer,
+            /* cmdCopyBuffer.dstBuffer */ *buffer.buffer,
+            /* cmdCopyBuffer.regions */ {buffer.region}
+        };
+
+        _commandBuffer.copyBuffer(cmdCopyBuffer);
+    }
+
+    // Prepare all the images for shader read and make all the buffers visible at once
+    {
+        API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+        pipelineBarrier.imageMemoryBarriers.resize(_images.size());
+        pipelineBarrier.bufferMemoryBarriers.resize(_buffers.size());
+
+        for (uint32_t i = 0; i < _images.size(); ++i) {
+            pipelineBarrier.imageMemoryBarriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            pipelineBarrier.imageMemoryBarriers[i].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            pipelineBarrier.imageMemoryBarriers[i].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            pipelineBarrier.imageMemoryBarriers[i].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            pipelineBarrier.imageMemoryBarriers[i].image = _images[i].image;
+            pipelineBarrier.imageMemoryBarriers[i].subresourceRange.levelCount = _images[i].mipLevels;
+            pipelineBarrier.imageMemoryBarriers[i].subresourceRange.layerCount = _images[i].layersCount;
+        }
+
+        for (uint32_t i = 0; i < _buffers.size(); ++i) {
+            pipelineBarrier.bufferMemoryBarriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            pipelineBarrier.bufferMemoryBarriers[i].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+            pipelineBarrier.bufferMemoryBarriers[i].buffer = _buffers[i].buffer;
+            pipelineBarrier.bufferMemoryBarriers[i].offset = _buffers[i].region.dstOffset;
+            pipelineBarrier.bufferMemoryBarriers[i].size = _buffers[i].region.size;
+        }
+
+        _commandBuffer.pipelineBarrier(pipelineBarrier);
+    }
+
+    if (!_commandBuffer.end()) {
+        LUG_LOG.error("UploadBatch::submit: Can't end the command buffer");
+        return false;
+    }
+
+    if (!queue.submit(_commandBuffer, {}, {}, {}, static_cast<VkFence>(_fence))) {
+        LUG_LOG.error("UploadBatch::submit: Can't submit the command buffer");
+        return false;
+    }
+
+    return true;
+}
+
+UploadBatch::Backend UploadBatch::getVulkanBackend() {
+    Backend backend;
+
+    backend.createStagingBuffer = [](UploadBatch& uploadBatch, const API::Device& device, const API::Queue& queue) {
+        return uploadBatch.createVulkanStagingBuffer(device, queue);
+    };
+
+    backend.submit = [](UploadBatch& uploadBatch, const API::Device& device, const API::Queue& queue) {
+        return uploadBatch.submitVulkan(device, queue);
+    };
+
+    backend.isComplete = [](UploadBatch& uploadBatch) {
+        return uploadBatch._fence.getStatus() == VK_SUCCESS;
+    };
+
+    // TODO(saveman71): set a define for the fence timeout
+    backend.wait = [](UploadBatch& uploadBatch) {
+        return uploadBatch._fence.wait();
+    };
+
+    return backend;
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
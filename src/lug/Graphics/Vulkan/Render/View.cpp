@@ -8,6 +8,7 @@
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -50,11 +51,24 @@ bool View::init(
 }
 
 bool View::render(const API::Semaphore& imageReadySemaphore, uint32_t currentImageIndex) {
+    LUG_PROFILE_SCOPE("View::render");
+
     if (!_camera) {
         return true; // Not fatal, return success anyway
     }
 
-    _camera->update(_renderer, *this, _renderQueue);
+    // Fetch the visible objects of the scene in the render queue
+    {
+        LUG_PROFILE_SCOPE("View::fetchVisibleObjects");
+        _camera->update(_renderer, *this, _renderQueue);
+    }
+
+    const auto& instancing = _renderer.getPreferences().instancing;
+    if (instancing.enabled) {
+        LUG_PROFILE_SCOPE("View::groupInstances");
+        _renderQueue.groupInstances(instancing.minInstancesCount);
+    }
+
     return _renderTechnique->render(_renderQueue, imageReadySemaphore, _drawCompleteSemaphores[currentImageIndex], currentImageIndex);
 }
 
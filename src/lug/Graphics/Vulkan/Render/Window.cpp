@@ -1,10 +1,16 @@
+#include <algorithm>
 #include <cstring>
+#include <lug/Graphics/Render/Camera/Camera.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
 #include <lug/Graphics/Vulkan/Render/SkyBox.hpp>
 #include <lug/Graphics/Vulkan/Render/View.hpp>
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Image.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/ImageView.hpp>
@@ -12,7 +18,9 @@
 #include <lug/Graphics/Vulkan/API/Builder/Surface.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Swapchain.hpp>
 #include <lug/Graphics/Vulkan/API/Instance.hpp>
+#include <lug/System/Clock.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
 
 #if defined(LUG_SYSTEM_WINDOWS)
     #include <lug/Window/Win32/WindowImplWin32.hpp>
@@ -34,6 +42,11 @@ Window::~Window() {
 }
 
 bool Window::pollEvent(lug::Window::Event& event) {
+    // There is no native window to receive events from
+    if (isHeadless()) {
+        return false;
+    }
+
     if (lug::Window::Window::pollEvent(event)) {
         if (event.type == lug::Window::Event::Type::Resize) {
             _swapchain.setOutOfDate(true);
@@ -59,82 +72,95 @@ bool Window::pollEvent(lug::Window::Event& event) {
 }
 
 bool Window::beginFrame(const lug::System::Time &elapsedTime) {
-    AcquireImageData* acquireImageData = nullptr;
-    // Retrieve free AcquireImageData
+    LUG_PROFILE_SCOPE("Window::beginFrame");
+
+    InFlightFrame& inFlightFrame = _inFlightFrames[_currentFrameIndex];
+
+    // The CPU can't be more than framesInFlight frames ahead of the GPU, whatever the number of images
     {
-        for (auto& acquireImageData_ : _acquireImageDatas) {
-            if (acquireImageData_.imageIdx == -1) {
-                acquireImageData = &acquireImageData_;
-                break;
-            }
+        LUG_PROFILE_SCOPE("Window::waitFrame");
+
+        if (!inFlightFrame.fence.wait()) {
+            LUG_LOG.error("Window::beginFrame: Can't wait for the previous frame");
+            return false;
         }
     }
 
+    updateLatency();
+    DescriptorSetPool::DescriptorSetPool::newFrame();
+
     if (_isGuiInitialized == true) {
         _guiInstance.beginFrame(elapsedTime);
     }
 
-    while (_swapchain.isOutOfDate() || !_swapchain.getNextImage(&_currentImageIndex, static_cast<VkSemaphore>(acquireImageData->completeSemaphore))) {
-        if (_swapchain.isOutOfDate()) {
-            if (!initSwapchainCapabilities() || !initSwapchain() || !buildCommandBuffers()) {
-                return false;
-            }
-
-            if (_isGuiInitialized == true) {
-                if (!_guiInstance.initFramebuffers(_swapchain.getImagesViews())) {
-                    LUG_LOG.error("Window::beginFrame: Failed to initialise Gui framebuffers");
+    // Acquire the next image, recreate the swapchain if needed
+    {
+        LUG_PROFILE_SCOPE("Window::acquireImage");
+        // The frames in flight are recreated if the number of images changes, don't keep a reference on them
+        while (_swapchain.isOutOfDate() || !_swapchain.getNextImage(&_currentImageIndex, static_cast<VkSemaphore>(_inFlightFrames[_currentFrameIndex].acquireImageSemaphore))) {
+            if (_swapchain.isOutOfDate()) {
+                if (!initSwapchainCapabilities() || !initSwapchain() || !initInFlightFrames() || !buildCommandBuffers()) {
                     return false;
                 }
-            }
-
-            for (auto& renderView: _renderViews) {
-                View* renderView_ = static_cast<View*>(renderView.get());
 
-                if (!renderView_->getRenderTechnique()->setSwapchainImageViews(_swapchain.getImagesViews()) ||
-                    !renderView_->getRenderTechnique()->initFrameDatas(_swapchain.getImagesViews())) {
-                    return false;
+                if (_isGuiInitialized == true) {
+                    if (!_guiInstance.initFramebuffers(_swapchain.getImagesViews())) {
+                        LUG_LOG.error("Window::beginFrame: Failed to initialise Gui framebuffers");
+                        return false;
+                    }
                 }
 
-                renderView_->setDirty();
-            }
-        } else {
-            return false;
-        }
-    }
+                for (auto& renderView: _renderViews) {
+                    View* renderView_ = static_cast<View*>(renderView.get());
 
-    // Set previous AcquireImageData free
-    {
-        for (auto& acquireImageData_ : _acquireImageDatas) {
-            if (acquireImageData_.imageIdx == (int)_currentImageIndex) {
-                acquireImageData_.imageIdx = -1;
+                    if (!renderView_->getRenderTechnique()->setSwapchainImageViews(_swapchain.getImagesViews()) ||
+                        !renderView_->getRenderTechnique()->initFrameDatas(_swapchain.getImagesViews())) {
+                        return false;
+                    }
+
+                    renderView_->setDirty();
+                }
+            } else {
+                return false;
             }
         }
     }
 
-    acquireImageData->imageIdx = (int)_currentImageIndex;
+    _inFlightFrames[_currentFrameIndex].beginTimestamp = lug::System::Clock::getTimestamp();
 
     FrameData& frameData = _framesData[_currentImageIndex];
     API::CommandBuffer& cmdBuffer = frameData.cmdBuffers[0];
 
+    // Must be resolved before the begin command buffer resets the queries
+    _gpuProfiler.resolve(_currentImageIndex);
+
     std::vector<VkSemaphore> imageReadyVkSemaphores(frameData.imageReadySemaphores.size());
 
     for (unsigned i = 0; i < frameData.imageReadySemaphores.size(); ++i) {
         imageReadyVkSemaphores[i] = static_cast<VkSemaphore>(frameData.imageReadySemaphores[i]);
     }
 
+    // The offscreen images are available right away
+    if (isHeadless()) {
+        return _presentQueue->submit(cmdBuffer, imageReadyVkSemaphores);
+    }
+
     return _presentQueue->submit(
         cmdBuffer,
         imageReadyVkSemaphores,
-        {static_cast<VkSemaphore>(acquireImageData->completeSemaphore)},
+        {static_cast<VkSemaphore>(_inFlightFrames[_currentFrameIndex].acquireImageSemaphore)},
         {VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT}
     );
 }
 
 bool Window::endFrame() {
+    LUG_PROFILE_SCOPE("Window::endFrame");
+
     bool uiResult = false;
     bool presentQueueResult = false;
 
     FrameData& frameData = _framesData[_currentImageIndex];
+    InFlightFrame& inFlightFrame = _inFlightFrames[_currentFrameIndex];
 
     API::CommandBuffer& cmdBuffer = frameData.cmdBuffers[1];
     std::vector<VkSemaphore> waitSemaphores(_renderViews.size());
@@ -153,25 +179,59 @@ bool Window::endFrame() {
         ++i;
     }
 
+    // Nothing waits for the end of the frame in headless mode but the fence
+    std::vector<VkSemaphore> signalSemaphores;
+    VkFence fence = static_cast<VkFence>(inFlightFrame.fence);
+
+    if (!isHeadless()) {
+        signalSemaphores.push_back(static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore));
+    }
+
     if (_isGuiInitialized) {
         uiResult = _guiInstance.endFrame(waitSemaphores, _currentImageIndex);
+    } else {
+        uiResult = true;
+    }
+
+    // Reset right before the submit, the next beginFrame of this frame in flight waits for it
+    if (!inFlightFrame.fence.reset()) {
+        LUG_LOG.error("Window::endFrame: Can't reset the fence of the frame");
+        return false;
+    }
+
+    if (_isGuiInitialized) {
         presentQueueResult = _presentQueue->submit(cmdBuffer,
-                                                   { static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore) },
+                                                   signalSemaphores,
                                                    { static_cast<VkSemaphore>(_guiInstance.getSemaphore(_currentImageIndex)) },
-                                                   { VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT });
+                                                   { VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT },
+                                                   fence);
     } else {
-        uiResult = true;
         std::vector<VkPipelineStageFlags> waitDstStageMasks(waitSemaphores.size(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
 
         presentQueueResult = _presentQueue->submit(cmdBuffer,
-                                                   { static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore) },
+                                                   signalSemaphores,
                                                    waitSemaphores,
-                                                   waitDstStageMasks);
+                                                   waitDstStageMasks,
+                                                   fence);
+    }
+
+    if (presentQueueResult) {
+        _gpuProfiler.markSubmitted(_currentImageIndex);
+        _lastRenderedImageIndex = static_cast<int>(_currentImageIndex);
+        _lastRenderedFrameIndex = static_cast<int>(_currentFrameIndex);
+        inFlightFrame.pending = true;
+    } else if (!resignalFence(inFlightFrame)) {
+        return false;
     }
 
-    return uiResult
+    const bool presentResult = uiResult
         && presentQueueResult
         && _swapchain.present(_presentQueue, _currentImageIndex, static_cast<VkSemaphore>(frameData.allDrawsFinishedSemaphore));
+
+    inFlightFrame.presentTimestamp = lug::System::Clock::getTimestamp();
+    _currentFrameIndex = (_currentFrameIndex + 1) % _inFlightFrames.size();
+
+    return presentResult;
 }
 
 lug::Graphics::Render::View* Window::createView(lug::Graphics::Render::View::InitInfo& initInfo) {
@@ -187,11 +247,15 @@ lug::Graphics::Render::View* Window::createView(lug::Graphics::Render::View::Ini
 }
 
 bool Window::render() {
+    LUG_PROFILE_SCOPE("Window::render");
+
     FrameData& frameData = _framesData[_currentImageIndex];
     uint32_t i = 0;
     // Contains all async results of Render::View::render
     std::vector<std::future<bool>> results(_renderViews.size());
 
+    computeVisibility();
+
     // Run renderView->render for all render views asynchronously
     for (auto& renderView: _renderViews) {
         auto view = static_cast<View*>(renderView.get());
@@ -203,6 +267,7 @@ bool Window::render() {
     }
 
     // Wait for jobs finish and check result
+    LUG_PROFILE_SCOPE("Window::waitViews");
     bool success = true;
     for (auto&& result: results) {
         result.wait();
@@ -212,6 +277,61 @@ bool Window::render() {
     return success;
 }
 
+void Window::computeVisibility() {
+    LUG_PROFILE_SCOPE("Window::computeVisibility");
+
+    // The views of the same scene share one traversal of the scene
+    std::vector<std::pair<::lug::Graphics::Scene::Scene*, std::vector<const ::lug::Graphics::Render::View*>>> scenes;
+
+    for (auto& renderView: _renderViews) {
+        const auto camera = renderView->getCamera();
+        if (!camera || !camera->getParent()) {
+            continue;
+        }
+
+        ::lug::Graphics::Scene::Scene* scene = &camera->getParent()->getScene();
+
+        auto it = std::find_if(scenes.begin(), scenes.end(), [scene](const auto& sceneViews) {
+            return sceneViews.first == scene;
+        });
+
+        if (it == scenes.end()) {
+            scenes.push_back({scene, {}});
+            it = scenes.end() - 1;
+        }
+
+        it->second.push_back(renderView.get());
+    }
+
+    // Without the shared visibility, each view traverses the scene when it fetches its visible objects
+    const bool shared = _renderer.getPreferences().visibility.shared;
+
+    for (auto& sceneViews: scenes) {
+        sceneViews.first->computeVisibility(shared ? sceneViews.second : std::vector<const ::lug::Graphics::Render::View*>{});
+    }
+}
+
+bool Window::readback(std::vector<uint8_t>& pixels) const {
+    if (!isHeadless() || !_initInfo.headless.readback || _lastRenderedImageIndex == -1) {
+        return false;
+    }
+
+    const FrameData& frameData = _framesData[_lastRenderedImageIndex];
+
+    if (!_inFlightFrames[_lastRenderedFrameIndex].fence.wait()) {
+        LUG_LOG.error("Window::readback: Can't wait for the last frame");
+        return false;
+    }
+
+    // The memory is host coherent, no need to invalidate it
+    const size_t size = static_cast<size_t>(_swapchain.getExtent().width) * _swapchain.getExtent().height * 4;
+
+    pixels.resize(size);
+    std::memcpy(pixels.data(), frameData.readbackData, size);
+
+    return true;
+}
+
 std::unique_ptr<Window>
 
 Window::create(lug::Graphics::Vulkan::Renderer& renderer, Window::InitInfo& initInfo) {
@@ -314,8 +434,8 @@ bool Window::initPresentQueue() {
 
     LUG_ASSERT(info != nullptr, "PhysicalDeviceInfo cannot be null");
 
-    // Get present queue families
-    {
+    // Get present queue families (without surface, the graphics queue is used to "present")
+    if (!isHeadless()) {
         VkResult result{VK_SUCCESS};
         for (auto& queueFamily : _renderer.getDevice().getQueueFamilies()) {
             VkBool32 supported = 0;
@@ -332,7 +452,7 @@ bool Window::initPresentQueue() {
 
     // Get present queue family and retrieve the first queue
     {
-        _presentQueueFamily = _renderer.getDevice().getQueueFamily(0, true);
+        _presentQueueFamily = isHeadless() ? _renderer.getDevice().getQueueFamily(VK_QUEUE_GRAPHICS_BIT) : _renderer.getDevice().getQueueFamily(0, true);
         if (!_presentQueueFamily) {
             LUG_LOG.error("Window::initPresentQueue: Can't find presentation queue family");
             return false;
@@ -360,15 +480,35 @@ bool Window::initPresentQueue() {
 bool Window::initSwapchain() {
     PhysicalDeviceInfo* info = _renderer.getPhysicalDeviceInfo();
 
+    // The present mode of the window is tried first, the ones of the renderer are the fallbacks
+    Renderer::Preferences::Swapchain swapchainPreferences = _renderer.getPreferences().swapchain;
+
+    if (_initInfo.presentMode != PresentMode::Default) {
+        const VkPresentModeKHR presentMode = [](PresentMode mode) {
+            switch (mode) {
+                case PresentMode::Mailbox:      return VK_PRESENT_MODE_MAILBOX_KHR;
+                case PresentMode::Immediate:    return VK_PRESENT_MODE_IMMEDIATE_KHR;
+                default:                        return VK_PRESENT_MODE_FIFO_KHR;
+            }
+        }(_initInfo.presentMode);
+
+        swapchainPreferences.presentModes.insert(swapchainPreferences.presentModes.begin(), presentMode);
+    }
+
     API::Builder::Swapchain swapchainBuilder(_renderer.getDevice());
-    swapchainBuilder.setPreferences(_renderer.getPreferences().swapchain);
+    swapchainBuilder.setPreferences(swapchainPreferences);
     swapchainBuilder.setImageUsage(VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT  | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
     swapchainBuilder.setImageColorSpace(VK_COLOR_SPACE_SRGB_NONLINEAR_KHR);
     swapchainBuilder.setMinImageCount(3);
 
-    // If width (and height) equals the special value 0xFFFFFFFF, the size of the surface will be set by the swapchain
-    if (info->swapchain.capabilities.currentExtent.height == 0xFFFFFFFF
+    if (isHeadless()) {
+        swapchainBuilder.setOffscreen(true);
+        swapchainBuilder.setImageUsage(VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT  | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        swapchainBuilder.setMinImageCount(_initInfo.headless.imagesCount);
+        swapchainBuilder.setImageExtent({_mode.width, _mode.height});
+    } else if (info->swapchain.capabilities.currentExtent.height == 0xFFFFFFFF
         && info->swapchain.capabilities.currentExtent.width == 0xFFFFFFFF) {
+        // If width (and height) equals the special value 0xFFFFFFFF, the size of the surface will be set by the swapchain
         swapchainBuilder.setImageExtent(
             {
                 _mode.width,
@@ -382,16 +522,18 @@ bool Window::initSwapchain() {
             });
     }
 
-    // Find the transformation of the surface
-    if (info->swapchain.capabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) {
-        // We prefer a non-rotated transform
-        swapchainBuilder.setPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR);
-    } else {
-        swapchainBuilder.setPreTransform(info->swapchain.capabilities.currentTransform);
-    }
+    if (!isHeadless()) {
+        // Find the transformation of the surface
+        if (info->swapchain.capabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) {
+            // We prefer a non-rotated transform
+            swapchainBuilder.setPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR);
+        } else {
+            swapchainBuilder.setPreTransform(info->swapchain.capabilities.currentTransform);
+        }
 
-    swapchainBuilder.setSurface(static_cast<VkSurfaceKHR>(_surface));
-    swapchainBuilder.setOldSwapchain(static_cast<VkSwapchainKHR>(_swapchain));
+        swapchainBuilder.setSurface(static_cast<VkSurfaceKHR>(_surface));
+        swapchainBuilder.setOldSwapchain(static_cast<VkSwapchainKHR>(_swapchain));
+    }
 
     // Create the swapchain
     {
@@ -440,7 +582,6 @@ bool Window::initFramesData() {
     }
 
     _framesData.resize(frameDataSize);
-    _acquireImageDatas.resize(frameDataSize + 1);
 
     API::Builder::CommandBuffer commandBufferBuilder(_renderer.getDevice(), _commandPool);
     commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
@@ -479,24 +620,187 @@ bool Window::initFramesData() {
                 return false;
             }
         }
+
+        if (isHeadless() && _initInfo.headless.readback && !initReadback(_framesData[i])) {
+            return false;
+        }
     }
 
-    for (uint32_t i = 0; i < frameDataSize + 1; ++i) {
-        // Acquire image semaphore
-        {
-            VkResult result{VK_SUCCESS};
-            if (!semaphoreBuilder.build(_acquireImageDatas[i].completeSemaphore, &result)) {
-                LUG_LOG.error("Window::initFramesData: Can't create semaphore: {}", result);
-                return false;
-            }
+    if (!initGpuProfiler()) {
+        return false;
+    }
 
-            _acquireImageDatas[i].imageIdx = -1;
-        }
+    if (!initInFlightFrames()) {
+        return false;
     }
 
     return buildCommandBuffers();
 }
 
+bool Window::initInFlightFrames() {
+    // More frames in flight than images would only wait for the images
+    const uint32_t imagesCount = static_cast<uint32_t>(_swapchain.getImages().size());
+    const uint32_t framesInFlight = std::max(1u, std::min(_initInfo.framesInFlight, imagesCount));
+
+    // Called again when the swapchain is recreated, the number of images may have changed
+    if (_inFlightFrames.size() == framesInFlight) {
+        return true;
+    }
+
+    if (framesInFlight != _initInfo.framesInFlight) {
+        LUG_LOG.warn("Window::initInFlightFrames: {} frames in flight requested, {} used for {} images", _initInfo.framesInFlight, framesInFlight, imagesCount);
+    }
+
+    // The GPU may still use the previous frames in flight
+    for (auto& inFlightFrame : _inFlightFrames) {
+        if (!inFlightFrame.fence.wait()) {
+            LUG_LOG.error("Window::initInFlightFrames: Can't wait for the previous frame");
+            return false;
+        }
+    }
+
+    _inFlightFrames.clear();
+    _inFlightFrames.resize(framesInFlight);
+    _currentFrameIndex = 0;
+    _lastRenderedImageIndex = -1;
+    _lastRenderedFrameIndex = -1;
+
+    API::Builder::Semaphore semaphoreBuilder(_renderer.getDevice());
+
+    // Signaled so that the first frames don't wait
+    API::Builder::Fence fenceBuilder(_renderer.getDevice());
+    fenceBuilder.setFlags(VK_FENCE_CREATE_SIGNALED_BIT);
+
+    for (auto& inFlightFrame : _inFlightFrames) {
+        VkResult result{VK_SUCCESS};
+
+        if (!fenceBuilder.build(inFlightFrame.fence, &result)) {
+            LUG_LOG.error("Window::initInFlightFrames: Can't create fence: {}", result);
+            return false;
+        }
+
+        if (!semaphoreBuilder.build(inFlightFrame.acquireImageSemaphore, &result)) {
+            LUG_LOG.error("Window::initInFlightFrames: Can't create semaphore: {}", result);
+            return false;
+        }
+    }
+
+    _latencyHistory.reserve(GpuProfiler::historySize);
+
+    return true;
+}
+
+bool Window::resignalFence(InFlightFrame& inFlightFrame) {
+    // Nothing was submitted to signal the fence, recreate it signaled or the next beginFrame would wait forever
+    API::Builder::Fence fenceBuilder(_renderer.getDevice());
+    fenceBuilder.setFlags(VK_FENCE_CREATE_SIGNALED_BIT);
+
+    VkResult result{VK_SUCCESS};
+    if (!fenceBuilder.build(inFlightFrame.fence, &result)) {
+        LUG_LOG.error("Window::resignalFence: Can't create fence: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
+void Window::updateLatency() {
+    // From the oldest frame to the most recent one, the frames finish in order
+    for (uint32_t i = 0; i < _inFlightFrames.size(); ++i) {
+        InFlightFrame& inFlightFrame = _inFlightFrames[(_currentFrameIndex + i) % _inFlightFrames.size()];
+
+        if (!inFlightFrame.pending || inFlightFrame.fence.getStatus() != VK_SUCCESS) {
+            continue;
+        }
+
+        inFlightFrame.pending = false;
+
+        const int64_t now = lug::System::Clock::getTimestamp();
+        _latency.cpu = static_cast<float>(inFlightFrame.presentTimestamp - inFlightFrame.beginTimestamp) / 1000000.0f;
+        _latency.total = static_cast<float>(now - inFlightFrame.beginTimestamp) / 1000000.0f;
+
+        if (_latencyHistory.size() < GpuProfiler::historySize) {
+            _latencyHistory.push_back(_latency.total);
+        } else {
+            _latencyHistory[_latencyHistoryIndex] = _latency.total;
+        }
+
+        _latencyHistoryIndex = (_latencyHistoryIndex + 1) % GpuProfiler::historySize;
+    }
+}
+
+bool Window::initReadback(FrameData& frameData) {
+    const VkDeviceSize size = static_cast<VkDeviceSize>(_swapchain.getExtent().width) * _swapchain.getExtent().height * 4;
+
+    // Buffer
+    {
+        VkResult result{VK_SUCCESS};
+        API::Builder::Buffer bufferBuilder(_renderer.getDevice());
+        bufferBuilder.setQueueFamilyIndices({_presentQueueFamily->getIdx()});
+        bufferBuilder.setSize(size);
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        if (!bufferBuilder.build(frameData.readbackBuffer, &result)) {
+            LUG_LOG.error("Window::initReadback: Can't create buffer: {}", result);
+            return false;
+        }
+    }
+
+    // Memory, host coherent as the mapped ranges are never invalidated
+    {
+        VkResult result{VK_SUCCESS};
+        API::Builder::DeviceMemory deviceMemoryBuilder(_renderer.getDevice());
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (!deviceMemoryBuilder.addBuffer(frameData.readbackBuffer)) {
+            LUG_LOG.error("Window::initReadback: Can't add buffer to device memory");
+            return false;
+        }
+
+        if (!deviceMemoryBuilder.build(frameData.readbackMemory, &result)) {
+            LUG_LOG.error("Window::initReadback: Can't create device memory: {}", result);
+            return false;
+        }
+    }
+
+    frameData.readbackData = frameData.readbackMemory.mapBuffer(frameData.readbackBuffer);
+    if (!frameData.readbackData) {
+        LUG_LOG.error("Window::initReadback: Can't map device memory");
+        return false;
+    }
+
+    return true;
+}
+
+bool Window::initGpuProfiler() {
+    const auto& profiling = _renderer.getPreferences().profiling;
+
+    if (!profiling.enabled) {
+        return true;
+    }
+
+    // The passes are recorded for the graphics queue
+    const API::Queue* graphicsQueue = _renderer.getDevice().getQueue("queue_graphics");
+    if (!graphicsQueue) {
+        LUG_LOG.error("Window::initGpuProfiler: Can't find queue with name queue_graphics");
+        return false;
+    }
+
+    if (!_gpuProfiler.init(
+        _renderer.getDevice(),
+        *_renderer.getPhysicalDeviceInfo(),
+        graphicsQueue->getQueueFamily()->getIdx(),
+        static_cast<uint32_t>(_framesData.size()),
+        profiling.pipelineStatistics && _renderer.getLoadedDeviceFeatures().pipelineStatisticsQuery
+    )) {
+        return false;
+    }
+
+    _frameScope = _gpuProfiler.addScope("Frame");
+
+    return true;
+}
+
 bool Window::buildBeginCommandBuffer() {
     uint32_t frameDataSize = (uint32_t)_swapchain.getImages().size();
 
@@ -508,6 +812,10 @@ bool Window::buildBeginCommandBuffer() {
             return false;
         }
 
+        // Reset the queries of all the passes of the frame, the views wait for this command buffer
+        _gpuProfiler.reset(cmdBuffer, i);
+        _gpuProfiler.begin(cmdBuffer, _frameScope, i);
+
         // Presentation to dst optimal
         {
             API::CommandBuffer::CmdPipelineBarrier pipelineBarrier{};
@@ -585,8 +893,41 @@ bool Window::buildEndCommandBuffer() {
         pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
         pipelineBarrier.imageMemoryBarriers[0].image = &_swapchain.getImages()[i];
 
+        // Headless: color attachment optimal to transfer src, to copy the image in the readback buffer
+        if (isHeadless()) {
+            pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        }
+
         cmdBuffer.pipelineBarrier(pipelineBarrier, VK_DEPENDENCY_BY_REGION_BIT);
 
+        if (isHeadless() && _initInfo.headless.readback) {
+            const VkBufferImageCopy region{
+                /* region.bufferOffset */ 0,
+                /* region.bufferRowLength */ 0,
+                /* region.bufferImageHeight */ 0,
+                /* region.imageSubresource */ {
+                    /* region.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                    /* region.imageSubresource.mipLevel */ 0,
+                    /* region.imageSubresource.baseArrayLayer */ 0,
+                    /* region.imageSubresource.layerCount */ 1
+                },
+                /* region.imageOffset */ {0, 0, 0},
+                /* region.imageExtent */ {_swapchain.getExtent().width, _swapchain.getExtent().height, 1}
+            };
+
+            const API::CommandBuffer::CmdCopyImageToBuffer cmdCopyImageToBuffer{
+                /* cmdCopyImageToBuffer.srcImage */ _swapchain.getImages()[i],
+                /* cmdCopyImageToBuffer.srcImageLayout */ VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                /* cmdCopyImageToBuffer.dstBuffer */ _framesData[i].readbackBuffer,
+                /* cmdCopyImageToBuffer.regions */ {region}
+            };
+
+            cmdBuffer.copyImageToBuffer(cmdCopyImageToBuffer);
+        }
+
+        _gpuProfiler.end(cmdBuffer, _frameScope, i);
+
         if (!cmdBuffer.end()) {
             return false;
         }
@@ -602,8 +943,11 @@ bool Window::buildCommandBuffers() {
 bool Window::init(Window::InitInfo& initInfo) {
     _initInfo = std::move(initInfo);
 
-    // Init the window
-    if (!::lug::Window::Window::init(_initInfo.windowInitInfo)) {
+    // Init the window, or only its size when rendering offscreen
+    if (isHeadless()) {
+        _mode.width = _initInfo.windowInitInfo.width;
+        _mode.height = _initInfo.windowInitInfo.height;
+    } else if (!::lug::Window::Window::init(_initInfo.windowInitInfo)) {
         return false;
     }
 
@@ -643,7 +987,11 @@ bool Window::init(Window::InitInfo& initInfo) {
 }
 
 bool Window::initRender() {
-    if (!(initSurface() && initSwapchainCapabilities() && initPresentQueue() && initSwapchain() && initFramesData())) {
+    if (isHeadless()) {
+        if (!(initPresentQueue() && initSwapchain() && initFramesData())) {
+            return false;
+        }
+    } else if (!(initSurface() && initSwapchainCapabilities() && initPresentQueue() && initSwapchain() && initFramesData())) {
         return false;
     }
 
@@ -672,7 +1020,10 @@ void Window::destroyRender() {
 
     _framesData.clear();
 
-    _acquireImageDatas.clear();
+    _inFlightFrames.clear();
+    _lastRenderedFrameIndex = -1;
+
+    _gpuProfiler.destroy();
 
     _commandPool.destroy();
 
@@ -60,6 +60,9 @@ Renderer::~Renderer() {
 }
 
 void Renderer::destroy() {
+    // Wait for the pipelines being compiled
+    _pipelineCompiler.reset();
+
     // Destroy the window
     _window.reset();
 
@@ -103,6 +106,8 @@ bool Renderer::finishInit() {
     if (static_cast<VkDevice>(_device)) {
         _device.waitIdle();
 
+        _pipelineCompiler.reset();
+
         // Destroy the render part of the window
         if (_window) {
             _window->destroyRender();
@@ -125,6 +130,20 @@ bool Renderer::finishInit() {
 
     _resourceManager = std::make_unique<::lug::Graphics::ResourceManager>(*this);
 
+    if (_preferences.pipelineCompilation.async) {
+        _pipelineCompiler = std::make_unique<Render::PipelineCompiler>(
+            [this](Render::Pipeline::Id id) {
+                // Compiled between the lookup of the caller and the start of this compilation
+                if (findPipeline(id)) {
+                    return true;
+                }
+
+                return static_cast<bool>(Render::Pipeline::create(*this, id));
+            },
+            _preferences.pipelineCompilation.workerCount
+        );
+    }
+
     return true;
 }
 
@@ -578,6 +597,71 @@ inline std::vector<const char*> Renderer::checkRequirementsExtensions(const Info
     return _window.get();
 }
 
+Resource::SharedPtr<Render::Pipeline> Renderer::findPipeline(Render::Pipeline::Id id) const {
+    std::lock_guard<std::mutex> lockGuard(_pipelinesMutex);
+
+    const auto it = _pipelines.find(id);
+    if (it == _pipelines.end()) {
+        return nullptr;
+    }
+
+    return it->second.lock();
+}
+
+Resource::SharedPtr<Render::Pipeline> Renderer::getPipeline(Render::Pipeline::Id id) {
+    Resource::SharedPtr<Render::Pipeline> pipeline = findPipeline(id);
+    if (pipeline) {
+        return pipeline;
+    }
+
+    // Waits for the compilation of the pipeline if it is already in flight, instead of compiling it twice
+    if (_pipelineCompiler) {
+        return _pipelineCompiler->compile(id) ? findPipeline(id) : nullptr;
+    }
+
+    std::lock_guard<std::mutex> lockGuard(_mutex);
+
+    pipeline = findPipeline(id);
+    if (pipeline) {
+        return pipeline;
+    }
+
+    return Render::Pipeline::create(*this, id);
+}
+
+Resource::SharedPtr<Render::Pipeline> Renderer::getPipelineAsync(Render::Pipeline::Id id) {
+    if (!_pipelineCompiler) {
+        return getPipeline(id);
+    }
+
+    Resource::SharedPtr<Render::Pipeline> pipeline = findPipeline(id);
+    if (!pipeline) {
+        _pipelineCompiler->request(id);
+    }
+
+    return pipeline;
+}
+
+void Renderer::prewarmPipelines(const std::vector<Render::Pipeline::Id>& ids) {
+    if (_pipelineCompiler) {
+        std::vector<Render::Pipeline::Id> missingIds;
+        for (const auto id : ids) {
+            if (!containsPipeline(id)) {
+                missingIds.push_back(id);
+            }
+        }
+
+        _pipelineCompiler->prewarm(missingIds);
+        return;
+    }
+
+    for (const auto id : ids) {
+        if (!getPipeline(id)) {
+            LUG_LOG.warn("Renderer::prewarmPipelines: Can't compile the pipeline {:#010x}", id.value);
+        }
+    }
+}
+
 bool Renderer::beginFrame(const lug::System::Time& elapsedTime) {
     return _window->beginFrame(elapsedTime);
 }
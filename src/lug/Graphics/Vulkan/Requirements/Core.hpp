@@ -125,7 +125,7 @@ const Renderer::Requirements requirements{
         VK_FALSE, // textureCompressionASTC_LDR
         VK_FALSE, // textureCompressionBC
         VK_FALSE, // occlusionQueryPrecise
-        VK_FALSE, // pipelineStatisticsQuery
+        VK_TRUE,  // pipelineStatisticsQuery
         VK_FALSE, // vertexPipelineStoresAndAtomics
         VK_FALSE, // fragmentStoresAndAtomics
         VK_FALSE, // shaderTessellationAndGeometryPointSize
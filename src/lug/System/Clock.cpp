@@ -1,5 +1,7 @@
 #include <lug/System/Clock.hpp>
 
+#include <chrono>
+
 namespace lug {
 namespace System {
 
@@ -38,5 +40,10 @@ Time Clock::reset() {
     return old;
 }
 
+int64_t Clock::getTimestamp() {
+    const auto now = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
 } // System
 } // lug
@@ -0,0 +1,249 @@
+#include <lug/System/Logger/BinaryHandler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include <lug/System/Exception.hpp>
+#include <lug/System/Logger/BinaryFormat.hpp>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+namespace {
+
+int64_t toNanoseconds(const std::chrono::system_clock::time_point& time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+// The type is written last, a record interrupted by a crash reads as the end of the data
+uint8_t* writeDefinition(uint8_t* data, priv::RecordType type, uint32_t id, const char* text, std::size_t size) {
+    uint8_t* end = priv::writeVarint(data + 1, id);
+    end = priv::writeVarint(end, size);
+
+    std::memcpy(end, text, size);
+    *data = static_cast<uint8_t>(type);
+
+    return end + size;
+}
+
+} // anonymous
+
+std::size_t BinaryHandler::Dictionary::KeyHash::operator()(const Key& key) const {
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (std::size_t i = 0; i < key.size; ++i) {
+        hash ^= static_cast<uint8_t>(key.text[i]);
+        hash *= 0x100000001B3ull;
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+bool BinaryHandler::Dictionary::KeyEqual::operator()(const Key& lhs, const Key& rhs) const {
+    return lhs.size == rhs.size && std::memcmp(lhs.text, rhs.text, lhs.size) == 0;
+}
+
+uint32_t BinaryHandler::Dictionary::getId(const char* text, std::size_t size, bool stablePointer, bool& added) {
+    added = false;
+
+    if (stablePointer) {
+        const auto it = pointerIds.find(text);
+
+        if (it != pointerIds.end() && texts[it->second].size() == size && std::memcmp(texts[it->second].data(), text, size) == 0) {
+            return it->second;
+        }
+    }
+
+    uint32_t id;
+
+    const auto it = ids.find(Key{text, size});
+    if (it != ids.end()) {
+        id = it->second;
+    } else {
+        id = static_cast<uint32_t>(texts.size());
+        texts.emplace_back(text, size);
+        ids.emplace(Key{texts.back().data(), size}, id);
+        added = true;
+    }
+
+    if (stablePointer) {
+        pointerIds[text] = id;
+    }
+
+    return id;
+}
+
+void BinaryHandler::Dictionary::clear() {
+    pointerIds.clear();
+    ids.clear();
+    texts.clear();
+}
+
+BinaryHandler::BinaryHandler(const std::string& name, const std::string& filename, uint32_t fileSize, uint32_t filesCount) :
+    Handler(name),
+    _filename(filename),
+    _fileSize(std::max(fileSize, static_cast<uint32_t>(priv::binaryHeaderSize + 1))),
+    _filesCount(std::max(filesCount, 1u)) {
+    if (!openFile()) {
+        LUG_EXCEPT(FileNotFoundException, "Failed to create the binary log file");
+    }
+}
+
+BinaryHandler::~BinaryHandler() {
+    if (_file.isOpen()) {
+        _file.close(_position);
+    }
+}
+
+void BinaryHandler::handle(const priv::Message& msg) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const uint8_t* arguments = reinterpret_cast<const uint8_t*>(msg.arguments.data());
+    const uint8_t* argumentsEnd = arguments + msg.arguments.size();
+
+    const char* format = nullptr;
+    std::size_t formatSize = 0;
+
+    // The message was not captured by a log call, its text is the argument
+    fmt::MemoryWriter text;
+
+    if (arguments != argumentsEnd) {
+        // The format is the first argument
+        uint64_t size = 0;
+
+        if (static_cast<ArgumentType>(*arguments++) != ArgumentType::String
+            || !priv::readVarint(arguments, argumentsEnd, size)
+            || size > static_cast<uint64_t>(argumentsEnd - arguments)) {
+            ++_droppedCount;
+            return;
+        }
+
+        format = reinterpret_cast<const char*>(arguments);
+        formatSize = static_cast<std::size_t>(size);
+
+        arguments += formatSize;
+    } else {
+        format = "{}";
+        formatSize = 2;
+
+        priv::writeString(text, msg.raw.data(), msg.raw.size());
+        arguments = reinterpret_cast<const uint8_t*>(text.data());
+        argumentsEnd = arguments + text.size();
+    }
+
+    const std::size_t loggerNameSize = std::strlen(msg.loggerName);
+    const std::size_t argumentsSize = argumentsEnd - arguments;
+
+    // The definitions and the message
+    const std::size_t maxSize = 2 * (1 + 2 * priv::maxVarintSize) + formatSize + loggerNameSize
+                                + 2 + 4 * priv::maxVarintSize + argumentsSize;
+
+    if (priv::binaryHeaderSize + maxSize > _fileSize) {
+        ++_droppedCount;
+        return;
+    }
+
+    if ((!_file.isOpen() || _position + maxSize > _file.getSize()) && !rotate()) {
+        ++_droppedCount;
+        return;
+    }
+
+    uint8_t* data = _file.getData() + _position;
+    bool added = false;
+
+    const uint32_t formatId = _formats.getId(format, formatSize, false, added);
+    if (added) {
+        data = writeDefinition(data, priv::RecordType::Format, formatId, format, formatSize);
+    }
+
+    const uint32_t loggerId = _loggers.getId(msg.loggerName, loggerNameSize, true, added);
+    if (added) {
+        data = writeDefinition(data, priv::RecordType::Logger, loggerId, msg.loggerName, loggerNameSize);
+    }
+
+    const int64_t time = toNanoseconds(msg.time);
+
+    uint8_t* end = data + 1;
+    *end++ = static_cast<uint8_t>(msg.level);
+    end = priv::writeVarint(end, formatId);
+    end = priv::writeVarint(end, loggerId);
+    end = priv::writeVarint(end, priv::zigzagEncode(time - _previousTime));
+    end = priv::writeVarint(end, argumentsSize);
+
+    std::memcpy(end, arguments, argumentsSize);
+    *data = static_cast<uint8_t>(priv::RecordType::Message);
+
+    _previousTime = time;
+    _position = (end + argumentsSize) - _file.getData();
+}
+
+void BinaryHandler::flush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _file.flush();
+}
+
+bool BinaryHandler::needsText() const {
+    return false;
+}
+
+bool BinaryHandler::needsArguments() const {
+    return true;
+}
+
+uint64_t BinaryHandler::getDroppedCount() const {
+    return _droppedCount.load();
+}
+
+bool BinaryHandler::openFile() {
+    _formats.clear();
+    _loggers.clear();
+    _position = 0;
+
+    if (!_file.create(_filename, _fileSize)) {
+        return false;
+    }
+
+    const int64_t time = toNanoseconds(std::chrono::system_clock::now());
+    const uint32_t version = priv::binaryVersion;
+
+    uint8_t* data = _file.getData();
+    std::memcpy(data, priv::binaryMagic, sizeof(priv::binaryMagic));
+    std::memcpy(data + 4, &version, sizeof(version));
+    std::memcpy(data + 8, &time, sizeof(time));
+
+    _previousTime = time;
+    _position = priv::binaryHeaderSize;
+
+    return true;
+}
+
+bool BinaryHandler::rotate() {
+    if (_file.isOpen()) {
+        _file.close(_position);
+    }
+
+    if (_filesCount > 1) {
+        std::remove(getRotatedFilename(_filesCount - 1).c_str());
+
+        for (uint32_t index = _filesCount - 1; index > 1; --index) {
+            std::rename(getRotatedFilename(index - 1).c_str(), getRotatedFilename(index).c_str());
+        }
+
+        std::rename(_filename.c_str(), getRotatedFilename(1).c_str());
+    }
+
+    return openFile();
+}
+
+std::string BinaryHandler::getRotatedFilename(uint32_t index) const {
+    return _filename + "." + std::to_string(index);
+}
+
+} // Logger
+} // System
+} // lug
@@ -0,0 +1,284 @@
+#include <lug/System/Logger/BinaryReader.hpp>
+
+#include <cstring>
+#include <exception>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+namespace {
+
+void writeArgument(fmt::MemoryWriter& writer, const std::string& pattern, const BinaryReader::Argument& argument) {
+    switch (argument.type) {
+        case ArgumentType::Int:
+            writer.write(pattern.c_str(), static_cast<long long>(argument.integer));
+            break;
+        case ArgumentType::UInt:
+            writer.write(pattern.c_str(), static_cast<unsigned long long>(argument.unsignedInteger));
+            break;
+        case ArgumentType::Boolean:
+            writer.write(pattern.c_str(), argument.integer != 0);
+            break;
+        case ArgumentType::Char:
+            writer.write(pattern.c_str(), static_cast<char>(argument.integer));
+            break;
+        case ArgumentType::Float:
+            writer.write(pattern.c_str(), static_cast<float>(argument.real));
+            break;
+        case ArgumentType::Double:
+            writer.write(pattern.c_str(), argument.real);
+            break;
+        case ArgumentType::String:
+            writer.write(pattern.c_str(), argument.text);
+            break;
+        case ArgumentType::Pointer:
+            writer.write(pattern.c_str(), reinterpret_cast<const void*>(static_cast<uintptr_t>(argument.unsignedInteger)));
+            break;
+    }
+}
+
+} // anonymous
+
+bool BinaryReader::open(const std::string& filename) {
+    _formats.clear();
+    _loggerNames.clear();
+    _corrupted = false;
+
+    if (!_file.open(filename) || _file.getSize() < priv::binaryHeaderSize) {
+        _file.close();
+        return false;
+    }
+
+    const uint8_t* data = _file.getData();
+    uint32_t version = 0;
+    std::memcpy(&version, data + 4, sizeof(version));
+
+    if (std::memcmp(data, priv::binaryMagic, sizeof(priv::binaryMagic)) != 0 || version != priv::binaryVersion) {
+        _file.close();
+        return false;
+    }
+
+    std::memcpy(&_time, data + 8, sizeof(_time));
+
+    _position = data + priv::binaryHeaderSize;
+    _end = data + _file.getSize();
+
+    return true;
+}
+
+bool BinaryReader::next(Record& record) {
+    while (!_corrupted && _position < _end) {
+        const priv::RecordType type = static_cast<priv::RecordType>(*_position++);
+
+        switch (type) {
+            case priv::RecordType::End:
+                _position = _end;
+                return false;
+
+            case priv::RecordType::Format:
+                _corrupted = !readDefinition(_formats);
+                break;
+
+            case priv::RecordType::Logger:
+                _corrupted = !readDefinition(_loggerNames);
+                break;
+
+            case priv::RecordType::Message: {
+                uint64_t formatId = 0;
+                uint64_t loggerId = 0;
+                uint64_t timeDelta = 0;
+                uint64_t argumentsSize = 0;
+
+                if (_position == _end || *_position > static_cast<uint8_t>(Level::Off)) {
+                    _corrupted = true;
+                    return false;
+                }
+
+                record.level = static_cast<Level>(*_position++);
+
+                _corrupted = !priv::readVarint(_position, _end, formatId) || formatId >= _formats.size()
+                    || !priv::readVarint(_position, _end, loggerId) || loggerId >= _loggerNames.size()
+                    || !priv::readVarint(_position, _end, timeDelta)
+                    || !priv::readVarint(_position, _end, argumentsSize) || argumentsSize > static_cast<uint64_t>(_end - _position)
+                    || !readArguments(_position, _position + argumentsSize, record.arguments);
+
+                if (_corrupted) {
+                    return false;
+                }
+
+                _position += argumentsSize;
+                _time += priv::zigzagDecode(timeDelta);
+
+                record.time = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(_time))
+                );
+                record.loggerName = _loggerNames[static_cast<std::size_t>(loggerId)];
+                record.format = _formats[static_cast<std::size_t>(formatId)];
+
+                return true;
+            }
+
+            default:
+                _corrupted = true;
+                break;
+        }
+    }
+
+    return false;
+}
+
+bool BinaryReader::isCorrupted() const {
+    return _corrupted;
+}
+
+bool BinaryReader::formatMessage(const std::string& format, const std::vector<Argument>& arguments, std::string& message) {
+    fmt::MemoryWriter writer;
+    std::size_t nextArgument = 0;
+
+    try {
+        for (std::size_t i = 0; i < format.size(); ++i) {
+            const char character = format[i];
+
+            if ((character == '{' || character == '}') && i + 1 < format.size() && format[i + 1] == character) {
+                writer << character;
+                ++i;
+                continue;
+            }
+
+            if (character != '{') {
+                writer << character;
+                continue;
+            }
+
+            const std::size_t end = format.find('}', i);
+            if (end == std::string::npos) {
+                return false;
+            }
+
+            // {[index][:spec]}
+            const std::string field = format.substr(i + 1, end - i - 1);
+            const std::size_t colon = field.find(':');
+            const std::string index = field.substr(0, colon);
+
+            std::size_t argumentIdx = nextArgument++;
+            if (!index.empty()) {
+                if (index.find_first_not_of("0123456789") != std::string::npos) {
+                    return false;
+                }
+
+                argumentIdx = static_cast<std::size_t>(std::stoul(index));
+            }
+
+            if (argumentIdx >= arguments.size()) {
+                return false;
+            }
+
+            writeArgument(writer, "{" + (colon == std::string::npos ? std::string() : field.substr(colon)) + "}", arguments[argumentIdx]);
+
+            i = end;
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    message = writer.str();
+
+    return true;
+}
+
+bool BinaryReader::readDefinition(std::vector<std::string>& definitions) {
+    uint64_t id = 0;
+    uint64_t size = 0;
+
+    // The ids of a file are consecutive
+    if (!priv::readVarint(_position, _end, id) || id != definitions.size()
+        || !priv::readVarint(_position, _end, size) || size > static_cast<uint64_t>(_end - _position)) {
+        return false;
+    }
+
+    definitions.emplace_back(reinterpret_cast<const char*>(_position), static_cast<std::size_t>(size));
+    _position += size;
+
+    return true;
+}
+
+bool BinaryReader::readArguments(const uint8_t* data, const uint8_t* end, std::vector<Argument>& arguments) {
+    arguments.clear();
+
+    while (data < end) {
+        Argument argument;
+        argument.type = static_cast<ArgumentType>(*data++);
+
+        uint64_t value = 0;
+
+        switch (argument.type) {
+            case ArgumentType::Int:
+                if (!priv::readVarint(data, end, value)) {
+                    return false;
+                }
+                argument.integer = priv::zigzagDecode(value);
+                break;
+
+            case ArgumentType::UInt:
+                if (!priv::readVarint(data, end, argument.unsignedInteger)) {
+                    return false;
+                }
+                break;
+
+            case ArgumentType::Boolean:
+            case ArgumentType::Char:
+                if (data == end) {
+                    return false;
+                }
+                argument.integer = argument.type == ArgumentType::Char ? static_cast<char>(*data++) : *data++;
+                break;
+
+            case ArgumentType::Float: {
+                float real = 0.0f;
+                if (end - data < static_cast<std::ptrdiff_t>(sizeof(real))) {
+                    return false;
+                }
+                std::memcpy(&real, data, sizeof(real));
+                argument.real = real;
+                data += sizeof(real);
+                break;
+            }
+
+            case ArgumentType::Double:
+                if (end - data < static_cast<std::ptrdiff_t>(sizeof(argument.real))) {
+                    return false;
+                }
+                std::memcpy(&argument.real, data, sizeof(argument.real));
+                data += sizeof(argument.real);
+                break;
+
+            case ArgumentType::String:
+                if (!priv::readVarint(data, end, value) || value > static_cast<uint64_t>(end - data)) {
+                    return false;
+                }
+                argument.text.assign(reinterpret_cast<const char*>(data), static_cast<std::size_t>(value));
+                data += value;
+                break;
+
+            case ArgumentType::Pointer:
+                if (end - data < static_cast<std::ptrdiff_t>(sizeof(argument.unsignedInteger))) {
+                    return false;
+                }
+                std::memcpy(&argument.unsignedInteger, data, sizeof(argument.unsignedInteger));
+                data += sizeof(argument.unsignedInteger);
+                break;
+
+            default:
+                return false;
+        }
+
+        arguments.push_back(std::move(argument));
+    }
+
+    return true;
+}
+
+} // Logger
+} // System
+} // lug
@@ -25,7 +25,7 @@ FileHandler::~FileHandler() {
 }
 
 void FileHandler::handle(const priv::Message& msg) {
-    _ofs << msg.formatted.c_str();
+    _ofs.write(msg.formatted.data(), msg.formatted.size());
 }
 
 void FileHandler::flush() {
@@ -1,192 +1,242 @@
 #include <lug/System/Logger/Formatter.hpp>
-#include <algorithm>
-#include <iomanip>
-#include <sstream>
+#include <chrono>
+#include <cstring>
 #include <lug/System/Logger/Message.hpp>
 
 namespace lug {
 namespace System {
 namespace Logger {
-namespace priv {
 
-std::string UserChars::format(Message*) const {
-    return _chars;
-}
+namespace {
 
-void UserChars::addChar(char c) {
-    _chars += c;
-}
+#define LUG_LOG_COUNT(CHANNEL) + 1
+constexpr size_t levelsCount = 0 LUG_LOG_LEVELS(LUG_LOG_COUNT);
+#undef LUG_LOG_COUNT
 
-std::string LevelFlag::format(Message* message) const {
-    if (!message) {
-        return "NoMsg!";
-    }
+// Upper case and padded to the longest name, in the order of Level
+constexpr const char* levelNames[] = {
+    "TRACE  ",
+    "DEBUG  ",
+    "INFO   ",
+    "WARNING",
+    "ERROR  ",
+    "FATAL  ",
+    "ASSERT ",
+    "OFF    "
+};
 
-    std::stringstream ss;
-    ss << std::left << std::setfill(' ') << std::setw(7) << message->level;
-    std::string tmp(ss.str());
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), [](char c) {
-        return static_cast<char>(toupper(c));
-    });
-    return tmp;
-}
+static_assert(sizeof(levelNames) / sizeof(levelNames[0]) == levelsCount, "A level has no name");
 
-std::string MessageFlag::format(Message* message) const {
-    if (!message) {
-        return "NoMsg!";
-    }
+constexpr uint32_t levelNameSize = 7;
 
-    return message->raw.str();
+} // anonymous
+
+Formatter::Formatter(const std::string& pattern) {
+    compilePattern(pattern);
 }
 
-} // namespace priv
+Formatter::~Formatter() = default;
 
-std::string Formatter::handleFlagy(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%y");
-    return ss.str();
+const char* Formatter::getLevelName(Level level) {
+    const size_t idx = static_cast<size_t>(level);
+    return idx < levelsCount ? levelNames[idx] : "UNKNOWN";
 }
 
-std::string Formatter::handleFlagY(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%Y");
-    return ss.str();
-}
+void Formatter::compilePattern(const std::string& pattern) {
+    // Characters and time flags found since the last %l or %v
+    std::string segment;
+    uint32_t segmentSize = 0;
+    bool hasTimeFlag = false;
 
-std::string Formatter::handleFlagm(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%m");
-    return ss.str();
-}
+    const auto endSegment = [&]() {
+        if (segment.empty()) {
+            return;
+        }
 
-std::string Formatter::handleFlagd(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%d");
-    return ss.str();
-}
+        if (hasTimeFlag) {
+            _instructions.push_back({
+                /* instruction.type         */ priv::Instruction::Type::Time,
+                /* instruction.offset       */ static_cast<uint32_t>(_timeText.size()),
+                /* instruction.size         */ 0,
+                /* instruction.capacity     */ segmentSize + 1,
+                /* instruction.timePattern  */ static_cast<uint32_t>(_timePatterns.size())
+            });
+
+            _timePatterns.push_back(segment);
+            _timeText.resize(_timeText.size() + segmentSize + 1);
+        } else {
+            _instructions.push_back({
+                /* instruction.type         */ priv::Instruction::Type::Text,
+                /* instruction.offset       */ static_cast<uint32_t>(_text.size()),
+                /* instruction.size         */ segmentSize,
+                /* instruction.capacity     */ segmentSize,
+                /* instruction.timePattern  */ 0
+            });
+
+            _text += segment;
+        }
 
-std::string Formatter::handleFlagH(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%H");
-    return ss.str();
-}
+        segment.clear();
+        segmentSize = 0;
+        hasTimeFlag = false;
+    };
+
+    const auto addInstruction = [this](priv::Instruction::Type type) {
+        _instructions.push_back({
+            /* instruction.type         */ type,
+            /* instruction.offset       */ 0,
+            /* instruction.size         */ 0,
+            /* instruction.capacity     */ 0,
+            /* instruction.timePattern  */ 0
+        });
+    };
+
+    for (auto it = pattern.begin(); it != pattern.end(); ++it) {
+        // Chars not following the % sign should be displayed as is
+        if (*it != '%') {
+            segment += *it;
+            ++segmentSize;
+            continue;
+        }
 
-std::string Formatter::handleFlagM(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%M");
-    return ss.str();
-}
+        if (++it == pattern.end()) {
+            break;
+        }
+
+        switch (*it) {
+            case 'y': // Year 2 digits
+            case 'm': // Month from 01 to 12
+            case 'd': // Day from 01 to 31
+            case 'H': // Hour from 00 to 23
+            case 'M': // Minute from 00 to 59
+            case 'S': // Sec from 00 to 60
+                segment += '%';
+                segment += *it;
+                segmentSize += 2;
+                hasTimeFlag = true;
+                break;
+            case 'Y': // Year 4 digits
+                segment += "%Y";
+                segmentSize += 4;
+                hasTimeFlag = true;
+                break;
+            case 'l':
+                endSegment();
+                addInstruction(priv::Instruction::Type::Level);
+                break;
+            case 'v':
+                endSegment();
+                addInstruction(priv::Instruction::Type::Message);
+                break;
+            default:
+                // Unknown flags are ignored
+                break;
+        }
+    }
 
-std::string Formatter::handleFlagS(const std::tm* now) {
-    std::stringstream ss;
-    ss << std::put_time(now, "%S");
-    return ss.str();
+    endSegment();
 }
 
-inline void Formatter::handleFlag(char flag) {
-    priv::Token token;
+void Formatter::renderTime(const std::tm* now) {
+    for (const auto& instruction : _instructions) {
+        if (instruction.type == priv::Instruction::Type::Time) {
+            char* timeText = _timeText.data() + instruction.offset;
 
-    switch (flag) {
-        case 'y':
-            token.basic = &Formatter::handleFlagy;
-            break;
-        case 'Y':
-            token.basic = &Formatter::handleFlagY;
-            break;
-        case 'm':
-            token.basic = &Formatter::handleFlagm;
-            break;
-        case 'd':
-            token.basic = &Formatter::handleFlagd;
-            break;
-        case 'H':
-            token.basic = &Formatter::handleFlagH;
-            break;
-        case 'M':
-            token.basic = &Formatter::handleFlagM;
-            break;
-        case 'S':
-            token.basic = &Formatter::handleFlagS;
-            break;
-        case 'v':
-            token.advanced = std::make_unique<priv::MessageFlag>();
-            break;
-        case 'l':
-            token.advanced = std::make_unique<priv::LevelFlag>();
-            break;
+            // The content is indeterminate when strftime fails
+            if (std::strftime(timeText, instruction.capacity, _timePatterns[instruction.timePattern].c_str(), now) == 0) {
+                timeText[0] = '\0';
+            }
+        }
     }
-
-    _formatChain.push_back(std::move(token));
 }
 
-inline void Formatter::compilePattern(const std::string& pattern) {
-    std::unique_ptr<priv::UserChars> chars;
+const std::vector<char>& Formatter::copyTimeText() const {
+    // Reused by the next messages of the thread, so the copy doesn't allocate
+    thread_local std::vector<char> timeText;
 
-    auto end = pattern.end();
+    timeText.assign(_timeText.begin(), _timeText.end());
+    return timeText;
+}
 
-    for (auto it = pattern.begin(); it != end; ++it) {
-        if (*it == '%') {
-            if (chars) {
-                // Append raw chars found so far
-                _formatChain.push_back(priv::Token(std::move(chars)));
-                chars = nullptr;
-            }
+void Formatter::write(priv::Message& msg, const char* timeText) const {
+    msg.formatted.clear();
 
-            if (++it != end) {
-                handleFlag(*it);
-            } else {
+    for (const auto& instruction : _instructions) {
+        switch (instruction.type) {
+            case priv::Instruction::Type::Text:
+                msg.formatted << fmt::StringRef(_text.data() + instruction.offset, instruction.size);
+                break;
+            case priv::Instruction::Type::Time:
+                msg.formatted << fmt::StringRef(timeText + instruction.offset, std::strlen(timeText + instruction.offset));
+                break;
+            case priv::Instruction::Type::Level:
+                msg.formatted << fmt::StringRef(getLevelName(msg.level), levelNameSize);
+                break;
+            case priv::Instruction::Type::Message:
+                msg.formatted << fmt::StringRef(msg.raw.data(), msg.raw.size());
                 break;
-            }
-        } else {
-            // Chars not following the % sign should be displayed as is
-            if (!chars) {
-                chars = std::make_unique<priv::UserChars>();
-            }
-
-            chars->addChar(*it);
         }
     }
+}
 
-    if (chars) {
-        // Append raw chars found so far
-        _formatChain.push_back(priv::Token(std::move(chars)));
+void Formatter::format(priv::Message& msg) {
+    if (_timePatterns.empty()) {
+        write(msg, nullptr);
+        return;
     }
-}
 
-Formatter::Formatter(const std::string& pattern) {
-    compilePattern(pattern);
-}
+    const std::time_t time = std::chrono::system_clock::to_time_t(msg.time);
 
-Formatter::~Formatter() = default;
+    const char* timeText = nullptr;
 
-void Formatter::format(priv::Message& msg) {
-    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-    std::time_t tt = std::chrono::system_clock::to_time_t(now);
-    std::tm tf;
+    {
+        std::lock_guard<std::mutex> lock(_timeMutex);
+
+        // The time flags are rendered once per second
+        if (time != _renderedTime) {
+            std::tm tf;
 
 #if defined(LUG_SYSTEM_WINDOWS)
-    // Use windows secure versions of localtime
-    localtime_s(&tf, &tt);
+            // Use windows secure versions of localtime
+            localtime_s(&tf, &time);
 #else
-    // Use linux secure versions of localtime
-    // TODO: test on android
-    // It could not work (what is the localtime secure version for android ?)
-    localtime_r(&tt, &tf);
+            // Use linux secure versions of localtime
+            // TODO: test on android
+            // It could not work (what is the localtime secure version for android ?)
+            localtime_r(&time, &tf);
 #endif
 
-    format(msg, &tf);
+            renderTime(&tf);
+            _renderedTime = time;
+        }
+
+        timeText = copyTimeText().data();
+    }
+
+    // The other threads can render another second meanwhile
+    write(msg, timeText);
 }
 
 void Formatter::format(priv::Message& msg, const std::tm* now) {
-    msg.formatted.clear();
+    if (_timePatterns.empty()) {
+        write(msg, nullptr);
+        return;
+    }
 
-    for (priv::Token& elem : _formatChain) {
-        if (elem.basic) {
-            msg.formatted << (this->*elem.basic)(now);
-        } else if (elem.advanced) {
-            msg.formatted << elem.advanced->format(&msg);
-        }
+    const char* timeText = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(_timeMutex);
+
+        renderTime(now);
+
+        // Not the time of the next messages, render it again
+        _renderedTime = -1;
+
+        timeText = copyTimeText().data();
     }
+
+    write(msg, timeText);
 }
 
 } // Logger
@@ -6,6 +6,8 @@ namespace lug {
 namespace System {
 namespace Logger {
 
+std::atomic<uint32_t> Handler::_levelsVersion{0};
+
 Handler::Handler(const std::string& name) :
     _name(name),
     _formatter(std::make_unique<Formatter>("[%H:%M:%S][%l] %v\n")),
@@ -23,8 +25,17 @@ void Handler::format(priv::Message& msg) {
     _formatter->format(msg);
 }
 
+bool Handler::needsText() const {
+    return true;
+}
+
+bool Handler::needsArguments() const {
+    return false;
+}
+
 void Handler::setLevel(Level level) {
     _level = level;
+    _levelsVersion.fetch_add(1, std::memory_order_release);
 }
 
 Level Handler::getLevel() const {
@@ -7,7 +7,7 @@ namespace Logger {
 LogCatHandler::LogCatHandler(const std::string& name) : Handler(name) {}
 
 void LogCatHandler::handle(const priv::Message& msg) {
-    __android_log_write(lugLevelToLogCatPrio(msg.level), msg.loggerName.c_str(), msg.formatted.c_str());
+    __android_log_write(lugLevelToLogCatPrio(msg.level), msg.loggerName, msg.formatted.c_str());
 }
 
 void LogCatHandler::flush() {
@@ -18,6 +18,8 @@ android_LogPriority LogCatHandler::lugLevelToLogCatPrio(Level level) {
     switch (level) {
         case lug::System::Logger::Level::Off:
             return ANDROID_LOG_SILENT;
+        case lug::System::Logger::Level::Trace:
+            return ANDROID_LOG_VERBOSE;
         case lug::System::Logger::Level::Debug:
             return ANDROID_LOG_DEBUG;
         case lug::System::Logger::Level::Info:
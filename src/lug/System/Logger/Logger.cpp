@@ -1,5 +1,23 @@
 #include <lug/System/Logger/Logger.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #include <io.h>
+#else
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
 #include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/RingBuffer.hpp>
 
 namespace lug {
 namespace System {
@@ -16,14 +34,357 @@ std::ostream& operator<<(std::ostream& os, Level level) {
 
 #undef LUG_LOG_ENUM
 
-Logger::Logger(const std::string& loggerName) : _name(loggerName) {}
+namespace priv {
+
+struct AsyncQueue {
+    AsyncQueue(Logger& asyncLogger, const AsyncInfo& asyncInfo) : logger(asyncLogger), info(asyncInfo), messages(asyncInfo.capacity) {}
+
+    void push(Message& msg);
+    void flush();
+    void run();
+    void drainOnCrash();
+
+    // Async-signal-safe: only writes the text of the queued messages to stderr, without calling the handlers
+    void writeOnSignal();
+
+    void dispatch(Message& msg);
+
+    // The mutex must be locked
+    uint32_t handleBatch(uint32_t maxCount);
+
+    Logger& logger;
+    const AsyncInfo info;
+    RingBuffer<Message> messages;
+
+    std::thread thread;
+    std::atomic<bool> running{true};
+    std::atomic<bool> waiting{false};
+
+    // Held by the thread popping the messages, the background thread or the crash handler
+    std::atomic<bool> consuming{false};
+
+    std::atomic<uint64_t> droppedCount{0};
+    uint64_t reportedDroppedCount{0};
+
+    // Locked by the background thread while it calls the handlers
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable handled;
+};
+
+} // priv
+
+namespace {
+
+// The queues to handle when the program crashes
+constexpr uint32_t maxCrashQueues = 16;
+std::array<std::atomic<priv::AsyncQueue*>, maxCrashQueues> crashQueues{};
+
+std::terminate_handler previousTerminateHandler = nullptr;
+
+constexpr std::array<int, 4> crashSignals{{SIGABRT, SIGFPE, SIGILL, SIGSEGV}};
+std::array<void (*)(int), crashSignals.size()> previousSignalHandlers{};
+
+void drainCrashQueues() {
+    for (auto& crashQueue : crashQueues) {
+        priv::AsyncQueue* asyncQueue = crashQueue.load(std::memory_order_acquire);
+
+        if (asyncQueue) {
+            asyncQueue->drainOnCrash();
+        }
+    }
+}
+
+void onTerminate() {
+    drainCrashQueues();
+
+    if (previousTerminateHandler) {
+        previousTerminateHandler();
+    }
+
+    std::abort();
+}
+
+void onSignal(int signal) {
+    for (auto& crashQueue : crashQueues) {
+        priv::AsyncQueue* asyncQueue = crashQueue.load(std::memory_order_acquire);
+
+        if (asyncQueue) {
+            asyncQueue->writeOnSignal();
+        }
+    }
+
+    for (uint32_t i = 0; i < crashSignals.size(); ++i) {
+        if (crashSignals[i] != signal) {
+            continue;
+        }
+
+        // Raise the signal again with the handler installed before, an ignored fatal signal would return to the faulting instruction
+        if (previousSignalHandlers[i] != SIG_IGN && previousSignalHandlers[i] != SIG_ERR) {
+            std::signal(signal, previousSignalHandlers[i]);
+        } else {
+            std::signal(signal, SIG_DFL);
+        }
+
+        std::raise(signal);
+    }
+}
+
+void registerCrashQueue(priv::AsyncQueue* asyncQueue) {
+    static std::once_flag installFlag;
+
+    std::call_once(installFlag, []() {
+        previousTerminateHandler = std::set_terminate(onTerminate);
+
+        for (uint32_t i = 0; i < crashSignals.size(); ++i) {
+            previousSignalHandlers[i] = std::signal(crashSignals[i], onSignal);
+        }
+    });
+
+    for (auto& crashQueue : crashQueues) {
+        priv::AsyncQueue* expected = nullptr;
+
+        if (crashQueue.compare_exchange_strong(expected, asyncQueue)) {
+            return;
+        }
+    }
+}
+
+void unregisterCrashQueue(priv::AsyncQueue* asyncQueue) {
+    for (auto& crashQueue : crashQueues) {
+        priv::AsyncQueue* expected = asyncQueue;
+
+        if (crashQueue.compare_exchange_strong(expected, nullptr)) {
+            return;
+        }
+    }
+}
+
+} // anonymous
+
+namespace priv {
+
+void AsyncQueue::push(Message& msg) {
+    if (!messages.tryPush(std::move(msg))) {
+        if (info.overflow != Overflow::Block) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        do {
+            wakeUp.notify_one();
+            std::this_thread::yield();
+        } while (!messages.tryPush(std::move(msg)));
+    }
+
+    // The producers only notify when the background thread waits, a missed notification delays it to the end of its wait
+    if (waiting.load()) {
+        wakeUp.notify_one();
+    }
+}
+
+void AsyncQueue::flush() {
+    const uint64_t position = messages.getWritePosition();
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (messages.getReadPosition() < position) {
+        wakeUp.notify_one();
+        handled.wait_for(lock, std::chrono::milliseconds(1));
+    }
+
+    for (auto& handler : logger._handlers) {
+        handler->flush();
+    }
+}
+
+void AsyncQueue::run() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            if (handleBatch(info.batchSize) == 0) {
+                if (!running.load() && messages.empty()) {
+                    return;
+                }
+
+                // Check again once the flag is visible to the producers
+                waiting.store(true);
+
+                if (running.load() && messages.empty()) {
+                    wakeUp.wait_for(lock, std::chrono::milliseconds(10));
+                }
+
+                waiting.store(false);
+
+                continue;
+            }
+        }
+
+        handled.notify_all();
+    }
+}
+
+uint32_t AsyncQueue::handleBatch(uint32_t maxCount) {
+    // The crash handler is handling the messages
+    if (consuming.exchange(true, std::memory_order_acquire)) {
+        return 0;
+    }
+
+    const uint32_t count = messages.pop([this](Message& msg) {
+        dispatch(msg);
+    }, maxCount);
+
+    if (info.overflow == Overflow::Count) {
+        const uint64_t dropped = droppedCount.load(std::memory_order_relaxed);
+
+        if (dropped != reportedDroppedCount) {
+            Message report(logger._name.c_str(), Level::Warning);
+            report.raw.write("{} messages dropped, the asynchronous queue was full", dropped - reportedDroppedCount);
+            captureArguments(report, "{} messages dropped, the asynchronous queue was full", dropped - reportedDroppedCount);
+            reportedDroppedCount = dropped;
+
+            dispatch(report);
+        }
+    }
+
+    consuming.store(false, std::memory_order_release);
+
+    return count;
+}
+
+void AsyncQueue::drainOnCrash() {
+    // The handlers crashed, don't call them again
+    if (std::this_thread::get_id() == thread.get_id()) {
+        return;
+    }
+
+    // Let the background thread finish its batch, but don't wait forever for a thread that may be stopped
+    for (uint32_t attempt = 0; consuming.exchange(true, std::memory_order_acquire); ++attempt) {
+        if (attempt == 100) {
+            return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    messages.pop([this](Message& msg) {
+        dispatch(msg);
+    });
+
+    for (auto& handler : logger._handlers) {
+        handler->flush();
+    }
+
+    consuming.store(false, std::memory_order_release);
+}
+
+void AsyncQueue::writeOnSignal() {
+    bool acquired = !consuming.exchange(true, std::memory_order_acquire);
+
+#if !defined(LUG_SYSTEM_WINDOWS)
+    // Let the background thread finish its batch, but the crashing thread may be the one holding the flag
+    for (uint32_t attempt = 0; !acquired && attempt < 100; ++attempt) {
+        const timespec delay{0, 1000000};
+        nanosleep(&delay, nullptr);
+
+        acquired = !consuming.exchange(true, std::memory_order_acquire);
+    }
+#endif
+
+    const auto writeStderr = [](const char* data, std::size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+        _write(2, data, static_cast<unsigned int>(size));
+#else
+        while (size > 0) {
+            const ssize_t written = ::write(STDERR_FILENO, data, size);
+            if (written <= 0) {
+                return;
+            }
+
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+#endif
+    };
+
+    // The text was formatted when the message was logged, the handlers would allocate and lock
+    messages.peek([&writeStderr](const Message& msg) {
+        if (msg.raw.size() == 0) {
+            return;
+        }
+
+        std::size_t nameSize = 0;
+        while (msg.loggerName[nameSize]) {
+            ++nameSize;
+        }
+
+        writeStderr(msg.loggerName, nameSize);
+        writeStderr(": ", 2);
+        writeStderr(msg.raw.data(), msg.raw.size());
+        writeStderr("\n", 1);
+    });
+
+    // A previous handler may recover from the signal
+    if (acquired) {
+        consuming.store(false, std::memory_order_release);
+    }
+}
+
+void AsyncQueue::dispatch(Message& msg) {
+    try {
+        logger.dispatch(msg);
+    } catch (const std::exception&) {
+        // Nothing to report it with, the handlers are the ones failing
+    }
+}
+
+} // priv
+
+Logger::Logger(const std::string& loggerName) : _name(loggerName), _mutex(std::make_unique<std::recursive_mutex>()) {}
+
+Logger::Logger(Logger&& logger) : _name(logger._name) {
+    // The background thread refers to the logger, start a new one
+    const bool async = logger.isAsync();
+    const AsyncInfo asyncInfo = async ? logger._asyncQueue->info : AsyncInfo{};
+
+    logger.disableAsync();
+
+    _handlers = std::move(logger._handlers);
+    _mutex = std::move(logger._mutex);
+
+    _minLevel.store(logger._minLevel.load());
+    _levelsVersion.store(logger._levelsVersion.load());
+    _needsText.store(logger._needsText.load());
+    _needsArguments.store(logger._needsArguments.load());
+
+    if (async) {
+        enableAsync(asyncInfo);
+    }
+}
+
+Logger::~Logger() {
+    disableAsync();
+}
 
 void Logger::addHandler(Handler* handler) {
+    std::unique_lock<std::mutex> asyncLock;
+    std::unique_lock<std::recursive_mutex> lock;
+
+    // The background thread reads the handlers under the mutex of the queue, and updateMinLevel under _mutex
+    if (_asyncQueue) {
+        asyncLock = std::unique_lock<std::mutex>(_asyncQueue->mutex);
+    }
+
+    lock = std::unique_lock<std::recursive_mutex>(*_mutex);
+
     _handlers.insert(handler);
+
+    updateHandlersState();
 }
 
 void Logger::addHandler(const std::string& name) {
-    _handlers.insert(LoggingFacility::getHandler(name));
+    addHandler(LoggingFacility::getHandler(name));
 }
 
 void Logger::defaultErrHandler(const std::string& msg) {
@@ -39,18 +400,128 @@ const std::string& Logger::getName() const {
 }
 
 void Logger::handle(priv::Message& msg) {
-    for (auto& handler : _handlers) {
-        if (handler->shouldLog(msg.level)) {
-            handler->format(msg);
-            handler->handle(msg);
+    if (_asyncQueue) {
+        // A handler logging from the background thread, which already holds the handlers
+        if (std::this_thread::get_id() == _asyncQueue->thread.get_id()) {
+            dispatch(msg);
+            return;
         }
+
+        // The program is likely to stop after a fatal message, don't let it in the queue
+        const bool fatal = msg.level >= Level::Fatal;
+
+        _asyncQueue->push(msg);
+
+        if (fatal) {
+            _asyncQueue->flush();
+        }
+
+        return;
     }
+
+    std::lock_guard<std::recursive_mutex> lock(*_mutex);
+    dispatch(msg);
 }
 
 void Logger::flush() {
+    if (_asyncQueue && std::this_thread::get_id() != _asyncQueue->thread.get_id()) {
+        _asyncQueue->flush();
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(*_mutex);
+
+    for (auto& handler : _handlers) {
+        handler->flush();
+    }
+}
+
+bool Logger::enableAsync(const AsyncInfo& asyncInfo) {
+    disableAsync();
+
+    std::unique_ptr<priv::AsyncQueue> asyncQueue = std::make_unique<priv::AsyncQueue>(*this, asyncInfo);
+
+    try {
+        asyncQueue->thread = std::thread(&priv::AsyncQueue::run, asyncQueue.get());
+    } catch (const std::system_error&) {
+        return false;
+    }
+
+    _asyncQueue = std::move(asyncQueue);
+
+    if (asyncInfo.drainOnCrash) {
+        registerCrashQueue(_asyncQueue.get());
+    }
+
+    return true;
+}
+
+void Logger::disableAsync() {
+    if (!_asyncQueue) {
+        return;
+    }
+
+    unregisterCrashQueue(_asyncQueue.get());
+
+    _asyncQueue->running.store(false);
+    _asyncQueue->wakeUp.notify_one();
+    _asyncQueue->thread.join();
+
+    // Flush the last messages handled by the background thread
     for (auto& handler : _handlers) {
         handler->flush();
     }
+
+    _asyncQueue.reset();
+}
+
+bool Logger::isAsync() const {
+    return _asyncQueue != nullptr;
+}
+
+uint64_t Logger::getDroppedCount() const {
+    return _asyncQueue ? _asyncQueue->droppedCount.load(std::memory_order_relaxed) : 0;
+}
+
+void Logger::dispatch(priv::Message& msg) {
+    for (auto& handler : _handlers) {
+        if (handler->shouldLog(msg.level)) {
+            if (handler->needsText()) {
+                handler->format(msg);
+            }
+
+            handler->handle(msg);
+        }
+    }
+}
+
+void Logger::updateHandlersState() const {
+    // Moved from
+    if (!_mutex) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(*_mutex);
+
+    // Read before the levels, a level changed meanwhile updates the version again
+    const uint32_t levelsVersion = Handler::getLevelsVersion();
+    Level minLevel = Level::Off;
+    bool needsText = false;
+    bool needsArguments = false;
+
+    for (const auto& handler : _handlers) {
+        if (handler->getLevel() < minLevel) {
+            minLevel = handler->getLevel();
+        }
+
+        needsText |= handler->needsText();
+        needsArguments |= handler->needsArguments();
+    }
+
+    _needsText.store(needsText, std::memory_order_relaxed);
+    _needsArguments.store(needsArguments, std::memory_order_relaxed);
+    _minLevel.store(minLevel, std::memory_order_relaxed);
+    _levelsVersion.store(levelsVersion, std::memory_order_relaxed);
 }
 
 Logger& Logger::getInternalLogger() {
@@ -6,8 +6,9 @@ namespace lug {
 namespace System {
 namespace Logger {
 
-static std::unordered_map<std::string, std::unique_ptr<Logger>> loggers{};
+// The loggers are destroyed first, the asynchronous ones handle their queued messages when destroyed
 static std::unordered_map<std::string, std::unique_ptr<Handler>> handlers{};
+static std::unordered_map<std::string, std::unique_ptr<Logger>> loggers{};
 
 void LoggingFacility::registerLogger(const std::string& loggerName, std::unique_ptr<Logger> logger) {
     loggers[loggerName] = std::move(logger);
@@ -26,8 +27,8 @@ Handler* LoggingFacility::getHandler(const std::string& handlerName) {
 }
 
 void LoggingFacility::clear() {
-    handlers.clear();
     loggers.clear();
+    handlers.clear();
 }
 
 } // Logger
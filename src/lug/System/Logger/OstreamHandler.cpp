@@ -9,7 +9,7 @@ namespace Logger {
 OstreamHandler::OstreamHandler(const std::string& name, std::ostream& out) : Handler(name), _os(out) {}
 
 void OstreamHandler::handle(const priv::Message& msg) {
-    _os << msg.formatted.c_str();
+    _os.write(msg.formatted.data(), msg.formatted.size());
 }
 
 void OstreamHandler::flush() {
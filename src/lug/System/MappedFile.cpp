@@ -0,0 +1,250 @@
+#include <lug/System/MappedFile.hpp>
+
+#include <utility>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace System {
+
+MappedFile::MappedFile(MappedFile&& mappedFile) {
+    *this = std::move(mappedFile);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& mappedFile) {
+    close();
+
+    std::swap(_data, mappedFile._data);
+    std::swap(_size, mappedFile._size);
+    std::swap(_writable, mappedFile._writable);
+    std::swap(_file, mappedFile._file);
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    std::swap(_mapping, mappedFile._mapping);
+#endif
+
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#if defined(LUG_SYSTEM_WINDOWS)
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    _file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) {
+        _file = nullptr;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0) {
+        close();
+        return false;
+    }
+
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!_mapping) {
+        close();
+        return false;
+    }
+
+    _data = static_cast<uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!_data) {
+        close();
+        return false;
+    }
+
+    _size = static_cast<std::size_t>(fileSize.QuadPart);
+    _writable = false;
+
+    return true;
+}
+
+bool MappedFile::create(const std::string& filename, std::size_t size) {
+    close();
+
+    _file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) {
+        _file = nullptr;
+        return false;
+    }
+
+    // The mapping extends the file, the new pages are filled with zeros
+    const uint64_t mappingSize = static_cast<uint64_t>(size);
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize), nullptr);
+    if (!_mapping) {
+        close();
+        return false;
+    }
+
+    _data = static_cast<uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, size));
+    if (!_data) {
+        close();
+        return false;
+    }
+
+    _size = size;
+    _writable = true;
+
+    return true;
+}
+
+void MappedFile::flush() {
+    if (_data && _writable) {
+        FlushViewOfFile(_data, 0);
+    }
+}
+
+void MappedFile::close() {
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+
+    if (_mapping) {
+        CloseHandle(_mapping);
+    }
+
+    if (_file) {
+        CloseHandle(_file);
+    }
+
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+}
+
+void MappedFile::close(std::size_t size) {
+    if (_data) {
+        UnmapViewOfFile(_data);
+        _data = nullptr;
+    }
+
+    if (_mapping) {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+
+    if (_file && _writable) {
+        LARGE_INTEGER position;
+        position.QuadPart = static_cast<LONGLONG>(size);
+
+        if (SetFilePointerEx(_file, position, nullptr, FILE_BEGIN)) {
+            SetEndOfFile(_file);
+        }
+    }
+
+    close();
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    _file = ::open(filename.c_str(), O_RDONLY);
+    if (_file == -1) {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(_file, &fileStat) != 0 || fileStat.st_size == 0) {
+        close();
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, _file, 0);
+    if (data == MAP_FAILED) {
+        close();
+        return false;
+    }
+
+    _data = static_cast<uint8_t*>(data);
+    _size = static_cast<std::size_t>(fileStat.st_size);
+    _writable = false;
+
+    return true;
+}
+
+bool MappedFile::create(const std::string& filename, std::size_t size) {
+    close();
+
+    _file = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (_file == -1) {
+        return false;
+    }
+
+    // The file is sparse, the new pages are filled with zeros
+    if (ftruncate(_file, static_cast<off_t>(size)) != 0) {
+        close();
+        return false;
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+    if (data == MAP_FAILED) {
+        close();
+        return false;
+    }
+
+    _data = static_cast<uint8_t*>(data);
+    _size = size;
+    _writable = true;
+
+    return true;
+}
+
+void MappedFile::flush() {
+    if (_data && _writable) {
+        msync(_data, _size, MS_ASYNC);
+    }
+}
+
+void MappedFile::close() {
+    if (_data) {
+        munmap(_data, _size);
+    }
+
+    if (_file != -1) {
+        ::close(_file);
+    }
+
+    _data = nullptr;
+    _file = -1;
+    _size = 0;
+}
+
+void MappedFile::close(std::size_t size) {
+    if (_data) {
+        munmap(_data, _size);
+        _data = nullptr;
+    }
+
+    // On failure the end of the file stays filled with zeros
+    if (_file != -1 && _writable) {
+        const int result = ftruncate(_file, static_cast<off_t>(size));
+        static_cast<void>(result);
+    }
+
+    close();
+}
+
+#endif
+
+} // System
+} // lug
@@ -0,0 +1,205 @@
+#include <lug/System/Profiler/Exporter.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <unordered_map>
+
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+namespace Exporter {
+
+namespace {
+
+constexpr uint32_t binaryMagic = 0x5047554C; // "LUGP"
+constexpr uint32_t binaryVersion = 1;
+
+struct BinaryEvent {
+    uint32_t nameIndex;
+    uint32_t threadId;
+    uint32_t depth;
+    uint32_t padding;
+    int64_t begin;
+    int64_t end;
+};
+
+void writeEscaped(std::ostream& stream, const char* str) {
+    for (; *str; ++str) {
+        if (*str == '"' || *str == '\\') {
+            stream << '\\' << *str;
+        } else if (static_cast<unsigned char>(*str) < 0x20) {
+            stream << ' ';
+        } else {
+            stream << *str;
+        }
+    }
+}
+
+} // anonymous
+
+bool writeChromeTrace(std::ostream& stream, const std::vector<Event>& events) {
+    int64_t origin = std::numeric_limits<int64_t>::max();
+    for (const Event& event : events) {
+        origin = std::min(origin, event.begin);
+    }
+
+    // The timestamps are in microseconds, keep the nanoseconds as decimals
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"traceEvents\":[";
+
+    for (size_t i = 0; i < events.size(); ++i) {
+        const Event& event = events[i];
+
+        stream << (i ? ",\n" : "\n") << "{\"name\":\"";
+        writeEscaped(stream, event.name);
+        stream << "\",\"cat\":\"lug\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadId
+               << ",\"ts\":" << static_cast<double>(event.begin - origin) / 1000.0
+               << ",\"dur\":" << static_cast<double>(event.end - event.begin) / 1000.0 << "}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return stream.good();
+}
+
+bool writeChromeTrace(const std::string& filename, const std::vector<Event>& events) {
+    std::ofstream file(filename, std::ios::trunc);
+
+    if (!file.good()) {
+        LUG_LOG.error("Profiler::Exporter::writeChromeTrace: Can't open {}", filename);
+        return false;
+    }
+
+    if (!writeChromeTrace(file, events)) {
+        LUG_LOG.error("Profiler::Exporter::writeChromeTrace: Can't write {}", filename);
+        return false;
+    }
+
+    return true;
+}
+
+bool writeBinary(const std::string& filename, const std::vector<Event>& events) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+    if (!file.good()) {
+        LUG_LOG.error("Profiler::Exporter::writeBinary: Can't open {}", filename);
+        return false;
+    }
+
+    // The names are static strings, index them by address first
+    std::unordered_map<const char*, uint32_t> namesIndices;
+    std::vector<const char*> names;
+    std::vector<BinaryEvent> binaryEvents;
+
+    binaryEvents.reserve(events.size());
+
+    for (const Event& event : events) {
+        const auto it = namesIndices.emplace(event.name, static_cast<uint32_t>(names.size()));
+        if (it.second) {
+            names.push_back(event.name);
+        }
+
+        binaryEvents.push_back({
+            /* binaryEvent.nameIndex    */ it.first->second,
+            /* binaryEvent.threadId     */ event.threadId,
+            /* binaryEvent.depth        */ event.depth,
+            /* binaryEvent.padding      */ 0,
+            /* binaryEvent.begin        */ event.begin,
+            /* binaryEvent.end          */ event.end
+        });
+    }
+
+    const uint32_t header[] = {
+        binaryMagic,
+        binaryVersion,
+        static_cast<uint32_t>(names.size()),
+        static_cast<uint32_t>(binaryEvents.size())
+    };
+
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    for (const char* name : names) {
+        const uint32_t size = static_cast<uint32_t>(std::strlen(name));
+
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(name, size);
+    }
+
+    file.write(reinterpret_cast<const char*>(binaryEvents.data()), binaryEvents.size() * sizeof(BinaryEvent));
+
+    if (!file.good()) {
+        LUG_LOG.error("Profiler::Exporter::writeBinary: Can't write {}", filename);
+        return false;
+    }
+
+    return true;
+}
+
+bool readBinary(const std::string& filename, std::vector<std::string>& names, std::vector<Event>& events) {
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.good()) {
+        LUG_LOG.error("Profiler::Exporter::readBinary: Can't open {}", filename);
+        return false;
+    }
+
+    uint32_t header[4];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != binaryMagic || header[1] != binaryVersion) {
+        LUG_LOG.error("Profiler::Exporter::readBinary: Invalid header for {}", filename);
+        return false;
+    }
+
+    std::vector<std::string> readNames(header[2]);
+    for (std::string& name : readNames) {
+        uint32_t size = 0;
+
+        if (!file.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+            LUG_LOG.error("Profiler::Exporter::readBinary: Truncated file {}", filename);
+            return false;
+        }
+
+        name.resize(size);
+        if (size && !file.read(&name[0], size)) {
+            LUG_LOG.error("Profiler::Exporter::readBinary: Truncated file {}", filename);
+            return false;
+        }
+    }
+
+    std::vector<BinaryEvent> binaryEvents(header[3]);
+    if (!file.read(reinterpret_cast<char*>(binaryEvents.data()), binaryEvents.size() * sizeof(BinaryEvent))) {
+        LUG_LOG.error("Profiler::Exporter::readBinary: Truncated file {}", filename);
+        return false;
+    }
+
+    names = std::move(readNames);
+    events.clear();
+    events.reserve(binaryEvents.size());
+
+    for (const BinaryEvent& binaryEvent : binaryEvents) {
+        if (binaryEvent.nameIndex >= names.size()) {
+            LUG_LOG.error("Profiler::Exporter::readBinary: Invalid event in {}", filename);
+            events.clear();
+            return false;
+        }
+
+        events.push_back({
+            /* event.name       */ names[binaryEvent.nameIndex].c_str(),
+            /* event.begin      */ binaryEvent.begin,
+            /* event.end        */ binaryEvent.end,
+            /* event.threadId   */ binaryEvent.threadId,
+            /* event.depth      */ binaryEvent.depth
+        });
+    }
+
+    return true;
+}
+
+} // Exporter
+} // Profiler
+} // System
+} // lug
@@ -0,0 +1,64 @@
+#include <lug/System/Profiler/Profiler.hpp>
+
+#include <algorithm>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+
+constexpr uint32_t ThreadBuffer::capacity;
+
+ThreadBuffer::ThreadBuffer(uint32_t threadId) : _events(new Event[capacity]), _threadId(threadId) {}
+
+void ThreadBuffer::pop(std::vector<Event>& events) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    const uint32_t head = _head.load(std::memory_order_acquire);
+
+    for (; tail != head; ++tail) {
+        events.push_back(_events[tail & (capacity - 1)]);
+    }
+
+    _tail.store(tail, std::memory_order_release);
+}
+
+ThreadBuffer& Profiler::getThreadBuffer() {
+    // There is only one profiler, the buffer of the thread can be cached
+    thread_local ThreadBuffer* threadBuffer = nullptr;
+
+    if (!threadBuffer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _threadBuffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(_threadBuffers.size())));
+        threadBuffer = _threadBuffers.back().get();
+    }
+
+    return *threadBuffer;
+}
+
+void Profiler::collect(std::vector<Event>& events) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& threadBuffer : _threadBuffers) {
+        threadBuffer->pop(events);
+    }
+}
+
+uint64_t Profiler::getDroppedCount() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    uint64_t droppedCount = 0;
+    for (const auto& threadBuffer : _threadBuffers) {
+        droppedCount += threadBuffer->getDroppedCount();
+    }
+
+    return droppedCount;
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+} // Profiler
+} // System
+} // lug
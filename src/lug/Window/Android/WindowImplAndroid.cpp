@@ -95,7 +95,7 @@ bool WindowImpl::pollEvent(lug::Window::Event& event) {
             }
 
             HandleInput(event, androidEvent);
-            LUG_LOG.info("WINDOWS ANDROID event coordinate  {} {}", event.touchScreen.coordinates[0].x(), event.touchScreen.coordinates[0].y());
+            LUG_LOG_DEBUG("WINDOWS ANDROID event coordinate  {} {}", event.touchScreen.coordinates[0].x(), event.touchScreen.coordinates[0].y());
             events.push(std::move(event));
             AInputQueue_finishEvent(inputQueue, androidEvent, 1);
         }
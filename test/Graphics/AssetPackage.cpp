@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/AssetCooker.hpp>
+#include <lug/Graphics/AssetPackage.hpp>
+#include <lug/Graphics/Render/Mesh.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+const std::string filename = "LugdunumTestFile.lugpack";
+
+// A package of a quad with a 4x2 texture, under a root node
+void fillWriter(AssetPackage::Writer& writer) {
+    writer.setName("scene");
+
+    const std::vector<uint8_t> pixels(4 * 2 * 4, 0x80);
+    const std::vector<uint8_t> mipLevels = AssetCooker::generateMipLevels(pixels.data(), 4, 2);
+
+    AssetPackage::Texture texture{};
+    texture.blob = writer.addBlob(mipLevels.data(), mipLevels.size());
+    texture.width = 4;
+    texture.height = 2;
+    texture.mipLevels = AssetCooker::getMipLevelsCount(4, 2);
+    texture.format = static_cast<uint8_t>(Render::Texture::Format::R8G8B8A8_UNORM);
+    writer.textures.push_back(texture);
+
+    AssetPackage::Material material{};
+    material.name = writer.addString("material");
+    material.baseColorFactor[0] = 0.5f;
+    material.baseColorTexture = {0, 1};
+    material.metallicRoughnessTexture = {AssetPackage::none, 0};
+    material.normalTexture = {AssetPackage::none, 0};
+    material.occlusionTexture = {AssetPackage::none, 0};
+    material.emissiveTexture = {AssetPackage::none, 0};
+    writer.materials.push_back(material);
+
+    const float positions[] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    const uint16_t indices[] = {0, 1, 2, 0, 2, 3};
+
+    writer.attributes.push_back({
+        static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Attribute::Type::Indice),
+        writer.addBlob(indices, sizeof(indices)), sizeof(uint16_t), 6
+    });
+    writer.attributes.push_back({
+        static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Attribute::Type::Position),
+        writer.addBlob(positions, sizeof(positions)), sizeof(float) * 3, 4
+    });
+
+    writer.primitiveSets.push_back({static_cast<uint32_t>(Render::Mesh::PrimitiveSet::Mode::Triangles), 0, 0, 2});
+    writer.meshes.push_back({writer.addString("quad"), 0, 1});
+
+    writer.nodes.push_back({writer.addString("root"), AssetPackage::none, AssetPackage::none, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}});
+    writer.nodes.push_back({writer.addString("quad"), 0, 0, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {2.0f, 2.0f, 2.0f}});
+}
+
+std::vector<char> readFile() {
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::vector<char>& data) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), data.size());
+}
+
+} // anonymous
+
+TEST(AssetPackage, SaveAndOpen) {
+    {
+        AssetPackage::Writer writer;
+        fillWriter(writer);
+        ASSERT_TRUE(writer.save(filename));
+    }
+
+    AssetPackage package;
+    ASSERT_TRUE(package.open(filename));
+
+    EXPECT_EQ(package.getString(package.getHeader().name), "scene");
+
+    ASSERT_EQ(package.getTextures().count, 1u);
+    EXPECT_EQ(package.getTextures()[0].mipLevels, 3u);
+    EXPECT_EQ(package.getBlobs()[package.getTextures()[0].blob].size, 4u * 2 * 4 + 2 * 1 * 4 + 1 * 1 * 4);
+    EXPECT_EQ(package.getBlobData(package.getTextures()[0].blob)[0], 0x80);
+
+    ASSERT_EQ(package.getMaterials().count, 1u);
+    EXPECT_EQ(package.getString(package.getMaterials()[0].name), "material");
+    EXPECT_EQ(package.getMaterials()[0].baseColorFactor[0], 0.5f);
+    EXPECT_EQ(package.getMaterials()[0].baseColorTexture.texCoord, 1u);
+
+    ASSERT_EQ(package.getMeshes().count, 1u);
+    ASSERT_EQ(package.getAttributes().count, 2u);
+
+    const AssetPackage::Attribute& indices = package.getAttributes()[0];
+    EXPECT_EQ(indices.elementsCount, 6u);
+    EXPECT_EQ(reinterpret_cast<const uint16_t*>(package.getBlobData(indices.blob))[5], 3u);
+
+    // The blobs are aligned for the GPU copies
+    for (const AssetPackage::Blob& blob : package.getBlobs()) {
+        EXPECT_EQ(blob.offset % AssetPackage::blobAlignment, 0u);
+    }
+
+    ASSERT_EQ(package.getNodes().count, 2u);
+    EXPECT_EQ(package.getNodes()[0].parent, AssetPackage::none);
+    EXPECT_EQ(package.getNodes()[1].parent, 0u);
+    EXPECT_EQ(package.getNodes()[1].mesh, 0u);
+    EXPECT_EQ(package.getNodes()[1].scale[2], 2.0f);
+
+    package = AssetPackage();
+    std::remove(filename.c_str());
+}
+
+TEST(AssetPackage, RejectInvalid) {
+    {
+        AssetPackage::Writer writer;
+        fillWriter(writer);
+        ASSERT_TRUE(writer.save(filename));
+    }
+
+    const std::vector<char> data = readFile();
+    ASSERT_GT(data.size(), sizeof(AssetPackage::Header));
+
+    AssetPackage package;
+
+    // Truncated
+    writeFile(std::vector<char>(data.begin(), data.end() - 1));
+    EXPECT_FALSE(package.open(filename));
+
+    // Other version
+    {
+        std::vector<char> invalidData = data;
+        invalidData[4] = static_cast<char>(AssetPackage::version + 1);
+        writeFile(invalidData);
+        EXPECT_FALSE(package.open(filename));
+    }
+
+    // Node before its parent
+    {
+        AssetPackage::Writer writer;
+        fillWriter(writer);
+        writer.nodes[0].parent = 1;
+        ASSERT_TRUE(writer.save(filename));
+        EXPECT_FALSE(package.open(filename));
+    }
+
+    // Texture smaller than its mip levels
+    {
+        AssetPackage::Writer writer;
+        fillWriter(writer);
+        writer.textures[0].width = 8;
+        ASSERT_TRUE(writer.save(filename));
+        EXPECT_FALSE(package.open(filename));
+    }
+
+    writeFile(data);
+    EXPECT_TRUE(package.open(filename));
+
+    package = AssetPackage();
+    std::remove(filename.c_str());
+}
+
+TEST(AssetCooker, MipLevels) {
+    EXPECT_EQ(AssetCooker::getMipLevelsCount(1, 1), 1u);
+    EXPECT_EQ(AssetCooker::getMipLevelsCount(4, 2), 3u);
+    EXPECT_EQ(AssetCooker::getMipLevelsCount(5, 3), 3u);
+    EXPECT_EQ(AssetCooker::getMipLevelsCount(2048, 2048), 12u);
+
+    // 2x2 image: the second level is the average of the 4 texels
+    const uint8_t pixels[] = {
+        0, 10, 255, 255,    100, 20, 255, 255,
+        50, 30, 0, 255,     250, 40, 0, 255
+    };
+
+    const std::vector<uint8_t> mipLevels = AssetCooker::generateMipLevels(pixels, 2, 2);
+    ASSERT_EQ(mipLevels.size(), 2u * 2 * 4 + 4);
+
+    EXPECT_EQ(std::vector<uint8_t>(mipLevels.begin(), mipLevels.begin() + 16), std::vector<uint8_t>(pixels, pixels + 16));
+    EXPECT_EQ(mipLevels[16], 100);
+    EXPECT_EQ(mipLevels[17], 25);
+    EXPECT_EQ(mipLevels[18], 128);
+    EXPECT_EQ(mipLevels[19], 255);
+
+    // 3x1 image: the levels are 3x1 then 1x1
+    const uint8_t row[] = {0, 0, 0, 0, 40, 40, 40, 40, 80, 80, 80, 80};
+    const std::vector<uint8_t> rowMipLevels = AssetCooker::generateMipLevels(row, 3, 1);
+    ASSERT_EQ(rowMipLevels.size(), 3u * 4 + 4);
+    EXPECT_EQ(rowMipLevels[12], 20);
+}
+
+TEST(AssetCooker, GenerateNormals) {
+    // Two triangles of a quad facing +Z, the last vertices are not used
+    const float positions[] = {
+        0.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        1.0f, 0.0f, 1.0f,
+        1.0f, 1.0f, 1.0f
+    };
+
+    const std::vector<float> normals = AssetCooker::generateNormals(positions, 6, {0, 1, 2, 0, 2, 3});
+    ASSERT_EQ(normals.size(), 18u);
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_FLOAT_EQ(normals[i * 3], 0.0f);
+        EXPECT_FLOAT_EQ(normals[i * 3 + 1], 0.0f);
+        EXPECT_FLOAT_EQ(normals[i * 3 + 2], 1.0f);
+    }
+
+    // The vertices of no triangle get a default normal
+    EXPECT_FLOAT_EQ(normals[4 * 3 + 2], 1.0f);
+
+    // Not indexed, each triangle has its own vertices
+    const float sharedPositions[] = {
+        0.0f, 0.0f, 0.0f,   2.0f, 0.0f, 0.0f,   2.0f, 2.0f, 0.0f,
+        2.0f, 0.0f, 0.0f,   2.0f, 0.0f, 1.0f,   2.0f, 1.0f, 0.0f
+    };
+
+    const std::vector<float> sharedNormals = AssetCooker::generateNormals(sharedPositions, 6, {});
+    EXPECT_FLOAT_EQ(sharedNormals[2], 1.0f);
+    EXPECT_FLOAT_EQ(sharedNormals[9], -1.0f);
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Builder/Mesh.hpp>
+#include <lug/Graphics/GltfBufferSource.hpp>
+
+#if defined(ENABLE_LONG_TESTS) && !defined(LUG_SYSTEM_WINDOWS)
+    #include <sys/resource.h>
+#endif
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+void writeUint32(std::vector<uint8_t>& data, uint32_t value) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        data.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+// The start of a .glb file of a JSON chunk and a BIN chunk of `binSize` bytes, up to the data of the BIN chunk
+std::vector<uint8_t> createGlbHeader(const std::string& json, std::size_t binSize) {
+    const std::size_t jsonSize = (json.size() + 3) & ~static_cast<std::size_t>(3);
+    const std::size_t paddedBinSize = (binSize + 3) & ~static_cast<std::size_t>(3);
+
+    std::vector<uint8_t> data;
+
+    writeUint32(data, 0x46546C67);
+    writeUint32(data, 2);
+    writeUint32(data, static_cast<uint32_t>(12 + 8 + jsonSize + 8 + paddedBinSize));
+
+    writeUint32(data, static_cast<uint32_t>(jsonSize));
+    writeUint32(data, 0x4E4F534A);
+    data.insert(data.end(), json.begin(), json.end());
+    data.resize(data.size() + jsonSize - json.size(), ' ');
+
+    writeUint32(data, static_cast<uint32_t>(binSize));
+    writeUint32(data, 0x004E4942);
+
+    return data;
+}
+
+std::vector<uint8_t> createGlb(const std::string& json, std::size_t binSize) {
+    std::vector<uint8_t> data = createGlbHeader(json, binSize);
+
+    const std::size_t paddedBinSize = (binSize + 3) & ~static_cast<std::size_t>(3);
+    for (std::size_t i = 0; i < paddedBinSize; ++i) {
+        data.push_back(static_cast<uint8_t>(i < binSize ? i * 7 : 0));
+    }
+
+    return data;
+}
+
+void writeFile(const std::string& filename, const std::vector<uint8_t>& data) {
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+} // anonymous
+
+TEST(GltfBufferSource, ParseGlb) {
+    const std::vector<uint8_t> glb = createGlb("{\"asset\":{}}", 10);
+
+    GltfBufferSource::Chunk json;
+    GltfBufferSource::Chunk bin;
+
+    ASSERT_TRUE(GltfBufferSource::parseGlb(glb.data(), glb.size(), json, bin));
+    EXPECT_EQ(json.offset, 20u);
+    EXPECT_EQ(json.size, 12u);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(glb.data() + json.offset), json.size), "{\"asset\":{}}");
+    EXPECT_EQ(bin.offset, 40u);
+    EXPECT_EQ(bin.size, 10u);
+
+    // Truncated file, wrong magic
+    EXPECT_FALSE(GltfBufferSource::parseGlb(glb.data(), glb.size() - 4, json, bin));
+
+    std::vector<uint8_t> invalid = glb;
+    invalid[0] = 'x';
+    EXPECT_FALSE(GltfBufferSource::parseGlb(invalid.data(), invalid.size(), json, bin));
+}
+
+TEST(GltfBufferSource, MapGlb) {
+    const std::string filename = "LugdunumTestFile.glb";
+    const std::vector<uint8_t> glb = createGlb("{}", 1000);
+    writeFile(filename, glb);
+
+    {
+        GltfBufferSource buffers;
+        ASSERT_TRUE(buffers.open(filename));
+
+        // The accessors point into the mapped BIN chunk
+        const char* data = buffers.getBufferData(0, "", 1000);
+        ASSERT_NE(data, nullptr);
+        EXPECT_EQ(std::memcmp(data, glb.data() + 32, 1000), 0);
+
+        EXPECT_EQ(buffers.getBufferData(0, "", 1001), nullptr);
+        EXPECT_EQ(buffers.getBufferData(1, "", 10), nullptr);
+        EXPECT_EQ(buffers.getMappedSize(), glb.size());
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(GltfBufferSource, MapExternalBuffer) {
+    const std::string filename = "LugdunumTestFile.bin";
+    const std::vector<uint8_t> bin(4096, 42);
+    writeFile(filename, bin);
+
+    {
+        GltfBufferSource buffers;
+        ASSERT_TRUE(buffers.open("./LugdunumTestFile.gltf"));
+
+        const char* data = buffers.getBufferData(1, filename, bin.size());
+        ASSERT_NE(data, nullptr);
+        EXPECT_EQ(std::memcmp(data, bin.data(), bin.size()), 0);
+
+        // Mapped once
+        EXPECT_EQ(buffers.getBufferData(1, filename, bin.size()), data);
+
+        // Left to the glTF parser
+        EXPECT_EQ(buffers.getBufferData(0, "data:application/octet-stream;base64,AAAA", 3), nullptr);
+        EXPECT_EQ(buffers.getBufferData(2, "LugdunumMissingFile.bin", 1), nullptr);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(GltfBufferSource, CopiedBytes) {
+    const std::vector<float> positions(300, 1.0f);
+    Builder::Mesh::PrimitiveSet primitiveSet;
+
+    const uint64_t copiedBytes = Builder::Mesh::getCopiedBytes();
+
+    primitiveSet.addExternalAttributeBuffer(positions.data(), sizeof(float) * 3, 100, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+    EXPECT_EQ(Builder::Mesh::getCopiedBytes(), copiedBytes);
+    EXPECT_EQ(primitiveSet.getAttributes().back().buffer.data, reinterpret_cast<const char*>(positions.data()));
+
+    primitiveSet.addAttributeBuffer(positions.data(), sizeof(float) * 3, 100, Render::Mesh::PrimitiveSet::Attribute::Type::Normal);
+    EXPECT_EQ(Builder::Mesh::getCopiedBytes(), copiedBytes + positions.size() * sizeof(float));
+
+    // Owned by the mesh once built
+    delete[] primitiveSet.getAttributes().back().buffer.data;
+}
+
+#if defined(ENABLE_LONG_TESTS)
+namespace {
+
+// Peak resident memory of the process, in kilobytes
+long getPeakMemory() {
+#if defined(LUG_SYSTEM_WINDOWS)
+    return 0;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+} // anonymous
+
+// Compares the loading of the buffer of a large .glb file, mapped or read in memory like the glTF parser does,
+// up to the copy to the memory of the GPU (a heap buffer here)
+TEST(GltfBufferSource, LargeGlbBenchmark) {
+    constexpr std::size_t binSize = 256 * 1024 * 1024;
+    constexpr uint32_t elementSize = sizeof(float) * 3;
+
+    const std::string filename = "LugdunumTestFile.glb";
+    const std::vector<uint8_t> header = createGlbHeader("{}", binSize);
+
+    // Written by pieces to not increase the peak memory
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+        const std::vector<char> piece(1024 * 1024, 7);
+        for (std::size_t i = 0; i < binSize / piece.size(); ++i) {
+            file.write(piece.data(), piece.size());
+        }
+    }
+
+    const long initialPeak = getPeakMemory();
+    long mappedPeak;
+    long readPeak;
+    double mappedTime;
+    double readTime;
+
+    {
+        const uint64_t copiedBytes = Builder::Mesh::getCopiedBytes();
+        const auto start = std::chrono::steady_clock::now();
+
+        GltfBufferSource buffers;
+        ASSERT_TRUE(buffers.open(filename));
+
+        const char* data = buffers.getBufferData(0, "", binSize);
+        ASSERT_NE(data, nullptr);
+
+        Builder::Mesh::PrimitiveSet primitiveSet;
+        primitiveSet.addExternalAttributeBuffer(data, elementSize, binSize / elementSize, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+
+        const auto& buffer = primitiveSet.getAttributes().back().buffer;
+        std::vector<char> gpuMemory(buffer.size);
+        std::memcpy(gpuMemory.data(), buffer.data, buffer.size);
+
+        mappedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        mappedPeak = getPeakMemory();
+
+        EXPECT_EQ(Builder::Mesh::getCopiedBytes(), copiedBytes);
+    }
+
+    {
+        const uint64_t copiedBytes = Builder::Mesh::getCopiedBytes();
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<char> data(binSize);
+        {
+            std::ifstream file(filename, std::ios::binary);
+            file.seekg(header.size());
+            file.read(data.data(), data.size());
+            ASSERT_TRUE(file.good());
+        }
+
+        Builder::Mesh::PrimitiveSet primitiveSet;
+        primitiveSet.addAttributeBuffer(data.data(), elementSize, binSize / elementSize, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+
+        const auto& buffer = primitiveSet.getAttributes().back().buffer;
+        std::vector<char> gpuMemory(buffer.size);
+        std::memcpy(gpuMemory.data(), buffer.data, buffer.size);
+
+        readTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        readPeak = getPeakMemory();
+
+        EXPECT_EQ(Builder::Mesh::getCopiedBytes(), copiedBytes + buffer.size);
+        delete[] buffer.data;
+    }
+
+    // The peak memory never decreases, the mapped buffer is loaded first
+    RecordProperty("mapped_ms", static_cast<int>(mappedTime));
+    RecordProperty("mapped_peak_memory_mib", static_cast<int>((mappedPeak - initialPeak) / 1024));
+    RecordProperty("read_ms", static_cast<int>(readTime));
+    RecordProperty("read_peak_memory_mib", static_cast<int>((readPeak - initialPeak) / 1024));
+
+#if !defined(LUG_SYSTEM_WINDOWS)
+    EXPECT_LT(mappedPeak, readPeak);
+#endif
+
+    std::remove(filename.c_str());
+}
+#endif
+
+} // Graphics
+} // lug
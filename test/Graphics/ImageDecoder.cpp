@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/ImageDecoder.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+// A 2x1 binary PPM image, decoded by stb_image
+void writePpm(const std::string& filename, uint8_t red) {
+    const uint8_t pixels[] = {red, 20, 30, 40, 50, 60};
+
+    std::ofstream file(filename, std::ios::binary);
+    file << "P6\n2 1\n255\n";
+    file.write(reinterpret_cast<const char*>(pixels), sizeof(pixels));
+}
+
+} // anonymous
+
+TEST(ImageDecoder, Decode) {
+    const std::string filename = "LugdunumTestFile.ppm";
+    writePpm(filename, 10);
+
+    ImageDecoder decoder;
+    ImageDecoder::Image image;
+
+    ASSERT_TRUE(decoder.decode({filename, false}, image));
+    EXPECT_EQ(image.width, 2u);
+    EXPECT_EQ(image.height, 1u);
+    EXPECT_EQ(image.format, Render::Texture::Format::R8G8B8A8_UNORM);
+
+    const uint8_t expectedPixels[] = {10, 20, 30, 255, 40, 50, 60, 255};
+    EXPECT_EQ(std::memcmp(image.pixels.get(), expectedPixels, sizeof(expectedPixels)), 0);
+
+    ASSERT_TRUE(decoder.decode({filename, true}, image));
+    EXPECT_EQ(image.format, Render::Texture::Format::R32G32B32A32_SFLOAT);
+
+    EXPECT_FALSE(decoder.decode({"LugdunumMissingFile.ppm", false}, image));
+    EXPECT_FALSE(image.pixels);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ImageDecoder, DecodeInParallel) {
+    std::vector<ImageDecoder::Source> sources;
+
+    for (uint8_t i = 0; i < 16; ++i) {
+        const std::string filename = "LugdunumTestFile" + std::to_string(i) + ".ppm";
+        writePpm(filename, i);
+        sources.push_back({filename, false});
+    }
+
+    sources.push_back({"", false});
+    sources.push_back({"LugdunumMissingFile.ppm", false});
+
+    const std::vector<ImageDecoder::Image> images = ImageDecoder(4).decode(sources);
+    ASSERT_EQ(images.size(), sources.size());
+
+    // The images are in the order of the sources
+    for (uint8_t i = 0; i < 16; ++i) {
+        ASSERT_TRUE(images[i].pixels);
+        EXPECT_EQ(images[i].pixels.get()[0], i);
+
+        std::remove(sources[i].filename.c_str());
+    }
+
+    EXPECT_FALSE(images[16].pixels);
+    EXPECT_FALSE(images[17].pixels);
+}
+
+TEST(ImageDecoder, SetDecoder) {
+    const std::string filename = "LugdunumTestFile.raw";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "raw";
+    }
+
+    std::atomic<uint32_t> calls{0};
+
+    ImageDecoder decoder(2);
+    decoder.setDecoder("RAW", [&calls](const unsigned char* data, std::size_t size, bool, ImageDecoder::Image& image) {
+        ++calls;
+
+        image.width = static_cast<uint32_t>(size);
+        image.height = 1;
+        image.format = Render::Texture::Format::R8G8B8A8_UNORM;
+        image.pixels.reset(static_cast<unsigned char*>(std::malloc(size * 4)));
+        std::memset(image.pixels.get(), data[0], size * 4);
+
+        return true;
+    });
+
+    const std::vector<ImageDecoder::Image> images = decoder.decode({{filename, false}, {filename, false}});
+
+    EXPECT_EQ(calls, 2u);
+    ASSERT_TRUE(images[1].pixels);
+    EXPECT_EQ(images[1].width, 3u);
+    EXPECT_EQ(images[1].pixels.get()[0], 'r');
+
+    std::remove(filename.c_str());
+}
+
+} // Graphics
+} // lug
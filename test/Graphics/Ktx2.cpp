@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Ktx2.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using Format = Render::Texture::Format;
+
+namespace {
+
+// The bytes of the mip levels of a texture, each level with a different value
+std::vector<uint8_t> getMipLevels(uint32_t width, uint32_t height, uint32_t mipLevels, Format format) {
+    std::vector<uint8_t> data(Render::Texture::getMipLevelsSize(width, height, format, mipLevels));
+
+    for (uint32_t level = 0; level < mipLevels; ++level) {
+        const std::size_t offset = Render::Texture::getMipLevelsSize(width, height, format, level);
+        const std::size_t size = Render::Texture::getMipLevelsSize(width, height, format, level + 1) - offset;
+
+        std::memset(data.data() + offset, static_cast<int>(level + 1), size);
+    }
+
+    return data;
+}
+
+} // anonymous
+
+TEST(Ktx2, WriteRead) {
+    const std::vector<uint8_t> data = getMipLevels(12, 8, 4, Format::BC1_RGBA_UNORM);
+    const std::vector<uint8_t> file = Ktx2::write(12, 8, 4, Format::BC1_RGBA_UNORM, data.data());
+
+    ASSERT_FALSE(file.empty());
+    EXPECT_TRUE(Ktx2::isKtx2(file.data(), file.size()));
+
+    ImageDecoder::Image image;
+    ASSERT_TRUE(Ktx2::read(file.data(), file.size(), false, image));
+
+    EXPECT_EQ(image.width, 12u);
+    EXPECT_EQ(image.height, 8u);
+    EXPECT_EQ(image.format, Format::BC1_RGBA_UNORM);
+    EXPECT_EQ(image.mipLevels, 4u);
+
+    // The levels are read back from the largest one
+    EXPECT_EQ(std::memcmp(image.pixels.get(), data.data(), data.size()), 0);
+}
+
+TEST(Ktx2, DecodeFile) {
+    const std::string filename = "LugdunumTestFile.ktx2";
+
+    const std::vector<uint8_t> data = getMipLevels(16, 16, 5, Format::BC3_UNORM);
+    const std::vector<uint8_t> file = Ktx2::write(16, 16, 5, Format::BC3_UNORM, data.data());
+    std::ofstream(filename, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+
+    // The KTX 2.0 files are read by the ImageDecoder in their format
+    ImageDecoder::Image image;
+    ASSERT_TRUE(ImageDecoder().decode({filename, false}, image));
+
+    EXPECT_EQ(image.format, Format::BC3_UNORM);
+    EXPECT_EQ(image.mipLevels, 5u);
+    EXPECT_EQ(std::memcmp(image.pixels.get(), data.data(), data.size()), 0);
+
+    std::remove(filename.c_str());
+}
+
+TEST(Ktx2, Unsupported) {
+    const std::vector<uint8_t> data = getMipLevels(4, 4, 1, Format::R8G8B8A8_UNORM);
+    const std::vector<uint8_t> file = Ktx2::write(4, 4, 1, Format::R8G8B8A8_UNORM, data.data());
+
+    ImageDecoder::Image image;
+    ASSERT_TRUE(Ktx2::read(file.data(), file.size(), false, image));
+
+    // Offsets of vkFormat and supercompressionScheme in the header
+    const std::size_t vkFormatOffset = 12;
+    const std::size_t supercompressionSchemeOffset = 44;
+
+    // BasisLZ
+    std::vector<uint8_t> supercompressed = file;
+    supercompressed[supercompressionSchemeOffset] = 1;
+    EXPECT_FALSE(Ktx2::read(supercompressed.data(), supercompressed.size(), false, image));
+
+    // Basis Universal UASTC
+    std::vector<uint8_t> uastc = file;
+    std::memset(uastc.data() + vkFormatOffset, 0, 4);
+    EXPECT_FALSE(Ktx2::read(uastc.data(), uastc.size(), false, image));
+
+    // Truncated level
+    EXPECT_FALSE(Ktx2::read(file.data(), file.size() - 1, false, image));
+    EXPECT_FALSE(Ktx2::isKtx2(data.data(), data.size()));
+}
+
+} // Graphics
+} // lug
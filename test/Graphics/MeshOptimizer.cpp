@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gltf2/glTF2.hpp>
+#include <gltf2/Exceptions.hpp>
+
+#include <lug/Graphics/Builder/Mesh.hpp>
+#include <lug/Graphics/GltfBufferSource.hpp>
+#include <lug/Graphics/GltfLoader.hpp>
+#include <lug/Graphics/MeshOptimizer.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+// Grid of size x size quads, two triangles per quad
+void createGrid(uint32_t size, std::vector<float>& positions, std::vector<uint32_t>& indices) {
+    for (uint32_t y = 0; y <= size; ++y) {
+        for (uint32_t x = 0; x <= size; ++x) {
+            positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y), 0.0f});
+        }
+    }
+
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            const uint32_t index = y * (size + 1) + x;
+            indices.insert(indices.end(), {index, index + 1, index + size + 1, index + 1, index + size + 2, index + size + 1});
+        }
+    }
+}
+
+void shuffleTriangles(std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+    std::memcpy(triangles.data(), indices.data(), indices.size() * sizeof(uint32_t));
+
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+
+    std::memcpy(indices.data(), triangles.data(), indices.size() * sizeof(uint32_t));
+}
+
+// The triangles of an indexed triangle list, by the positions of their vertices, rotated to start with the smallest one
+std::vector<std::array<float, 9>> getTriangles(const Render::Mesh::PrimitiveSet::Attribute& indices, const Render::Mesh::PrimitiveSet::Attribute& positions) {
+    const uint32_t indexSize = indices.buffer.size / indices.buffer.elementsCount;
+
+    std::vector<std::array<float, 9>> triangles(indices.buffer.elementsCount / 3);
+    for (uint32_t i = 0; i < indices.buffer.elementsCount; ++i) {
+        uint32_t index = 0;
+        if (indexSize == sizeof(uint16_t)) {
+            index = reinterpret_cast<const uint16_t*>(indices.buffer.data)[i];
+        } else {
+            index = reinterpret_cast<const uint32_t*>(indices.buffer.data)[i];
+        }
+
+        std::memcpy(triangles[i / 3].data() + (i % 3) * 3, positions.buffer.data + index * sizeof(float) * 3, sizeof(float) * 3);
+    }
+
+    for (auto& triangle : triangles) {
+        std::array<float, 9> rotated = triangle;
+        for (uint32_t vertex = 1; vertex < 3; ++vertex) {
+            std::array<float, 9> candidate;
+            for (uint32_t i = 0; i < 9; ++i) {
+                candidate[i] = triangle[(i + vertex * 3) % 9];
+            }
+            rotated = std::min(rotated, candidate);
+        }
+        triangle = rotated;
+    }
+
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+const Render::Mesh::PrimitiveSet::Attribute* getAttribute(const Builder::Mesh::PrimitiveSet& primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type type) {
+    for (const auto& attribute : primitiveSet.getAttributes()) {
+        if (attribute.type == type) {
+            return &attribute;
+        }
+    }
+
+    return nullptr;
+}
+
+// Recorded as a property of the test instead of printed
+std::string formatStatistics(const MeshOptimizer::Statistics& before, const MeshOptimizer::Statistics& after) {
+    std::ostringstream text;
+    text << "ACMR " << before.acmr << " -> " << after.acmr << ", ATVR " << before.atvr << " -> " << after.atvr;
+    return text.str();
+}
+
+} // anonymous
+
+TEST(MeshOptimizer, CacheStatistics) {
+    // Two triangles sharing an edge: 4 vertices transformed once
+    const std::vector<uint32_t> indices{0, 1, 2, 2, 1, 3};
+
+    const MeshOptimizer::Statistics statistics = MeshOptimizer::getCacheStatistics(indices, 4);
+    EXPECT_FLOAT_EQ(statistics.acmr, 2.0f);
+    EXPECT_FLOAT_EQ(statistics.atvr, 1.0f);
+
+    // With a cache of 3 vertices, the first two vertices are evicted and transformed again
+    const std::vector<uint32_t> reused{0, 1, 2, 2, 1, 3, 3, 0, 1};
+    EXPECT_FLOAT_EQ(MeshOptimizer::getCacheStatistics(reused, 4, 3).acmr, 2.0f);
+    EXPECT_FLOAT_EQ(MeshOptimizer::getCacheStatistics(reused, 4, 3).atvr, 1.5f);
+}
+
+TEST(MeshOptimizer, VertexCacheGrid) {
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+    createGrid(64, positions, indices);
+    shuffleTriangles(indices);
+
+    const uint32_t verticesCount = static_cast<uint32_t>(positions.size() / 3);
+    const MeshOptimizer::Statistics before = MeshOptimizer::getCacheStatistics(indices, verticesCount);
+
+    std::vector<uint32_t> optimizedIndices = indices;
+    MeshOptimizer::optimizeVertexCache(optimizedIndices, verticesCount);
+
+    const MeshOptimizer::Statistics after = MeshOptimizer::getCacheStatistics(optimizedIndices, verticesCount);
+    RecordProperty("Grid64x64", formatStatistics(before, after));
+
+    // A grid has 2 triangles per vertex, an ACMR of 0.5 is the best possible
+    EXPECT_GT(before.acmr, 2.0f);
+    EXPECT_LT(after.acmr, 0.8f);
+    EXPECT_LT(after.atvr, 1.6f);
+
+    // Same triangles, in another order
+    std::sort(indices.begin(), indices.end());
+    std::sort(optimizedIndices.begin(), optimizedIndices.end());
+    EXPECT_EQ(indices, optimizedIndices);
+
+    // The overdraw optimization keeps the ACMR under its threshold
+    MeshOptimizer::optimizeVertexCache(optimizedIndices, verticesCount);
+    const float acmr = MeshOptimizer::getCacheStatistics(optimizedIndices, verticesCount).acmr;
+
+    MeshOptimizer::optimizeOverdraw(optimizedIndices, positions.data(), verticesCount, 1.05f);
+    EXPECT_LE(MeshOptimizer::getCacheStatistics(optimizedIndices, verticesCount).acmr, acmr * 1.05f + 0.01f);
+}
+
+TEST(MeshOptimizer, VertexFetch) {
+    std::vector<uint32_t> indices{4, 2, 0, 0, 2, 3};
+    std::vector<uint32_t> remap;
+
+    // The vertex 1 is not used
+    EXPECT_EQ(MeshOptimizer::optimizeVertexFetch(indices, 5, remap), 4u);
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 2, 2, 1, 3}));
+    EXPECT_EQ(remap, (std::vector<uint32_t>{2, ~0u, 1, 3, 0}));
+
+    const std::vector<uint16_t> vertices{10, 11, 12, 13, 14};
+    std::vector<uint16_t> remappedVertices(4);
+    MeshOptimizer::remapVertices(remappedVertices.data(), vertices.data(), sizeof(uint16_t), remap);
+    EXPECT_EQ(remappedVertices, (std::vector<uint16_t>{14, 12, 10, 13}));
+}
+
+TEST(MeshOptimizer, PrimitiveSetNarrowIndices) {
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+    createGrid(16, positions, indices);
+    shuffleTriangles(indices);
+
+    const uint32_t verticesCount = static_cast<uint32_t>(positions.size() / 3);
+
+    Builder::Mesh::PrimitiveSet primitiveSet;
+    primitiveSet.addExternalAttributeBuffer(indices.data(), sizeof(uint32_t), static_cast<uint32_t>(indices.size()), Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+    primitiveSet.addExternalAttributeBuffer(positions.data(), sizeof(float) * 3, verticesCount, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+
+    const auto trianglesBefore = getTriangles(
+        *getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Indice),
+        *getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Position)
+    );
+
+    MeshOptimizer::Statistics before;
+    MeshOptimizer::Statistics after;
+    EXPECT_TRUE(primitiveSet.optimize(&before, &after));
+    EXPECT_LT(after.acmr, before.acmr);
+
+    const Render::Mesh::PrimitiveSet::Attribute* indicesAttribute = getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+    const Render::Mesh::PrimitiveSet::Attribute* positionsAttribute = getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+
+    // The indices are narrowed to 16 bits, in buffers owned by the builder
+    EXPECT_EQ(indicesAttribute->buffer.size, indices.size() * sizeof(uint16_t));
+    EXPECT_EQ(indicesAttribute->buffer.elementsCount, indices.size());
+    EXPECT_FALSE(indicesAttribute->buffer.external);
+    EXPECT_FALSE(positionsAttribute->buffer.external);
+    EXPECT_EQ(positionsAttribute->buffer.elementsCount, verticesCount);
+
+    EXPECT_EQ(getTriangles(*indicesAttribute, *positionsAttribute), trianglesBefore);
+
+    delete[] indicesAttribute->buffer.data;
+    delete[] positionsAttribute->buffer.data;
+}
+
+TEST(MeshOptimizer, PrimitiveSetNotOptimized) {
+    const std::vector<float> positions(9, 0.0f);
+    const std::vector<uint16_t> indices{0, 1, 2};
+
+    // Not a triangle list
+    Builder::Mesh::PrimitiveSet strip;
+    strip.setMode(Render::Mesh::PrimitiveSet::Mode::TriangleStrip);
+    strip.addExternalAttributeBuffer(indices.data(), sizeof(uint16_t), 3, Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+    strip.addExternalAttributeBuffer(positions.data(), sizeof(float) * 3, 3, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+    EXPECT_FALSE(strip.optimize());
+
+    // Without indices
+    Builder::Mesh::PrimitiveSet noIndices;
+    noIndices.addExternalAttributeBuffer(positions.data(), sizeof(float) * 3, 3, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+    EXPECT_FALSE(noIndices.optimize());
+
+    // Attributes with different numbers of elements
+    Builder::Mesh::PrimitiveSet mismatch;
+    mismatch.addExternalAttributeBuffer(indices.data(), sizeof(uint16_t), 3, Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+    mismatch.addExternalAttributeBuffer(positions.data(), sizeof(float) * 3, 3, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+    mismatch.addExternalAttributeBuffer(positions.data(), sizeof(float) * 2, 2, Render::Mesh::PrimitiveSet::Attribute::Type::TexCoord);
+    EXPECT_FALSE(mismatch.optimize());
+
+    EXPECT_TRUE(mismatch.getAttributes()[0].buffer.external);
+}
+
+// Optimizes the primitive sets of the bundled models, like GltfLoader does with GltfLoader::setOptimizeMeshes
+TEST(MeshOptimizer, BundledModels) {
+    const std::vector<std::string> filenames{
+        LUG_TEST_MODELS_DIR "DamagedHelmet/DamagedHelmet.gltf",
+        LUG_TEST_MODELS_DIR "Box.gltf"
+    };
+
+    for (const std::string& filename : filenames) {
+        gltf2::Asset asset;
+        try {
+            asset = gltf2::load(filename);
+        } catch (gltf2::MisformattedException& e) {
+            FAIL() << filename << ": " << e.what();
+        }
+
+        GltfBufferSource buffers;
+        buffers.open(filename);
+
+        for (const gltf2::Mesh& mesh : asset.meshes) {
+            for (const gltf2::Primitive& primitive : mesh.primitives) {
+                ASSERT_NE(primitive.indices, -1);
+
+                Builder::Mesh::PrimitiveSet primitiveSet;
+
+                const gltf2::Accessor& indicesAccessor = asset.accessors[primitive.indices];
+                const void* indicesData = GltfLoader::getBufferViewData(asset, buffers, indicesAccessor);
+                ASSERT_NE(indicesData, nullptr);
+                primitiveSet.addExternalAttributeBuffer(indicesData, GltfLoader::getAttributeSize(indicesAccessor), indicesAccessor.count, Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+
+                for (const auto& attribute : primitive.attributes) {
+                    const gltf2::Accessor& accessor = asset.accessors[attribute.second];
+                    const void* data = GltfLoader::getBufferViewData(asset, buffers, accessor);
+                    ASSERT_NE(data, nullptr);
+
+                    Render::Mesh::PrimitiveSet::Attribute::Type type = Render::Mesh::PrimitiveSet::Attribute::Type::Normal;
+                    if (attribute.first == "POSITION") {
+                        type = Render::Mesh::PrimitiveSet::Attribute::Type::Position;
+                    } else if (attribute.first == "TANGENT") {
+                        type = Render::Mesh::PrimitiveSet::Attribute::Type::Tangent;
+                    } else if (attribute.first.find("TEXCOORD_") != std::string::npos) {
+                        type = Render::Mesh::PrimitiveSet::Attribute::Type::TexCoord;
+                    }
+                    primitiveSet.addExternalAttributeBuffer(data, GltfLoader::getAttributeSize(accessor), accessor.count, type);
+                }
+
+                const auto trianglesBefore = getTriangles(
+                    *getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Indice),
+                    *getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Position)
+                );
+
+                MeshOptimizer::Statistics before;
+                MeshOptimizer::Statistics after;
+                ASSERT_TRUE(primitiveSet.optimize(&before, &after));
+
+                RecordProperty(
+                    mesh.name,
+                    std::to_string(indicesAccessor.count / 3) + " triangles, " + formatStatistics(before, after)
+                );
+
+                EXPECT_LE(after.acmr, before.acmr);
+                EXPECT_LE(after.atvr, before.atvr);
+
+                const Render::Mesh::PrimitiveSet::Attribute* indicesAttribute = getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Indice);
+                const Render::Mesh::PrimitiveSet::Attribute* positionsAttribute = getAttribute(primitiveSet, Render::Mesh::PrimitiveSet::Attribute::Type::Position);
+
+                EXPECT_EQ(indicesAttribute->buffer.size / indicesAttribute->buffer.elementsCount, sizeof(uint16_t));
+                EXPECT_EQ(getTriangles(*indicesAttribute, *positionsAttribute), trianglesBefore);
+
+                for (const auto& attribute : primitiveSet.getAttributes()) {
+                    delete[] attribute.buffer.data;
+                }
+            }
+        }
+    }
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include <lug/Graphics/Render/Bloom.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace Bloom = Render::Bloom;
+
+namespace {
+
+Bloom::Image makeImage(uint32_t width, uint32_t height, float value) {
+    Bloom::Image image(width, height);
+    std::fill(image.data.begin(), image.data.end(), value);
+
+    return image;
+}
+
+float sum(const Bloom::Image& image, uint32_t channel) {
+    float result = 0.0f;
+
+    for (uint32_t y = 0; y < image.height; ++y) {
+        for (uint32_t x = 0; x < image.width; ++x) {
+            result += image.at(x, y)[channel];
+        }
+    }
+
+    return result;
+}
+
+} // anonymous
+
+TEST(Bloom, MipChain) {
+    const std::vector<Bloom::Extent> extents = Bloom::computeMipChain(1280, 720, 6);
+
+    ASSERT_EQ(extents.size(), 6u);
+    EXPECT_EQ(extents[0].width, 640u);
+    EXPECT_EQ(extents[0].height, 360u);
+    EXPECT_EQ(extents[5].width, 20u);
+    EXPECT_EQ(extents[5].height, 11u);
+
+    // Stops before a side is smaller than the minimum size
+    EXPECT_EQ(Bloom::computeMipChain(16, 8, 6).size(), 2u);
+    EXPECT_TRUE(Bloom::computeMipChain(2, 2, 6).empty());
+}
+
+TEST(Bloom, BilinearSample) {
+    Bloom::Image image(2, 1);
+    image.at(0, 0)[0] = 0.0f;
+    image.at(1, 0)[0] = 1.0f;
+
+    float color[4];
+
+    // Texel centers
+    Bloom::sample(image, 0.25f, 0.5f, color);
+    EXPECT_FLOAT_EQ(color[0], 0.0f);
+
+    Bloom::sample(image, 0.5f, 0.5f, color);
+    EXPECT_FLOAT_EQ(color[0], 0.5f);
+
+    // Clamp to edge
+    Bloom::sample(image, 1.5f, 0.5f, color);
+    EXPECT_FLOAT_EQ(color[0], 1.0f);
+}
+
+TEST(Bloom, FiltersPreserveConstantImages) {
+    const Bloom::Image source = makeImage(32, 16, 2.0f);
+
+    const Bloom::Image downsampled = Bloom::downsample(source, {16, 8});
+    for (float value : downsampled.data) {
+        EXPECT_NEAR(value, 2.0f, 1e-5f);
+    }
+
+    // The tent filter weights sum to 1, the upsample adds the source to the destination
+    Bloom::Image destination = makeImage(32, 16, 1.0f);
+    Bloom::upsampleAdd(downsampled, destination);
+    for (float value : destination.data) {
+        EXPECT_NEAR(value, 3.0f, 1e-5f);
+    }
+}
+
+TEST(Bloom, Threshold) {
+    float dark[4] = {0.2f, 0.2f, 0.2f, 1.0f};
+    Bloom::applyThreshold(dark, 1.0f, 0.1f);
+    EXPECT_FLOAT_EQ(dark[0], 0.0f);
+    EXPECT_FLOAT_EQ(dark[3], 1.0f);
+
+    // Above the knee, the threshold is subtracted from the luminance
+    float bright[4] = {3.0f, 3.0f, 3.0f, 1.0f};
+    Bloom::applyThreshold(bright, 1.0f, 0.1f);
+    EXPECT_NEAR(bright[0], 2.0f, 1e-4f);
+
+    // In the knee, the curve is continuous and below the linear part
+    float knee[4] = {1.05f, 1.05f, 1.05f, 1.0f};
+    Bloom::applyThreshold(knee, 1.0f, 0.1f);
+    EXPECT_GT(knee[0], 0.0f);
+    EXPECT_LT(knee[0], 0.1f);
+}
+
+TEST(Bloom, ImpulseIsSymmetric) {
+    // One bright pixel in the middle of an image whose size is a power of 2
+    Bloom::Image glow(64, 64);
+    for (uint32_t c = 0; c < 3; ++c) {
+        glow.at(31, 31)[c] = 100.0f;
+        glow.at(32, 31)[c] = 100.0f;
+        glow.at(31, 32)[c] = 100.0f;
+        glow.at(32, 32)[c] = 100.0f;
+    }
+
+    const Bloom::Image bloom = Bloom::compute(glow, 0.0f, 4, 0.0f);
+    ASSERT_EQ(bloom.width, 32u);
+    ASSERT_EQ(bloom.height, 32u);
+
+    for (uint32_t y = 0; y < 32; ++y) {
+        for (uint32_t x = 0; x < 32; ++x) {
+            EXPECT_NEAR(bloom.at(x, y)[0], bloom.at(31 - x, y)[0], 1e-3f);
+            EXPECT_NEAR(bloom.at(x, y)[0], bloom.at(x, 31 - y)[0], 1e-3f);
+        }
+    }
+
+    // The peak is in the middle and the glow spreads further than the 13 taps of the first level
+    EXPECT_GT(bloom.at(15, 15)[0], bloom.at(10, 15)[0]);
+    EXPECT_GT(bloom.at(4, 15)[0], 0.0f);
+
+    // Each level of the chain keeps the energy of the impulse, the bloom sums 4 levels
+    const float glowEnergy = sum(glow, 0) / 4.0f;
+    EXPECT_NEAR(sum(bloom, 0), glowEnergy * 4.0f, glowEnergy * 0.05f);
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include <lug/Graphics/Render/BrdfLut.hpp>
+#include <lug/Math/Half.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace BrdfLut = Render::BrdfLut;
+
+TEST(BrdfLut, SmoothSurfaceFacingTheView) {
+    // No Fresnel bias and no masking when the view, the normal and the half vectors are the same
+    const Math::Vec2f value = BrdfLut::integrate(0.999f, 0.05f);
+
+    EXPECT_NEAR(value.x(), 1.0f, 0.02f);
+    EXPECT_NEAR(value.y(), 0.0f, 0.02f);
+}
+
+TEST(BrdfLut, ScaleAndBiasAreBounded) {
+    for (float NoV = 0.05f; NoV <= 1.0f; NoV += 0.1f) {
+        for (float roughness = 0.0f; roughness <= 1.0f; roughness += 0.1f) {
+            const Math::Vec2f value = BrdfLut::integrate(NoV, roughness, 256);
+
+            EXPECT_GE(value.x(), 0.0f);
+            EXPECT_GE(value.y(), 0.0f);
+
+            // The BRDF doesn't create energy
+            EXPECT_LE(value.x() + value.y(), 1.01f) << "NoV " << NoV << ", roughness " << roughness;
+        }
+    }
+}
+
+TEST(BrdfLut, RoughSurfacesLoseEnergy) {
+    const Math::Vec2f smooth = BrdfLut::integrate(0.5f, 0.1f, 256);
+    const Math::Vec2f rough = BrdfLut::integrate(0.5f, 0.9f, 256);
+
+    EXPECT_LT(rough.x() + rough.y(), smooth.x() + smooth.y());
+}
+
+TEST(BrdfLut, TexelLayout) {
+    constexpr uint32_t size = 4;
+    constexpr uint32_t samplesCount = 64;
+
+    const std::vector<Math::Vec2f> lut = BrdfLut::compute(size, samplesCount);
+    ASSERT_EQ(lut.size(), size * size);
+
+    // NoV increases with x, the roughness decreases with y
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            const Math::Vec2f expected = BrdfLut::integrate((x + 0.5f) / size, 1.0f - (y + 0.5f) / size, samplesCount);
+
+            EXPECT_FLOAT_EQ(lut[y * size + x].x(), expected.x());
+            EXPECT_FLOAT_EQ(lut[y * size + x].y(), expected.y());
+        }
+    }
+}
+
+TEST(BrdfLut, Entry) {
+    constexpr uint32_t size = 8;
+    constexpr uint32_t samplesCount = 64;
+
+    const Render::IblCache::Entry entry = BrdfLut::createEntry(size, samplesCount);
+    const std::vector<Math::Vec2f> lut = BrdfLut::compute(size, samplesCount);
+
+    EXPECT_EQ(entry.key, BrdfLut::getKey(size, samplesCount));
+    EXPECT_NE(entry.key, BrdfLut::getKey(size, samplesCount * 2));
+    EXPECT_EQ(entry.format, Render::Texture::Format::R16G16_SFLOAT);
+    ASSERT_EQ(entry.data.size(), size * size * 2 * sizeof(uint16_t));
+
+    for (size_t i = 0; i < lut.size(); ++i) {
+        uint16_t texel[2];
+        std::memcpy(texel, entry.data.data() + i * sizeof(texel), sizeof(texel));
+
+        // Half precision, 11 bits of mantissa
+        EXPECT_NEAR(Math::fromHalf(texel[0]), lut[i].x(), 1e-3f);
+        EXPECT_NEAR(Math::fromHalf(texel[1]), lut[i].y(), 1e-3f);
+    }
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <lug/Graphics/Render/IblCache.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace IblCache = Render::IblCache;
+
+namespace {
+
+IblCache::Entry createEntry(uint64_t key) {
+    IblCache::Entry entry{};
+
+    entry.key = key;
+    entry.width = 8;
+    entry.height = 8;
+    entry.layersCount = 6;
+    entry.mipLevels = 4;
+    entry.format = Render::Texture::Format::R32G32B32A32_SFLOAT;
+    entry.data.resize(IblCache::getDataSize(entry));
+
+    for (size_t i = 0; i < entry.data.size(); ++i) {
+        entry.data[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    return entry;
+}
+
+} // anonymous
+
+TEST(IblCache, Hash) {
+    // FNV-1a reference values
+    EXPECT_EQ(IblCache::hash("", 0), 0xCBF29CE484222325ull);
+    EXPECT_EQ(IblCache::hash("a", 1), 0xAF63DC4C8601EC8Cull);
+
+    // Hashing in several pieces is the same as hashing everything at once
+    EXPECT_EQ(IblCache::hash("ar", 2, IblCache::hash("fo", 2)), IblCache::hash("foar", 4));
+}
+
+TEST(IblCache, Filename) {
+    EXPECT_EQ(IblCache::getFilename("", 0x1234ull), "0000000000001234.iblcache");
+    EXPECT_EQ(IblCache::getFilename("cache", 0xFEDCBA9876543210ull), "cache/fedcba9876543210.iblcache");
+    EXPECT_EQ(IblCache::getFilename("cache/", 0xFull), "cache/000000000000000f.iblcache");
+}
+
+TEST(IblCache, DataSize) {
+    const IblCache::Entry entry = createEntry(0);
+
+    // 8x8, 4x4, 2x2 and 1x1, 6 layers of 16 bytes texels
+    EXPECT_EQ(IblCache::getMipLevelSize(entry, 0), 8u * 8u * 6u * 16u);
+    EXPECT_EQ(IblCache::getMipLevelSize(entry, 3), 6u * 16u);
+    EXPECT_EQ(IblCache::getDataSize(entry), (64u + 16u + 4u + 1u) * 6u * 16u);
+}
+
+TEST(IblCache, SaveAndLoad) {
+    const std::string filename = IblCache::getFilename("", 42);
+    const IblCache::Entry entry = createEntry(42);
+
+    ASSERT_TRUE(IblCache::save(filename, entry));
+
+    IblCache::Entry loaded{};
+    ASSERT_TRUE(IblCache::load(filename, 42, loaded));
+
+    EXPECT_EQ(loaded.key, entry.key);
+    EXPECT_EQ(loaded.width, entry.width);
+    EXPECT_EQ(loaded.height, entry.height);
+    EXPECT_EQ(loaded.layersCount, entry.layersCount);
+    EXPECT_EQ(loaded.mipLevels, entry.mipLevels);
+    EXPECT_EQ(loaded.format, entry.format);
+    EXPECT_EQ(loaded.data, entry.data);
+
+    // Another key, e.g. another environment texture, doesn't use the file
+    EXPECT_FALSE(IblCache::load(filename, 43, loaded));
+
+    std::remove(filename.c_str());
+}
+
+TEST(IblCache, MissingOrTruncatedFile) {
+    const std::string filename = IblCache::getFilename("", 7);
+    IblCache::Entry entry = createEntry(7);
+
+    std::remove(filename.c_str());
+    EXPECT_FALSE(IblCache::load(filename, 7, entry));
+
+    // Wrong data size
+    entry.data.pop_back();
+    EXPECT_FALSE(IblCache::save(filename, entry));
+
+    // Truncated texels
+    {
+        ASSERT_TRUE(IblCache::save(filename, createEntry(7)));
+
+        std::string content;
+        {
+            std::ifstream file(filename, std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size() / 2);
+    }
+
+    EXPECT_FALSE(IblCache::load(filename, 7, entry));
+
+    std::remove(filename.c_str());
+}
+
+} // Graphics
+} // lug
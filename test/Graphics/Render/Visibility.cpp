@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include <lug/Graphics/Render/Visibility.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Geometry/Trigonometry.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+Render::BoundingBox makeBox(const Math::Vec3f& center, float extent) {
+    Render::BoundingBox box;
+    box.extend(Math::Vec3f{center.x() - extent, center.y() - extent, center.z() - extent});
+    box.extend(Math::Vec3f{center.x() + extent, center.y() + extent, center.z() + extent});
+
+    return box;
+}
+
+// Looks down -z from the origin, 90 degrees of vertical field of view
+Render::Frustum makeFrustum(const Math::Mat4x4f& view = Math::Mat4x4f::identity()) {
+    const Math::Mat4x4f projection = Math::Geometry::perspective(Math::Geometry::radians(90.0f), 1.0f, 1.0f, 100.0f);
+
+    return Render::Frustum(projection * view);
+}
+
+} // anonymous
+
+TEST(Visibility, FrustumPlanes) {
+    const Render::Frustum frustum = makeFrustum();
+
+    // The planes are normalized, the distances are in world units
+    const Math::Vec4f& nearPlane = frustum.getPlane(Render::Frustum::Plane::Near);
+    EXPECT_NEAR(nearPlane.x() * 0.0f + nearPlane.y() * 0.0f + nearPlane.z() * -3.0f + nearPlane.w(), 2.0f, 1e-4f);
+
+    const Math::Vec4f& farPlane = frustum.getPlane(Render::Frustum::Plane::Far);
+    EXPECT_NEAR(farPlane.z() * -90.0f + farPlane.w(), 10.0f, 1e-3f);
+
+    EXPECT_TRUE(frustum.intersects(makeBox({0.0f, 0.0f, -10.0f}, 1.0f)));
+
+    // Behind the camera, beyond the far plane and on the sides
+    EXPECT_FALSE(frustum.intersects(makeBox({0.0f, 0.0f, 10.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.intersects(makeBox({0.0f, 0.0f, -200.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.intersects(makeBox({20.0f, 0.0f, -10.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.intersects(makeBox({0.0f, -20.0f, -10.0f}, 1.0f)));
+
+    // Partially inside
+    EXPECT_TRUE(frustum.intersects(makeBox({10.5f, 0.0f, -10.0f}, 1.0f)));
+
+    // An invalid box is always visible
+    EXPECT_TRUE(frustum.intersects(Render::BoundingBox{}));
+}
+
+TEST(Visibility, TransformBoundingBox) {
+    const Render::BoundingBox box = makeBox({1.0f, 0.0f, 0.0f}, 1.0f);
+
+    // Rotates (1, 0, 0) to (0, 1, 0) then translates it to (0, 1, 5)
+    const Math::Mat4x4f transform{
+        0.0f, -1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 5.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    const Render::BoundingBox transformed = box.transform(transform);
+    ASSERT_TRUE(transformed.isValid());
+    EXPECT_NEAR(transformed.min.x(), -1.0f, 1e-5f);
+    EXPECT_NEAR(transformed.max.x(), 1.0f, 1e-5f);
+    EXPECT_NEAR(transformed.min.y(), 0.0f, 1e-5f);
+    EXPECT_NEAR(transformed.max.y(), 2.0f, 1e-5f);
+    EXPECT_NEAR(transformed.min.z(), 4.0f, 1e-5f);
+    EXPECT_NEAR(transformed.max.z(), 6.0f, 1e-5f);
+
+    EXPECT_FALSE(Render::BoundingBox{}.transform(transform).isValid());
+}
+
+TEST(Visibility, MatchesFrustumTest) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+    // 5 views to use a partial group of frustums
+    std::vector<Render::Frustum> frustums;
+    for (uint32_t i = 0; i < 5; ++i) {
+        const Math::Vec3f eye{position(generator), position(generator), position(generator)};
+        frustums.push_back(makeFrustum(Math::Geometry::lookAt(eye, Math::Vec3f{0.0f, 0.0f, 0.0f}, Math::Vec3f{0.0f, 1.0f, 0.0f})));
+    }
+
+    std::vector<Render::BoundingBox> boxes;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        if (i % 100 == 0) {
+            boxes.push_back(Render::BoundingBox{});
+        } else {
+            boxes.push_back(makeBox({position(generator), position(generator), position(generator)}, size(generator)));
+        }
+    }
+
+    Render::Visibility visibility;
+    visibility.compute(frustums, boxes);
+
+    ASSERT_EQ(visibility.getViewsCount(), 5u);
+    ASSERT_EQ(visibility.getObjectsCount(), 1000u);
+
+    for (uint32_t viewIdx = 0; viewIdx < frustums.size(); ++viewIdx) {
+        EXPECT_EQ(visibility.getBitset(viewIdx).size(), 16u);
+
+        uint32_t visibleCount = 0;
+        for (uint32_t objectIdx = 0; objectIdx < boxes.size(); ++objectIdx) {
+            const bool expected = frustums[viewIdx].intersects(boxes[objectIdx]);
+            EXPECT_EQ(visibility.isVisible(viewIdx, objectIdx), expected);
+
+            visibleCount += expected;
+        }
+
+        // Each view sees some of the boxes, but not all of them
+        EXPECT_GT(visibleCount, 10u);
+        EXPECT_LT(visibleCount, 990u);
+    }
+}
+
+TEST(Visibility, ForEachVisible) {
+    std::vector<Render::BoundingBox> boxes(130, makeBox({0.0f, 0.0f, 10.0f}, 1.0f));
+    boxes[3] = makeBox({0.0f, 0.0f, -10.0f}, 1.0f);
+    boxes[64] = makeBox({0.0f, 0.0f, -10.0f}, 1.0f);
+    boxes[129] = Render::BoundingBox{};
+
+    Render::Visibility visibility;
+    visibility.compute({makeFrustum()}, boxes);
+
+    std::vector<uint32_t> visibleObjects;
+    visibility.forEachVisible(0, [&visibleObjects](uint32_t objectIdx) {
+        visibleObjects.push_back(objectIdx);
+    });
+
+    EXPECT_EQ(visibleObjects, (std::vector<uint32_t>{3, 64, 129}));
+
+    // The results are replaced by the next computation
+    visibility.compute({}, boxes);
+    EXPECT_EQ(visibility.getViewsCount(), 0u);
+}
+
+} // Graphics
+} // lug
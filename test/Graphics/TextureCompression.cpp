@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <lug/Graphics/AssetCooker.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/Graphics/TextureCompression.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using Format = Render::Texture::Format;
+
+namespace {
+
+std::vector<uint8_t> getSolidImage(uint32_t width, uint32_t height, const uint8_t (&color)[4]) {
+    std::vector<uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = color[i % 4];
+    }
+
+    return pixels;
+}
+
+std::vector<uint8_t> roundTrip(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, uint32_t mipLevels, Format format) {
+    const std::vector<uint8_t> data = TextureCompression::encode(pixels.data(), width, height, mipLevels, format);
+    EXPECT_EQ(data.size(), Render::Texture::getMipLevelsSize(width, height, format, mipLevels));
+
+    std::vector<uint8_t> decoded(Render::Texture::getMipLevelsSize(width, height, Format::R8G8B8A8_UNORM, mipLevels));
+    EXPECT_TRUE(TextureCompression::decode(data.data(), width, height, mipLevels, format, decoded.data()));
+
+    return decoded;
+}
+
+int getMaxError(const std::vector<uint8_t>& pixels, const std::vector<uint8_t>& decoded, uint32_t firstChannel, uint32_t channelsCount) {
+    int maxError = 0;
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4) {
+        for (uint32_t channel = firstChannel; channel < firstChannel + channelsCount; ++channel) {
+            maxError = std::max(maxError, std::abs(pixels[i + channel] - decoded[i + channel]));
+        }
+    }
+
+    return maxError;
+}
+
+} // anonymous
+
+TEST(TextureCompression, ImageSize) {
+    // Padded to whole 4x4 blocks
+    EXPECT_EQ(Render::Texture::getImageSize(4, 4, Format::BC1_RGBA_UNORM), 8u);
+    EXPECT_EQ(Render::Texture::getImageSize(5, 5, Format::BC1_RGBA_UNORM), 32u);
+    EXPECT_EQ(Render::Texture::getImageSize(1, 1, Format::BC3_UNORM), 16u);
+    EXPECT_EQ(Render::Texture::getImageSize(5, 5, Format::R8G8B8A8_UNORM), 100u);
+
+    // 8x8, 4x4, 2x2 and 1x1
+    EXPECT_EQ(Render::Texture::getMipLevelsSize(8, 8, Format::BC1_RGBA_UNORM, 4), 32u + 8u + 8u + 8u);
+    EXPECT_EQ(Render::Texture::getMipLevelsSize(8, 8, Format::BC7_UNORM, 4, 1), 48u);
+
+    EXPECT_TRUE(Render::Texture::isCompressed(Format::ASTC_4x4_UNORM));
+    EXPECT_FALSE(Render::Texture::isCompressed(Format::R16G16_SFLOAT));
+}
+
+// Size of a full mip chain on the GPU, compared to R8G8B8A8
+TEST(TextureCompression, MemoryFootprint) {
+    const uint32_t size = 2048;
+    const uint32_t mipLevels = AssetCooker::getMipLevelsCount(size, size);
+
+    const double uncompressedSize = static_cast<double>(Render::Texture::getMipLevelsSize(size, size, Format::R8G8B8A8_UNORM, mipLevels));
+
+    EXPECT_NEAR(uncompressedSize / Render::Texture::getMipLevelsSize(size, size, Format::BC1_RGBA_UNORM, mipLevels), 8.0, 0.01);
+    EXPECT_NEAR(uncompressedSize / Render::Texture::getMipLevelsSize(size, size, Format::BC3_UNORM, mipLevels), 4.0, 0.01);
+    EXPECT_NEAR(uncompressedSize / Render::Texture::getMipLevelsSize(size, size, Format::BC7_UNORM, mipLevels), 4.0, 0.01);
+    EXPECT_NEAR(uncompressedSize / Render::Texture::getMipLevelsSize(size, size, Format::ASTC_4x4_UNORM, mipLevels), 4.0, 0.01);
+}
+
+TEST(TextureCompression, SolidColor) {
+    // Representable exactly in R5G6B5, with a size which is not a multiple of the blocks
+    const uint8_t color[4] = {132, 130, 66, 255};
+    const std::vector<uint8_t> pixels = getSolidImage(5, 3, color);
+
+    EXPECT_EQ(roundTrip(pixels, 5, 3, 1, Format::BC1_RGBA_UNORM), pixels);
+    EXPECT_EQ(roundTrip(pixels, 5, 3, 1, Format::BC3_UNORM), pixels);
+}
+
+TEST(TextureCompression, Gradient) {
+    const uint32_t size = 64;
+    std::vector<uint8_t> pixels(size * size * 4);
+
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint8_t* texel = pixels.data() + (y * size + x) * 4;
+
+            texel[0] = static_cast<uint8_t>(x * 4);
+            texel[1] = static_cast<uint8_t>(y * 4);
+            texel[2] = static_cast<uint8_t>(255 - x * 2);
+            texel[3] = static_cast<uint8_t>((x + y) * 2);
+        }
+    }
+
+    // Quantization to R5G6B5 and interpolation of the endpoints
+    const std::vector<uint8_t> bc3 = roundTrip(pixels, size, size, 1, Format::BC3_UNORM);
+    EXPECT_LE(getMaxError(pixels, bc3, 0, 3), 12);
+    EXPECT_LE(getMaxError(pixels, bc3, 3, 1), 2);
+
+    // With all the mip levels, the colors of the blocks of the small levels are on a line, as BC1 requires
+    std::vector<uint8_t> linePixels(size * size * 4);
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint8_t* texel = linePixels.data() + (y * size + x) * 4;
+
+            texel[0] = static_cast<uint8_t>(x * 4);
+            texel[1] = 128;
+            texel[2] = static_cast<uint8_t>(255 - x * 4);
+            texel[3] = 255;
+        }
+    }
+
+    const uint32_t mipLevels = AssetCooker::getMipLevelsCount(size, size);
+    const std::vector<uint8_t> mipLevelsPixels = AssetCooker::generateMipLevels(linePixels.data(), size, size);
+
+    const std::vector<uint8_t> bc1 = roundTrip(mipLevelsPixels, size, size, mipLevels, Format::BC1_RGBA_UNORM);
+    EXPECT_LE(getMaxError(mipLevelsPixels, bc1, 0, 3), 12);
+    EXPECT_EQ(getMaxError(mipLevelsPixels, bc1, 3, 1), 0);
+}
+
+TEST(TextureCompression, Bc1Transparency) {
+    const uint8_t color[4] = {200, 100, 50, 255};
+    std::vector<uint8_t> pixels = getSolidImage(4, 4, color);
+
+    // Every other texel is transparent
+    for (uint32_t i = 0; i < 16; i += 2) {
+        pixels[i * 4 + 3] = 0;
+    }
+
+    const std::vector<uint8_t> decoded = roundTrip(pixels, 4, 4, 1, Format::BC1_RGBA_UNORM);
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(decoded[i * 4 + 3], i % 2 ? 255 : 0);
+    }
+
+    EXPECT_LE(getMaxError(getSolidImage(4, 4, color), roundTrip(getSolidImage(4, 4, color), 4, 4, 1, Format::BC1_RGBA_UNORM), 0, 3), 4);
+}
+
+TEST(TextureCompression, SelectFormat) {
+    const uint8_t opaque[4] = {10, 20, 30, 255};
+    const uint8_t translucent[4] = {10, 20, 30, 128};
+
+    EXPECT_EQ(TextureCompression::selectEncodeFormat(getSolidImage(8, 8, opaque).data(), 8, 8), Format::BC1_RGBA_UNORM);
+    EXPECT_EQ(TextureCompression::selectEncodeFormat(getSolidImage(8, 8, translucent).data(), 8, 8), Format::BC3_UNORM);
+
+    // A device without the block compressed formats, e.g. a mobile GPU
+    const auto isSupported = [](Format format) {
+        return format == Format::R8G8B8A8_UNORM || format == Format::ETC2_R8G8B8A8_UNORM;
+    };
+
+    EXPECT_EQ(TextureCompression::selectTranscodeFormat(Format::ETC2_R8G8B8A8_UNORM, isSupported), Format::ETC2_R8G8B8A8_UNORM);
+    EXPECT_EQ(TextureCompression::selectTranscodeFormat(Format::BC1_RGBA_UNORM, isSupported), Format::R8G8B8A8_UNORM);
+    EXPECT_EQ(TextureCompression::selectTranscodeFormat(Format::BC3_UNORM, isSupported), Format::R8G8B8A8_UNORM);
+    EXPECT_EQ(TextureCompression::selectTranscodeFormat(Format::BC7_UNORM, isSupported), Format::Undefined);
+
+    EXPECT_FALSE(TextureCompression::canEncode(Format::R8G8B8A8_UNORM));
+    EXPECT_TRUE(TextureCompression::encode(getSolidImage(4, 4, opaque).data(), 4, 4, 1, Format::BC7_UNORM).empty());
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,184 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <list>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorPoolChain.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using DescriptorPoolChain = Vulkan::Render::DescriptorSetPool::DescriptorPoolChain;
+
+namespace API = Vulkan::API;
+
+namespace {
+
+// Counts the descriptor sets of each pool instead of calling Vulkan.
+// The chain is supposed to serialize the calls, so the counts are not synchronized.
+struct FakeBackend {
+    std::unordered_map<const API::DescriptorPool*, uint32_t> setsCount;
+    std::atomic<uint32_t> callsInProgress{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<bool> overflowed{false};
+
+    DescriptorPoolChain::Backend get() {
+        DescriptorPoolChain::Backend backend;
+
+        backend.createPool = [this](const API::Device&, API::DescriptorPool& descriptorPool, VkResult*) {
+            enter();
+            setsCount[&descriptorPool] = 0;
+            leave();
+            return true;
+        };
+
+        backend.allocateSet = [this](
+            const API::Device&,
+            const API::DescriptorPool& descriptorPool,
+            const API::DescriptorSetLayout&,
+            API::DescriptorSet&,
+            VkResult*
+        ) {
+            enter();
+
+            uint32_t& count = setsCount[&descriptorPool];
+            const bool success = count < DescriptorPoolChain::setsPerPool;
+            if (success) {
+                ++count;
+            }
+
+            // Another thread could have allocated in the same pool between the check and the increment
+            if (count > DescriptorPoolChain::setsPerPool) {
+                overflowed = true;
+            }
+
+            leave();
+            return success;
+        };
+
+        backend.freeSet = [this](const API::Device&, const API::DescriptorPool& descriptorPool, API::DescriptorSet&) {
+            enter();
+            --setsCount[&descriptorPool];
+            leave();
+        };
+
+        return backend;
+    }
+
+    void enter() {
+        if (callsInProgress.fetch_add(1) != 0) {
+            overlapped = true;
+        }
+
+        // Widen the window of a missing lock
+        std::this_thread::yield();
+    }
+
+    void leave() {
+        callsInProgress.fetch_sub(1);
+    }
+};
+
+} // anonymous
+
+TEST(DescriptorPoolChain, GrowsWhenFull) {
+    FakeBackend fakeBackend;
+    DescriptorPoolChain chain(fakeBackend.get());
+
+    API::Device device;
+    API::DescriptorSetLayout descriptorSetLayout;
+
+    ASSERT_TRUE(chain.init(device));
+    EXPECT_EQ(chain.getPoolsCount(), 1u);
+
+    std::list<API::DescriptorSet> descriptorSets;
+    std::vector<const API::DescriptorPool*> descriptorPools;
+
+    for (uint32_t i = 0; i < DescriptorPoolChain::setsPerPool + 1; ++i) {
+        descriptorSets.emplace_back();
+        descriptorPools.push_back(nullptr);
+        ASSERT_TRUE(chain.allocate(device, descriptorSetLayout, descriptorSets.back(), descriptorPools.back()));
+    }
+
+    EXPECT_EQ(chain.getPoolsCount(), 2u);
+    EXPECT_NE(descriptorPools.front(), descriptorPools.back());
+
+    // A set freed from the first pool makes room in it again, once the second one is full
+    chain.free(device, *descriptorPools.front(), descriptorSets.front());
+
+    for (uint32_t i = 0; i < DescriptorPoolChain::setsPerPool; ++i) {
+        descriptorSets.emplace_back();
+        descriptorPools.push_back(nullptr);
+        ASSERT_TRUE(chain.allocate(device, descriptorSetLayout, descriptorSets.back(), descriptorPools.back()));
+    }
+
+    EXPECT_EQ(chain.getPoolsCount(), 2u);
+    EXPECT_EQ(descriptorPools.back(), descriptorPools.front());
+    EXPECT_EQ(fakeBackend.setsCount[descriptorPools.front()], DescriptorPoolChain::setsPerPool);
+
+    chain.destroy();
+    EXPECT_TRUE(chain.empty());
+}
+
+TEST(DescriptorPoolChain, ConcurrentAllocations) {
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t setsPerThread = 200;
+
+    FakeBackend fakeBackend;
+    DescriptorPoolChain chain(fakeBackend.get());
+
+    API::Device device;
+    API::DescriptorSetLayout descriptorSetLayout;
+
+    ASSERT_TRUE(chain.init(device));
+
+    std::atomic<uint32_t> failuresCount{0};
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread = 0; thread < threadsCount; ++thread) {
+        threads.emplace_back([&]() {
+            std::list<API::DescriptorSet> descriptorSets;
+            std::vector<const API::DescriptorPool*> descriptorPools;
+
+            // Keep half of the sets, and free the other half, so the views reuse the freed space
+            for (uint32_t i = 0; i < setsPerThread; ++i) {
+                descriptorSets.emplace_back();
+                descriptorPools.push_back(nullptr);
+
+                if (!chain.allocate(device, descriptorSetLayout, descriptorSets.back(), descriptorPools.back())) {
+                    ++failuresCount;
+                    return;
+                }
+
+                if (i % 2 == 1) {
+                    chain.free(device, *descriptorPools.back(), descriptorSets.back());
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failuresCount, 0u);
+    EXPECT_FALSE(fakeBackend.overlapped);
+    EXPECT_FALSE(fakeBackend.overflowed);
+
+    uint32_t setsCount = 0;
+    for (const auto& pool : fakeBackend.setsCount) {
+        setsCount += pool.second;
+    }
+
+    // Each thread holds at most one set more than it keeps, the one it is about to free
+    const uint32_t keptSetsCount = threadsCount * setsPerThread / 2;
+    EXPECT_EQ(setsCount, keptSetsCount);
+    EXPECT_GE(chain.getPoolsCount(), (keptSetsCount + DescriptorPoolChain::setsPerPool - 1) / DescriptorPoolChain::setsPerPool);
+    EXPECT_LE(chain.getPoolsCount(), (keptSetsCount + threadsCount + DescriptorPoolChain::setsPerPool - 1) / DescriptorPoolChain::setsPerPool);
+}
+
+} // Graphics
+} // lug
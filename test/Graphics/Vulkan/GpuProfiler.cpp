@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/GpuProfiler.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using GpuProfiler = Vulkan::Render::GpuProfiler;
+
+TEST(GpuProfiler, StatisticsWithoutSamples) {
+    const GpuProfiler::Statistics statistics = GpuProfiler::computeStatistics({});
+
+    EXPECT_EQ(statistics.samplesCount, 0u);
+    EXPECT_FLOAT_EQ(statistics.average, 0.0f);
+    EXPECT_FLOAT_EQ(statistics.max, 0.0f);
+}
+
+TEST(GpuProfiler, StatisticsOfOneSample) {
+    const GpuProfiler::Statistics statistics = GpuProfiler::computeStatistics({4.0f});
+
+    EXPECT_EQ(statistics.samplesCount, 1u);
+    EXPECT_FLOAT_EQ(statistics.average, 4.0f);
+    EXPECT_FLOAT_EQ(statistics.p50, 4.0f);
+    EXPECT_FLOAT_EQ(statistics.p99, 4.0f);
+    EXPECT_FLOAT_EQ(statistics.max, 4.0f);
+}
+
+TEST(GpuProfiler, StatisticsPercentiles) {
+    // 100 down to 1, the samples don't have to be sorted
+    std::vector<float> samples;
+    for (int i = 100; i > 0; --i) {
+        samples.push_back(static_cast<float>(i));
+    }
+
+    const GpuProfiler::Statistics statistics = GpuProfiler::computeStatistics(samples);
+
+    EXPECT_EQ(statistics.samplesCount, 100u);
+    EXPECT_FLOAT_EQ(statistics.average, 50.5f);
+    EXPECT_FLOAT_EQ(statistics.p50, 50.0f);
+    EXPECT_FLOAT_EQ(statistics.p90, 90.0f);
+    EXPECT_FLOAT_EQ(statistics.p99, 99.0f);
+    EXPECT_FLOAT_EQ(statistics.max, 100.0f);
+}
+
+} // Graphics
+} // lug
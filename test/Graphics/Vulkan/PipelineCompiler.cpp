@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/PipelineCompiler.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using Pipeline = Vulkan::Render::Pipeline;
+using PipelineCompiler = Vulkan::Render::PipelineCompiler;
+
+namespace {
+
+Pipeline::Id getTexturedModelId() {
+    Pipeline::Id baseId = Pipeline::getModelBaseId();
+
+    Pipeline::Id::Model::PrimitivePart primitivePart = baseId.getModelPrimitivePart();
+    primitivePart.tangentVertexData = 1;
+    primitivePart.countTexCoord = 1;
+
+    Pipeline::Id::Model::MaterialPart materialPart = baseId.getModelMaterialPart();
+    materialPart.baseColorInfo = 0; // First texture coordinates
+    materialPart.normalInfo = 0; // First texture coordinates
+
+    Pipeline::Id::Model::ExtraPart extraPart = baseId.getModelExtraPart();
+    extraPart.antialiasing = 1;
+    extraPart.irradianceMapInfo = 1;
+    extraPart.prefilteredMapInfo = 1;
+
+    return Pipeline::Id::createModel(primitivePart, materialPart, extraPart);
+}
+
+} // anonymous
+
+TEST(PipelineCompiler, ConcurrentRequestsCompileOnce) {
+    std::atomic<uint32_t> callsCount{0};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    PipelineCompiler compiler([&callsCount, released](Pipeline::Id) {
+        ++callsCount;
+        released.wait();
+        return true;
+    }, 2);
+
+    const Pipeline::Id id = getTexturedModelId();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&compiler, id]() {
+            EXPECT_TRUE(compiler.request(id));
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(compiler.isPending(id));
+
+    release.set_value();
+    compiler.waitIdle();
+    EXPECT_FALSE(compiler.isPending(id));
+
+    const PipelineCompiler::Statistics statistics = compiler.getStatistics();
+
+    EXPECT_EQ(callsCount, 1u);
+    EXPECT_EQ(statistics.requested, 1u);
+    EXPECT_EQ(statistics.compiled, 1u);
+    EXPECT_EQ(statistics.failed, 0u);
+}
+
+TEST(PipelineCompiler, FailedPipelineIsNotRequestedAgain) {
+    std::atomic<uint32_t> callsCount{0};
+
+    PipelineCompiler compiler([&callsCount](Pipeline::Id) {
+        ++callsCount;
+        return false;
+    }, 1);
+
+    const Pipeline::Id id = Pipeline::getModelBaseId();
+
+    EXPECT_TRUE(compiler.request(id));
+    compiler.waitIdle();
+
+    EXPECT_FALSE(compiler.isPending(id));
+    EXPECT_FALSE(compiler.wait(id));
+    EXPECT_FALSE(compiler.request(id));
+    compiler.waitIdle();
+
+    const PipelineCompiler::Statistics statistics = compiler.getStatistics();
+
+    EXPECT_EQ(callsCount, 1u);
+    EXPECT_EQ(statistics.requested, 1u);
+    EXPECT_EQ(statistics.compiled, 0u);
+    EXPECT_EQ(statistics.failed, 1u);
+    EXPECT_EQ(statistics.latencyHistogram[0], 0u);
+}
+
+TEST(PipelineCompiler, SynchronousRequestWaitsForBackgroundCompilation) {
+    std::mutex mutex;
+    std::unordered_set<Pipeline::Id> created;
+    std::atomic<uint32_t> callsCount{0};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    // Like the factory of the renderer, doesn't create again a pipeline already created
+    PipelineCompiler compiler([&](Pipeline::Id id) {
+        {
+            std::lock_guard<std::mutex> lockGuard(mutex);
+            if (created.find(id) != created.end()) {
+                return true;
+            }
+        }
+
+        ++callsCount;
+        released.wait();
+
+        std::lock_guard<std::mutex> lockGuard(mutex);
+        created.insert(id);
+        return true;
+    }, 1);
+
+    const Pipeline::Id id = getTexturedModelId();
+
+    EXPECT_TRUE(compiler.request(id));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&compiler, id]() {
+            EXPECT_TRUE(compiler.compile(id));
+        });
+    }
+
+    // Let the threads find the compilation in flight
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(compiler.isPending(id));
+
+    release.set_value();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(compiler.isPending(id));
+    EXPECT_EQ(callsCount, 1u);
+    EXPECT_EQ(compiler.getStatistics().requested, 1u);
+}
+
+TEST(PipelineCompiler, SynchronousRequestCompilesOnCallingThread) {
+    std::thread::id compilingThread;
+
+    PipelineCompiler compiler([&compilingThread](Pipeline::Id) {
+        compilingThread = std::this_thread::get_id();
+        return true;
+    }, 1);
+
+    EXPECT_TRUE(compiler.compile(Pipeline::getModelBaseId()));
+    EXPECT_EQ(compilingThread, std::this_thread::get_id());
+    EXPECT_FALSE(compiler.isPending(Pipeline::getModelBaseId()));
+
+    const PipelineCompiler::Statistics statistics = compiler.getStatistics();
+
+    EXPECT_EQ(statistics.requested, 1u);
+    EXPECT_EQ(statistics.compiled, 1u);
+}
+
+TEST(PipelineCompiler, Prewarm) {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::unordered_map<Pipeline::Id, uint32_t> callsCount;
+    uint32_t callsInProgress = 0;
+    uint32_t maxCallsInProgress = 0;
+
+    // Each compilation waits for another one to run at the same time, or gives up after a while
+    PipelineCompiler compiler([&](Pipeline::Id id) {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        ++callsCount[id];
+        maxCallsInProgress = std::max(maxCallsInProgress, ++callsInProgress);
+        condition.notify_all();
+
+        condition.wait_for(lock, std::chrono::seconds(1), [&maxCallsInProgress]() {
+            return maxCallsInProgress >= 2;
+        });
+
+        --callsInProgress;
+        return true;
+    }, 2);
+
+    const std::vector<Pipeline::Id> ids{
+        Pipeline::getModelBaseId(),
+        getTexturedModelId(),
+        Pipeline::getSkyboxBaseId(),
+        Pipeline::getBrdfLutBaseId()
+    };
+
+    compiler.prewarm(ids);
+    compiler.waitIdle();
+
+    const PipelineCompiler::Statistics statistics = compiler.getStatistics();
+
+    uint32_t histogramCount = 0;
+    for (const uint32_t count : statistics.latencyHistogram) {
+        histogramCount += count;
+    }
+
+    ASSERT_EQ(callsCount.size(), ids.size());
+    for (const auto id : ids) {
+        EXPECT_EQ(callsCount[id], 1u);
+    }
+
+    // Both workers compiled at the same time
+    EXPECT_EQ(maxCallsInProgress, 2u);
+
+    EXPECT_EQ(statistics.requested, 4u);
+    EXPECT_EQ(statistics.compiled, 4u);
+    EXPECT_EQ(histogramCount, 4u);
+}
+
+TEST(PipelineCompiler, LatencyBuckets) {
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(0), 0u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(999), 0u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(1000), 1u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(1999), 1u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(2000), 2u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(3999), 2u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(4000), 3u);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(1023999), 10u);
+
+    // Everything above 1024ms goes in the last bucket
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(1024000), PipelineCompiler::Statistics::latencyBucketsCount - 1);
+    EXPECT_EQ(PipelineCompiler::getLatencyBucket(60000000), PipelineCompiler::Statistics::latencyBucketsCount - 1);
+}
+
+TEST(PipelineCompiler, ModelFallbackId) {
+    Pipeline::Id id = getTexturedModelId();
+    Pipeline::Id fallbackId = Pipeline::getModelFallbackId(id);
+
+    // Same vertex layout, without any texture
+    EXPECT_EQ(fallbackId.getModelPrimitivePart().value, id.getModelPrimitivePart().value);
+    EXPECT_EQ(fallbackId.getModelMaterialPart().value, Pipeline::getModelBaseId().getModelMaterialPart().value);
+    EXPECT_EQ(fallbackId.getModelExtraPart().antialiasing, 1u);
+    EXPECT_EQ(fallbackId.getModelExtraPart().irradianceMapInfo, 0u);
+    EXPECT_EQ(fallbackId.getModelExtraPart().prefilteredMapInfo, 0u);
+
+    // The instanced pipelines fall back to an instanced pipeline
+    EXPECT_EQ(Pipeline::getModelFallbackId(Pipeline::getModelInstancedId(id)).getModelExtraPart().instanced, 1u);
+
+    // The base pipeline is its own fallback
+    EXPECT_TRUE(Pipeline::getModelFallbackId(Pipeline::getModelBaseId()) == Pipeline::getModelBaseId());
+}
+
+} // Graphics
+} // lug
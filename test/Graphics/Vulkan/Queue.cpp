@@ -0,0 +1,153 @@
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/Queue.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using Pipeline = Vulkan::Render::Pipeline;
+using Queue = Vulkan::Render::Queue;
+
+namespace {
+
+// groupInstances only compares the pointers, the objects are never read
+template <typename T>
+T* fakePointer(uintptr_t id) {
+    return reinterpret_cast<T*>(id * 64);
+}
+
+Queue::PrimitiveSetInstance makeInstance(uintptr_t node, uintptr_t primitiveSet, uintptr_t material) {
+    return Queue::PrimitiveSetInstance{
+        /* node */ fakePointer<Scene::Node>(node),
+        /* primitiveSet */ fakePointer<const Vulkan::Render::Mesh::PrimitiveSet>(primitiveSet),
+        /* material */ fakePointer<Vulkan::Render::Material>(material)
+    };
+}
+
+} // anonymous
+
+TEST(Queue, GroupInstancesByPrimitiveSetAndMaterial) {
+    const Pipeline::Id pipelineId = Pipeline::getModelBaseId();
+
+    Queue queue;
+
+    // Interleaved: 3 instances of (1, 1), 2 of (1, 2), 1 of (2, 1)
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(1, 1, 1));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(2, 1, 2));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(3, 2, 1));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(4, 1, 1));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(5, 1, 2));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(6, 1, 1));
+
+    queue.groupInstances(2);
+
+    // The single instance stays a regular draw, with the pipeline it was added with
+    ASSERT_EQ(queue.getPrimitiveSets().size(), 1u);
+    ASSERT_EQ(queue.getPrimitiveSets().count(pipelineId), 1u);
+
+    const auto& primitiveSetInstances = queue.getPrimitiveSets().at(pipelineId);
+    ASSERT_EQ(primitiveSetInstances.size(), 1u);
+    EXPECT_EQ(primitiveSetInstances[0].node, fakePointer<Scene::Node>(3));
+
+    // The batches use the instanced pipeline
+    ASSERT_EQ(queue.getPrimitiveSetBatches().size(), 1u);
+    ASSERT_EQ(queue.getPrimitiveSetBatches().count(Pipeline::getModelInstancedId(pipelineId)), 1u);
+
+    const auto& batches = queue.getPrimitiveSetBatches().at(Pipeline::getModelInstancedId(pipelineId));
+    ASSERT_EQ(batches.size(), 2u);
+
+    EXPECT_EQ(batches[0].primitiveSet, fakePointer<const Vulkan::Render::Mesh::PrimitiveSet>(1));
+    EXPECT_EQ(batches[0].material, fakePointer<Vulkan::Render::Material>(1));
+    EXPECT_EQ(batches[0].firstInstance, 0u);
+    EXPECT_EQ(batches[0].instancesCount, 3u);
+
+    EXPECT_EQ(batches[1].primitiveSet, fakePointer<const Vulkan::Render::Mesh::PrimitiveSet>(1));
+    EXPECT_EQ(batches[1].material, fakePointer<Vulkan::Render::Material>(2));
+    EXPECT_EQ(batches[1].firstInstance, 3u);
+    EXPECT_EQ(batches[1].instancesCount, 2u);
+
+    // The nodes of each batch are contiguous, in the order they were added
+    const std::vector<Scene::Node*> expectedInstances{
+        fakePointer<Scene::Node>(1),
+        fakePointer<Scene::Node>(4),
+        fakePointer<Scene::Node>(6),
+        fakePointer<Scene::Node>(2),
+        fakePointer<Scene::Node>(5)
+    };
+
+    EXPECT_EQ(queue.getInstances(), expectedInstances);
+}
+
+TEST(Queue, GroupSingleInstances) {
+    const Pipeline::Id pipelineId = Pipeline::getModelBaseId();
+
+    Queue queue;
+
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(1, 1, 1));
+    queue.addPrimitiveSetInstance(pipelineId, makeInstance(2, 2, 1));
+
+    queue.groupInstances(2);
+
+    // Nothing to instance
+    EXPECT_TRUE(queue.getPrimitiveSetBatches().empty());
+    EXPECT_TRUE(queue.getInstances().empty());
+    ASSERT_EQ(queue.getPrimitiveSets().count(pipelineId), 1u);
+    EXPECT_EQ(queue.getPrimitiveSets().at(pipelineId).size(), 2u);
+
+    // With a minimum of 1 instance, each primitive set is a batch of one instance
+    queue.groupInstances(1);
+
+    EXPECT_TRUE(queue.getPrimitiveSets().empty());
+    ASSERT_EQ(queue.getPrimitiveSetBatches().count(Pipeline::getModelInstancedId(pipelineId)), 1u);
+
+    const auto& batches = queue.getPrimitiveSetBatches().at(Pipeline::getModelInstancedId(pipelineId));
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[0].instancesCount, 1u);
+    EXPECT_EQ(batches[1].instancesCount, 1u);
+    EXPECT_EQ(queue.getInstances().size(), 2u);
+}
+
+TEST(Queue, GroupInstancesAlreadyInstanced) {
+    const Pipeline::Id instancedId = Pipeline::getModelInstancedId(Pipeline::getModelBaseId());
+
+    Queue queue;
+
+    queue.addPrimitiveSetInstance(instancedId, makeInstance(1, 1, 1));
+    queue.addPrimitiveSetInstance(instancedId, makeInstance(2, 1, 1));
+
+    queue.groupInstances(2);
+
+    EXPECT_TRUE(queue.getPrimitiveSetBatches().empty());
+    ASSERT_EQ(queue.getPrimitiveSets().count(instancedId), 1u);
+    EXPECT_EQ(queue.getPrimitiveSets().at(instancedId).size(), 2u);
+}
+
+TEST(Queue, GroupManyInstances) {
+    constexpr uint32_t instancesCount = 10000;
+    constexpr uint32_t materialsCount = 49;
+
+    const Pipeline::Id pipelineId = Pipeline::getModelBaseId();
+
+    Queue queue;
+
+    // The spheres of the benchmark sample: one mesh, the materials of the grid
+    for (uint32_t i = 0; i < instancesCount; ++i) {
+        queue.addPrimitiveSetInstance(pipelineId, makeInstance(i + 1, 1, i % materialsCount + 1));
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    queue.groupInstances(2);
+    const auto end = std::chrono::steady_clock::now();
+
+    EXPECT_TRUE(queue.getPrimitiveSets().empty());
+    EXPECT_EQ(queue.getPrimitiveSetBatches().at(Pipeline::getModelInstancedId(pipelineId)).size(), materialsCount);
+    EXPECT_EQ(queue.getInstances().size(), instancesCount);
+
+    RecordProperty("group_10k_instances_us", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()));
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+#include <lug/Graphics/Vulkan/Render/ShaderArchive.hpp>
+#include <lug/System/Clock.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using Pipeline = Vulkan::Render::Pipeline;
+
+static std::vector<Pipeline::Id> getTestedPipelineIds() {
+    const std::vector<Pipeline::Id> permutations = Pipeline::ShaderBuilder::getModelPermutations(1, 0, {Renderer::DisplayMode::Full});
+
+    // Compiling all of them is too long, take some ids spread over the permutations
+    std::vector<Pipeline::Id> pipelineIds;
+    for (size_t i = 0; i < permutations.size(); i += 32) {
+        pipelineIds.push_back(permutations[i]);
+    }
+
+    return pipelineIds;
+}
+
+static std::vector<uint32_t> compileShader(Pipeline::ShaderBuilder::Type type, Pipeline::Id id) {
+    switch (type) {
+        case Pipeline::ShaderBuilder::Type::Vertex:
+            return Pipeline::ShaderBuilder::buildShaderFromFile("./shaders/forward/shader.vert", type, id);
+        case Pipeline::ShaderBuilder::Type::Fragment:
+            return Pipeline::ShaderBuilder::buildShaderFromFile("./shaders/forward/shader.frag", type, id);
+    }
+
+    return {};
+}
+
+TEST(VulkanShaderArchive, Permutations) {
+    // 2 tangent * 1 color * (1 + 2^5 textures with 1 UV) * 2 irradiance * 2 prefiltered * 2 instanced
+    EXPECT_EQ(Pipeline::ShaderBuilder::getModelPermutations(1, 0, {Renderer::DisplayMode::Full}).size(), 528u);
+    EXPECT_EQ(Pipeline::ShaderBuilder::getModelPermutations(0, 0, {Renderer::DisplayMode::Full, Renderer::DisplayMode::Albedo}).size(), 32u);
+}
+
+TEST(VulkanShaderArchive, Key) {
+    Pipeline::Id id = Pipeline::getModelBaseId();
+    Pipeline::Id::Model::ExtraPart extraPart = id.getModelExtraPart();
+    extraPart.antialiasing = 2;
+
+    const Pipeline::Id antialiasedId = Pipeline::Id::createModel(id.getModelPrimitivePart(), id.getModelMaterialPart(), extraPart);
+
+    EXPECT_NE(id, antialiasedId);
+    EXPECT_EQ(Vulkan::Render::ShaderArchive::getKey(id), Vulkan::Render::ShaderArchive::getKey(antialiasedId));
+}
+
+TEST(VulkanShaderArchive, InvalidFile) {
+    Vulkan::Render::ShaderArchive archive;
+
+    EXPECT_FALSE(archive.load("./shaders/forward/doesnotexist.lsa"));
+    EXPECT_FALSE(archive.load("./shaders/forward/shader.vert"));
+}
+
+TEST(VulkanShaderArchive, LookupMatchesRuntimeCompilation) {
+    const std::vector<Pipeline::Id> pipelineIds = getTestedPipelineIds();
+    const Pipeline::ShaderBuilder::Type types[] = {Pipeline::ShaderBuilder::Type::Vertex, Pipeline::ShaderBuilder::Type::Fragment};
+
+    std::vector<std::vector<uint32_t>> compiledShaders;
+
+    // Generate the archive like the shaders compiler tool does
+    {
+        Vulkan::Render::ShaderArchive archive;
+
+        for (const auto id : pipelineIds) {
+            for (const auto type : types) {
+                std::vector<uint32_t> spirv = compileShader(type, id);
+                ASSERT_FALSE(spirv.empty());
+
+                archive.add(id, type, spirv);
+            }
+        }
+
+        ASSERT_EQ(archive.getEntriesCount(), pipelineIds.size() * 2);
+        ASSERT_TRUE(archive.save("./shaders/test.lsa"));
+    }
+
+    Vulkan::Render::ShaderArchive archive;
+    ASSERT_TRUE(archive.load("./shaders/test.lsa"));
+    EXPECT_EQ(archive.getEntriesCount(), pipelineIds.size() * 2);
+
+    System::Clock clock;
+
+    for (const auto id : pipelineIds) {
+        for (const auto type : types) {
+            compiledShaders.push_back(compileShader(type, id));
+        }
+    }
+
+    const int64_t compilationTime = clock.reset().getMicroseconds();
+
+    std::vector<std::vector<uint32_t>> archivedShaders;
+    for (const auto id : pipelineIds) {
+        for (const auto type : types) {
+            std::vector<uint32_t> spirv;
+            EXPECT_TRUE(archive.find(id, type, spirv));
+
+            archivedShaders.push_back(std::move(spirv));
+        }
+    }
+
+    const int64_t lookupTime = clock.getElapsedTime().getMicroseconds();
+
+    RecordProperty("CompilationTimeUs", static_cast<int>(compilationTime));
+    RecordProperty("LookupTimeUs", static_cast<int>(lookupTime));
+
+    EXPECT_EQ(archivedShaders, compiledShaders);
+
+    // The skybox is not in the archive
+    std::vector<uint32_t> spirv;
+    EXPECT_FALSE(archive.find(Pipeline::getSkyboxBaseId(), Pipeline::ShaderBuilder::Type::Vertex, spirv));
+}
+
+} // Graphics
+} // lug
@@ -12,65 +12,7 @@ static void tryToCompileShader(Render::Technique::Type technique, Vulkan::Render
 }
 
 static std::vector<Vulkan::Render::Pipeline::Id> generatePipelineIds() {
-    std::vector<Vulkan::Render::Pipeline::Id> pipelineIds{};
-
-    Vulkan::Render::Pipeline::Id::PrimitivePart primitivePart{};
-    Vulkan::Render::Pipeline::Id::MaterialPart materialPart{};
-
-    for (uint8_t positionVertexData = 0; positionVertexData <= 1; ++positionVertexData) {
-        primitivePart.positionVertexData = positionVertexData;
-
-        for (uint8_t normalVertexData = 0; normalVertexData <= 1; ++normalVertexData) {
-            primitivePart.normalVertexData = normalVertexData;
-
-            for (uint8_t tangentVertexData = 0; tangentVertexData <= 1; ++tangentVertexData) {
-                primitivePart.tangentVertexData = tangentVertexData;
-
-                for (uint8_t countColor = 0; countColor <= 3; ++countColor) {
-                    primitivePart.countColor = countColor;
-
-                    for (uint8_t countTexCoord = 0; countTexCoord <= 3; ++countTexCoord) {
-                        primitivePart.countTexCoord = countTexCoord;
-
-                        if (countTexCoord == 0) {
-                            materialPart.baseColorInfo = 0b11;
-                            materialPart.metallicRoughnessInfo = 0b11;
-                            materialPart.normalInfo = 0b11;
-                            materialPart.occlusionInfo = 0b11;
-                            materialPart.emissiveInfo = 0b11;
-
-                            pipelineIds.push_back(Vulkan::Render::Pipeline::Id::create(primitivePart, materialPart));
-                            continue;
-                        }
-
-                        for (uint8_t baseColorInfo = 0; baseColorInfo <= countTexCoord; ++baseColorInfo) {
-                            materialPart.baseColorInfo = baseColorInfo != countTexCoord ? baseColorInfo : 0b11;
-
-                            for (uint8_t metallicRoughnessInfo = 0; metallicRoughnessInfo <= countTexCoord; ++metallicRoughnessInfo) {
-                                materialPart.metallicRoughnessInfo = metallicRoughnessInfo != countTexCoord ? metallicRoughnessInfo : 0b11;
-
-                                for (uint8_t normalInfo = 0; normalInfo <= countTexCoord; ++normalInfo) {
-                                    materialPart.normalInfo = normalInfo != countTexCoord ? normalInfo : 0b11;
-
-                                    for (uint8_t occlusionInfo = 0; occlusionInfo <= countTexCoord; ++occlusionInfo) {
-                                        materialPart.occlusionInfo = occlusionInfo != countTexCoord ? occlusionInfo : 0b11;
-
-                                        for (uint8_t emissiveInfo = 0; emissiveInfo <= countTexCoord; ++emissiveInfo) {
-                                            materialPart.emissiveInfo = emissiveInfo != countTexCoord ? emissiveInfo : 0b11;
-
-                                            pipelineIds.push_back(Vulkan::Render::Pipeline::Id::create(primitivePart, materialPart));
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    return pipelineIds;
+    return Vulkan::Render::Pipeline::ShaderBuilder::getModelPermutations(3, 3, {Renderer::DisplayMode::Full});
 };
 
 class VulkanShaders : public testing::TestWithParam<Vulkan::Render::Pipeline::Id> {};
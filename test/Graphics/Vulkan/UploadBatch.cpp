@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/Graphics/Vulkan/API/Image.hpp>
+#include <lug/Graphics/Vulkan/API/Queue.hpp>
+#include <lug/Graphics/Vulkan/Render/UploadBatch.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using UploadBatch = Vulkan::Render::UploadBatch;
+
+namespace {
+
+// Counts the calls of the batch and keeps the staging buffer in memory, instead of calling Vulkan
+struct FakeBackend {
+    uint32_t stagingBuffersCount{0};
+    uint32_t submitsCount{0};
+    bool failStagingBuffer{false};
+    std::vector<uint8_t> stagingBuffer;
+
+    UploadBatch::Backend get() {
+        UploadBatch::Backend backend;
+
+        backend.createStagingBuffer = [this](UploadBatch& uploadBatch, const Vulkan::API::Device&, const Vulkan::API::Queue&) {
+            if (failStagingBuffer) {
+                return false;
+            }
+
+            ++stagingBuffersCount;
+            stagingBuffer.resize(static_cast<size_t>(uploadBatch.getStagingSize()));
+            uploadBatch.copyData(stagingBuffer.data());
+
+            return true;
+        };
+
+        backend.submit = [this](UploadBatch&, const Vulkan::API::Device&, const Vulkan::API::Queue&) {
+            ++submitsCount;
+            return true;
+        };
+
+        backend.isComplete = [](UploadBatch&) {
+            return true;
+        };
+
+        backend.wait = [](UploadBatch&) {
+            return true;
+        };
+
+        return backend;
+    }
+};
+
+} // anonymous
+
+// Records the textures of several materials, like GltfLoader does:
+// they share one staging buffer, and the batch allocates and submits only once
+TEST(UploadBatch, MultipleTextures) {
+    constexpr uint32_t texturesCount = 12;
+    constexpr uint32_t size = 64;
+    constexpr Render::Texture::Format format = Render::Texture::Format::R8G8B8A8_UNORM;
+    const uint32_t texelSize = Render::Texture::formatToSize(format);
+
+    const uint64_t submitsCount = UploadBatch::getSubmitsCount();
+    const uint64_t stagingAllocationsCount = UploadBatch::getStagingAllocationsCount();
+
+    // A different value for each texture, to check where it is copied
+    std::vector<std::vector<uint8_t>> pixels;
+    for (uint32_t i = 0; i < texturesCount; ++i) {
+        pixels.emplace_back(size * size * texelSize, static_cast<uint8_t>(i + 1));
+    }
+
+    std::vector<Vulkan::API::Image> images(texturesCount);
+
+    FakeBackend fakeBackend;
+    UploadBatch uploadBatch(fakeBackend.get());
+    EXPECT_TRUE(uploadBatch.isEmpty());
+
+    std::vector<VkDeviceSize> offsets;
+    for (uint32_t i = 0; i < texturesCount; ++i) {
+        offsets.push_back(uploadBatch.addData(pixels[i].data(), pixels[i].size(), texelSize));
+
+        VkBufferImageCopy region{};
+        region.bufferOffset = offsets.back();
+        region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        region.imageExtent = {size, size, 1};
+
+        uploadBatch.addImage(images[i], 1, 1, {region});
+    }
+
+    EXPECT_FALSE(uploadBatch.isEmpty());
+    EXPECT_FALSE(uploadBatch.isSubmitted());
+    EXPECT_EQ(uploadBatch.getImagesCount(), texturesCount);
+    EXPECT_EQ(uploadBatch.getBuffersCount(), 0u);
+
+    // All the textures are in one staging buffer, one after another
+    EXPECT_EQ(uploadBatch.getStagingSize(), pixels[0].size() * texturesCount);
+    for (uint32_t i = 0; i < texturesCount; ++i) {
+        EXPECT_EQ(offsets[i], pixels[0].size() * i);
+    }
+
+    // Nothing is allocated or submitted while recording
+    EXPECT_EQ(fakeBackend.stagingBuffersCount, 0u);
+    EXPECT_EQ(fakeBackend.submitsCount, 0u);
+
+    Vulkan::API::Device device;
+    Vulkan::API::Queue queue;
+
+    ASSERT_TRUE(uploadBatch.submit(device, queue));
+    EXPECT_TRUE(uploadBatch.isSubmitted());
+
+    EXPECT_EQ(fakeBackend.stagingBuffersCount, 1u);
+    EXPECT_EQ(fakeBackend.submitsCount, 1u);
+    EXPECT_EQ(UploadBatch::getSubmitsCount(), submitsCount + 1);
+    EXPECT_EQ(UploadBatch::getStagingAllocationsCount(), stagingAllocationsCount + 1);
+
+    ASSERT_EQ(fakeBackend.stagingBuffer.size(), pixels[0].size() * texturesCount);
+    for (uint32_t i = 0; i < texturesCount; ++i) {
+        EXPECT_TRUE(std::equal(pixels[i].begin(), pixels[i].end(), fakeBackend.stagingBuffer.begin() + static_cast<ptrdiff_t>(offsets[i])));
+    }
+
+    EXPECT_TRUE(uploadBatch.wait());
+    EXPECT_FALSE(uploadBatch.isSubmitted());
+    EXPECT_TRUE(uploadBatch.isEmpty());
+}
+
+TEST(UploadBatch, StagingBufferFailure) {
+    const uint64_t submitsCount = UploadBatch::getSubmitsCount();
+
+    const std::vector<uint8_t> data(16, 0);
+
+    FakeBackend fakeBackend;
+    fakeBackend.failStagingBuffer = true;
+
+    Vulkan::API::Buffer buffer;
+    Vulkan::API::Device device;
+    Vulkan::API::Queue queue;
+
+    UploadBatch uploadBatch(fakeBackend.get());
+    uploadBatch.addBuffer(buffer, data.data(), data.size());
+
+    // The uploads are dropped and nothing is submitted
+    EXPECT_FALSE(uploadBatch.submit(device, queue));
+    EXPECT_FALSE(uploadBatch.isSubmitted());
+    EXPECT_TRUE(uploadBatch.isEmpty());
+    EXPECT_EQ(fakeBackend.submitsCount, 0u);
+    EXPECT_EQ(UploadBatch::getSubmitsCount(), submitsCount);
+}
+
+TEST(UploadBatch, AlignData) {
+    UploadBatch uploadBatch;
+    const std::vector<unsigned char> data(10, 0);
+
+    EXPECT_EQ(uploadBatch.addData(data.data(), 10), 0u);
+
+    // Multiple of 4 for the copies
+    EXPECT_EQ(uploadBatch.addData(data.data(), 10, 1), 12u);
+
+    // Multiple of 4 and of the size of a R16G16B16_SFLOAT texel
+    EXPECT_EQ(uploadBatch.addData(data.data(), 6, Render::Texture::formatToSize(Render::Texture::Format::R16G16B16_SFLOAT)), 24u);
+    EXPECT_EQ(uploadBatch.addData(data.data(), 16, 16), 32u);
+
+    EXPECT_EQ(uploadBatch.getStagingSize(), 48u);
+}
+
+TEST(UploadBatch, SubmitEmptyBatch) {
+    const uint64_t submitsCount = UploadBatch::getSubmitsCount();
+    const uint64_t stagingAllocationsCount = UploadBatch::getStagingAllocationsCount();
+
+    // An empty batch doesn't use the device
+    Vulkan::API::Device device;
+    Vulkan::API::Queue queue;
+
+    UploadBatch uploadBatch;
+    EXPECT_TRUE(uploadBatch.submit(device, queue));
+    EXPECT_FALSE(uploadBatch.isSubmitted());
+    EXPECT_TRUE(uploadBatch.wait());
+
+    EXPECT_EQ(UploadBatch::getSubmitsCount(), submitsCount);
+    EXPECT_EQ(UploadBatch::getStagingAllocationsCount(), stagingAllocationsCount);
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,288 @@
+#include <atomic>
+#include <csignal>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lug/System/Logger/Handler.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/RingBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+namespace {
+
+constexpr const char* loggerName = "MyAsyncLogger";
+constexpr const char* handlerName = "MyAsyncHandler";
+
+// Records the messages, optionally blocks in handle() until it is opened
+class RecordingHandler : public Handler {
+public:
+    RecordingHandler(const std::string& name) : Handler(name) {}
+
+    void handle(const priv::Message& msg) override {
+        entered = true;
+
+        while (closed) {
+            std::this_thread::yield();
+        }
+
+        messages.push_back(msg.raw.c_str());
+        levels.push_back(msg.level);
+        threads.insert(std::this_thread::get_id());
+        ++handledCount;
+    }
+
+    void flush() override {
+        ++flushCount;
+    }
+
+    std::atomic<bool> closed{false};
+    std::atomic<bool> entered{false};
+    std::atomic<uint32_t> handledCount{0};
+    std::atomic<uint32_t> flushCount{0};
+
+    std::vector<std::string> messages;
+    std::vector<Level> levels;
+    std::set<std::thread::id> threads;
+};
+
+} // anonymous
+
+TEST(AsyncLogger, RingBufferOrder) {
+    RingBuffer<std::string> ringBuffer(3);
+    ASSERT_EQ(ringBuffer.getCapacity(), 4u);
+    EXPECT_TRUE(ringBuffer.empty());
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        std::string element = std::to_string(i);
+        EXPECT_TRUE(ringBuffer.tryPush(std::move(element)));
+    }
+
+    // Full, the element is not moved
+    std::string element = "4";
+    EXPECT_FALSE(ringBuffer.tryPush(std::move(element)));
+    EXPECT_EQ(element, "4");
+
+    std::vector<std::string> elements;
+    EXPECT_EQ(ringBuffer.pop([&elements](std::string& popped) { elements.push_back(popped); }, 3), 3u);
+    EXPECT_EQ(ringBuffer.getReadPosition(), 3u);
+
+    EXPECT_TRUE(ringBuffer.tryPush(std::move(element)));
+    EXPECT_EQ(ringBuffer.pop([&elements](std::string& popped) { elements.push_back(popped); }), 2u);
+
+    EXPECT_EQ(elements, (std::vector<std::string>{"0", "1", "2", "3", "4"}));
+    EXPECT_TRUE(ringBuffer.empty());
+    EXPECT_EQ(ringBuffer.getWritePosition(), 5u);
+}
+
+TEST(AsyncLogger, RingBufferPeek) {
+    RingBuffer<std::string> ringBuffer(4);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        std::string element = std::to_string(i);
+        EXPECT_TRUE(ringBuffer.tryPush(std::move(element)));
+    }
+
+    EXPECT_EQ(ringBuffer.pop([](std::string&) {}, 1), 1u);
+
+    // The elements are left in the buffer
+    std::vector<std::string> elements;
+    EXPECT_EQ(ringBuffer.peek([&elements](const std::string& peeked) { elements.push_back(peeked); }), 2u);
+    EXPECT_EQ(elements, (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(ringBuffer.getReadPosition(), 1u);
+    EXPECT_FALSE(ringBuffer.empty());
+}
+
+TEST(AsyncLogger, RingBufferProducers) {
+    constexpr uint32_t producersCount = 4;
+    constexpr uint32_t elementsCount = 20000;
+
+    RingBuffer<uint64_t> ringBuffer(64);
+
+    std::vector<std::thread> producers;
+    for (uint32_t producerIdx = 0; producerIdx < producersCount; ++producerIdx) {
+        producers.emplace_back([&ringBuffer, producerIdx]() {
+            for (uint64_t i = 0; i < elementsCount; ++i) {
+                while (!ringBuffer.tryPush(uint64_t(producerIdx) << 32 | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // The elements of each producer are popped in the order they were pushed
+    std::vector<uint64_t> nextElements(producersCount, 0);
+    uint32_t poppedCount = 0;
+    bool ordered = true;
+
+    while (poppedCount < producersCount * elementsCount) {
+        const uint32_t count = ringBuffer.pop([&nextElements, &ordered](uint64_t element) {
+            uint64_t& next = nextElements[element >> 32];
+            ordered &= (element & 0xFFFFFFFF) == next;
+            ++next;
+        });
+
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+
+        poppedCount += count;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(ringBuffer.empty());
+    EXPECT_EQ(nextElements, std::vector<uint64_t>(producersCount, elementsCount));
+}
+
+TEST(AsyncLogger, FlushIsABarrier) {
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t messagesCount = 2000;
+
+    Logger* logger = makeLogger(loggerName);
+    RecordingHandler* handler = makeHandler<RecordingHandler>(handlerName);
+
+    logger->addHandler(handler);
+    ASSERT_TRUE(logger->enableAsync({64, 16, Overflow::Block, false}));
+    EXPECT_TRUE(logger->isAsync());
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx) {
+        threads.emplace_back([logger, threadIdx]() {
+            for (uint32_t i = 0; i < messagesCount; ++i) {
+                logger->info("{} {}", threadIdx, i);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    logger->flush();
+
+    // Handled by the background thread only
+    EXPECT_EQ(handler->handledCount, threadsCount * messagesCount);
+    EXPECT_EQ(handler->flushCount, 1u);
+    EXPECT_EQ(handler->threads.size(), 1u);
+    EXPECT_EQ(handler->threads.count(std::this_thread::get_id()), 0u);
+    EXPECT_EQ(logger->getDroppedCount(), 0u);
+
+    logger->disableAsync();
+    EXPECT_FALSE(logger->isAsync());
+
+    // Synchronous again
+    logger->info("sync");
+    EXPECT_EQ(handler->messages.back(), "sync");
+    EXPECT_EQ(handler->threads.count(std::this_thread::get_id()), 1u);
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncLogger, OverflowDrop) {
+    Logger* logger = makeLogger(loggerName);
+    RecordingHandler* handler = makeHandler<RecordingHandler>(handlerName);
+
+    logger->addHandler(handler);
+    ASSERT_TRUE(logger->enableAsync({4, 16, Overflow::Drop, false}));
+
+    // The background thread is stuck in the handler with the first message
+    handler->closed = true;
+    logger->info("first");
+
+    while (!handler->entered) {
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        logger->info("{}", i);
+    }
+
+    // The slot of the first message is freed once it is handled
+    EXPECT_EQ(logger->getDroppedCount(), 7u);
+
+    handler->closed = false;
+    logger->flush();
+
+    EXPECT_EQ(handler->messages, (std::vector<std::string>{"first", "0", "1", "2"}));
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncLogger, OverflowCount) {
+    Logger* logger = makeLogger(loggerName);
+    RecordingHandler* handler = makeHandler<RecordingHandler>(handlerName);
+
+    logger->addHandler(handler);
+    ASSERT_TRUE(logger->enableAsync({4, 16, Overflow::Count, false}));
+
+    handler->closed = true;
+    logger->info("first");
+
+    while (!handler->entered) {
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        logger->info("{}", i);
+    }
+
+    handler->closed = false;
+    logger->flush();
+
+    // The number of dropped messages is logged after the next batch
+    ASSERT_EQ(handler->messages.size(), 5u);
+    EXPECT_EQ(handler->messages.back(), "7 messages dropped, the asynchronous queue was full");
+    EXPECT_EQ(handler->levels.back(), Level::Warning);
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncLogger, FatalIsHandledBeforeReturning) {
+    Logger* logger = makeLogger(loggerName);
+    RecordingHandler* handler = makeHandler<RecordingHandler>(handlerName);
+
+    logger->addHandler(handler);
+    ASSERT_TRUE(logger->enableAsync());
+
+    logger->info("info");
+    logger->fatal("fatal");
+
+    EXPECT_EQ(handler->messages, (std::vector<std::string>{"info", "fatal"}));
+    EXPECT_EQ(handler->flushCount, 1u);
+
+    LoggingFacility::clear();
+}
+
+TEST(AsyncLogger, CrashWritesQueuedMessages) {
+    EXPECT_DEATH({
+        Logger* logger = makeLogger(loggerName);
+        RecordingHandler* handler = makeHandler<RecordingHandler>(handlerName);
+
+        logger->addHandler(handler);
+        ASSERT_TRUE(logger->enableAsync({64, 16, Overflow::Block, true}));
+
+        // The background thread is stuck in the handler, the messages stay in the queue
+        handler->closed = true;
+        logger->info("first");
+
+        while (!handler->entered) {
+            std::this_thread::yield();
+        }
+
+        logger->info("second");
+        std::raise(SIGSEGV);
+    }, "MyAsyncLogger: first\nMyAsyncLogger: second");
+}
+
+} // Logger
+} // System
+} // lug
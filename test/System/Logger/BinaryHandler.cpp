@@ -0,0 +1,199 @@
+#include <lug/System/Logger/BinaryHandler.hpp>
+#include <lug/System/Logger/BinaryReader.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+namespace {
+
+constexpr const char* loggerName = "MyBinaryLogger";
+constexpr const char* handlerName = "MyBinaryHandler";
+const std::string fileName = "LugdunumTestFile.lugb";
+
+struct Decoded {
+    Level level;
+    std::string loggerName;
+    std::string format;
+    std::string message;
+};
+
+std::vector<Decoded> decode(const std::string& file) {
+    std::vector<Decoded> messages;
+
+    BinaryReader reader;
+    EXPECT_TRUE(reader.open(file));
+
+    BinaryReader::Record record;
+    while (reader.next(record)) {
+        Decoded decoded{record.level, record.loggerName, record.format, ""};
+        EXPECT_TRUE(BinaryReader::formatMessage(record.format, record.arguments, decoded.message));
+
+        messages.push_back(decoded);
+    }
+
+    EXPECT_FALSE(reader.isCorrupted());
+
+    return messages;
+}
+
+} // anonymous
+
+TEST(BinaryHandler, Decode) {
+    Logger* logger = makeLogger(loggerName);
+    BinaryHandler* handler = makeHandler<BinaryHandler>(handlerName, fileName, 64 * 1024, 1);
+    handler->setLevel(Level::Trace);
+    logger->addHandler(handler);
+
+    const std::string dynamicFormat = "dynamic {}";
+    const bool flag = false;
+
+    logger->info("Hello {} {:.2f} {}", -42, 1.5f, std::string("world"));
+    logger->warn("{0}{1}{0} {2:b} {3} {4}", "abra", "cad", 42u, true, 'c');
+    logger->error("Level {} at {:>5}", Level::Error, 2.25);
+    logger->debug(dynamicFormat, 1);
+    logger->trace(flag);
+    logger->fatal("Hello {} {:.2f} {}", 7, 0.25f, "again");
+
+    // Not captured by a log call
+    priv::Message msg(loggerName, Level::Info);
+    msg.raw << "raw text";
+    handler->handle(msg);
+
+    EXPECT_EQ(handler->getDroppedCount(), 0u);
+
+    // Truncates the file
+    LoggingFacility::clear();
+
+    const std::vector<Decoded> messages = decode(fileName);
+    ASSERT_EQ(messages.size(), 7u);
+
+    EXPECT_EQ(messages[0].level, Level::Info);
+    EXPECT_EQ(messages[0].loggerName, loggerName);
+    EXPECT_EQ(messages[0].format, "Hello {} {:.2f} {}");
+    EXPECT_EQ(messages[0].message, "Hello -42 1.50 world");
+
+    EXPECT_EQ(messages[1].level, Level::Warning);
+    EXPECT_EQ(messages[1].message, "abracadabra 101010 true c");
+
+    EXPECT_EQ(messages[2].message, "Level Error at  2.25");
+    EXPECT_EQ(messages[3].message, "dynamic 1");
+    EXPECT_EQ(messages[4].level, Level::Trace);
+    EXPECT_EQ(messages[4].message, "false");
+
+    // The format is defined once
+    EXPECT_EQ(messages[5].message, "Hello 7 0.25 again");
+    EXPECT_EQ(messages[5].format, messages[0].format);
+
+    EXPECT_EQ(messages[6].message, "raw text");
+
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryHandler, FormatBuffer) {
+    Logger* logger = makeLogger(loggerName);
+    BinaryHandler* handler = makeHandler<BinaryHandler>(handlerName, fileName, 64 * 1024, 1);
+    logger->addHandler(handler);
+    ASSERT_TRUE(logger->enableAsync());
+
+    // A char array is not a string literal, it may be overwritten before the message is handled
+    char format[] = "buffer {}";
+    logger->info(format, 1);
+    std::strcpy(format, "reused {}");
+
+    LoggingFacility::clear();
+
+    const std::vector<Decoded> messages = decode(fileName);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].format, "buffer {}");
+    EXPECT_EQ(messages[0].message, "buffer 1");
+
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryHandler, ManyFormats) {
+    constexpr uint32_t formatsCount = 100;
+
+    Logger* logger = makeLogger(loggerName);
+    BinaryHandler* handler = makeHandler<BinaryHandler>(handlerName, fileName, 64 * 1024, 1);
+    logger->addHandler(handler);
+
+    // Short formats, stored inside the strings of the dictionary, logged again once it has grown
+    for (uint32_t pass = 0; pass < 2; ++pass) {
+        for (uint32_t i = 0; i < formatsCount; ++i) {
+            const std::string format = "f" + std::to_string(i) + " {}";
+            logger->info(format, pass);
+        }
+    }
+
+    LoggingFacility::clear();
+
+    const std::vector<Decoded> messages = decode(fileName);
+    ASSERT_EQ(messages.size(), 2 * formatsCount);
+
+    for (uint32_t i = 0; i < 2 * formatsCount; ++i) {
+        EXPECT_EQ(messages[i].format, "f" + std::to_string(i % formatsCount) + " {}");
+        EXPECT_EQ(messages[i].message, "f" + std::to_string(i % formatsCount) + " " + std::to_string(i / formatsCount));
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryHandler, Rotation) {
+    constexpr uint32_t messagesCount = 1000;
+
+    Logger* logger = makeLogger(loggerName);
+    BinaryHandler* handler = makeHandler<BinaryHandler>(handlerName, fileName, 4096, 3);
+    logger->addHandler(handler);
+
+    for (uint32_t i = 0; i < messagesCount; ++i) {
+        logger->info("Message {}", i);
+    }
+
+    LoggingFacility::clear();
+
+    // Each file defines its format and decodes alone, the current one ends with the last message
+    const std::vector<Decoded> current = decode(fileName);
+    const std::vector<Decoded> previous = decode(fileName + ".1");
+    const std::vector<Decoded> oldest = decode(fileName + ".2");
+
+    ASSERT_FALSE(current.empty());
+    ASSERT_FALSE(previous.empty());
+    ASSERT_FALSE(oldest.empty());
+
+    EXPECT_EQ(current.back().message, "Message 999");
+    EXPECT_EQ(previous.back().message, "Message " + std::to_string(messagesCount - current.size() - 1));
+    EXPECT_EQ(oldest.back().message, "Message " + std::to_string(messagesCount - current.size() - previous.size() - 1));
+
+    BinaryReader reader;
+    EXPECT_FALSE(reader.open(fileName + ".3"));
+
+    std::remove(fileName.c_str());
+    std::remove((fileName + ".1").c_str());
+    std::remove((fileName + ".2").c_str());
+}
+
+TEST(BinaryHandler, FormatMessage) {
+    std::vector<BinaryReader::Argument> arguments(2);
+    arguments[0].type = ArgumentType::Int;
+    arguments[0].integer = 255;
+    arguments[1].type = ArgumentType::String;
+    arguments[1].text = "text";
+
+    std::string message;
+    EXPECT_TRUE(BinaryReader::formatMessage("{{{1}}} {0:#x} {1:>6}", arguments, message));
+    EXPECT_EQ(message, "{text} 0xff   text");
+
+    EXPECT_FALSE(BinaryReader::formatMessage("{} {} {}", arguments, message));
+    EXPECT_FALSE(BinaryReader::formatMessage("{0:d}", {arguments[1]}, message));
+}
+
+} // Logger
+} // System
+} // lug
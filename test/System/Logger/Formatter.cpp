@@ -1,3 +1,6 @@
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 #include <lug/System/Logger/Formatter.hpp>
 #include <lug/System/Logger/Common.hpp>
 #include <lug/System/Logger/Message.hpp>
@@ -33,6 +36,7 @@ TEST(Formatter, FormatsWithLevel) {
         ASSERT_STREQ(msg.formatted.c_str(), ("[" + stringified + "][Hello world!]\n").c_str());
     };
 
+    testOneLevel(Level::Trace,   "TRACE  ");
     testOneLevel(Level::Debug,   "DEBUG  ");
     testOneLevel(Level::Info,    "INFO   ");
     testOneLevel(Level::Warning, "WARNING");
@@ -70,6 +74,50 @@ TEST(Formatter, FormatsTime) {
     ASSERT_STREQ(msg.formatted.c_str(), ss.str().c_str());
 }
 
+TEST(Formatter, FormatsTimeOfMessage) {
+    Formatter formatter("[%Y-%m-%d %H:%M:%S][%l] %v%q\n%");
+
+    const auto expected = [](std::time_t time, const char* end) {
+        std::tm tf;
+
+    #if defined(LUG_SYSTEM_WINDOWS)
+        localtime_s(&tf, &time);
+    #else
+        localtime_r(&time, &tf);
+    #endif
+
+        std::stringstream ss;
+        ss << std::put_time(&tf, "[%Y-%m-%d %H:%M:%S]") << end;
+        return ss.str();
+    };
+
+    const std::time_t time = 1500000000;
+
+    priv::Message msg("Test", Level::Warning);
+    msg.raw << "Hello world!";
+    msg.time = std::chrono::system_clock::from_time_t(time);
+
+    // The unknown flags and the trailing % are ignored
+    formatter.format(msg);
+    ASSERT_EQ(msg.formatted.str(), expected(time, "[WARNING] Hello world!\n"));
+
+    // Same second, from the cache
+    msg.level = Level::Error;
+    formatter.format(msg);
+    ASSERT_EQ(msg.formatted.str(), expected(time, "[ERROR  ] Hello world!\n"));
+
+    // Another second
+    msg.time += std::chrono::seconds(3661);
+    formatter.format(msg);
+    ASSERT_EQ(msg.formatted.str(), expected(time + 3661, "[ERROR  ] Hello world!\n"));
+}
+
+TEST(Formatter, LevelNames) {
+    EXPECT_STREQ(Formatter::getLevelName(Level::Debug), "DEBUG  ");
+    EXPECT_STREQ(Formatter::getLevelName(Level::Off), "OFF    ");
+    EXPECT_STREQ(Formatter::getLevelName(static_cast<Level>(42)), "UNKNOWN");
+}
+
 }
 }
 }
@@ -0,0 +1,46 @@
+// Removes the log macros below Info from this file, whatever the level of the build
+#undef LUG_LOG_MIN_LEVEL
+#define LUG_LOG_MIN_LEVEL LUG_LOG_LEVEL_INFO
+
+#include <lug/System/Logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "MockHandler.hpp"
+
+namespace lug {
+namespace System {
+namespace Logger {
+
+using namespace ::testing;
+
+TEST(LogMacros, StrippedBelowMinLevel) {
+    Logger* logger = makeLogger("MyMacrosLogger");
+    MockHandler* handler = makeHandler<MockHandler>("MyMacrosHandler");
+
+    handler->setLevel(Level::Trace);
+    logger->addHandler(handler);
+
+    uint32_t evaluationsCount = 0;
+
+    // Enabled at runtime, but removed at compile time
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::level, Level::Trace))).Times(0);
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::level, Level::Debug))).Times(0);
+    LUG_LOGGER_TRACE(*logger, "{}", ++evaluationsCount);
+    LUG_LOGGER_DEBUG(*logger, "{}", ++evaluationsCount);
+    EXPECT_EQ(evaluationsCount, 0u);
+
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::level, Level::Info))).Times(1);
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::level, Level::Warning))).Times(1);
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::level, Level::Error))).Times(1);
+    LUG_LOGGER_INFO(*logger, "{}", ++evaluationsCount);
+    LUG_LOGGER_WARN(*logger, "{}", ++evaluationsCount);
+    LUG_LOGGER_ERROR(*logger, "{}", ++evaluationsCount);
+    EXPECT_EQ(evaluationsCount, 3u);
+
+    LoggingFacility::clear();
+}
+
+} // Logger
+} // System
+} // lug
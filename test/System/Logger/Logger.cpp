@@ -311,6 +311,66 @@ TEST(Logger, LogsExceptionWhenParseFails) {
 } // namespace ExceptionHandler
 
 
+TEST(Logger, MinLevel) {
+    Logger* logger = makeLogger(loggerName);
+    MockHandler* handler = makeHandler<MockHandler>(handlerName);
+    MockHandler* handler2 = makeHandler<MockHandler>(handlerName2);
+
+    // Without handler, nothing is logged
+    EXPECT_FALSE(logger->shouldLog(Level::Assert));
+
+    handler->setLevel(Level::Error);
+    logger->addHandler(handler);
+    EXPECT_FALSE(logger->shouldLog(Level::Warning));
+    EXPECT_TRUE(logger->shouldLog(Level::Error));
+
+    // The lowest level of the handlers
+    handler2->setLevel(Level::Info);
+    logger->addHandler(handler2);
+    EXPECT_FALSE(logger->shouldLog(Level::Debug));
+    EXPECT_TRUE(logger->shouldLog(Level::Info));
+
+    // Updated when a handler of the logger changes its level
+    handler->setLevel(Level::Trace);
+    EXPECT_TRUE(logger->shouldLog(Level::Trace));
+
+    handler->setLevel(Level::Off);
+    handler2->setLevel(Level::Off);
+    EXPECT_FALSE(logger->shouldLog(Level::Assert));
+
+    LoggingFacility::clear();
+}
+
+TEST(Logger, DisabledLevelIsNotFormatted) {
+    Logger* logger = makeLogger(loggerName);
+    MockHandler* handler = makeHandler<MockHandler>(handlerName);
+
+    handler->setLevel(Level::Info);
+    logger->addHandler(handler);
+
+    uint32_t evaluationsCount = 0;
+    const auto expensive = lazy([&evaluationsCount]() {
+        ++evaluationsCount;
+        return 42;
+    });
+
+    EXPECT_CALL(*handler, handle(Field(&priv::Message::raw, Property(&fmt::MemoryWriter::c_str, StrEq("value 42"))))).Times(1);
+
+    logger->debug("value {}", expensive);
+    logger->trace("value {}", expensive);
+    EXPECT_EQ(evaluationsCount, 0u);
+
+    logger->info("value {}", expensive);
+    EXPECT_EQ(evaluationsCount, 1u);
+
+    // The arguments of the macros are not evaluated either
+    LUG_LOGGER_DEBUG(*logger, "value {}", ++evaluationsCount);
+    EXPECT_EQ(evaluationsCount, 1u);
+
+    LoggingFacility::clear();
+}
+
+
 }
 }
 }
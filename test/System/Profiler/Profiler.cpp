@@ -0,0 +1,196 @@
+#include <lug/System/Clock.hpp>
+#include <lug/System/Profiler/Exporter.hpp>
+#include <lug/System/Profiler/Profiler.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace lug {
+namespace System {
+namespace Profiler {
+
+// Empties the buffers of the previous tests
+static std::vector<Event> collectEvents() {
+    std::vector<Event> events;
+    Profiler::getInstance().collect(events);
+    return events;
+}
+
+TEST(Profiler, DisabledZonesAreNotRecorded) {
+    Profiler::getInstance().setEnabled(false);
+    collectEvents();
+
+    {
+        Zone zone("disabled");
+    }
+
+    EXPECT_TRUE(collectEvents().empty());
+}
+
+TEST(Profiler, NestedZones) {
+    Profiler::getInstance().setEnabled(true);
+    collectEvents();
+
+    {
+        Zone outer("outer");
+        {
+            Zone inner("inner");
+        }
+    }
+
+    Profiler::getInstance().setEnabled(false);
+
+    const std::vector<Event> events = collectEvents();
+    ASSERT_EQ(events.size(), 2u);
+
+    // The events are pushed when the zones end
+    EXPECT_STREQ(events[0].name, "inner");
+    EXPECT_EQ(events[0].depth, 1u);
+    EXPECT_STREQ(events[1].name, "outer");
+    EXPECT_EQ(events[1].depth, 0u);
+
+    EXPECT_LE(events[1].begin, events[0].begin);
+    EXPECT_GE(events[1].end, events[0].end);
+    EXPECT_EQ(events[0].threadId, events[1].threadId);
+}
+
+TEST(Profiler, CollectsAllThreads) {
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t zonesCount = 1000;
+
+    Profiler::getInstance().setEnabled(true);
+    collectEvents();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([]() {
+            for (uint32_t j = 0; j < zonesCount; ++j) {
+                LUG_PROFILE_SCOPE("thread");
+            }
+        });
+    }
+
+    // Collect while the threads are still writing
+    std::vector<Event> events;
+    Profiler::getInstance().collect(events);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Profiler::getInstance().setEnabled(false);
+    Profiler::getInstance().collect(events);
+
+#if defined(LUG_PROFILER_DISABLED)
+    EXPECT_TRUE(events.empty());
+#else
+    EXPECT_EQ(events.size(), threadsCount * zonesCount);
+#endif
+}
+
+TEST(ThreadBuffer, DropsEventsWhenFull) {
+    ThreadBuffer threadBuffer(42);
+
+    for (uint32_t i = 0; i < ThreadBuffer::capacity; ++i) {
+        EXPECT_TRUE(threadBuffer.push({"event", i, i + 1, 42, 0}));
+    }
+
+    EXPECT_FALSE(threadBuffer.push({"dropped", 0, 0, 42, 0}));
+    EXPECT_EQ(threadBuffer.getDroppedCount(), 1u);
+
+    std::vector<Event> events;
+    threadBuffer.pop(events);
+
+    ASSERT_EQ(events.size(), ThreadBuffer::capacity);
+    EXPECT_EQ(events.back().begin, static_cast<int64_t>(ThreadBuffer::capacity - 1));
+
+    // There is room again
+    EXPECT_TRUE(threadBuffer.push({"event", 0, 0, 42, 0}));
+}
+
+TEST(Exporter, ChromeTrace) {
+    const std::vector<Event> events{
+        {"Frame", 1000000, 1016000, 0, 0},
+        {"Quote\"d", 1001000, 1002500, 1, 0}
+    };
+
+    std::ostringstream stream;
+    ASSERT_TRUE(Exporter::writeChromeTrace(stream, events));
+
+    const std::string trace = stream.str();
+    EXPECT_NE(trace.find("{\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Frame\",\"cat\":\"lug\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":0.000,\"dur\":16.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Quote\\\"d\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":1.000,\"dur\":1.500"), std::string::npos);
+}
+
+TEST(Exporter, BinaryRoundTrip) {
+    const std::string filename = "LugdunumTestProfile.lugprof";
+
+    const std::vector<Event> events{
+        {"Frame", 100, 900, 0, 0},
+        {"Render", 200, 800, 0, 1},
+        {"Frame", 1000, 1900, 0, 0},
+        {"Record", 300, 400, 3, 0}
+    };
+
+    ASSERT_TRUE(Exporter::writeBinary(filename, events));
+
+    std::vector<std::string> names;
+    std::vector<Event> readEvents;
+    ASSERT_TRUE(Exporter::readBinary(filename, names, readEvents));
+
+    std::remove(filename.c_str());
+
+    // The names are only stored once
+    EXPECT_EQ(names.size(), 3u);
+
+    ASSERT_EQ(readEvents.size(), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_STREQ(readEvents[i].name, events[i].name);
+        EXPECT_EQ(readEvents[i].begin, events[i].begin);
+        EXPECT_EQ(readEvents[i].end, events[i].end);
+        EXPECT_EQ(readEvents[i].threadId, events[i].threadId);
+        EXPECT_EQ(readEvents[i].depth, events[i].depth);
+    }
+}
+
+// Measures the cost of a zone, recorded as properties of the test
+TEST(Profiler, ZoneOverhead) {
+    constexpr uint32_t zonesCount = ThreadBuffer::capacity / 2;
+
+    const auto measure = [](bool enabled) {
+        Profiler::getInstance().setEnabled(enabled);
+        collectEvents();
+
+        const int64_t begin = Clock::getTimestamp();
+        for (uint32_t i = 0; i < zonesCount; ++i) {
+            LUG_PROFILE_SCOPE("overhead");
+        }
+        const int64_t end = Clock::getTimestamp();
+
+        Profiler::getInstance().setEnabled(false);
+        collectEvents();
+
+        return static_cast<double>(end - begin) / zonesCount;
+    };
+
+    const double disabledCost = measure(false);
+    const double enabledCost = measure(true);
+
+    RecordProperty("EnabledZoneNanoseconds", static_cast<int>(enabledCost));
+    RecordProperty("DisabledZoneNanoseconds", static_cast<int>(disabledCost));
+
+    // Loose bounds, a zone records two timestamps in a thread local buffer and takes no lock
+    EXPECT_LT(enabledCost, 10000.0);
+    EXPECT_LT(disabledCost, 1000.0);
+
+    EXPECT_EQ(Profiler::getInstance().getDroppedCount(), 0u);
+}
+
+} // Profiler
+} // System
+} // lug
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <string>
+
+#include <lug/Graphics/AssetCooker.hpp>
+#include <lug/Graphics/AssetPackage.hpp>
+#include <lug/System/Clock.hpp>
+
+namespace AssetCooker = lug::Graphics::AssetCooker;
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [--compress] <input.gltf|input.glb> <output.lugpack>" << std::endl
+              << "Cooks the default scene of a glTF file into a package loaded by the ResourceManager" << std::endl
+              << "  --compress  Encodes the textures to BC1, or BC3 if they are not opaque" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    const bool compressTextures = argc == 4 && std::string(argv[1]) == "--compress";
+
+    if (argc != 3 && !compressTextures) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    const std::string input = argv[argc - 2];
+    const std::string output = argv[argc - 1];
+
+    lug::System::Clock clock;
+
+    lug::Graphics::AssetPackage::Writer writer;
+    AssetCooker::Statistics statistics;
+
+    if (!AssetCooker::cook(input, writer, statistics, compressTextures)) {
+        std::cerr << "Can't cook " << input << std::endl;
+        return 1;
+    }
+
+    if (!writer.save(output)) {
+        std::cerr << "Can't write the package " << output << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << statistics.nodesCount << " nodes, " << statistics.meshesCount << " meshes ("
+              << statistics.buffersSize << " bytes) and " << statistics.texturesCount << " textures ("
+              << statistics.texturesSize << " bytes) to " << output << " in "
+              << clock.getElapsedTime().getSeconds() << "s" << std::endl;
+
+    // Memory footprint of the textures on the GPU, compared to R8G8B8A8
+    if (statistics.texturesSize) {
+        std::cout << "Textures: " << statistics.texturesSize << " bytes, " << statistics.uncompressedTexturesSize
+                  << " bytes in R8G8B8A8 (" << static_cast<double>(statistics.uncompressedTexturesSize) / statistics.texturesSize
+                  << "x)" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/System/Clock.hpp>
+
+using ImageDecoder = lug::Graphics::ImageDecoder;
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [options] <image>..." << std::endl
+              << "Decodes the images with 1 to N threads, e.g. resources/models/DamagedHelmet/textures/*.jpg" << std::endl
+              << "Options:" << std::endl
+              << "  --threads <n>      Maximum number of threads (default: hardware concurrency)" << std::endl
+              << "  --iterations <n>   Number of decodes per number of threads, the best one is kept (default: 3)" << std::endl
+              << "  --hdr              Decodes to R32G32B32A32_SFLOAT" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    uint32_t maxThreadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    uint32_t iterations = 3;
+    bool hdr = false;
+
+    std::vector<ImageDecoder::Source> sources;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (i + 1 < argc && option == "--threads") {
+            maxThreadsCount = std::max(static_cast<uint32_t>(std::atoi(argv[++i])), 1u);
+        } else if (i + 1 < argc && option == "--iterations") {
+            iterations = std::max(static_cast<uint32_t>(std::atoi(argv[++i])), 1u);
+        } else if (option == "--hdr") {
+            hdr = true;
+        } else if (option.size() > 2 && option.compare(0, 2, "--") == 0) {
+            printUsage(argv[0]);
+            return 1;
+        } else {
+            sources.push_back({option, false});
+        }
+    }
+
+    if (sources.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    for (auto& source : sources) {
+        source.hdr = hdr;
+    }
+
+    maxThreadsCount = std::min(maxThreadsCount, 255u);
+
+    double singleThreadTime = 0.0;
+
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "time (ms)" << std::setw(10) << "speedup" << std::endl;
+
+    for (uint32_t threadsCount = 1; threadsCount <= maxThreadsCount; ++threadsCount) {
+        ImageDecoder decoder(static_cast<uint8_t>(threadsCount));
+        double bestTime = 0.0;
+
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+            lug::System::Clock clock;
+            const std::vector<ImageDecoder::Image> images = decoder.decode(sources);
+            const double time = clock.getElapsedTime().getMilliseconds<double>();
+
+            for (size_t i = 0; i < images.size(); ++i) {
+                if (!images[i].pixels) {
+                    std::cerr << "Can't decode " << sources[i].filename << std::endl;
+                    return 1;
+                }
+            }
+
+            bestTime = iteration ? std::min(bestTime, time) : time;
+        }
+
+        if (threadsCount == 1) {
+            singleThreadTime = bestTime;
+        }
+
+        std::cout << std::setw(8) << threadsCount
+                  << std::setw(12) << std::fixed << std::setprecision(1) << bestTime
+                  << std::setw(9) << std::setprecision(2) << singleThreadTime / bestTime << "x" << std::endl;
+    }
+
+    return 0;
+}
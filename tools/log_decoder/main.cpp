@@ -0,0 +1,172 @@
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <lug/System/Logger/BinaryReader.hpp>
+#include <lug/System/Logger/Formatter.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+using BinaryReader = lug::System::Logger::BinaryReader;
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [options] <file>..." << std::endl
+              << "Decodes the files written by the binary log handler, in the order of the arguments" << std::endl
+              << "Options:" << std::endl
+              << "  --json               Writes one JSON object per message" << std::endl
+              << "  --pattern <pattern>  Pattern of the text messages (default: \"[%Y-%m-%d %H:%M:%S][%l] %v\")" << std::endl;
+}
+
+static void writeJsonString(std::ostream& os, const std::string& text) {
+    os << '"';
+
+    for (const char character : text) {
+        switch (character) {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\r': os << "\\r"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(character));
+                    os << escaped;
+                } else {
+                    os << character;
+                }
+        }
+    }
+
+    os << '"';
+}
+
+static void writeJsonArgument(std::ostream& os, const BinaryReader::Argument& argument) {
+    switch (argument.type) {
+        case lug::System::Logger::ArgumentType::Int:
+            os << argument.integer;
+            break;
+        case lug::System::Logger::ArgumentType::UInt:
+            os << argument.unsignedInteger;
+            break;
+        case lug::System::Logger::ArgumentType::Boolean:
+            os << (argument.integer ? "true" : "false");
+            break;
+        case lug::System::Logger::ArgumentType::Char:
+            writeJsonString(os, std::string(1, static_cast<char>(argument.integer)));
+            break;
+        case lug::System::Logger::ArgumentType::Float:
+        case lug::System::Logger::ArgumentType::Double: {
+            std::ostringstream real;
+            real.precision(17);
+            real << argument.real;
+            os << real.str();
+            break;
+        }
+        case lug::System::Logger::ArgumentType::String:
+            writeJsonString(os, argument.text);
+            break;
+        case lug::System::Logger::ArgumentType::Pointer: {
+            char address[19];
+            std::snprintf(address, sizeof(address), "0x%" PRIx64, argument.unsignedInteger);
+            writeJsonString(os, address);
+            break;
+        }
+    }
+}
+
+static void writeJson(std::ostream& os, const BinaryReader::Record& record, const std::string& message) {
+    std::ostringstream level;
+    level << record.level;
+
+    os << "{\"time\":" << std::chrono::duration_cast<std::chrono::nanoseconds>(record.time.time_since_epoch()).count()
+       << ",\"level\":";
+    writeJsonString(os, level.str());
+    os << ",\"logger\":";
+    writeJsonString(os, record.loggerName);
+    os << ",\"format\":";
+    writeJsonString(os, record.format);
+    os << ",\"message\":";
+    writeJsonString(os, message);
+    os << ",\"arguments\":[";
+
+    for (std::size_t i = 0; i < record.arguments.size(); ++i) {
+        if (i) {
+            os << ',';
+        }
+
+        writeJsonArgument(os, record.arguments[i]);
+    }
+
+    os << "]}" << '\n';
+}
+
+int main(int argc, char* argv[]) {
+    bool json = false;
+    std::string pattern = "[%Y-%m-%d %H:%M:%S][%l] %v";
+    std::vector<std::string> filenames;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (option == "--json") {
+            json = true;
+        } else if (i + 1 < argc && option == "--pattern") {
+            pattern = argv[++i];
+        } else if (!option.empty() && option[0] != '-') {
+            filenames.push_back(option);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (filenames.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    lug::System::Logger::Formatter formatter(pattern + "\n");
+    bool corrupted = false;
+
+    for (const auto& filename : filenames) {
+        BinaryReader reader;
+
+        if (!reader.open(filename)) {
+            std::cerr << filename << ": not a binary log file" << std::endl;
+            return 1;
+        }
+
+        BinaryReader::Record record;
+        std::string message;
+
+        while (reader.next(record)) {
+            // Keep the message readable when the arguments don't match the format
+            if (!BinaryReader::formatMessage(record.format, record.arguments, message)) {
+                message = record.format + " (can't format " + std::to_string(record.arguments.size()) + " arguments)";
+            }
+
+            if (json) {
+                writeJson(std::cout, record, message);
+                continue;
+            }
+
+            lug::System::Logger::priv::Message msg(record.loggerName.c_str(), record.level);
+            msg.time = record.time;
+            msg.raw << message;
+
+            formatter.format(msg);
+            std::cout.write(msg.formatted.data(), msg.formatted.size());
+        }
+
+        if (reader.isCorrupted()) {
+            std::cerr << filename << ": corrupted record, the rest of the file is skipped" << std::endl;
+            corrupted = true;
+        }
+    }
+
+    return corrupted ? 1 : 0;
+}
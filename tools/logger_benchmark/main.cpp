@@ -0,0 +1,353 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lug/System/Clock.hpp>
+#include <lug/System/Exception.hpp>
+#include <lug/System/Logger/BinaryHandler.hpp>
+#include <lug/System/Logger/FileHandler.hpp>
+#include <lug/System/Logger/Formatter.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/Message.hpp>
+
+using Logger = lug::System::Logger::Logger;
+
+// Counts the heap allocations of the whole program
+static std::atomic<uint64_t> allocationsCount{0};
+
+void* operator new(std::size_t size) {
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+struct Result {
+    double throughput;          // Messages per second until the last log call returns
+    double flushedThroughput;   // Messages per second until they are all written
+    std::vector<int64_t> latencies;
+};
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [options]" << std::endl
+              << "Options:" << std::endl
+              << "  --threads <n>                  Number of producer threads (default: 4)" << std::endl
+              << "  --messages <n>                 Number of messages per thread (default: 100000)" << std::endl
+              << "  --mode <sync|async|both|format|disabled|binary>" << std::endl
+              << "                                 Logging mode to measure, only the formatting, the calls of a disabled level," << std::endl
+              << "                                 or the text and the binary handlers (default: both)" << std::endl
+              << "  --capacity <n>                 Capacity of the asynchronous queue (default: 8192)" << std::endl
+              << "  --overflow <block|drop|count>  Overflow policy of the asynchronous queue (default: block)" << std::endl
+              << "  --output <file>                File written by the handler (default: logger_benchmark.log)" << std::endl;
+}
+
+static Result run(bool async, const lug::System::Logger::AsyncInfo& asyncInfo, uint32_t threadsCount, uint32_t messagesCount, const std::string& output) {
+    Logger logger("benchmark");
+    auto handler = lug::System::Logger::makeHandler<lug::System::Logger::FileHandler>(async ? "async" : "sync", output, true);
+    logger.addHandler(handler);
+
+    if (async && !logger.enableAsync(asyncInfo)) {
+        std::cerr << "Can't start the background thread of the logger" << std::endl;
+        std::exit(1);
+    }
+
+    std::vector<std::vector<int64_t>> latencies(threadsCount);
+    std::vector<std::thread> threads;
+
+    const int64_t begin = lug::System::Clock::getTimestamp();
+
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx) {
+        threads.emplace_back([&logger, &latencies, threadIdx, messagesCount]() {
+            std::vector<int64_t>& threadLatencies = latencies[threadIdx];
+            threadLatencies.reserve(messagesCount);
+
+            for (uint32_t i = 0; i < messagesCount; ++i) {
+                const int64_t callBegin = lug::System::Clock::getTimestamp();
+                logger.info("Thread {} message {}: {:.3f}", threadIdx, i, i * 0.5f);
+                threadLatencies.push_back(lug::System::Clock::getTimestamp() - callBegin);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const int64_t logged = lug::System::Clock::getTimestamp();
+    logger.flush();
+    const int64_t flushed = lug::System::Clock::getTimestamp();
+
+    const double totalCount = static_cast<double>(threadsCount) * messagesCount;
+
+    Result result;
+    result.throughput = totalCount / ((logged - begin) / 1e9);
+    result.flushedThroughput = totalCount / ((flushed - begin) / 1e9);
+
+    for (const auto& threadLatencies : latencies) {
+        result.latencies.insert(result.latencies.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+
+    std::sort(result.latencies.begin(), result.latencies.end());
+
+    if (async && logger.getDroppedCount()) {
+        std::cout << "  " << logger.getDroppedCount() << " messages dropped" << std::endl;
+    }
+
+    return result;
+}
+
+static void runFormat(uint32_t threadsCount, uint32_t messagesCount) {
+    // Shared by the threads, as the formatter of a handler
+    lug::System::Logger::Formatter formatter("[%H:%M:%S][%l] %v\n");
+
+    std::vector<double> throughputs(threadsCount);
+    std::vector<std::thread> threads;
+
+    // The threads and the messages allocate once, before the measure
+    std::atomic<uint32_t> readyCount{0};
+    std::atomic<bool> start{false};
+    std::atomic<uint64_t> allocationsBegin{0};
+
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx) {
+        threads.emplace_back([&, threadIdx]() {
+            lug::System::Logger::priv::Message msg("benchmark", lug::System::Logger::Level::Info);
+            msg.raw.write("Thread {} message {}: {:.3f}", threadIdx, 42, 21.0f);
+
+            ++readyCount;
+            while (!start) {
+                std::this_thread::yield();
+            }
+
+            const int64_t begin = lug::System::Clock::getTimestamp();
+
+            for (uint32_t i = 0; i < messagesCount; ++i) {
+                msg.time = std::chrono::system_clock::now();
+                formatter.format(msg);
+            }
+
+            throughputs[threadIdx] = messagesCount / ((lug::System::Clock::getTimestamp() - begin) / 1e9);
+        });
+    }
+
+    while (readyCount != threadsCount) {
+        std::this_thread::yield();
+    }
+
+    allocationsBegin = allocationsCount.load();
+    start = true;
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const uint64_t allocations = allocationsCount.load() - allocationsBegin;
+
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx) {
+        std::cout << "format thread " << threadIdx << std::fixed << std::setprecision(0)
+                  << std::setw(12) << throughputs[threadIdx] << " msg/s" << std::endl;
+    }
+
+    std::cout << "format " << std::setprecision(3) << static_cast<double>(allocations) / (static_cast<double>(threadsCount) * messagesCount)
+              << " allocations per message" << std::endl;
+}
+
+static void runDisabled(uint32_t messagesCount) {
+    Logger logger("benchmark");
+    auto handler = lug::System::Logger::makeHandler<lug::System::Logger::FileHandler>("disabled", "logger_benchmark_disabled.log", true);
+    handler->setLevel(lug::System::Logger::Level::Info);
+    logger.addHandler(handler);
+
+    // Only the minimum level of the logger is checked, the arguments are neither formatted nor evaluated
+    const auto measure = [messagesCount](const char* name, const std::function<void(uint32_t)>& call) {
+        const uint64_t allocationsBegin = allocationsCount.load();
+        const int64_t begin = lug::System::Clock::getTimestamp();
+
+        for (uint32_t i = 0; i < messagesCount; ++i) {
+            call(i);
+        }
+
+        const int64_t end = lug::System::Clock::getTimestamp();
+
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(8) << static_cast<double>(end - begin) / messagesCount << " ns per call, "
+                  << static_cast<double>(allocationsCount.load() - allocationsBegin) / messagesCount << " allocations per call" << std::endl;
+    };
+
+    measure("debug() disabled", [&logger](uint32_t i) {
+        logger.debug("Message {}: {:.3f} {}", i, i * 0.5f, "text");
+    });
+
+    measure("LUG_LOGGER_DEBUG disabled", [&logger](uint32_t i) {
+        LUG_LOGGER_DEBUG(logger, "Message {}: {:.3f} {}", i, i * 0.5f, "text");
+    });
+
+    measure("info() enabled", [&logger](uint32_t i) {
+        logger.info("Message {}: {:.3f} {}", i, i * 0.5f, "text");
+    });
+}
+
+static void runHandlers(uint32_t threadsCount, uint32_t messagesCount, const std::string& output) {
+    const auto measure = [threadsCount, messagesCount](const char* name, const std::string& filename, std::unique_ptr<lug::System::Logger::Handler> handler) {
+        int64_t begin;
+        int64_t end;
+
+        {
+            Logger logger("benchmark");
+            logger.addHandler(handler.get());
+
+            std::vector<std::thread> threads;
+
+            begin = lug::System::Clock::getTimestamp();
+
+            for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx) {
+                threads.emplace_back([&logger, threadIdx, messagesCount]() {
+                    for (uint32_t i = 0; i < messagesCount; ++i) {
+                        logger.info("Thread {} message {}: {:.3f}", threadIdx, i, i * 0.5f);
+                    }
+                });
+            }
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            logger.flush();
+            end = lug::System::Clock::getTimestamp();
+        }
+
+        // The binary handler truncates its file when it is destroyed
+        handler.reset();
+
+        const double totalCount = static_cast<double>(threadsCount) * messagesCount;
+        const std::streamoff size = std::ifstream(filename, std::ios::binary | std::ios::ate).tellg();
+
+        std::cout << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(12) << totalCount / ((end - begin) / 1e9) << " records/s"
+                  << std::setprecision(1) << std::setw(8) << size / totalCount << " bytes/record" << std::endl;
+    };
+
+    const std::string binaryOutput = output + ".lugb";
+    const uint32_t binaryFileSize = static_cast<uint32_t>(std::min<uint64_t>(static_cast<uint64_t>(threadsCount) * messagesCount * 64 + 4096, 1u << 31));
+
+    measure("text", output, std::make_unique<lug::System::Logger::FileHandler>("text", output, true));
+    measure("binary", binaryOutput, std::make_unique<lug::System::Logger::BinaryHandler>("binary", binaryOutput, binaryFileSize, 1));
+}
+
+static void printResult(const std::string& mode, const Result& result) {
+    const auto percentile = [&result](double value) {
+        const size_t idx = std::min(result.latencies.size() - 1, static_cast<size_t>(value * result.latencies.size()));
+        return result.latencies[idx];
+    };
+
+    std::cout << std::left << std::setw(6) << mode << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << result.throughput << " msg/s"
+              << std::setw(12) << result.flushedThroughput << " msg/s flushed"
+              << "   latency (ns) p50 " << percentile(0.5)
+              << " p99 " << percentile(0.99)
+              << " p99.9 " << percentile(0.999)
+              << " max " << result.latencies.back() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    uint32_t threadsCount = 4;
+    uint32_t messagesCount = 100000;
+    std::string mode = "both";
+    std::string output = "logger_benchmark.log";
+    lug::System::Logger::AsyncInfo asyncInfo;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (i + 1 < argc && option == "--threads") {
+            threadsCount = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (i + 1 < argc && option == "--messages") {
+            messagesCount = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (i + 1 < argc && option == "--mode") {
+            mode = argv[++i];
+        } else if (i + 1 < argc && option == "--capacity") {
+            asyncInfo.capacity = static_cast<uint32_t>(std::max(2, std::atoi(argv[++i])));
+        } else if (i + 1 < argc && option == "--overflow") {
+            const std::string overflow = argv[++i];
+
+            if (overflow == "block") {
+                asyncInfo.overflow = lug::System::Logger::Overflow::Block;
+            } else if (overflow == "drop") {
+                asyncInfo.overflow = lug::System::Logger::Overflow::Drop;
+            } else if (overflow == "count") {
+                asyncInfo.overflow = lug::System::Logger::Overflow::Count;
+            } else {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (i + 1 < argc && option == "--output") {
+            output = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (mode != "sync" && mode != "async" && mode != "both" && mode != "format" && mode != "disabled" && mode != "binary") {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::cout << threadsCount << " threads, " << messagesCount << " messages per thread, "
+              << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    if (mode == "format") {
+        runFormat(threadsCount, messagesCount);
+        return 0;
+    }
+
+    if (mode == "disabled") {
+        runDisabled(messagesCount);
+        return 0;
+    }
+
+    if (mode == "binary") {
+        try {
+            runHandlers(threadsCount, messagesCount, output);
+        } catch (const lug::System::Exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    try {
+        if (mode != "async") {
+            printResult("sync", run(false, asyncInfo, threadsCount, messagesCount, output));
+        }
+
+        if (mode != "sync") {
+            printResult("async", run(true, asyncInfo, threadsCount, messagesCount, output));
+        }
+    } catch (const lug::System::Exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+#include <lug/Graphics/Vulkan/Render/ShaderArchive.hpp>
+#include <lug/System/Clock.hpp>
+#include <lug/System/Exception.hpp>
+#include <lug/System/ThreadPool.hpp>
+
+using Pipeline = lug::Graphics::Vulkan::Render::Pipeline;
+using ShaderArchive = lug::Graphics::Vulkan::Render::ShaderArchive;
+
+struct Shaders {
+    bool success;
+    std::vector<uint32_t> vertex;
+    std::vector<uint32_t> fragment;
+};
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " <shaders root> <output archive> [options]" << std::endl
+              << "Options:" << std::endl
+              << "  --max-texcoords <n>    Maximum number of texture coordinates (default: 3)" << std::endl
+              << "  --max-colors <n>       Maximum number of vertex colors (default: 3)" << std::endl
+              << "  --all-display-modes    Also compile the debug display modes" << std::endl
+              << "  --jobs <n>             Number of compilation threads (default: hardware concurrency)" << std::endl;
+}
+
+static Shaders compileShaders(const std::string& shadersRoot, Pipeline::Id id) {
+    Shaders shaders{false, {}, {}};
+
+    try {
+        // Compile from the sources, buildShader() would read the archive we are generating
+        shaders.vertex = Pipeline::ShaderBuilder::buildShaderFromFile(shadersRoot + "forward/shader.vert", Pipeline::ShaderBuilder::Type::Vertex, id);
+        shaders.fragment = Pipeline::ShaderBuilder::buildShaderFromFile(shadersRoot + "forward/shader.frag", Pipeline::ShaderBuilder::Type::Fragment, id);
+        shaders.success = true;
+    } catch (const lug::System::Exception& e) {
+        std::cerr << "Can't compile the shaders of the pipeline " << id.value << ": " << e.what() << std::endl;
+    }
+
+    return shaders;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    const std::string shadersRoot = argv[1];
+    const std::string output = argv[2];
+
+    uint8_t maxTexCoords = 3;
+    uint8_t maxColors = 3;
+    uint8_t jobs = 0;
+    std::vector<lug::Graphics::Renderer::DisplayMode> displayModes{lug::Graphics::Renderer::DisplayMode::Full};
+
+    for (int i = 3; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (option == "--all-display-modes") {
+            displayModes = {
+                lug::Graphics::Renderer::DisplayMode::Full,
+                lug::Graphics::Renderer::DisplayMode::Albedo,
+                lug::Graphics::Renderer::DisplayMode::Normal,
+                lug::Graphics::Renderer::DisplayMode::Metallic,
+                lug::Graphics::Renderer::DisplayMode::Roughness,
+                lug::Graphics::Renderer::DisplayMode::AmbientOcclusion,
+                lug::Graphics::Renderer::DisplayMode::AmbientOcclusionRoughnessMetallic,
+                lug::Graphics::Renderer::DisplayMode::Emissive
+            };
+        } else if (i + 1 < argc && option == "--max-texcoords") {
+            maxTexCoords = static_cast<uint8_t>(std::atoi(argv[++i]));
+        } else if (i + 1 < argc && option == "--max-colors") {
+            maxColors = static_cast<uint8_t>(std::atoi(argv[++i]));
+        } else if (i + 1 < argc && option == "--jobs") {
+            jobs = static_cast<uint8_t>(std::atoi(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    const std::vector<Pipeline::Id> ids = Pipeline::ShaderBuilder::getModelPermutations(maxTexCoords, maxColors, displayModes);
+    std::cout << "Compiling " << ids.size() << " permutations" << std::endl;
+
+    lug::System::Clock clock;
+
+    std::vector<std::future<Shaders>> results;
+    results.reserve(ids.size());
+
+    {
+        lug::System::ThreadPool threadPool(jobs);
+
+        for (const auto id : ids) {
+            results.push_back(threadPool.enqueue(compileShaders, shadersRoot, id));
+        }
+
+        // The destructor of the thread pool waits for all the tasks
+    }
+
+    // Add the shaders in the order of the ids to get a reproducible archive
+    ShaderArchive archive;
+    uint32_t failures = 0;
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const Shaders shaders = results[i].get();
+
+        if (!shaders.success) {
+            ++failures;
+            continue;
+        }
+
+        archive.add(ids[i], Pipeline::ShaderBuilder::Type::Vertex, shaders.vertex);
+        archive.add(ids[i], Pipeline::ShaderBuilder::Type::Fragment, shaders.fragment);
+    }
+
+    if (!archive.save(output)) {
+        std::cerr << "Can't write the archive " << output << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << archive.getEntriesCount() << " shaders (" << archive.getBlobsCount() << " unique) to "
+              << output << " in " << clock.getElapsedTime().getSeconds() << "s" << std::endl;
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/AssetCooker.hpp>
+#include <lug/Graphics/ImageDecoder.hpp>
+#include <lug/Graphics/Ktx2.hpp>
+#include <lug/Graphics/Render/Texture.hpp>
+#include <lug/Graphics/TextureCompression.hpp>
+
+namespace Graphics = lug::Graphics;
+using Format = Graphics::Render::Texture::Format;
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [options] <input image> <output.ktx2>" << std::endl
+              << "Encodes an image with its mip levels to a KTX 2.0 texture" << std::endl
+              << "Options:" << std::endl
+              << "  --format <format>  bc1, bc3, rgba8 or auto: bc1 if the image is opaque, bc3 otherwise (default: auto)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::string formatName = "auto";
+    std::vector<std::string> filenames;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (i + 1 < argc && option == "--format") {
+            formatName = argv[++i];
+        } else if (option.size() > 2 && option.compare(0, 2, "--") == 0) {
+            printUsage(argv[0]);
+            return 1;
+        } else {
+            filenames.push_back(option);
+        }
+    }
+
+    if (filenames.size() != 2 || (formatName != "auto" && formatName != "bc1" && formatName != "bc3" && formatName != "rgba8")) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    Graphics::ImageDecoder::Image image;
+    if (!Graphics::ImageDecoder(1).decode({filenames[0], false}, image) || image.format != Format::R8G8B8A8_UNORM) {
+        std::cerr << "Can't decode " << filenames[0] << std::endl;
+        return 1;
+    }
+
+    Format format = Format::R8G8B8A8_UNORM;
+    if (formatName == "auto") {
+        format = Graphics::TextureCompression::selectEncodeFormat(image.pixels.get(), image.width, image.height);
+    } else if (formatName == "bc1") {
+        format = Format::BC1_RGBA_UNORM;
+    } else if (formatName == "bc3") {
+        format = Format::BC3_UNORM;
+    }
+
+    const uint32_t mipLevels = Graphics::AssetCooker::getMipLevelsCount(image.width, image.height);
+    std::vector<uint8_t> data = Graphics::AssetCooker::generateMipLevels(image.pixels.get(), image.width, image.height);
+    const std::size_t uncompressedSize = data.size();
+
+    if (format != Format::R8G8B8A8_UNORM) {
+        data = Graphics::TextureCompression::encode(data.data(), image.width, image.height, mipLevels, format);
+    }
+
+    const std::vector<uint8_t> file = Graphics::Ktx2::write(image.width, image.height, mipLevels, format, data.data());
+
+    std::ofstream output(filenames[1], std::ios::binary);
+    if (!output.write(reinterpret_cast<const char*>(file.data()), file.size())) {
+        std::cerr << "Can't write " << filenames[1] << std::endl;
+        return 1;
+    }
+
+    // Memory footprint of the texture on the GPU, compared to R8G8B8A8
+    std::cout << "Wrote " << image.width << "x" << image.height << " with " << mipLevels << " mip levels to " << filenames[1] << ": "
+              << data.size() << " bytes, " << uncompressedSize << " bytes in R8G8B8A8 ("
+              << static_cast<double>(uncompressedSize) / data.size() << "x)" << std::endl;
+
+    return 0;
+}